@@ -5,6 +5,117 @@
 #include "src/structures/graph_PartialDominatingSet.h"
 #include "src/structures/dataPoints_EuclidianDistance.h"
 #include "src/algorithms/tree_search_iterative.h"
+#include "src/algorithms/BatchRunner.h"
+
+/**
+ * Adds the element that gives the best score to the set.
+ *
+ * @param t The structure.
+ * @param s The set.
+ * @return The set with one more element.
+ */
+template<class T, typename TypeSF>
+std::vector<uint32_t> add_best_element(T &t, std::vector<uint32_t> s) {
+    const size_t s_size = s.size() + 1;
+    s.push_back(0);
+
+    TypeSF best_score = -std::numeric_limits<TypeSF>::max();
+    uint32_t best_c = 0;
+    for (uint32_t c = 0; c < t.get_n(); ++c) {
+        if (!contains(s, s_size - 1, c)) {
+            s[s_size - 1] = c;
+            TypeSF score = t.evaluate_general(s, s_size);
+            if (score > best_score) {
+                best_score = score;
+                best_c = c;
+            }
+        }
+    }
+    s[s_size - 1] = best_c;
+    return s;
+}
+
+/**
+ * Solves every k of the k-range on the same structure. The initial set of
+ * each k is the best set of k - 1 plus the element that gives the best
+ * score. The results of all k are written to one JSON file.
+ *
+ * @param t The structure, initialized for the largest k.
+ * @param ac Algorithm Configuration.
+ * @param initial The initial set of k_min, if an initial solution file is given.
+ * @return The exit code.
+ */
+template<class T, typename TypeSF>
+int solve_k_range(T &t, const AlgorithmConfiguration &ac, std::vector<uint32_t> initial) {
+    std::vector<uint32_t> prev_best_s;
+    std::string err_msg;
+    std::string content = "{\n\"k_range\" : [\n";
+
+    for (size_t k = ac.k_range_min; k <= ac.k_range_max; ++k) {
+        AlgorithmConfiguration ac_k = ac;
+        ac_k.k = k;
+        ac_k.write_output = false;
+        ac_k.finalize();
+
+        TreeSearchIterative<T, TypeSF> ts = TreeSearchIterative<T, TypeSF>(t, ac_k);
+        if (!prev_best_s.empty()) {
+            initial = add_best_element<T, TypeSF>(t, prev_best_s);
+        }
+        if ((!prev_best_s.empty() || !ac.initial_solution_path.empty()) && !ts.set_initial_solution(initial, err_msg)) {
+            std::cout << err_msg << std::endl;
+            return EXIT_FAILURE;
+        }
+        prev_best_s = ts.search();
+
+        content += ts.parse_to_JSON();
+        content += k < ac.k_range_max ? ",\n" : "\n";
+    }
+    content += "]\n}";
+
+    if (ac.write_output) {
+        std::ofstream file;
+        file.open(ac.output_file_path);
+        file << content;
+        file.close();
+    }
+    return EXIT_SUCCESS;
+}
+
+/**
+ * Searches the best set for the finalized structure, or for every k of the
+ * k-range.
+ *
+ * @param t The structure.
+ * @param ac Algorithm Configuration.
+ * @return The exit code.
+ */
+template<class T, typename TypeSF>
+int solve(T &t, AlgorithmConfiguration &ac) {
+    t.initialize_helping_structures(ac.k);
+    if (t.get_n() < ac.k) {
+        std::cout << "n (" << t.get_n() << ") is smaller than k (" << ac.k << ")!" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::vector<uint32_t> initial;
+    std::string err_msg;
+    if (!ac.initial_solution_path.empty() && !read_initial_vector(ac.initial_solution_path, initial, err_msg)) {
+        std::cout << err_msg << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (ac.k_range_min > 0) {
+        return solve_k_range<T, TypeSF>(t, ac, initial);
+    }
+
+    TreeSearchIterative<T, TypeSF> ts = TreeSearchIterative<T, TypeSF>(t, ac);
+    if (!ac.initial_solution_path.empty() && !ts.set_initial_solution(initial, err_msg)) {
+        std::cout << err_msg << std::endl;
+        return EXIT_FAILURE;
+    }
+    ts.search();
+    return EXIT_SUCCESS;
+}
 
 int main(int argc, char *argv[]) {
     AlgorithmConfiguration ac = parse_command_line(argc, argv, true);
@@ -13,28 +124,20 @@ int main(int argc, char *argv[]) {
         return EXIT_FAILURE;
     }
 
+    if (!ac.batch_manifest_path.empty()) {
+        BatchRunner runner(ac);
+        return runner.run();
+    }
+
     if (ac.structure_type == "graph") {
         if (ac.score_function == "negative-group-farness") {
             GraphNegativeGroupFarness<int> g(ac.input_file_path);
-            g.finalize();
-            g.initialize_helping_structures(ac.k);
-            if (g.get_n() < ac.k) {
-                std::cout << "n (" << g.get_n() << ") is smaller than k (" << ac.k << ")!" << std::endl;
-                return EXIT_FAILURE;
-            }
-            TreeSearchIterative<GraphNegativeGroupFarness<int>, int> ts = TreeSearchIterative<GraphNegativeGroupFarness<int>, int>(g, ac);
-            ts.search();
+            prepare_structure(g, ac);
+            return solve<GraphNegativeGroupFarness<int>, int>(g, ac);
         } else if (ac.score_function == "partial-dominating-set") {
             GraphPartialDominatingSet<int> g(ac.input_file_path);
-            g.finalize();
-            g.initialize_helping_structures(ac.k);
-            if (g.get_n() < ac.k) {
-                std::cout << "n (" << g.get_n() << ") is smaller than k (" << ac.k << ")!" << std::endl;
-                return EXIT_FAILURE;
-            }
-
-            TreeSearchIterative<GraphPartialDominatingSet<int>, int> ts = TreeSearchIterative<GraphPartialDominatingSet<int>, int>(g, ac);
-            ts.search();
+            prepare_structure(g, ac);
+            return solve<GraphPartialDominatingSet<int>, int>(g, ac);
         } else {
             std::cout << "Score function '" << ac.score_function << "' not known for structure type '" << ac.structure_type << "'!" << std::endl;
             return EXIT_FAILURE;
@@ -42,15 +145,8 @@ int main(int argc, char *argv[]) {
     } else if (ac.structure_type == "k-medoid") {
         if (ac.score_function == "euclidian-distance") {
             DataPointsEuclidianDistance<double> dp(ac.input_file_path);
-            dp.finalize();
-            dp.initialize_helping_structures(ac.k);
-            if (dp.get_n() < ac.k) {
-                std::cout << "n (" << dp.get_n() << ") is smaller than k (" << ac.k << ")!" << std::endl;
-                return EXIT_FAILURE;
-            }
-
-            TreeSearchIterative<DataPointsEuclidianDistance<double>, double> ts = TreeSearchIterative<DataPointsEuclidianDistance<double>, double>(dp, ac);
-            ts.search();
+            prepare_structure(dp, ac);
+            return solve<DataPointsEuclidianDistance<double>, double>(dp, ac);
         } else {
             std::cout << "Score function '" << ac.score_function << "' not known for structure type '" << ac.structure_type << "'!" << std::endl;
             return EXIT_FAILURE;
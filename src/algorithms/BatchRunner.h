@@ -0,0 +1,341 @@
+#ifndef SMSM_BATCHRUNNER_H
+#define SMSM_BATCHRUNNER_H
+
+#include <algorithm>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "../utility/AlgorithmConfiguration.h"
+#include "../utility/JSON_util.h"
+#include "../utility/StructureCache.h"
+#include "../utility/ThreadPool.h"
+#include "../structures/graph_NegativeGroupFarness.h"
+#include "../structures/graph_PartialDominatingSet.h"
+#include "../structures/dataPoints_EuclidianDistance.h"
+#include "tree_search_iterative.h"
+
+/**
+ * Finalizes a loaded structure and applies the preprocessing enabled in the
+ * configuration.
+ *
+ * @param t The structure.
+ * @param ac Algorithm Configuration.
+ */
+template<class T>
+void prepare_structure(T &t, const AlgorithmConfiguration &ac) {
+    t.finalize();
+    if constexpr (requires { t.determine_dominated_vertices(); }) {
+        if (ac.dominance_enabled) {
+            t.determine_dominated_vertices();
+        }
+    }
+    if constexpr (requires { t.determine_twin_classes(); }) {
+        if (ac.twins_enabled) {
+            t.determine_twin_classes();
+        }
+    }
+    if constexpr (requires { t.reduce_columns(ac.column_merge_epsilon); }) {
+        if (ac.column_reduction_enabled) {
+            t.reduce_columns(ac.column_merge_epsilon);
+        }
+    }
+}
+
+/**
+ * Solves the jobs of a manifest. Each line of the manifest is a JSON object
+ * {"args" : "..."} that holds the command line arguments of one job, see
+ * parse_manifest_line(). Each structure, i.e. the input file and its
+ * preprocessing, is loaded once and kept in the cache, the jobs search on
+ * copies of it. The jobs are sorted by their structure, so the jobs of a
+ * structure run one after another while it is cached. The jobs are solved on
+ * a thread pool and one JSON line per job is written as soon as the job is
+ * done, to the output file or to the console. The OpenMP threads are split
+ * between the workers of the pool, so the jobs together do not use more
+ * threads than a single search.
+ */
+class BatchRunner {
+public:
+    explicit BatchRunner(const AlgorithmConfiguration &t_ac) :
+            ac(t_ac),
+            farness_cache(t_ac.batch_cache_mb << 20),
+            pds_cache(t_ac.batch_cache_mb << 20),
+            euclidian_cache(t_ac.batch_cache_mb << 20) {};
+
+    /**
+     * Reads the manifest and solves all jobs.
+     *
+     * @return The exit code.
+     */
+    int run() {
+        if (!read_manifest()) {
+            return EXIT_FAILURE;
+        }
+
+        std::ofstream file;
+        if (ac.write_output) {
+            file.open(ac.output_file_path);
+            out = &file;
+        }
+
+        std::vector<size_t> order(jobs.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            return jobs[a].key < jobs[b].key;
+        });
+
+#ifdef _OPENMP
+        if (ac.batch_n_threads > 1) {
+            n_omp_threads = std::max(1, omp_get_max_threads() / (int) ac.batch_n_threads);
+        }
+#endif
+
+        {
+            ThreadPool pool(ac.batch_n_threads);
+            for (size_t idx: order) {
+                pool.submit([this, idx] { run_job(jobs[idx]); });
+            }
+            pool.wait();
+        }
+
+        if (ac.verbose_level > 0) {
+            std::cout << "Solved " << jobs.size() << " jobs, loaded " << n_loads() << " structures, reused "
+                      << n_hits() << " times." << std::endl;
+        }
+        return EXIT_SUCCESS;
+    }
+
+private:
+    struct Job {
+        size_t id = 0;
+        std::string args;
+        AlgorithmConfiguration ac;
+        std::string key; // identifies the structure
+        std::vector<uint32_t> initial_s; // read from the initial solution file
+        std::string error; // empty if the job is valid
+    };
+
+    AlgorithmConfiguration ac;
+    std::vector<Job> jobs;
+
+    StructureCache<GraphNegativeGroupFarness<int>> farness_cache;
+    StructureCache<GraphPartialDominatingSet<int>> pds_cache;
+    StructureCache<DataPointsEuclidianDistance<double>> euclidian_cache;
+
+    std::mutex out_mutex;
+    std::ostream *out = &std::cout;
+    int n_omp_threads = 0; // OpenMP threads of each job, 0 keeps the default
+
+    size_t n_loads() const {
+        return farness_cache.n_loads + pds_cache.n_loads + euclidian_cache.n_loads;
+    }
+
+    size_t n_hits() const {
+        return farness_cache.n_hits + pds_cache.n_hits + euclidian_cache.n_hits;
+    }
+
+    /**
+     * Reads the manifest and parses the arguments of each job.
+     *
+     * @return False if the manifest can not be read.
+     */
+    bool read_manifest() {
+        std::ifstream file(ac.batch_manifest_path);
+        if (!file.is_open()) {
+            std::cout << "Could not open the manifest '" << ac.batch_manifest_path << "'!" << std::endl;
+            return false;
+        }
+
+        std::string line;
+        while (std::getline(file, line)) {
+            if (line.find_first_not_of(" \t\r") == std::string::npos) {
+                continue;
+            }
+
+            Job job;
+            job.id = jobs.size();
+            if (parse_manifest_line(line, job.args)) {
+                parse_job(job);
+            } else {
+                job.args.clear();
+                job.error = "line is not of the form {\"args\" : \"...\"}";
+            }
+            jobs.push_back(job);
+        }
+        return true;
+    }
+
+    /**
+     * Parses one line of the manifest, it has to be exactly the object
+     * {"args" : "..."}. The escapes \" and \\ are resolved, other escapes are
+     * not supported. The arguments are split at spaces, so they can not hold
+     * paths with spaces.
+     *
+     * @param line The line.
+     * @param args Set to the arguments.
+     * @return False if the line is not of this form.
+     */
+    static bool parse_manifest_line(const std::string &line, std::string &args) {
+        size_t pos = 0;
+        auto skip_spaces = [&] {
+            while (pos < line.size() && (line[pos] == ' ' || line[pos] == '\t' || line[pos] == '\r')) {
+                pos += 1;
+            }
+        };
+        auto expect = [&](const std::string &token) {
+            skip_spaces();
+            if (line.compare(pos, token.size(), token) != 0) {
+                return false;
+            }
+            pos += token.size();
+            return true;
+        };
+
+        if (!expect("{") || !expect("\"args\"") || !expect(":") || !expect("\"")) {
+            return false;
+        }
+
+        args.clear();
+        while (pos < line.size() && line[pos] != '"') {
+            if (line[pos] == '\\') {
+                pos += 1;
+                if (pos == line.size() || (line[pos] != '"' && line[pos] != '\\')) {
+                    return false;
+                }
+            }
+            args += line[pos];
+            pos += 1;
+        }
+        if (pos == line.size()) {
+            return false;
+        }
+        pos += 1;
+
+        if (!expect("}")) {
+            return false;
+        }
+        skip_spaces();
+        return pos == line.size();
+    }
+
+    /**
+     * Parses the arguments of the job into its configuration.
+     */
+    void parse_job(Job &job) const {
+        std::vector<std::string> tokens = {"SMSM"};
+        for (const std::string &token: split(job.args, ' ')) {
+            if (!token.empty()) {
+                tokens.push_back(token);
+            }
+        }
+        std::vector<char *> argv;
+        for (std::string &token: tokens) {
+            if (token == "-h" || token == "--help") {
+                job.error = "--help is not allowed in a job";
+                return;
+            }
+            argv.push_back(token.data());
+        }
+
+        try {
+            job.ac = parse_command_line((int) argv.size(), argv.data(), false);
+        } catch (const std::exception &e) {
+            job.error = e.what();
+            return;
+        }
+
+        if (job.ac.invalid) {
+            job.error = "invalid arguments";
+        } else if (!job.ac.batch_manifest_path.empty()) {
+            job.error = "--batch is not allowed in a job";
+        } else if (job.ac.k_range_min > 0) {
+            job.error = "--k-range is not allowed in a job";
+        } else if (job.ac.k < 1) {
+            job.error = "k has to be at least 1";
+        } else if (!std::ifstream(job.ac.input_file_path).is_open()) {
+            job.error = "Could not open the input file '" + job.ac.input_file_path + "'";
+        } else if (!job.ac.initial_solution_path.empty()) {
+            read_initial_vector(job.ac.initial_solution_path, job.initial_s, job.error);
+        }
+        job.ac.write_output = false;
+
+        job.key = job.ac.structure_type + " " + job.ac.score_function + " " + job.ac.input_file_path + " "
+                  + std::to_string(job.ac.dominance_enabled) + std::to_string(job.ac.twins_enabled)
+                  + std::to_string(job.ac.column_reduction_enabled) + " " + std::to_string(job.ac.column_merge_epsilon);
+    }
+
+    /**
+     * Solves the job on the structure of its type and writes the result.
+     */
+    void run_job(Job &job) {
+#ifdef _OPENMP
+        if (n_omp_threads > 0) {
+            // the setting belongs to the calling worker thread
+            omp_set_num_threads(n_omp_threads);
+        }
+#endif
+
+        std::string result;
+        if (job.error.empty()) {
+            if (job.ac.structure_type == "graph" && job.ac.score_function == "negative-group-farness") {
+                result = solve_job<GraphNegativeGroupFarness<int>, int>(farness_cache, job);
+            } else if (job.ac.structure_type == "graph" && job.ac.score_function == "partial-dominating-set") {
+                result = solve_job<GraphPartialDominatingSet<int>, int>(pds_cache, job);
+            } else if (job.ac.structure_type == "k-medoid" && job.ac.score_function == "euclidian-distance") {
+                result = solve_job<DataPointsEuclidianDistance<double>, double>(euclidian_cache, job);
+            } else {
+                job.error = "score function '" + job.ac.score_function + "' not known for structure type '" + job.ac.structure_type + "'";
+            }
+        }
+
+        std::string line = "{\"job\" : " + to_JSON_value(job.id) + ", \"args\" : " + to_JSON_value(job.args) + ", ";
+        if (job.error.empty()) {
+            result.erase(std::remove(result.begin(), result.end(), '\n'), result.end());
+            line += "\"result\" : " + result + "}";
+        } else {
+            line += "\"error\" : " + to_JSON_value(job.error) + "}";
+        }
+
+        std::unique_lock<std::mutex> lock(out_mutex);
+        *out << line << std::endl;
+    }
+
+    /**
+     * Searches the best set of the job on a copy of the cached structure.
+     *
+     * @return The result as JSON, empty if the job has an error.
+     */
+    template<class T, typename TypeSF>
+    std::string solve_job(StructureCache<T> &cache, Job &job) {
+        std::string result;
+        {
+            T t = cache.acquire(job.key, job.ac.input_file_path, [&](T &loaded) {
+                prepare_structure(loaded, job.ac);
+            });
+
+            t.initialize_helping_structures(job.ac.k);
+            if (t.get_n() < job.ac.k) {
+                job.error = "n (" + std::to_string(t.get_n()) + ") is smaller than k (" + std::to_string(job.ac.k) + ")";
+            } else {
+                TreeSearchIterative<T, TypeSF> ts = TreeSearchIterative<T, TypeSF>(t, job.ac);
+                if (job.ac.initial_solution_path.empty() || ts.set_initial_solution(job.initial_s, job.error)) {
+                    ts.search();
+                    result = ts.parse_to_JSON();
+                }
+            }
+        }
+
+        cache.release(job.key);
+        return result;
+    }
+};
+
+#endif //SMSM_BATCHRUNNER_H
@@ -0,0 +1,204 @@
+#ifndef SMSM_CANDIDATEARENA_H
+#define SMSM_CANDIDATEARENA_H
+
+#include <cstdint>
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "../utility/util.h"
+
+/**
+ * Storage for the candidate managers of all depths. The candidates of one
+ * depth form a block, that starts where the block of the parent depth ends,
+ * so the arena is used like a stack: a child never holds more candidates than
+ * the remaining window of its parent, and a block is released implicitly when
+ * the next sibling is placed at the same position. The arena only grows to
+ * the largest stack that actually occurs. In addition, the arena holds the
+ * sort buffers and the SUB heap, which are shared by all depths, since only
+ * one depth uses them at a time.
+ *
+ * @tparam TypeSF The numeric type used for score improvement.
+ */
+template<typename TypeSF>
+class CandidateArena {
+public:
+    using SortKey = std::conditional_t<std::is_integral_v<TypeSF>, std::make_unsigned_t<std::conditional_t<std::is_integral_v<TypeSF>, TypeSF, int>>, TypeSF>;
+
+    // blocks of all depths
+    std::vector<uint32_t> c;
+    std::vector<TypeSF> si;
+    std::vector<uint8_t> acc;
+    std::vector<TypeSF> csum; // each block has one more entry than candidates
+
+    // buffers for sorting
+    std::vector<SortKey> sort_keys, sort_keys_temp;
+    std::vector<uint32_t> sort_idx, sort_idx_temp;
+    std::vector<uint32_t> temp_c;
+    std::vector<TypeSF> temp_si;
+    std::vector<uint8_t> temp_acc;
+
+    // indexed 4-ary min-heap over the r largest score improvements
+    static constexpr uint32_t SUB_heap_absent = std::numeric_limits<uint32_t>::max();
+    std::vector<uint32_t> SUB_heap_c;
+    std::vector<TypeSF> SUB_heap_si;
+    std::vector<uint32_t> SUB_heap_pos; // candidate -> slot in the heap
+    size_t SUB_heap_size = 0;
+    size_t SUB_heap_max_size = 0;
+    TypeSF SUB_heap_sum = 0;
+
+    CandidateArena() = default;
+
+    /**
+     * Constructor.
+     *
+     * @param max_block Largest number of candidates of one depth.
+     */
+    explicit CandidateArena(size_t max_block) {
+        reserve(max_block, max_block + 1);
+
+        sort_keys.resize(max_block);
+        sort_keys_temp.resize(max_block);
+        sort_idx.resize(max_block);
+        sort_idx_temp.resize(max_block);
+        temp_c.resize(max_block);
+        temp_si.resize(max_block);
+        temp_acc.resize(max_block);
+    }
+
+    /**
+     * Ensures that the arena holds at least the given number of entries. The
+     * capacity is at least doubled, so the arena grows only a few times.
+     *
+     * @param n_entries Number of candidate entries.
+     * @param n_csum_entries Number of cumulative sum entries.
+     * @return True if the arena was reallocated, all blocks have to be bound again.
+     */
+    bool reserve(size_t n_entries, size_t n_csum_entries) {
+        bool moved = false;
+        if (n_entries > c.size()) {
+            size_t capacity = std::max(n_entries, 2 * c.size());
+            c.resize(capacity);
+            si.resize(capacity);
+            acc.resize(capacity);
+            moved = true;
+        }
+        if (n_csum_entries > csum.size()) {
+            csum.resize(std::max(n_csum_entries, 2 * csum.size()));
+            moved = true;
+        }
+        return moved;
+    }
+
+    /**
+     * Clears the SUB heap and sets its size to r.
+     */
+    void SUB_heap_clear(size_t r) {
+        for (size_t i = 0; i < SUB_heap_size; ++i) {
+            SUB_heap_pos[SUB_heap_c[i]] = SUB_heap_absent;
+        }
+        SUB_heap_c.resize(r);
+        SUB_heap_si.resize(r);
+        SUB_heap_size = 0;
+        SUB_heap_max_size = r;
+        SUB_heap_sum = 0;
+    }
+
+    /**
+     * Adds the candidate to the SUB heap. Once the heap holds r candidates, the
+     * candidate only replaces the minimum if its score improvement is larger.
+     *
+     * @param candidate The candidate, must not be in the heap.
+     * @param score_improvement Its score improvement.
+     */
+    void SUB_heap_add(uint32_t candidate, TypeSF score_improvement){
+        if (candidate >= SUB_heap_pos.size()) {
+            SUB_heap_pos.resize(candidate + 1, SUB_heap_absent);
+        }
+        ASSERT(SUB_heap_pos[candidate] == SUB_heap_absent);
+
+        if (SUB_heap_size < SUB_heap_max_size) {
+            // add the element to the heap, if it has less than r elements
+            SUB_heap_sum += score_improvement;
+            SUB_heap_size += 1;
+            SUB_heap_sift_up(SUB_heap_size - 1, candidate, score_improvement);
+        } else if (score_improvement > SUB_heap_si[0]) {
+            // replace the minimum
+            SUB_heap_sum = SUB_heap_sum - SUB_heap_si[0] + score_improvement;
+            SUB_heap_pos[SUB_heap_c[0]] = SUB_heap_absent;
+            SUB_heap_sift_down(0, candidate, score_improvement);
+        }
+    }
+
+    /**
+     * Changes the score improvement of a candidate in the SUB heap.
+     *
+     * @param candidate The candidate, must be in the heap.
+     * @param score_improvement The new score improvement.
+     */
+    void SUB_heap_update(uint32_t candidate, TypeSF score_improvement){
+        ASSERT(candidate < SUB_heap_pos.size() && SUB_heap_pos[candidate] != SUB_heap_absent);
+        size_t idx = SUB_heap_pos[candidate];
+        TypeSF old_score_improvement = SUB_heap_si[idx];
+        SUB_heap_sum = SUB_heap_sum - old_score_improvement + score_improvement;
+
+        if (score_improvement < old_score_improvement) {
+            SUB_heap_sift_up(idx, candidate, score_improvement);
+        } else {
+            SUB_heap_sift_down(idx, candidate, score_improvement);
+        }
+    }
+
+    /**
+     * Places the entry at slot idx or one of its ancestors, moving larger
+     * parents down.
+     */
+    void SUB_heap_sift_up(size_t idx, uint32_t candidate, TypeSF score_improvement) {
+        while (idx > 0) {
+            size_t parent_idx = (idx - 1) / 4;
+            if (!(score_improvement < SUB_heap_si[parent_idx])) { break; }
+            SUB_heap_set(idx, SUB_heap_c[parent_idx], SUB_heap_si[parent_idx]);
+            idx = parent_idx;
+        }
+        SUB_heap_set(idx, candidate, score_improvement);
+    }
+
+    /**
+     * Places the entry at slot idx or one of its descendants, moving smaller
+     * children up.
+     */
+    void SUB_heap_sift_down(size_t idx, uint32_t candidate, TypeSF score_improvement) {
+        while (true) {
+            size_t first_child = 4 * idx + 1;
+            if (first_child >= SUB_heap_size) { break; }
+
+            size_t last_child = std::min(first_child + 4, SUB_heap_size);
+            size_t min_idx = first_child;
+            for (size_t i = first_child + 1; i < last_child; ++i) {
+                if (SUB_heap_si[i] < SUB_heap_si[min_idx]) { min_idx = i; }
+            }
+
+            if (!(SUB_heap_si[min_idx] < score_improvement)) { break; }
+            SUB_heap_set(idx, SUB_heap_c[min_idx], SUB_heap_si[min_idx]);
+            idx = min_idx;
+        }
+        SUB_heap_set(idx, candidate, score_improvement);
+    }
+
+    void SUB_heap_set(size_t idx, uint32_t candidate, TypeSF score_improvement) {
+        SUB_heap_c[idx] = candidate;
+        SUB_heap_si[idx] = score_improvement;
+        SUB_heap_pos[candidate] = (uint32_t) idx;
+    }
+
+    TypeSF SUB_heap_min() {
+        return SUB_heap_si[0];
+    }
+
+    TypeSF get_SUB_heap_sum() {
+        return SUB_heap_sum;
+    }
+};
+
+#endif //SMSM_CANDIDATEARENA_H
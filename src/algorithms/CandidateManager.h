@@ -3,79 +3,99 @@
 
 #include <cstdint>
 #include <algorithm>
+#include <array>
+#include <limits>
+#include <type_traits>
 
 #include "../utility/util.h"
+#include "CandidateArena.h"
 
 /**
- * Represents a candidate with score improvement and accuracy information.
- *
- * @tparam TypeSF The type of the 'score_improvement' attribute (e.g., int, float, double).
- */
-template<typename TypeSF>
-struct CandidateEntry {
-    TypeSF score_improvement;
-    uint32_t candidate;
-    uint8_t accurate;
-};
-
-/**
- * Manages a collection of candidate entries for optimization.
+ * Manages a collection of candidate entries for optimization. The entries are
+ * stored as a structure of arrays, candidate i is given by candidates_c[i],
+ * candidates_si[i] and candidates_acc[i]. The arrays are a block of a
+ * CandidateArena, that is shared by the managers of all depths.
  *
  * @tparam TypeSF The numeric type used for score improvement.
  */
 template<typename TypeSF>
 class CandidateManager {
 public:
-    std::vector<CandidateEntry<TypeSF>> candidates;
-    std::vector<TypeSF> csum_si;
+    CandidateArena<TypeSF> *arena;
+    uint32_t *candidates_c = nullptr;
+    TypeSF *candidates_si = nullptr;
+    uint8_t *candidates_acc = nullptr;
+    TypeSF *csum_si = nullptr;
+    size_t block_start = 0; // position of the candidates in the arena
+    size_t csum_block_start = 0; // position of the cumulative sums in the arena
+
+    using SortKey = typename CandidateArena<TypeSF>::SortKey;
 
     size_t offset; // current offset into the candidates
     size_t size; // current size of the candidates
     size_t max_size; // maximum size of the candidates
 
-    std::vector<CandidateEntry<TypeSF>> SUB_heap;
-    size_t SUB_heap_size;
-    size_t SUB_heap_max_size;
-    TypeSF SUB_heap_sum;
-
     size_t candidate_heap_size;
     size_t n_sorted_candidates;
 
     /**
      * Constructor.
      *
-     * @param n Number of candidates.
+     * @param t_arena The arena holding the candidates.
      */
-    explicit CandidateManager(size_t n) {
-        candidates.resize(n);
-        csum_si.resize(n + 1);
+    explicit CandidateManager(CandidateArena<TypeSF> &t_arena) {
+        arena = &t_arena;
 
         offset = 0;
         size = 0;
-        max_size = n;
-
-        SUB_heap_size = 0;
-        SUB_heap_max_size = 0;
-        SUB_heap_sum = 0;
+        max_size = 0;
 
         candidate_heap_size = 0;
         n_sorted_candidates = 0;
     };
 
-    void reinitialize(size_t n){
-        candidates.resize(n);
-        csum_si.resize(n + 1);
-
+    /**
+     * Places the candidates at the given position of the arena. The arena
+     * must be large enough.
+     *
+     * @param t_arena The arena holding the candidates.
+     * @param t_block_start Position of the candidates.
+     * @param t_csum_block_start Position of the cumulative sums.
+     * @param n Maximum number of candidates.
+     */
+    void assign(CandidateArena<TypeSF> &t_arena, size_t t_block_start, size_t t_csum_block_start, size_t n) {
+        ASSERT(t_block_start + n <= t_arena.c.size() && t_csum_block_start + n + 1 <= t_arena.csum.size());
+        arena = &t_arena;
+        block_start = t_block_start;
+        csum_block_start = t_csum_block_start;
+        max_size = n;
         offset = 0;
         size = 0;
-        max_size = n;
+        rebind();
+    }
 
-        SUB_heap_size = 0;
-        SUB_heap_max_size = 0;
-        SUB_heap_sum = 0;
+    /**
+     * Updates the pointers into the arena, needed after the arena grew.
+     */
+    void rebind() {
+        candidates_c = arena->c.data() + block_start;
+        candidates_si = arena->si.data() + block_start;
+        candidates_acc = arena->acc.data() + block_start;
+        csum_si = arena->csum.data() + csum_block_start;
+    }
 
-        candidate_heap_size = 0;
-        n_sorted_candidates = 0;
+    /**
+     * @return Position after the candidates in the arena.
+     */
+    size_t block_end() const {
+        return block_start + max_size;
+    }
+
+    /**
+     * @return Position after the cumulative sums in the arena.
+     */
+    size_t csum_block_end() const {
+        return csum_block_start + max_size + 1;
     }
 
     /**
@@ -86,9 +106,29 @@ public:
     void fill_candidates(size_t n) {
         size_t idx = 0;
         for (size_t i = 0; i < n; ++i) {
-            candidates[idx].candidate = i;
-            candidates[idx].score_improvement = 0;
-            candidates[idx].accurate = 0;
+            candidates_c[idx] = i;
+            candidates_si[idx] = 0;
+            candidates_acc[idx] = 0;
+            idx += 1;
+        }
+        offset = 0;
+        size = idx;
+    };
+
+    /**
+     * Fills the candidate array with all values 0, ..., n-1 that are not
+     * marked in the mask.
+     *
+     * @param n Number of elements.
+     * @param mask Marks the elements to leave out.
+     */
+    void fill_candidates(size_t n, const std::vector<uint8_t> &mask) {
+        size_t idx = 0;
+        for (size_t i = 0; i < n; ++i) {
+            if (mask[i]) { continue; }
+            candidates_c[idx] = i;
+            candidates_si[idx] = 0;
+            candidates_acc[idx] = 0;
             idx += 1;
         }
         offset = 0;
@@ -97,7 +137,7 @@ public:
 
     void fill_from_candidate_manager(const CandidateManager<TypeSF> &ref_manager) {
         for (size_t i = ref_manager.offset; i < ref_manager.size; ++i) {
-            candidates[i - ref_manager.offset].candidate = ref_manager.get_c(i);
+            candidates_c[i - ref_manager.offset] = ref_manager.get_c(i);
         }
         offset = 0;
         size = ref_manager.size - ref_manager.offset;
@@ -111,30 +151,41 @@ public:
     * @param is_accurate A flag indicating the accuracy.
     */
     void add_entry(uint32_t candidate_id, TypeSF score_improvement, uint8_t is_accurate) {
-        candidates[size].candidate = candidate_id;
-        candidates[size].score_improvement = score_improvement;
-        candidates[size].accurate = is_accurate;
+        candidates_c[size] = candidate_id;
+        candidates_si[size] = score_improvement;
+        candidates_acc[size] = is_accurate;
         size += 1;
     }
 
     void set_entry(size_t idx, uint32_t candidate_id, TypeSF score_improvement, uint8_t is_accurate) {
-        candidates[idx].candidate = candidate_id;
-        candidates[idx].score_improvement = score_improvement;
-        candidates[idx].accurate = is_accurate;
+        candidates_c[idx] = candidate_id;
+        candidates_si[idx] = score_improvement;
+        candidates_acc[idx] = is_accurate;
+    }
+
+    /**
+     * Swaps the entries at the two indices.
+     */
+    void swap_entries(size_t idx_1, size_t idx_2) {
+        std::swap(candidates_c[idx_1], candidates_c[idx_2]);
+        std::swap(candidates_si[idx_1], candidates_si[idx_2]);
+        std::swap(candidates_acc[idx_1], candidates_acc[idx_2]);
+    }
+
+    /**
+     * Copies the entry at src to dst.
+     */
+    void copy_entry(size_t dst, size_t src) {
+        candidates_c[dst] = candidates_c[src];
+        candidates_si[dst] = candidates_si[src];
+        candidates_acc[dst] = candidates_acc[src];
     }
 
     /**
     * Sort the candidates by score improvement in descending order.
     */
     void sort() {
-        auto first = candidates.begin();
-
-        auto last = candidates.begin();
-        std::advance(last, size);
-
-        std::sort(first, last, [](const CandidateEntry<TypeSF> &a, const CandidateEntry<TypeSF> &b) {
-            return a.score_improvement > b.score_improvement;
-        });
+        sort_range<false>(0, size);
     }
 
     /**
@@ -145,70 +196,159 @@ public:
         csum_si[0] = 0; // Initialize the first element.
 
         for (size_t i = 0; i < size; ++i) {
-            cumulative_sum += candidates[i].score_improvement;
+            cumulative_sum += candidates_si[i];
             csum_si[i + 1] = cumulative_sum;
         }
     }
 
     /**
-     * Clears the manager.
+     * Sort the candidates by score improvement in descending order and
+     * calculate the cumulative sum in the same pass.
      */
-    void clear(size_t r) {
-        SUB_heap.resize(r);
-        SUB_heap_size = 0;
-        SUB_heap_max_size = r;
-        SUB_heap_sum = 0;
+    void sort_and_calc_csum() {
+        csum_si[0] = 0;
+        sort_range<true>(0, size);
+    }
 
-        size = 0;
+    /**
+     * Maps a score improvement to an unsigned key, such that ascending keys
+     * correspond to descending score improvements.
+     */
+    static inline SortKey to_sort_key(TypeSF v) {
+        if constexpr (std::is_signed_v<TypeSF>) {
+            constexpr SortKey sign_bit = SortKey(1) << (sizeof(SortKey) * 8 - 1);
+            return ~(static_cast<SortKey>(v) ^ sign_bit);
+        } else {
+            return ~static_cast<SortKey>(v);
+        }
     }
 
-    void SUB_heap_add(uint32_t candidate, TypeSF score_improvement){
-        if (SUB_heap_size < SUB_heap_max_size) {
-            // add the element to the heap, if it has less than r elements
-            SUB_heap_sum += score_improvement;
-            SUB_heap[SUB_heap_size].candidate = candidate;
-            SUB_heap[SUB_heap_size].score_improvement = score_improvement;
-            SUB_heap_size += 1;
+    /**
+     * Sorts the candidates in [first, last) by score improvement in descending
+     * order. Equal score improvements keep their relative order. For integer
+     * score improvements an LSD radix sort over a key-index permutation is
+     * used, digits that are equal for all keys are skipped. If with_csum is
+     * set, csum_si[first + 1], ..., csum_si[last] are computed from
+     * csum_si[first] while the entries are permuted.
+     *
+     * @param first Index of the first entry.
+     * @param last Index after the last entry.
+     */
+    template<bool with_csum>
+    void sort_range(size_t first, size_t last) {
+        const size_t len = last - first;
+        if (len <= 1) {
+            if constexpr (with_csum) {
+                if (len == 1) { csum_si[last] = csum_si[first] + candidates_si[first]; }
+            }
+            return;
+        }
+
+        uint32_t *idx = arena->sort_idx.data();
+        if constexpr (std::is_integral_v<TypeSF>) {
+            SortKey *keys = arena->sort_keys.data();
+            SortKey *keys_temp = arena->sort_keys_temp.data();
+            uint32_t *idx_temp = arena->sort_idx_temp.data();
 
-            if (SUB_heap_size == SUB_heap_max_size) {
-                // if the heap is full, then heapify
-                std::make_heap(SUB_heap.begin(), SUB_heap.end(), [](const CandidateEntry<TypeSF> &a, const CandidateEntry<TypeSF> &b) { return a.score_improvement > b.score_improvement; });
+            for (size_t i = 0; i < len; ++i) {
+                keys[i] = to_sort_key(candidates_si[first + i]);
+                idx[i] = (uint32_t) i;
             }
-        } else {
-            if (score_improvement > SUB_heap[0].score_improvement) {
-                // we have to push the score improvement on the heap
-                SUB_heap_sum = SUB_heap_sum - SUB_heap[0].score_improvement + score_improvement;
-                SUB_heap[0].candidate = candidate;
-                SUB_heap[0].score_improvement = score_improvement;
 
-                std::make_heap(SUB_heap.begin(), SUB_heap.end(), [](const CandidateEntry<TypeSF> &a, const CandidateEntry<TypeSF> &b) { return a.score_improvement > b.score_improvement; });
+            if (len < 32) {
+                // insertion sort for small ranges
+                for (size_t i = 1; i < len; ++i) {
+                    SortKey key = keys[i];
+                    uint32_t id = idx[i];
+                    size_t j = i;
+                    while (j > 0 && keys[j - 1] > key) {
+                        keys[j] = keys[j - 1];
+                        idx[j] = idx[j - 1];
+                        j -= 1;
+                    }
+                    keys[j] = key;
+                    idx[j] = id;
+                }
+            } else {
+                constexpr size_t n_digits = sizeof(SortKey);
+                std::array<std::array<uint32_t, 256>, n_digits> hist{};
+                for (size_t i = 0; i < len; ++i) {
+                    SortKey key = keys[i];
+                    for (size_t d = 0; d < n_digits; ++d) {
+                        hist[d][(key >> (8 * d)) & 0xFF] += 1;
+                    }
+                }
+
+                for (size_t d = 0; d < n_digits; ++d) {
+                    // skip digits that are the same for all keys
+                    if (hist[d][(keys[0] >> (8 * d)) & 0xFF] == len) { continue; }
+
+                    uint32_t pos = 0;
+                    for (size_t b = 0; b < 256; ++b) {
+                        uint32_t count = hist[d][b];
+                        hist[d][b] = pos;
+                        pos += count;
+                    }
+                    for (size_t i = 0; i < len; ++i) {
+                        uint32_t p = hist[d][(keys[i] >> (8 * d)) & 0xFF]++;
+                        keys_temp[p] = keys[i];
+                        idx_temp[p] = idx[i];
+                    }
+                    std::swap(keys, keys_temp);
+                    std::swap(idx, idx_temp);
+                }
             }
+        } else {
+            for (size_t i = 0; i < len; ++i) { idx[i] = (uint32_t) i; }
+
+            const TypeSF *si = candidates_si + first;
+            std::stable_sort(idx, idx + len, [si](uint32_t a, uint32_t b) { return si[a] > si[b]; });
         }
-    }
 
-    size_t SUB_heap_find(uint32_t candidate){
-        for(size_t i = 0; i < SUB_heap_size; ++i){
-            if (SUB_heap[i].candidate == candidate){
-                return i;
+        // apply the permutation
+        uint32_t *temp_c = arena->temp_c.data();
+        TypeSF *temp_si = arena->temp_si.data();
+        uint8_t *temp_acc = arena->temp_acc.data();
+        for (size_t i = 0; i < len; ++i) {
+            temp_c[i] = candidates_c[first + idx[i]];
+            temp_si[i] = candidates_si[first + idx[i]];
+            temp_acc[i] = candidates_acc[first + idx[i]];
+        }
+
+        TypeSF cumulative_sum = csum_si[first];
+        for (size_t i = 0; i < len; ++i) {
+            candidates_c[first + i] = temp_c[i];
+            candidates_si[first + i] = temp_si[i];
+            candidates_acc[first + i] = temp_acc[i];
+            if constexpr (with_csum) {
+                cumulative_sum += temp_si[i];
+                csum_si[first + i + 1] = cumulative_sum;
             }
         }
-        std::cout << "Error: Could not find candidate " << candidate << std::endl;
-        abort();
     }
 
-    void SUB_heap_update(size_t idx, TypeSF score_improvement){
-        SUB_heap_sum = SUB_heap_sum - SUB_heap[idx].score_improvement + score_improvement;
+    /**
+     * Clears the manager.
+     */
+    void clear(size_t r) {
+        arena->SUB_heap_clear(r);
+        size = 0;
+    }
+
+    void SUB_heap_add(uint32_t candidate, TypeSF score_improvement) {
+        arena->SUB_heap_add(candidate, score_improvement);
+    }
 
-        SUB_heap[idx].score_improvement = score_improvement;
-        std::make_heap(SUB_heap.begin(), SUB_heap.end(), [](const CandidateEntry<TypeSF> &a, const CandidateEntry<TypeSF> &b) { return a.score_improvement > b.score_improvement; });
+    void SUB_heap_update(uint32_t candidate, TypeSF score_improvement) {
+        arena->SUB_heap_update(candidate, score_improvement);
     }
 
     TypeSF SUB_heap_min() {
-        return SUB_heap[0].score_improvement;
+        return arena->SUB_heap_min();
     }
 
     TypeSF get_SUB_heap_sum() {
-        return SUB_heap_sum;
+        return arena->get_SUB_heap_sum();
     }
 
     /**
@@ -230,7 +370,7 @@ public:
      * @return The score improvement.
      */
     TypeSF get_si(size_t idx) const {
-        return candidates[idx].score_improvement;
+        return candidates_si[idx];
     }
 
     /**
@@ -240,7 +380,7 @@ public:
      * @return The candidate.
      */
     uint32_t get_c(size_t idx) const {
-        return candidates[idx].candidate;
+        return candidates_c[idx];
     }
 
     /**
@@ -250,7 +390,7 @@ public:
      * @return The accuracy.
      */
     uint8_t get_acc(size_t idx) const {
-        return candidates[idx].accurate;
+        return candidates_acc[idx];
     }
 
     /**
@@ -264,10 +404,10 @@ public:
             std::string t0, t1, t2, t3, t4;
 
             t0 = std::to_string(i);
-            t1 = std::to_string(candidates[i].candidate);
-            t2 = double_to_string(candidates[i].score_improvement, 2);
+            t1 = std::to_string(candidates_c[i]);
+            t2 = double_to_string(candidates_si[i], 2);
             t3 = double_to_string(csum_si[i], 2);
-            t4 = std::to_string(candidates[i].accurate);
+            t4 = std::to_string(candidates_acc[i]);
 
             size_t max_len = std::max({(size_t) t0.size(), (size_t) t1.size(), (size_t) t2.size(), (size_t) t3.size(), (size_t) t4.size()});
             while (t0.size() != max_len) {
@@ -345,9 +485,7 @@ public:
     }
 
     void add_to_candidate_heap(uint32_t c, TypeSF si) {
-        candidates[size - 1 - candidate_heap_size].candidate = c;
-        candidates[size - 1 - candidate_heap_size].score_improvement = si;
-        candidates[size - 1 - candidate_heap_size].accurate = 0;
+        set_entry(size - 1 - candidate_heap_size, c, si, 0);
         candidate_heap_size += 1;
     }
 
@@ -356,15 +494,15 @@ public:
     }
 
     bool top_candidate_heap_is_accurate() {
-        return candidates[size - 1].accurate;
+        return candidates_acc[size - 1];
     }
 
     uint32_t top_candidate_heap_get_c() {
-        return candidates[size - 1].candidate;
+        return candidates_c[size - 1];
     }
 
     TypeSF top_candidate_heap_get_si() {
-        return candidates[size - 1].score_improvement;
+        return candidates_si[size - 1];
     }
 
 #define get_idx_child_1(idx) (((idx)*2) + 1);
@@ -372,8 +510,8 @@ public:
 #define get_idx_parent(idx ) (((idx) - 1)/2);
 
     void top_candidate_heap_update(TypeSF si) {
-        candidates[size - 1].score_improvement = si;
-        candidates[size - 1].accurate = 1;
+        candidates_si[size - 1] = si;
+        candidates_acc[size - 1] = 1;
         drop_down(0);
     }
 
@@ -381,17 +519,17 @@ public:
         n_sorted_candidates += 1;
         if(candidate_heap_size == 1){
             candidate_heap_size -= 1;
-            csum_si[size] = csum_si[size - 1] + candidates[size - 1].score_improvement;
+            csum_si[size] = csum_si[size - 1] + candidates_si[size - 1];
             return;
         }
 
-        TypeSF si_temp = candidates[size - 1].score_improvement;
-        candidates[size - 1].score_improvement = -1;
+        TypeSF si_temp = candidates_si[size - 1];
+        candidates_si[size - 1] = -1;
 
         size_t idx = drop_down(0);
 
-        std::swap(candidates[size - candidate_heap_size], candidates[size - 1 - idx]);
-        candidates[size - candidate_heap_size].score_improvement = si_temp;
+        swap_entries(size - candidate_heap_size, size - 1 - idx);
+        candidates_si[size - candidate_heap_size] = si_temp;
 
         candidate_heap_size -= 1;
 
@@ -403,18 +541,16 @@ public:
     }
 
     void place_top_candidate_heap_away(){
-        candidates[n_sorted_candidates] = candidates[size - 1];
+        copy_entry(n_sorted_candidates, size - 1);
         n_sorted_candidates += 1;
 
-        std::swap(candidates[size - candidate_heap_size], candidates[size - 1]);
+        swap_entries(size - candidate_heap_size, size - 1);
         candidate_heap_size -= 1;
         drop_down(0);
     }
 
     void push_to_candidate_heap(uint32_t c, TypeSF si){
-        candidates[size - 1 - candidate_heap_size].candidate = c;
-        candidates[size - 1 - candidate_heap_size].score_improvement = si;
-        candidates[size - 1 - candidate_heap_size].accurate = 0;
+        set_entry(size - 1 - candidate_heap_size, c, si, 0);
         candidate_heap_size += 1;
         bubble_up(candidate_heap_size-1);
     }
@@ -424,19 +560,7 @@ public:
             return;
         }
 
-        auto first = candidates.begin();
-        std::advance(first, size - candidate_heap_size);
-
-        auto last = candidates.begin();
-        std::advance(last, size);
-
-        std::sort(first, last, [](const CandidateEntry<TypeSF> &a, const CandidateEntry<TypeSF> &b) {
-            return a.score_improvement > b.score_improvement;
-        });
-
-        for (size_t i = size - candidate_heap_size; i < size; ++i) {
-            csum_si[i + 1] = csum_si[i] + candidates[i].score_improvement;
-        }
+        sort_range<true>(size - candidate_heap_size, size);
     }
 
     size_t drop_down(size_t idx) {
@@ -446,14 +570,14 @@ public:
         size_t idx_child_1 = get_idx_child_1(idx);
         size_t idx_child_2 = get_idx_child_2(idx);
 
-        bool child_1_valid = idx_child_1 < candidate_heap_size && candidates[size - 1 - idx_child_1].score_improvement > candidates[size - 1 - idx].score_improvement;
-        bool child_2_valid = idx_child_2 < candidate_heap_size && candidates[size - 1 - idx_child_2].score_improvement > candidates[size - 1 - idx].score_improvement;
+        bool child_1_valid = idx_child_1 < candidate_heap_size && candidates_si[size - 1 - idx_child_1] > candidates_si[size - 1 - idx];
+        bool child_2_valid = idx_child_2 < candidate_heap_size && candidates_si[size - 1 - idx_child_2] > candidates_si[size - 1 - idx];
 
         while (child_1_valid || child_2_valid) {
             // at least one child is larger
             if (child_1_valid && child_2_valid) {
                 // both children are valid
-                if (candidates[size - 1 - idx_child_1].score_improvement > candidates[size - 1 - idx_child_2].score_improvement) {
+                if (candidates_si[size - 1 - idx_child_1] > candidates_si[size - 1 - idx_child_2]) {
                     // swap with child 1
                     idx_to_swap = idx_child_1;
                 } else {
@@ -468,14 +592,14 @@ public:
                 idx_to_swap = idx_child_2;
             }
 
-            std::swap(candidates[size - 1 - idx], candidates[size - 1 - idx_to_swap]);
+            swap_entries(size - 1 - idx, size - 1 - idx_to_swap);
             idx = idx_to_swap;
 
             idx_child_1 = get_idx_child_1(idx);
             idx_child_2 = get_idx_child_2(idx);
 
-            child_1_valid = idx_child_1 < candidate_heap_size && candidates[size - 1 - idx_child_1].score_improvement > candidates[size - 1 - idx].score_improvement;
-            child_2_valid = idx_child_2 < candidate_heap_size && candidates[size - 1 - idx_child_2].score_improvement > candidates[size - 1 - idx].score_improvement;
+            child_1_valid = idx_child_1 < candidate_heap_size && candidates_si[size - 1 - idx_child_1] > candidates_si[size - 1 - idx];
+            child_2_valid = idx_child_2 < candidate_heap_size && candidates_si[size - 1 - idx_child_2] > candidates_si[size - 1 - idx];
         }
 
         return idx;
@@ -488,8 +612,8 @@ public:
 
         size_t parent_idx = get_idx_parent(idx);
 
-        while(candidates[size - 1 - idx].score_improvement > candidates[size - 1 - parent_idx].score_improvement){
-            std::swap(candidates[size - 1 - idx], candidates[size - 1 - parent_idx]);
+        while(candidates_si[size - 1 - idx] > candidates_si[size - 1 - parent_idx]){
+            swap_entries(size - 1 - idx, size - 1 - parent_idx);
             idx = parent_idx;
 
             if(idx == 0){
@@ -506,18 +630,18 @@ public:
             return true;
         }
 
-        TypeSF si = candidates[size - 1 - idx].score_improvement;
+        TypeSF si = candidates_si[size - 1 - idx];
         bool valid = true;
 
         size_t child_idx_1 = get_idx_child_1(idx);
         if (child_idx_1 < candidate_heap_size) {
-            TypeSF si_child = candidates[size - 1 - child_idx_1].score_improvement;
+            TypeSF si_child = candidates_si[size - 1 - child_idx_1];
             valid &= (si >= si_child) && is_valid_heap(child_idx_1);
         }
 
         size_t child_idx_2 = get_idx_child_2(idx);
         if (child_idx_2 < candidate_heap_size) {
-            TypeSF si_child = candidates[size - 1 - child_idx_2].score_improvement;
+            TypeSF si_child = candidates_si[size - 1 - child_idx_2];
             valid &= (si >= si_child) && is_valid_heap(child_idx_2);
         }
         return valid;
@@ -538,7 +662,7 @@ public:
     }
 
     void collect_to_vec(size_t depth, size_t idx, std::vector<std::vector<std::string>> &depths){
-        std::string content = std::to_string(candidates[size - 1 - idx].candidate) + "/" + std::to_string(candidates[size - 1 - idx].score_improvement) + "/" + std::to_string(idx);
+        std::string content = std::to_string(candidates_c[size - 1 - idx]) + "/" + std::to_string(candidates_si[size - 1 - idx]) + "/" + std::to_string(idx);
         depths[depth].push_back(content);
 
         size_t idx_child_1 = get_idx_child_1(idx);
@@ -0,0 +1,690 @@
+#ifndef SMSM_CARDINALITYMATCHING_H
+#define SMSM_CARDINALITYMATCHING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+
+#include "../utility/util.h"
+
+/**
+ * Maximum weight matching on a dense graph with the primal-dual blossom
+ * algorithm of Edmonds (O(n^3), following the formulation of Galil). Each
+ * stage grows an alternating forest from all free vertices, which share the
+ * same dual value, and augments along one path. Thus the matching after stage
+ * s is a maximum weight matching among all matchings with s edges and a single
+ * solve yields the optimal matching for every cardinality.
+ *
+ * Duals are stored doubled (as in the usual formulation), so that integer
+ * weights only lead to integer computations.
+ *
+ * @tparam TypeSF The type of the edge weights (e.g. int, double).
+ */
+template<typename TypeSF>
+class CardinalityMatching {
+public:
+    // solution for each cardinality
+    std::vector<TypeSF> weights; // weights[s] = weight of the best matching with s edges
+    std::vector<size_t> pairs; // the s pairs of cardinality s start at s * (s - 1)
+
+private:
+    size_t n = 0;
+    size_t n_edges = 0;
+
+    // graph
+    std::vector<int> edge_u;
+    std::vector<int> edge_v;
+    std::vector<TypeSF> edge_w;
+    std::vector<std::vector<int>> neighbend; // endpoints p (edge p / 2) incident to a vertex
+
+    // state of the primal-dual algorithm
+    std::vector<int> mate;
+    std::vector<int> label;
+    std::vector<int> labelend;
+    std::vector<int> inblossom;
+    std::vector<int> blossomparent;
+    std::vector<std::vector<int>> blossomchilds;
+    std::vector<int> blossombase;
+    std::vector<std::vector<int>> blossomendps;
+    std::vector<int> bestedge;
+    std::vector<std::vector<int>> blossombestedges;
+    std::vector<uint8_t> has_blossombestedges;
+    std::vector<int> unusedblossoms;
+    std::vector<TypeSF> dualvar;
+    std::vector<uint8_t> allowedge;
+    std::vector<int> queue;
+
+    // temporary vectors
+    std::vector<int> leaves;
+    std::vector<int> path;
+    std::vector<int> bestedgeto;
+
+public:
+    /**
+     * Computes the maximum weight matchings of all cardinalities of the
+     * complete graph with n vertices.
+     *
+     * @param t_n Number of vertices.
+     * @param w Row-major n x n weight matrix, only entries w[i * n + j] with i < j are used.
+     */
+    void solve(size_t t_n, const std::vector<TypeSF> &w) {
+        build_graph(t_n, w);
+
+        weights.clear();
+        pairs.clear();
+        weights.push_back(0);
+
+        if (n < 2) {
+            return;
+        }
+
+        for (size_t stage = 0; stage < n / 2; ++stage) {
+            if (!augment_stage()) {
+                break;
+            }
+
+            // end of stage, expand all S-blossoms with zero dual
+            for (size_t b = n; b < 2 * n; ++b) {
+                if (blossomparent[b] == -1 && blossombase[b] >= 0 && label[b] == 1 && dualvar[b] == 0) {
+                    expand_blossom((int) b, true);
+                }
+            }
+
+            record_solution();
+        }
+    }
+
+    /**
+     * @return The largest cardinality that has a solution.
+     */
+    inline size_t max_cardinality() const {
+        return weights.size() - 1;
+    }
+
+private:
+    /**
+     * Builds the complete graph and resets the algorithm state.
+     */
+    void build_graph(size_t t_n, const std::vector<TypeSF> &w) {
+        n = t_n;
+        n_edges = n < 2 ? 0 : (n * (n - 1)) / 2;
+
+        edge_u.resize(n_edges);
+        edge_v.resize(n_edges);
+        edge_w.resize(n_edges);
+        neighbend.resize(n);
+        for (size_t i = 0; i < n; ++i) {
+            neighbend[i].clear();
+        }
+
+        TypeSF max_w = 0;
+        size_t k = 0;
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = i + 1; j < n; ++j) {
+                edge_u[k] = (int) i;
+                edge_v[k] = (int) j;
+                edge_w[k] = w[i * n + j];
+                max_w = std::max(max_w, edge_w[k]);
+                neighbend[i].push_back((int) (2 * k + 1));
+                neighbend[j].push_back((int) (2 * k));
+                k += 1;
+            }
+        }
+
+        mate.assign(n, -1);
+        label.assign(2 * n, 0);
+        labelend.assign(2 * n, -1);
+        inblossom.resize(n);
+        for (size_t i = 0; i < n; ++i) {
+            inblossom[i] = (int) i;
+        }
+        blossomparent.assign(2 * n, -1);
+        blossomchilds.resize(2 * n);
+        blossomendps.resize(2 * n);
+        blossombestedges.resize(2 * n);
+        for (size_t b = 0; b < 2 * n; ++b) {
+            blossomchilds[b].clear();
+            blossomendps[b].clear();
+            blossombestedges[b].clear();
+        }
+        has_blossombestedges.assign(2 * n, 0);
+        blossombase.resize(2 * n);
+        for (size_t i = 0; i < n; ++i) {
+            blossombase[i] = (int) i;
+        }
+        std::fill(blossombase.begin() + (long) n, blossombase.end(), -1);
+        bestedge.assign(2 * n, -1);
+        unusedblossoms.clear();
+        for (size_t b = 2 * n; b > n; --b) {
+            unusedblossoms.push_back((int) (b - 1));
+        }
+        dualvar.assign(2 * n, 0);
+        std::fill(dualvar.begin(), dualvar.begin() + (long) n, max_w);
+        allowedge.assign(n_edges, 0);
+        queue.clear();
+        bestedgeto.assign(2 * n, -1);
+    }
+
+    /**
+     * Stores the weight and the pairs of the current matching.
+     */
+    void record_solution() {
+        TypeSF sum = 0;
+        [[maybe_unused]] size_t old_size = pairs.size();
+        for (size_t v = 0; v < n; ++v) {
+            if (mate[v] == -1) { continue; }
+            int p = mate[v];
+            int u = endpoint(p);
+            if ((size_t) u < v) { continue; }
+            pairs.push_back(v);
+            pairs.push_back((size_t) u);
+            sum += edge_w[p / 2];
+        }
+        ASSERT(pairs.size() - old_size == 2 * weights.size());
+        weights.push_back(sum);
+    }
+
+    inline int endpoint(int p) const {
+        return (p & 1) ? edge_v[p / 2] : edge_u[p / 2];
+    }
+
+    inline TypeSF slack(int k) const {
+        return dualvar[edge_u[k]] + dualvar[edge_v[k]] - 2 * edge_w[k];
+    }
+
+    inline static int wrap(int j, int len) {
+        return ((j % len) + len) % len;
+    }
+
+    /**
+     * Collects all vertices of the (sub-)blossom b into leaves.
+     */
+    void blossom_leaves(int b, std::vector<int> &out) const {
+        if (b < (int) n) {
+            out.push_back(b);
+            return;
+        }
+        for (int t: blossomchilds[b]) {
+            blossom_leaves(t, out);
+        }
+    }
+
+    /**
+     * Assigns label t to the top-level blossom containing vertex w, coming
+     * through endpoint p. T-blossoms also label the mate of their base.
+     */
+    void assign_label(int w, int t, int p) {
+        int b = inblossom[w];
+        ASSERT(label[w] == 0 && label[b] == 0);
+        label[w] = label[b] = t;
+        labelend[w] = labelend[b] = p;
+        bestedge[w] = bestedge[b] = -1;
+        if (t == 1) {
+            leaves.clear();
+            blossom_leaves(b, leaves);
+            queue.insert(queue.end(), leaves.begin(), leaves.end());
+        } else if (t == 2) {
+            int base = blossombase[b];
+            ASSERT(mate[base] >= 0);
+            assign_label(endpoint(mate[base]), 1, mate[base] ^ 1);
+        }
+    }
+
+    /**
+     * Traces back from v and w to find a new blossom or an augmenting path.
+     *
+     * @return The base of the new blossom or -1 for an augmenting path.
+     */
+    int scan_blossom(int v, int w) {
+        path.clear();
+        int base = -1;
+        while (v != -1 || w != -1) {
+            int b = inblossom[v];
+            if (label[b] & 4) {
+                base = blossombase[b];
+                break;
+            }
+            ASSERT(label[b] == 1);
+            path.push_back(b);
+            label[b] = 5;
+            if (labelend[b] == -1) {
+                v = -1;
+            } else {
+                v = endpoint(labelend[b]);
+                b = inblossom[v];
+                ASSERT(label[b] == 2);
+                v = endpoint(labelend[b]);
+            }
+            if (w != -1) {
+                std::swap(v, w);
+            }
+        }
+        for (int b: path) {
+            label[b] = 1;
+        }
+        return base;
+    }
+
+    /**
+     * Constructs a new blossom with the given base, containing edge k.
+     */
+    void add_blossom(int base, int k) {
+        int v = edge_u[k], w = edge_v[k];
+        int bb = inblossom[base];
+        int bv = inblossom[v];
+        int bw = inblossom[w];
+
+        int b = unusedblossoms.back();
+        unusedblossoms.pop_back();
+        blossombase[b] = base;
+        blossomparent[b] = -1;
+        blossomparent[bb] = b;
+
+        std::vector<int> &childs = blossomchilds[b];
+        std::vector<int> &endps = blossomendps[b];
+        childs.clear();
+        endps.clear();
+        while (bv != bb) {
+            blossomparent[bv] = b;
+            childs.push_back(bv);
+            endps.push_back(labelend[bv]);
+            v = endpoint(labelend[bv]);
+            bv = inblossom[v];
+        }
+        childs.push_back(bb);
+        std::reverse(childs.begin(), childs.end());
+        std::reverse(endps.begin(), endps.end());
+        endps.push_back(2 * k);
+        while (bw != bb) {
+            blossomparent[bw] = b;
+            childs.push_back(bw);
+            endps.push_back(labelend[bw] ^ 1);
+            w = endpoint(labelend[bw]);
+            bw = inblossom[w];
+        }
+
+        ASSERT(label[bb] == 1);
+        label[b] = 1;
+        labelend[b] = labelend[bb];
+        dualvar[b] = 0;
+
+        leaves.clear();
+        blossom_leaves(b, leaves);
+        for (int u: leaves) {
+            if (label[inblossom[u]] == 2) {
+                queue.push_back(u);
+            }
+            inblossom[u] = b;
+        }
+
+        // compute the least-slack edges to neighbouring S-blossoms
+        std::fill(bestedgeto.begin(), bestedgeto.end(), -1);
+        for (int c: childs) {
+            if (!has_blossombestedges[c]) {
+                leaves.clear();
+                blossom_leaves(c, leaves);
+                for (int u: leaves) {
+                    for (int p: neighbend[u]) {
+                        update_bestedgeto(b, p / 2);
+                    }
+                }
+            } else {
+                for (int e: blossombestedges[c]) {
+                    update_bestedgeto(b, e);
+                }
+            }
+            blossombestedges[c].clear();
+            has_blossombestedges[c] = 0;
+            bestedge[c] = -1;
+        }
+
+        std::vector<int> &best = blossombestedges[b];
+        best.clear();
+        for (int e: bestedgeto) {
+            if (e != -1) { best.push_back(e); }
+        }
+        has_blossombestedges[b] = 1;
+
+        bestedge[b] = -1;
+        for (int e: best) {
+            if (bestedge[b] == -1 || slack(e) < slack(bestedge[b])) {
+                bestedge[b] = e;
+            }
+        }
+    }
+
+    inline void update_bestedgeto(int b, int k) {
+        int j = edge_v[k];
+        if (inblossom[j] == b) {
+            j = edge_u[k];
+        }
+        int bj = inblossom[j];
+        if (bj != b && label[bj] == 1 && (bestedgeto[bj] == -1 || slack(k) < slack(bestedgeto[bj]))) {
+            bestedgeto[bj] = k;
+        }
+    }
+
+    /**
+     * Expands the given top-level blossom.
+     */
+    void expand_blossom(int b, bool endstage) {
+        for (int s: blossomchilds[b]) {
+            blossomparent[s] = -1;
+            if (s < (int) n) {
+                inblossom[s] = s;
+            } else if (endstage && dualvar[s] == 0) {
+                expand_blossom(s, endstage);
+            } else {
+                leaves.clear();
+                blossom_leaves(s, leaves);
+                for (int u: leaves) {
+                    inblossom[u] = s;
+                }
+            }
+        }
+
+        // if we expand a T-blossom during a stage, its sub-blossoms must be relabeled
+        if (!endstage && label[b] == 2) {
+            ASSERT(labelend[b] >= 0);
+            const std::vector<int> &childs = blossomchilds[b];
+            const std::vector<int> &endps = blossomendps[b];
+            const int len = (int) childs.size();
+
+            int entrychild = inblossom[endpoint(labelend[b] ^ 1)];
+            int j = (int) (std::find(childs.begin(), childs.end(), entrychild) - childs.begin());
+            int jstep, endptrick;
+            if (j & 1) {
+                j -= len;
+                jstep = 1;
+                endptrick = 0;
+            } else {
+                jstep = -1;
+                endptrick = 1;
+            }
+
+            // move along the blossom until we get to the base
+            int p = labelend[b];
+            while (j != 0) {
+                label[endpoint(p ^ 1)] = 0;
+                label[endpoint(endps[wrap(j - endptrick, len)] ^ endptrick ^ 1)] = 0;
+                assign_label(endpoint(p ^ 1), 2, p);
+                allowedge[endps[wrap(j - endptrick, len)] / 2] = 1;
+                j += jstep;
+                p = endps[wrap(j - endptrick, len)] ^ endptrick;
+                allowedge[p / 2] = 1;
+                j += jstep;
+            }
+
+            // relabel the base T-sub-blossom without stepping through to its mate
+            int bv = childs[wrap(j, len)];
+            label[endpoint(p ^ 1)] = label[bv] = 2;
+            labelend[endpoint(p ^ 1)] = labelend[bv] = p;
+            bestedge[bv] = -1;
+
+            // continue along the blossom until we get back to entrychild
+            j += jstep;
+            while (childs[wrap(j, len)] != entrychild) {
+                bv = childs[wrap(j, len)];
+                if (label[bv] == 1) {
+                    j += jstep;
+                    continue;
+                }
+                leaves.clear();
+                blossom_leaves(bv, leaves);
+                int v = -1;
+                for (int u: leaves) {
+                    v = u;
+                    if (label[u] != 0) { break; }
+                }
+                if (label[v] != 0) {
+                    ASSERT(label[v] == 2);
+                    ASSERT(inblossom[v] == bv);
+                    label[v] = 0;
+                    label[endpoint(mate[blossombase[bv]])] = 0;
+                    assign_label(v, 2, labelend[v]);
+                }
+                j += jstep;
+            }
+        }
+
+        // recycle the blossom number
+        label[b] = labelend[b] = -1;
+        blossomchilds[b].clear();
+        blossomendps[b].clear();
+        blossombase[b] = -1;
+        blossombestedges[b].clear();
+        has_blossombestedges[b] = 0;
+        bestedge[b] = -1;
+        unusedblossoms.push_back(b);
+    }
+
+    /**
+     * Swaps matched and unmatched edges along the alternating path inside
+     * blossom b from vertex v to the base.
+     */
+    void augment_blossom(int b, int v) {
+        int t = v;
+        while (blossomparent[t] != b) {
+            t = blossomparent[t];
+        }
+        if (t >= (int) n) {
+            augment_blossom(t, v);
+        }
+
+        std::vector<int> &childs = blossomchilds[b];
+        std::vector<int> &endps = blossomendps[b];
+        const int len = (int) childs.size();
+        int i = (int) (std::find(childs.begin(), childs.end(), t) - childs.begin());
+        int j = i;
+        int jstep, endptrick;
+        if (i & 1) {
+            j -= len;
+            jstep = 1;
+            endptrick = 0;
+        } else {
+            jstep = -1;
+            endptrick = 1;
+        }
+
+        while (j != 0) {
+            j += jstep;
+            t = childs[wrap(j, len)];
+            int p = endps[wrap(j - endptrick, len)] ^ endptrick;
+            if (t >= (int) n) {
+                augment_blossom(t, endpoint(p));
+            }
+            j += jstep;
+            t = childs[wrap(j, len)];
+            if (t >= (int) n) {
+                augment_blossom(t, endpoint(p ^ 1));
+            }
+            mate[endpoint(p)] = p ^ 1;
+            mate[endpoint(p ^ 1)] = p;
+        }
+
+        // rotate the lists, so that the new base is at the front
+        std::rotate(childs.begin(), childs.begin() + i, childs.end());
+        std::rotate(endps.begin(), endps.begin() + i, endps.end());
+        blossombase[b] = blossombase[childs[0]];
+        ASSERT(blossombase[b] == v);
+    }
+
+    /**
+     * Swaps matched and unmatched edges along the augmenting path through
+     * edge k.
+     */
+    void augment_matching(int k) {
+        int ends[2] = {edge_u[k], edge_v[k]};
+        int ps[2] = {2 * k + 1, 2 * k};
+        for (size_t side = 0; side < 2; ++side) {
+            int s = ends[side];
+            int p = ps[side];
+            while (true) {
+                int bs = inblossom[s];
+                ASSERT(label[bs] == 1);
+                if (bs >= (int) n) {
+                    augment_blossom(bs, s);
+                }
+                mate[s] = p;
+                if (labelend[bs] == -1) {
+                    break;
+                }
+                int t = endpoint(labelend[bs]);
+                int bt = inblossom[t];
+                ASSERT(label[bt] == 2);
+                s = endpoint(labelend[bt]);
+                int j = endpoint(labelend[bt] ^ 1);
+                ASSERT(blossombase[bt] == t);
+                if (bt >= (int) n) {
+                    augment_blossom(bt, j);
+                }
+                mate[j] = labelend[bt];
+                p = labelend[bt] ^ 1;
+            }
+        }
+    }
+
+    /**
+     * Runs one stage of the algorithm.
+     *
+     * @return True if the matching was augmented.
+     */
+    bool augment_stage() {
+        std::fill(label.begin(), label.end(), 0);
+        std::fill(bestedge.begin(), bestedge.end(), -1);
+        for (size_t b = n; b < 2 * n; ++b) {
+            blossombestedges[b].clear();
+            has_blossombestedges[b] = 0;
+        }
+        std::fill(allowedge.begin(), allowedge.end(), 0);
+        queue.clear();
+
+        for (size_t v = 0; v < n; ++v) {
+            if (mate[v] == -1 && label[inblossom[v]] == 0) {
+                assign_label((int) v, 1, -1);
+            }
+        }
+
+        while (true) {
+            // grow the forest with tight edges
+            while (!queue.empty()) {
+                int v = queue.back();
+                queue.pop_back();
+                ASSERT(label[inblossom[v]] == 1);
+
+                for (int p: neighbend[v]) {
+                    int k = p / 2;
+                    int w = endpoint(p);
+                    if (inblossom[v] == inblossom[w]) {
+                        continue;
+                    }
+                    TypeSF kslack = 0;
+                    if (!allowedge[k]) {
+                        kslack = slack(k);
+                        if (kslack <= 0) {
+                            allowedge[k] = 1;
+                        }
+                    }
+                    if (allowedge[k]) {
+                        if (label[inblossom[w]] == 0) {
+                            assign_label(w, 2, p ^ 1);
+                        } else if (label[inblossom[w]] == 1) {
+                            int base = scan_blossom(v, w);
+                            if (base >= 0) {
+                                add_blossom(base, k);
+                            } else {
+                                augment_matching(k);
+                                return true;
+                            }
+                        } else if (label[w] == 0) {
+                            ASSERT(label[inblossom[w]] == 2);
+                            label[w] = 2;
+                            labelend[w] = p ^ 1;
+                        }
+                    } else if (label[inblossom[w]] == 1) {
+                        int b = inblossom[v];
+                        if (bestedge[b] == -1 || kslack < slack(bestedge[b])) {
+                            bestedge[b] = k;
+                        }
+                    } else if (label[w] == 0) {
+                        if (bestedge[w] == -1 || kslack < slack(bestedge[w])) {
+                            bestedge[w] = k;
+                        }
+                    }
+                }
+            }
+
+            // no augmenting path with tight edges, update the duals
+            int deltatype = -1;
+            TypeSF delta = 0;
+            int deltaedge = -1;
+            int deltablossom = -1;
+
+            for (size_t v = 0; v < n; ++v) {
+                if (label[inblossom[v]] == 0 && bestedge[v] != -1) {
+                    TypeSF d = slack(bestedge[v]);
+                    if (deltatype == -1 || d < delta) {
+                        delta = d;
+                        deltatype = 2;
+                        deltaedge = bestedge[v];
+                    }
+                }
+            }
+            for (size_t b = 0; b < 2 * n; ++b) {
+                if (blossomparent[b] == -1 && label[b] == 1 && bestedge[b] != -1) {
+                    TypeSF d = slack(bestedge[b]) / 2;
+                    if (deltatype == -1 || d < delta) {
+                        delta = d;
+                        deltatype = 3;
+                        deltaedge = bestedge[b];
+                    }
+                }
+            }
+            for (size_t b = n; b < 2 * n; ++b) {
+                if (blossombase[b] >= 0 && blossomparent[b] == -1 && label[b] == 2 && (deltatype == -1 || dualvar[b] < delta)) {
+                    delta = dualvar[b];
+                    deltatype = 4;
+                    deltablossom = (int) b;
+                }
+            }
+            if (deltatype == -1) {
+                // no further augmentation possible
+                return false;
+            }
+
+            for (size_t v = 0; v < n; ++v) {
+                if (label[inblossom[v]] == 1) {
+                    dualvar[v] -= delta;
+                } else if (label[inblossom[v]] == 2) {
+                    dualvar[v] += delta;
+                }
+            }
+            for (size_t b = n; b < 2 * n; ++b) {
+                if (blossombase[b] >= 0 && blossomparent[b] == -1) {
+                    if (label[b] == 1) {
+                        dualvar[b] += delta;
+                    } else if (label[b] == 2) {
+                        dualvar[b] -= delta;
+                    }
+                }
+            }
+
+            if (deltatype == 2) {
+                allowedge[deltaedge] = 1;
+                int i = edge_u[deltaedge];
+                if (label[inblossom[i]] == 0) {
+                    i = edge_v[deltaedge];
+                }
+                queue.push_back(i);
+            } else if (deltatype == 3) {
+                allowedge[deltaedge] = 1;
+                queue.push_back(edge_u[deltaedge]);
+            } else {
+                expand_blossom(deltablossom, false);
+            }
+        }
+    }
+};
+
+#endif //SMSM_CARDINALITYMATCHING_H
@@ -0,0 +1,144 @@
+#ifndef SMSM_GRASP_H
+#define SMSM_GRASP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+
+#include "../utility/util.h"
+#include "SwapLocalState.h"
+
+/**
+ * Multi-start GRASP for sum-of-min objectives. Each start builds a
+ * randomized greedy solution: in every step the cost of adding each candidate
+ * is computed, and one candidate is drawn uniformly from the restricted
+ * candidate list, i.e. all candidates with a cost of at most
+ * best + alpha * (worst - best). The solution is then improved by the swap
+ * local search. The starts run in parallel, each with its own random
+ * generator seeded by seed + start, so the sets do not depend on the number
+ * of threads. Only the rows of the distance matrix are read, the structure
+ * itself is not touched.
+ *
+ * @tparam TypeSF Datatype of the score function.
+ */
+template<typename TypeSF>
+class GRASP {
+public:
+    std::vector<std::vector<uint32_t>> sets; // set of each start, only the prefix if its construction was dropped
+    std::vector<uint8_t> finished; // whether the start finished within the time limit
+
+    /**
+     * Runs the starts until all are done or the time limit is reached.
+     *
+     * @param rows The rows of the distance matrix, one per element.
+     * @param prefix The fixed elements of S.
+     * @param prefix_size Number of fixed elements.
+     * @param k The size of S.
+     * @param candidates The candidates, none of them is in the prefix.
+     * @param n_starts Number of starts.
+     * @param alpha Size of the restricted candidate list, 0 is the greedy, 1 is uniform.
+     * @param seed Seed of the first start.
+     * @param time_limit Time limit in seconds.
+     */
+    template<class Rows>
+    void run(const Rows &rows, const std::vector<uint32_t> &prefix, const size_t prefix_size, const size_t k,
+             const std::vector<uint32_t> &candidates, const size_t n_starts, const double alpha,
+             const uint64_t seed, const double time_limit) {
+        const auto sp = get_time_point();
+        sets.assign(n_starts, std::vector<uint32_t>(prefix.begin(), prefix.begin() + (long) prefix_size));
+        finished.assign(n_starts, 0);
+
+#pragma omp parallel for schedule(dynamic) if (n_starts > 1)
+        for (long start = 0; start < (long) n_starts; ++start) {
+            if (get_elapsed_seconds(sp, get_time_point()) >= time_limit) {
+                continue;
+            }
+
+            std::mt19937_64 rng(seed + (uint64_t) start);
+            std::vector<uint32_t> &set = sets[start];
+            set.resize(k);
+            std::vector<uint32_t> pool(candidates);
+            if (!construct(rows, set, prefix_size, k, pool, alpha, rng, sp, time_limit)) {
+                // drop the unfinished start, only complete sets are scored
+                set.resize(prefix_size);
+                continue;
+            }
+
+            // improve with best improvement swaps
+            SwapLocalState<TypeSF> state;
+            state.assign(rows, set, k);
+            while (get_elapsed_seconds(sp, get_time_point()) < time_limit) {
+                typename SwapLocalState<TypeSF>::Swap swap = state.find_swap(rows, pool.data(), pool.size(), prefix_size, k, false);
+                if (swap.gain <= 0) {
+                    finished[start] = 1;
+                    break;
+                }
+                std::swap(set[swap.pos], pool[swap.idx]);
+                state.apply_swap(rows, set, k, swap.pos);
+            }
+        }
+    }
+
+    /**
+     * Builds the randomized greedy solution of one start. The chosen
+     * candidates are removed from the pool. The time limit is checked before
+     * each added element, an unfinished start is dropped.
+     *
+     * @param sp Start point of the time limit.
+     * @param time_limit Time limit in seconds.
+     * @return False if no candidates are left or the time limit was reached.
+     */
+    template<class Rows>
+    bool construct(const Rows &rows, std::vector<uint32_t> &set, const size_t prefix_size, const size_t k,
+                   std::vector<uint32_t> &pool, const double alpha, std::mt19937_64 &rng,
+                   const std::chrono::steady_clock::time_point sp, const double time_limit) const {
+        const size_t n_columns = rows[pool[0]].size();
+        std::vector<TypeSF> min_dist(n_columns, std::numeric_limits<TypeSF>::max());
+        for (size_t p = 0; p < prefix_size; ++p) {
+            const TypeSF *row = rows[set[p]].data();
+            for (size_t j = 0; j < n_columns; ++j) {
+                min_dist[j] = std::min(min_dist[j], row[j]);
+            }
+        }
+
+        std::vector<TypeSF> cost(pool.size());
+        std::vector<size_t> rcl;
+        for (size_t i = prefix_size; i < k; ++i) {
+            if (pool.empty() || get_elapsed_seconds(sp, get_time_point()) >= time_limit) {
+                return false;
+            }
+
+            TypeSF best = std::numeric_limits<TypeSF>::max();
+            TypeSF worst = -std::numeric_limits<TypeSF>::max();
+            for (size_t c = 0; c < pool.size(); ++c) {
+                cost[c] = sum_of_min(min_dist.data(), rows[pool[c]].data(), n_columns);
+                best = std::min(best, cost[c]);
+                worst = std::max(worst, cost[c]);
+            }
+
+            const double threshold = (double) best + alpha * ((double) worst - (double) best);
+            rcl.clear();
+            for (size_t c = 0; c < pool.size(); ++c) {
+                if ((double) cost[c] <= threshold) {
+                    rcl.push_back(c);
+                }
+            }
+
+            std::uniform_int_distribution<size_t> dist(0, rcl.size() - 1);
+            const size_t chosen = rcl[dist(rng)];
+            set[i] = pool[chosen];
+            min_in_place(min_dist.data(), rows[pool[chosen]].data(), n_columns);
+
+            pool[chosen] = pool.back();
+            pool.pop_back();
+            cost.pop_back();
+        }
+        return true;
+    }
+};
+
+#endif //SMSM_GRASP_H
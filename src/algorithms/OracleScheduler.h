@@ -0,0 +1,156 @@
+#ifndef SMSM_ORACLESCHEDULER_H
+#define SMSM_ORACLESCHEDULER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+/**
+ * Statistics of one oracle on one depth of the search tree.
+ */
+struct OracleStats {
+    double success_rate = 1.0; // moving average of the pruning success
+    double cost = 0.0; // moving average of the seconds per call
+    double call_rate = 1.0; // fraction of the opportunities where the oracle is called
+    double call_acc = 0.0; // accumulator for the deterministic skipping
+    size_t n_calls = 0;
+
+    // hill climbing on the size parameter of the oracle
+    double l_scale = 1.0;
+    double l_direction = -1.0;
+    double window_value = 0.0;
+    double last_window_value = 0.0;
+    size_t window_calls = 0;
+    bool has_last_window = false;
+};
+
+/**
+ * Decides online whether the expensive bounding oracles (UB2D, PBF and REC)
+ * are called on a depth. For each oracle and depth it keeps the success rate
+ * and the cost per call, and for each depth the time needed to finish a node
+ * that no oracle pruned, i.e. the time a successful call saves. A call is worth
+ * it if the expected saved time (success rate times node time) exceeds its
+ * cost. The call rate is doubled or halved accordingly, but never
+ * drops below min_call_rate, so that the estimates stay up to date. In
+ * addition, the size parameter l of each oracle is tuned by hill climbing on
+ * the net value per call.
+ */
+class OracleScheduler {
+public:
+    enum Oracle {
+        UB2D = 0, PBF = 1, REC = 2, N_ORACLES = 3
+    };
+
+    static constexpr size_t warmup_calls = 8;
+    static constexpr double min_call_rate = 1.0 / 32.0;
+    static constexpr double alpha = 0.1; // weight of new samples in the moving averages
+    static constexpr double node_alpha = 0.05;
+    static constexpr size_t window_size = 32;
+    static constexpr double l_step = 1.25;
+    static constexpr double min_l_scale = 0.25;
+
+    std::vector<OracleStats> stats; // index: oracle * max_depth + depth
+    std::vector<double> node_time; // moving average of the seconds to finish an unpruned node on each depth
+    std::vector<uint8_t> has_node_time;
+    size_t max_depth = 0;
+
+    OracleScheduler() = default;
+
+    explicit OracleScheduler(size_t t_max_depth) {
+        max_depth = t_max_depth;
+        stats.resize(N_ORACLES * max_depth);
+        node_time.assign(max_depth, 0.0);
+        has_node_time.assign(max_depth, 0);
+    }
+
+    /**
+     * Whether the oracle should be called on the depth at the current
+     * opportunity.
+     */
+    inline bool should_call(Oracle o, size_t depth) {
+        OracleStats &st = get(o, depth);
+        st.call_acc += st.call_rate;
+        if (st.call_acc >= 1.0) {
+            st.call_acc -= 1.0;
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * Scales the configured size parameter of the oracle down, the result is
+     * at least 2 (if l is at least 2).
+     */
+    inline size_t scale_l(Oracle o, size_t depth, size_t l) const {
+        const OracleStats &st = stats[o * max_depth + depth];
+        return std::min(l, std::max((size_t) 2, (size_t) std::lround((double) l * st.l_scale)));
+    }
+
+    /**
+     * Records the outcome of a call and updates the call rate and l.
+     *
+     * @param o The oracle.
+     * @param depth The depth of the call.
+     * @param success Whether the oracle pruned the node.
+     * @param seconds Time needed for the call.
+     */
+    void record_call(Oracle o, size_t depth, bool success, double seconds) {
+        OracleStats &st = get(o, depth);
+        st.n_calls += 1;
+        if (st.n_calls == 1) {
+            st.cost = seconds;
+            st.success_rate = success ? 1.0 : 0.0;
+        } else {
+            st.cost += alpha * (seconds - st.cost);
+            st.success_rate += alpha * ((success ? 1.0 : 0.0) - st.success_rate);
+        }
+
+        if (st.n_calls < warmup_calls || !has_node_time[depth]) {
+            return;
+        }
+
+        // expected saved time minus the cost of a call
+        double value = st.success_rate * node_time[depth] - st.cost;
+        if (value > 0.0) {
+            st.call_rate = std::min(1.0, 2.0 * st.call_rate);
+        } else {
+            st.call_rate = std::max(min_call_rate, 0.5 * st.call_rate);
+        }
+
+        // hill climbing on l
+        st.window_value += (success ? node_time[depth] : 0.0) - seconds;
+        st.window_calls += 1;
+        if (st.window_calls == window_size) {
+            double mean_value = st.window_value / (double) window_size;
+            if (st.has_last_window && mean_value < st.last_window_value) {
+                st.l_direction = -st.l_direction;
+            }
+            st.l_scale = std::clamp(st.l_scale * std::pow(l_step, st.l_direction), min_l_scale, 1.0);
+            st.last_window_value = mean_value;
+            st.has_last_window = true;
+            st.window_value = 0.0;
+            st.window_calls = 0;
+        }
+    }
+
+    /**
+     * Records the time needed to finish a node on the depth, that was not
+     * pruned by an oracle.
+     */
+    inline void record_node(size_t depth, double seconds) {
+        if (!has_node_time[depth]) {
+            node_time[depth] = seconds;
+            has_node_time[depth] = 1;
+        } else {
+            node_time[depth] += node_alpha * (seconds - node_time[depth]);
+        }
+    }
+
+    inline OracleStats &get(Oracle o, size_t depth) {
+        return stats[o * max_depth + depth];
+    }
+};
+
+#endif //SMSM_ORACLESCHEDULER_H
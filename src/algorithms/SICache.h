@@ -1,105 +1,84 @@
 #ifndef SMSM_SICACHE_H
 #define SMSM_SICACHE_H
 
+#include <algorithm>
+#include <bit>
 #include <cstddef>
+#include <cstdint>
 #include <utility>
 #include <vector>
-#include <unordered_map>
-#include <map>
 #include <string>
 #include <iostream>
 
 /**
- * Represents a cached entry storing a vector and score improvement.
- *
- * @tparam TypeSF The numeric type used for the 'score_improvement' attribute (e.g., int, float, double).
- */
-template<typename TypeSF>
-struct CacheEntry {
-    std::vector<size_t> vec;
-    TypeSF score_improvement = 0.0;
-
-    /**
-     * Default constructor for CacheEntry.
-     */
-    inline CacheEntry() = default;
-
-    /**
-     * Constructor for CacheEntry that initializes the attributes.
-     *
-     * @param v The vector.
-     * @param si The score improvement.
-     */
-    inline CacheEntry(std::vector<size_t> &v, TypeSF si) {
-        vec = v;
-        score_improvement = si;
-    }
-};
-
-/**
- * Represents a cached entry storing two elements and score improvement.
- *
- * @tparam TypeSF The numeric type used for the 'score_improvement' attribute (e.g., int, float, double).
- */
-template<typename TypeSF>
-struct CacheEntry2D {
-    size_t x1 = 0;
-    size_t x2 = 0;
-    TypeSF score_improvement = 0.0;
-
-    /**
-     * Default constructor for CacheEntry2D.
-     */
-    inline CacheEntry2D() = default;
-
-    /**
-     * Constructor for CacheEntry2D that initializes the attributes.
-     *
-     * @param x The value of the first element.
-     * @param y The value of the second element.
-     * @param si The score improvement.
-     */
-    inline CacheEntry2D(size_t x, size_t y, TypeSF si) {
-        x1 = x;
-        x2 = y;
-        score_improvement = si;
-    }
-};
-
-/**
- * Cache for storing score improvement entries.
+ * Cache for storing score improvement entries. Entries are kept in two flat
+ * open-addressing tables with linear probing, one for pairs and one for larger
+ * sets. Keys of the larger sets are stored inline with a fixed stride, that
+ * grows with the largest inserted set. A slot is only valid if its generation
+ * equals the current generation, so clearing the cache is O(1) and does not
+ * free any memory.
  *
  * @tparam TypeSF The numeric type used for score improvement attributes (e.g., int, float, double).
  */
 template<typename TypeSF>
 class SICache {
 public:
-    std::unordered_map<size_t, CacheEntry<TypeSF>> hash_map;
-    std::unordered_map<size_t, CacheEntry2D<TypeSF>> hash_map_2D;
+    static constexpr size_t min_capacity = 256;
+
+    uint32_t generation = 1;
+
+    // table for sets with more than two elements
+    size_t capacity = 0; // power of two
+    size_t shift = 64;
+    size_t n_entries = 0;
+    size_t key_stride = 0; // number of uint32_t per key, multiple of 8
+    std::vector<uint32_t> slot_generation;
+    std::vector<size_t> slot_hash;
+    std::vector<uint32_t> slot_len;
+    std::vector<uint32_t> slot_keys; // capacity * key_stride, unused positions are 0
+    std::vector<TypeSF> slot_si;
+    std::vector<uint32_t> temp_key;
+
+    // table for pairs
+    size_t capacity_2D = 0; // power of two
+    size_t shift_2D = 64;
+    size_t n_entries_2D = 0;
+    std::vector<uint32_t> slot_generation_2D;
+    std::vector<uint64_t> slot_key_2D;
+    std::vector<TypeSF> slot_si_2D;
 
     /**
      * Clears the cache, removing all stored entries.
      */
     inline void clear() {
-        hash_map.clear();
-        hash_map_2D.clear();
+        generation += 1;
+        if (generation == 0) {
+            // generation overflow, invalidate all slots explicitly
+            std::fill(slot_generation.begin(), slot_generation.end(), 0);
+            std::fill(slot_generation_2D.begin(), slot_generation_2D.end(), 0);
+            generation = 1;
+        }
+        n_entries = 0;
+        n_entries_2D = 0;
     }
 
     /**
      * Checks if a entry with the specified vector exists in the cache.
      *
      * @param v A vector of indices or values to check for in the cache.
-     * @return True if the entry exists and matches the provided vector; false otherwise.
+     * @return The score improvement if the entry exists, -1 otherwise.
      */
     inline TypeSF get_entry(size_t hash, std::vector<size_t> &v) {
-        auto iter = hash_map.find(hash);
+        if (n_entries == 0 || v.size() > key_stride) {
+            return -1;
+        }
+        pack_key(v);
 
-        if (iter != hash_map.end()) {
-            if (iter->second.vec == v) {
-                // vectors are the same
-                return iter->second.score_improvement;
+        const size_t mask = capacity - 1;
+        for (size_t idx = slot_idx(hash, shift); slot_generation[idx] == generation; idx = (idx + 1) & mask) {
+            if (slot_hash[idx] == hash && slot_len[idx] == v.size() && key_equal(&slot_keys[idx * key_stride])) {
+                return slot_si[idx];
             }
-            return -1;
         }
         return -1;
     }
@@ -109,40 +88,73 @@ public:
      *
      * @param x The value of the first element.
      * @param y The value of the second element.
-     * @return True if the entry exists and matches the provided values; false otherwise.
+     * @return The score improvement if the entry exists, -1 otherwise.
      */
     inline TypeSF get_entry_2D(size_t hash, size_t x, size_t y) {
-        auto iter = hash_map_2D.find(hash);
+        if (n_entries_2D == 0) {
+            return -1;
+        }
+        const uint64_t key = pair_key(x, y);
 
-        if (iter != hash_map_2D.end()) {
-            if (iter->second.x1 == x && iter->second.x2 == y) {
-                // vectors are the same
-                return iter->second.score_improvement;
+        const size_t mask = capacity_2D - 1;
+        for (size_t idx = slot_idx(hash, shift_2D); slot_generation_2D[idx] == generation; idx = (idx + 1) & mask) {
+            if (slot_key_2D[idx] == key) {
+                return slot_si_2D[idx];
             }
-            return -1;
         }
         return -1;
     }
 
     /**
-     * Inserts an entry into the cache.
+     * Inserts an entry into the cache. Does nothing if the entry already exists.
      *
      * @param v A vector of indices or values associated with the entry.
      * @param si The score improvement to be stored with the entry.
      */
     inline void insert_entry(size_t hash, std::vector<size_t> &v, TypeSF si) {
-        hash_map.emplace(hash, CacheEntry(v, si));
+        if (v.size() > key_stride) {
+            rebuild(capacity == 0 ? min_capacity : capacity, (v.size() + 7) & ~size_t(7));
+        } else if (2 * (n_entries + 1) > capacity) {
+            rebuild(std::max(min_capacity, 2 * capacity), key_stride);
+        }
+        pack_key(v);
+
+        const size_t mask = capacity - 1;
+        size_t idx = slot_idx(hash, shift);
+        for (; slot_generation[idx] == generation; idx = (idx + 1) & mask) {
+            if (slot_hash[idx] == hash && slot_len[idx] == v.size() && key_equal(&slot_keys[idx * key_stride])) {
+                return;
+            }
+        }
+        set_slot(idx, hash, (uint32_t) v.size(), temp_key.data(), si);
+        n_entries += 1;
     }
 
     /**
-     * Inserts a two-element entry into the cache.
+     * Inserts a two-element entry into the cache. Does nothing if the entry
+     * already exists.
      *
      * @param x The value of the first element.
      * @param y The value of the second element.
      * @param si The score improvement to be stored with the entry.
      */
     inline void insert_entry_2D(size_t hash, size_t x, size_t y, TypeSF si) {
-        hash_map_2D.emplace(hash, CacheEntry2D(x, y, si));
+        if (2 * (n_entries_2D + 1) > capacity_2D) {
+            rebuild_2D(std::max(min_capacity, 2 * capacity_2D));
+        }
+        const uint64_t key = pair_key(x, y);
+
+        const size_t mask = capacity_2D - 1;
+        size_t idx = slot_idx(hash, shift_2D);
+        for (; slot_generation_2D[idx] == generation; idx = (idx + 1) & mask) {
+            if (slot_key_2D[idx] == key) {
+                return;
+            }
+        }
+        slot_generation_2D[idx] = generation;
+        slot_key_2D[idx] = key;
+        slot_si_2D[idx] = si;
+        n_entries_2D += 1;
     }
 
     /**
@@ -181,6 +193,113 @@ public:
         seed ^= y + 0x9e3779b9 + (seed << 6) + (seed >> 2);
         return seed;
     }
+
+private:
+    /**
+     * Maps a hash to the first slot to probe (Fibonacci hashing).
+     */
+    inline static size_t slot_idx(size_t hash, size_t t_shift) {
+        return (size_t) (((uint64_t) hash * 0x9E3779B97F4A7C15ull) >> t_shift);
+    }
+
+    inline static uint64_t pair_key(size_t x, size_t y) {
+        return ((uint64_t) x << 32) | (uint64_t) (uint32_t) y;
+    }
+
+    /**
+     * Writes v into temp_key and pads it with zeros up to the key stride.
+     */
+    inline void pack_key(const std::vector<size_t> &v) {
+        for (size_t i = 0; i < v.size(); ++i) {
+            temp_key[i] = (uint32_t) v[i];
+        }
+        for (size_t i = v.size(); i < key_stride; ++i) {
+            temp_key[i] = 0;
+        }
+    }
+
+    /**
+     * Compares the stored key with temp_key. The loop has no early exit, so
+     * that it is vectorized over the full stride.
+     */
+    inline bool key_equal(const uint32_t *key) const {
+        uint32_t diff = 0;
+        for (size_t i = 0; i < key_stride; ++i) {
+            diff |= key[i] ^ temp_key[i];
+        }
+        return diff == 0;
+    }
+
+    inline void set_slot(size_t idx, size_t hash, uint32_t len, const uint32_t *key, TypeSF si) {
+        slot_generation[idx] = generation;
+        slot_hash[idx] = hash;
+        slot_len[idx] = len;
+        std::copy(key, key + key_stride, &slot_keys[idx * key_stride]);
+        slot_si[idx] = si;
+    }
+
+    /**
+     * Rebuilds the table for larger sets with the new capacity and key stride,
+     * keeping all valid entries.
+     */
+    void rebuild(size_t new_capacity, size_t new_key_stride) {
+        std::vector<uint32_t> old_generation = std::move(slot_generation);
+        std::vector<size_t> old_hash = std::move(slot_hash);
+        std::vector<uint32_t> old_len = std::move(slot_len);
+        std::vector<uint32_t> old_keys = std::move(slot_keys);
+        std::vector<TypeSF> old_si = std::move(slot_si);
+        const size_t old_capacity = capacity;
+        const size_t old_key_stride = key_stride;
+
+        capacity = new_capacity;
+        shift = 64 - (size_t) std::countr_zero(capacity);
+        key_stride = new_key_stride;
+        slot_generation.assign(capacity, 0);
+        slot_hash.resize(capacity);
+        slot_len.resize(capacity);
+        slot_keys.assign(capacity * key_stride, 0);
+        slot_si.resize(capacity);
+        temp_key.assign(key_stride, 0);
+
+        const size_t mask = capacity - 1;
+        for (size_t i = 0; i < old_capacity; ++i) {
+            if (old_generation[i] != generation) { continue; }
+
+            std::copy(&old_keys[i * old_key_stride], &old_keys[i * old_key_stride] + old_key_stride, temp_key.begin());
+            size_t idx = slot_idx(old_hash[i], shift);
+            while (slot_generation[idx] == generation) { idx = (idx + 1) & mask; }
+            set_slot(idx, old_hash[i], old_len[i], temp_key.data(), old_si[i]);
+        }
+    }
+
+    /**
+     * Rebuilds the table for pairs with the new capacity, keeping all valid
+     * entries.
+     */
+    void rebuild_2D(size_t new_capacity) {
+        std::vector<uint32_t> old_generation = std::move(slot_generation_2D);
+        std::vector<uint64_t> old_key = std::move(slot_key_2D);
+        std::vector<TypeSF> old_si = std::move(slot_si_2D);
+        const size_t old_capacity = capacity_2D;
+
+        capacity_2D = new_capacity;
+        shift_2D = 64 - (size_t) std::countr_zero(capacity_2D);
+        slot_generation_2D.assign(capacity_2D, 0);
+        slot_key_2D.resize(capacity_2D);
+        slot_si_2D.resize(capacity_2D);
+
+        const size_t mask = capacity_2D - 1;
+        for (size_t i = 0; i < old_capacity; ++i) {
+            if (old_generation[i] != generation) { continue; }
+
+            size_t x = old_key[i] >> 32, y = old_key[i] & 0xFFFFFFFFull;
+            size_t idx = slot_idx(hash_2D(x, y), shift_2D);
+            while (slot_generation_2D[idx] == generation) { idx = (idx + 1) & mask; }
+            slot_generation_2D[idx] = generation;
+            slot_key_2D[idx] = old_key[i];
+            slot_si_2D[idx] = old_si[i];
+        }
+    }
 };
 
 
@@ -0,0 +1,190 @@
+#ifndef SMSM_SWAPLOCALSTATE_H
+#define SMSM_SWAPLOCALSTATE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <algorithm>
+
+#include "../utility/util.h"
+
+/**
+ * State of a set S for the swap local search on sum-of-min objectives, i.e.
+ * the cost of S is the sum over all columns j of min_{s in S} d(s, j). For
+ * each column it stores the smallest and the second smallest entry over S
+ * and the position of the smallest one. Replacing the element at position p
+ * by a candidate c changes the cost of column j to min(second[j], d(c, j)) if
+ * best_pos[j] = p and to min(best[j], d(c, j)) otherwise. So one pass over
+ * the row of c gives the cost of all k swaps of c at once, without building
+ * a new minimum vector.
+ *
+ * @tparam TypeSF Datatype of the score function.
+ */
+template<typename TypeSF>
+class SwapLocalState {
+public:
+    static constexpr size_t chunk_size = 64; // candidates per parallel chunk
+    static constexpr size_t first_improvement_chunks = 16; // chunks per round of the first improvement
+
+    /**
+     * A swap of the candidate at index idx with the element at position pos.
+     */
+    struct Swap {
+        TypeSF gain = 0;
+        size_t idx = 0;
+        size_t pos = 0;
+    };
+
+    size_t n_columns = 0;
+    std::vector<TypeSF> best;
+    std::vector<TypeSF> second;
+    std::vector<uint32_t> best_pos;
+    std::vector<uint32_t> second_pos;
+    TypeSF cost = 0;
+
+    /**
+     * Builds the state for the set S.
+     *
+     * @param rows The rows of the distance matrix, one per element.
+     * @param s The set S.
+     * @param k The size of S.
+     */
+    template<class Rows>
+    void assign(const Rows &rows, const std::vector<uint32_t> &s, const size_t k) {
+        n_columns = rows[s[0]].size();
+        best.assign(n_columns, std::numeric_limits<TypeSF>::max());
+        second.assign(n_columns, std::numeric_limits<TypeSF>::max());
+        best_pos.assign(n_columns, 0);
+        second_pos.assign(n_columns, 0);
+
+        for (size_t p = 0; p < k; ++p) {
+            const TypeSF *row = rows[s[p]].data();
+            for (size_t j = 0; j < n_columns; ++j) {
+                insert(j, row[j], (uint32_t) p);
+            }
+        }
+
+        cost = 0;
+        for (size_t j = 0; j < n_columns; ++j) {
+            cost += best[j];
+        }
+    }
+
+    /**
+     * Updates the state after the element at position pos was replaced. Only
+     * the columns whose smallest or second smallest entry was at pos are
+     * rebuilt from all k rows, the other columns only compare against the
+     * row of the new element. So a swap costs O(n + k * r) instead of
+     * O(k * n), where r is the number of columns served by the old element.
+     *
+     * @param rows The rows of the distance matrix, one per element.
+     * @param s The set S, it already holds the new element at pos.
+     * @param k The size of S.
+     * @param pos The position of the swap.
+     */
+    template<class Rows>
+    void apply_swap(const Rows &rows, const std::vector<uint32_t> &s, const size_t k, const size_t pos) {
+        const TypeSF *row = rows[s[pos]].data();
+        cost = 0;
+        for (size_t j = 0; j < n_columns; ++j) {
+            if (best_pos[j] == pos || second_pos[j] == pos) {
+                best[j] = std::numeric_limits<TypeSF>::max();
+                second[j] = std::numeric_limits<TypeSF>::max();
+                for (size_t p = 0; p < k; ++p) {
+                    insert(j, rows[s[p]][j], (uint32_t) p);
+                }
+            } else {
+                insert(j, row[j], (uint32_t) pos);
+            }
+            cost += best[j];
+        }
+    }
+
+    /**
+     * Finds an improving swap between a candidate and a position of S. The
+     * candidates are evaluated in parallel chunks. With best improvement all
+     * candidates are evaluated and the swap with the largest gain is
+     * returned. With first improvement the chunks are evaluated in rounds and
+     * the best swap of the first round that contains an improvement is
+     * returned. Ties are broken by the smallest index and position, so the
+     * result does not depend on the number of threads.
+     *
+     * @param rows The rows of the distance matrix, one per element.
+     * @param candidates The candidates, none of them is in S.
+     * @param n_candidates Number of candidates.
+     * @param first_pos Positions before it are fixed.
+     * @param k The size of S.
+     * @param first_improvement Whether to stop at the first round with an improvement.
+     * @return The swap, its gain is 0 if no improving swap exists.
+     */
+    template<class Rows>
+    Swap find_swap(const Rows &rows, const uint32_t *candidates, const size_t n_candidates,
+                   const size_t first_pos, const size_t k, const bool first_improvement) const {
+        Swap result;
+        const size_t n_chunks = ceil(n_candidates, chunk_size);
+        const size_t round_size = first_improvement ? first_improvement_chunks : n_chunks;
+
+        for (size_t round_start = 0; round_start < n_chunks; round_start += round_size) {
+            const long round_end = (long) std::min(n_chunks, round_start + round_size);
+
+#pragma omp parallel for schedule(dynamic) if (round_end - (long) round_start > 1)
+            for (long chunk = (long) round_start; chunk < round_end; ++chunk) {
+                std::vector<TypeSF> delta(k);
+                Swap chunk_result;
+
+                const size_t first = (size_t) chunk * chunk_size;
+                const size_t last = std::min(n_candidates, first + chunk_size);
+                for (size_t i = first; i < last; ++i) {
+                    const TypeSF *row = rows[candidates[i]].data();
+                    std::fill(delta.begin(), delta.end(), 0);
+
+                    TypeSF base = 0;
+                    for (size_t j = 0; j < n_columns; ++j) {
+                        const TypeSF m = std::min(best[j], row[j]);
+                        base += m;
+                        delta[best_pos[j]] += std::min(second[j], row[j]) - m;
+                    }
+
+                    for (size_t p = first_pos; p < k; ++p) {
+                        const TypeSF gain = cost - (base + delta[p]);
+                        if (gain > chunk_result.gain) {
+                            chunk_result = {gain, i, p};
+                        }
+                    }
+                }
+
+#pragma omp critical
+                {
+                    if (chunk_result.gain > result.gain ||
+                        (chunk_result.gain == result.gain && chunk_result.gain > 0 && chunk_result.idx < result.idx)) {
+                        result = chunk_result;
+                    }
+                }
+            }
+
+            if (result.gain > 0) {
+                break;
+            }
+        }
+        return result;
+    }
+
+private:
+    /**
+     * Adds the entry of position p to column j.
+     */
+    inline void insert(const size_t j, const TypeSF value, const uint32_t p) {
+        if (value < best[j]) {
+            second[j] = best[j];
+            second_pos[j] = best_pos[j];
+            best[j] = value;
+            best_pos[j] = p;
+        } else if (value < second[j]) {
+            second[j] = value;
+            second_pos[j] = p;
+        }
+    }
+};
+
+#endif //SMSM_SWAPLOCALSTATE_H
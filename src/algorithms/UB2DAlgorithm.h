@@ -5,9 +5,12 @@
 #include <vector>
 #include <cstddef>
 #include <algorithm>
+#include <bit>
+#include <limits>
 
 #include "../utility/util.h"
 #include "UB2DStorage.h"
+#include "CardinalityMatching.h"
 #include "../../3rd_party_tools/blossom5-v2.05/PerfectMatching.h"
 #include "../utility/VectorOfVectors.h"
 
@@ -27,6 +30,37 @@ struct Edge {
     TypeSF weight;
 };
 
+/**
+ * A Blossom V instance that is kept between calls, so that a new solve starts
+ * from the previous dual solution. The graph consists of the clique on the
+ * (possibly shifted) nodes, one dummy node per clique node connected to all
+ * clique nodes with cost 0 and a pair edge between consecutive dummy nodes.
+ * Pair edges are switched on (very negative cost, the two dummies are matched
+ * together and two clique nodes must be matched with each other) or off (very
+ * positive cost) via cost updates.
+ */
+struct WarmMatching {
+    PerfectMatching *pm = nullptr;
+    size_t n_clique_nodes = 0;
+    size_t n_clique_edges = 0;
+    size_t n_pairs = 0;
+    std::vector<size_t> clique_edge_idx; // index into the edges of the UB2DAlgorithm
+    std::vector<size_t> clique_n1, clique_n2;
+    std::vector<double> clique_cost;
+    std::vector<double> pair_cost;
+    bool synced = false; // whether clique_cost matches the current edge weights
+
+    ~WarmMatching() {
+        delete pm;
+    }
+
+    void reset() {
+        delete pm;
+        pm = nullptr;
+        synced = false;
+    }
+};
+
 /**
  * This class serves as a superclass for all methods that return an upper bound
  * with 2D score improvements.
@@ -50,21 +84,29 @@ public:
 
     // needed for matching
     PerfectMatching::Options options;
-    PerfectMatching *pm = nullptr;
-    size_t pm_last_n_endpoints = 0;
-    PerfectMatching *pm_skip_first = nullptr;
-    size_t pm_skip_first_last_n_endpoints = 0;
+    WarmMatching pm;
+    WarmMatching pm_skip_first;
+    bool warm_matching = false; // whether the matching instances are kept between graphs
+
+    // needed for the native matching
+    CardinalityMatching<TypeSF> native_matching;
+    CardinalityMatching<TypeSF> native_matching_skip_first;
+    bool native_solved = false;
+    bool native_skip_first_solved = false;
+    std::vector<TypeSF> native_weights;
 
     // needed for brute force iterative
     std::vector<size_t> set;
     std::vector<size_t> best_set;
     std::vector<size_t> count;
 
+    // needed for the lookup of valid sets
+    std::vector<TypeSF> lookup_weights;
+    std::vector<TypeSF> lookup_sums;
+
     // needed for dynamic programming
-    std::vector<uint8_t> solution_ready;
-    std::vector<TypeSF> cache_si;
-    std::vector<size_t> cache_bitset_t1;
-    std::vector<size_t> cache_bitset_t2;
+    std::vector<uint8_t> solution_ready; // whether the layer with t pairs is computed
+    std::vector<TypeSF> dp_weights; // dense n x n weight matrix
     std::vector<size_t> node_set;
 
     /**
@@ -72,12 +114,14 @@ public:
      *
      * @param n Number of vertices.
      * @param m Number of edges.
+     * @param warm Whether the matching instances are warm-started across graphs.
      */
-    explicit UB2DAlgorithm(size_t n, size_t algo_type) {
+    explicit UB2DAlgorithm(size_t n, size_t algo_type, bool warm = false) {
         n_nodes = n;
         n_edges = (n * (n - 1)) / 2;
 
         algorithm_type = algo_type;
+        warm_matching = warm;
 
         edges_size = 0;
 
@@ -87,10 +131,7 @@ public:
     /**
      * De-constructor.
      */
-    ~UB2DAlgorithm() {
-        delete pm;
-        delete pm_skip_first;
-    }
+    ~UB2DAlgorithm() = default;
 
     /**
      * Clears all structures.
@@ -106,18 +147,23 @@ public:
         }
 
         if (algorithm_type == 2) {
-            delete pm;
-            pm = nullptr;
-            pm_last_n_endpoints = 0;
+            if (warm_matching) {
+                // keep the matching instances, only the weights have to be updated
+                pm.synced = false;
+                pm_skip_first.synced = false;
+            } else {
+                pm.reset();
+                pm_skip_first.reset();
+            }
+        }
 
-            delete pm_skip_first;
-            pm_skip_first = nullptr;
-            pm_skip_first_last_n_endpoints = 0;
+        if (algorithm_type == 5) {
+            native_solved = false;
+            native_skip_first_solved = false;
         }
 
         if (algorithm_type == 4) {
             solution_ready.clear();
-            cache_si.clear();
         }
     }
 
@@ -145,19 +191,16 @@ public:
             options.update_duals_after = false;
             options.single_tree_threshold = 1.00;
             options.verbose = false;
+
+            // the matching instances can only be reused for the same number of nodes
+            if (pm.pm != nullptr && pm.n_clique_nodes != n) { pm.reset(); }
+            if (pm_skip_first.pm != nullptr && pm_skip_first.n_clique_nodes + 1 != n) { pm_skip_first.reset(); }
         }
 
         if (algorithm_type == 4) {
-            size_t c = ceil(n, 2);
-            size_t cache_size = pow_2(n);
-            solution_ready.resize(c);
-            std::fill(solution_ready.begin(), solution_ready.end(), 0);
-
-            cache_si.resize(cache_size);
-            std::fill(cache_si.begin(), cache_si.end(), std::numeric_limits<TypeSF>::max());
-
-            cache_bitset_t1.resize(cache_size);
-            cache_bitset_t2.resize(cache_size);
+            ASSERT(n < 32);
+            solution_ready.assign(n / 2 + 1, 0);
+            dp_weights.resize(n * n);
         }
     }
 
@@ -197,6 +240,7 @@ public:
      * - If `algorithm_type` is 2, it uses a matching algorithm.
      * - If `algorithm_type` is 3, it uses a brute-force algorithm.
      * - If `algorithm_type` is 4, it uses a dynamic programming algorithm.
+     * - If `algorithm_type` is 5, it uses the native matching algorithm.
      *
      * @param v_s The vector of vectors containing subsets of endpoints.
      * @param w_s The vector of weights corresponding to the subsets.
@@ -210,7 +254,7 @@ public:
         ASSERT(w_s.empty());
         ASSERT(n_endpoints <= n_nodes);
 
-        ASSERT(n_endpoints == 0 || n_endpoints == 2 || n_endpoints == 4 || algorithm_type == 1 || algorithm_type == 2 || algorithm_type == 3 || algorithm_type == 4);
+        ASSERT(n_endpoints == 0 || n_endpoints == 2 || n_endpoints == 4 || algorithm_type == 1 || algorithm_type == 2 || algorithm_type == 3 || algorithm_type == 4 || algorithm_type == 5);
 
         TypeSF result;
         if (n_endpoints == 0) {
@@ -218,8 +262,8 @@ public:
         } else if (n_endpoints == 2) {
             result = two_endpoints(v_s, w_s, offset);
         } else if (n_endpoints == 4) {
-            if (n_nodes <= 10) {
-                result = four_endpoints_10(v_s, w_s, offset);
+            if (n_nodes <= valid_sets_max_n) {
+                result = four_endpoints_lookup(v_s, w_s, offset);
             } else {
                 result = four_endpoints(v_s, w_s, offset);
             }
@@ -228,13 +272,15 @@ public:
         } else if (algorithm_type == 2) {
             result = get_upper_bound_matching(v_s, w_s, n_endpoints, offset);
         } else if (algorithm_type == 3) {
-            if (n_nodes <= 10) {
+            if (n_nodes <= valid_sets_max_n) {
                 result = get_upper_bound_bforce_lookup(v_s, w_s, n_endpoints, offset);
             } else {
                 result = get_upper_bound_bforce_iterative(v_s, w_s, n_endpoints, offset);
             }
         } else if (algorithm_type == 4) {
             result = get_upper_bound_dynamic(v_s, w_s, n_endpoints, offset);
+        } else if (algorithm_type == 5) {
+            result = get_upper_bound_native_matching(v_s, w_s, n_endpoints, offset);
         } else {
             std::cout << "Dont recognize algorithm type " << algorithm_type << " for UB2D!" << std::endl;
             exit(EXIT_FAILURE);
@@ -252,6 +298,7 @@ public:
      * - If `algorithm_type` is 2, it uses a matching algorithm.
      * - If `algorithm_type` is 3, it uses a brute-force algorithm.
      * - If `algorithm_type` is 4, it uses a dynamic programming algorithm.
+     * - If `algorithm_type` is 5, it uses the native matching algorithm.
      *
      * @param v_s The vector of vectors containing subsets of endpoints.
      * @param w_s The vector of weights corresponding to the subsets.
@@ -265,7 +312,7 @@ public:
         ASSERT(w_s.empty());
         ASSERT(n_endpoints <= n_nodes);
 
-        ASSERT(n_endpoints == 0 || n_endpoints == 2 || n_endpoints == 4 || algorithm_type == 1 || algorithm_type == 2 || algorithm_type == 3 || algorithm_type == 4);
+        ASSERT(n_endpoints == 0 || n_endpoints == 2 || n_endpoints == 4 || algorithm_type == 1 || algorithm_type == 2 || algorithm_type == 3 || algorithm_type == 4 || algorithm_type == 5);
 
         TypeSF result;
         if (n_endpoints == 0) {
@@ -273,8 +320,8 @@ public:
         } else if (n_endpoints == 2) {
             result = two_endpoints_skip_first(v_s, w_s, offset);
         } else if (n_endpoints == 4) {
-            if (n_nodes <= 10) {
-                result = four_endpoints_10_skip_first(v_s, w_s, offset);
+            if (n_nodes - 1 <= valid_sets_max_n) {
+                result = four_endpoints_lookup_skip_first(v_s, w_s, offset);
             } else {
                 result = four_endpoints_skip_first(v_s, w_s, offset);
             }
@@ -283,13 +330,15 @@ public:
         } else if (algorithm_type == 2) {
             result = get_upper_bound_skip_first_matching(v_s, w_s, n_endpoints, offset);
         } else if (algorithm_type == 3) {
-            if (n_nodes <= 10) {
+            if (n_nodes - 1 <= valid_sets_max_n) {
                 result = get_upper_bound_skip_first_bforce_lookup(v_s, w_s, n_endpoints, offset);
             } else {
                 result = get_upper_bound_skip_first_bforce_iterative(v_s, w_s, n_endpoints, offset);
             }
         } else if (algorithm_type == 4) {
             result = get_upper_bound_skip_first_dynamic(v_s, w_s, n_endpoints, offset);
+        } else if (algorithm_type == 5) {
+            result = get_upper_bound_skip_first_native_matching(v_s, w_s, n_endpoints, offset);
         } else {
             std::cout << "Dont recognize algorithm type " << algorithm_type << " for UB2D!" << std::endl;
             exit(EXIT_FAILURE);
@@ -324,7 +373,6 @@ public:
         return edges[best_i].weight;
     }
 
-#define UPDATE(i, j) if (edges[i].weight + edges[j].weight > edges[best_i].weight + edges[best_j].weight){ best_i = i; best_j = j; }
 #define NO_OVERLAP(i, j) (edges[i].n1 != edges[j].n1 && edges[i].n1 != edges[j].n2 && edges[i].n2 != edges[j].n1 && edges[i].n2 != edges[j].n2)
 
     /**
@@ -361,1568 +409,81 @@ public:
         return best_sum;
     }
 
-    TypeSF four_endpoints_10(VectorOfVectors<size_t> &v_s, std::vector<TypeSF> &w_s, size_t offset) {
+    /**
+     * Finds the valid set with the maximum weight. The weights are copied into
+     * a contiguous array, then the sums of all sets are accumulated column by
+     * column and the maximum is found with a separate reduction, so that both
+     * loops are vectorized.
+     *
+     * @param sets The column-major block of valid sets.
+     * @param n_sets Number of sets in the block (at least one).
+     * @param t Number of edges per set.
+     * @param edge_offset Index of the first edge of the clique the sets refer to.
+     * @param best_sum Is set to the maximum weight.
+     * @return The index of the first set with the maximum weight.
+     */
+    size_t lookup_best_set(const uint8_t *sets, size_t n_sets, size_t t, size_t edge_offset, TypeSF &best_sum) {
+        ASSERT(n_sets > 0);
+        ASSERT(t > 0);
+
+        lookup_weights.resize(edges_size - edge_offset);
+        for (size_t i = edge_offset; i < edges_size; ++i) {
+            lookup_weights[i - edge_offset] = edges[i].weight;
+        }
+        const TypeSF *w = lookup_weights.data();
+
+        lookup_sums.resize(n_sets);
+        TypeSF *sums = lookup_sums.data();
+        for (size_t s = 0; s < n_sets; ++s) {
+            sums[s] = w[sets[s]];
+        }
+        for (size_t j = 1; j < t; ++j) {
+            const uint8_t *column = sets + j * n_sets;
+            for (size_t s = 0; s < n_sets; ++s) {
+                sums[s] += w[column[s]];
+            }
+        }
+
+        TypeSF max_sum = sums[0];
+        for (size_t s = 1; s < n_sets; ++s) {
+            max_sum = sums[s] > max_sum ? sums[s] : max_sum;
+        }
+
+        size_t best_idx = 0;
+        while (sums[best_idx] != max_sum) {
+            best_idx += 1;
+        }
+
+        best_sum = max_sum;
+        return best_idx;
+    }
+
+    /**
+     * Adds two edges that have the combined maximum weight by iterating over
+     * the precomputed valid sets.
+     *
+     * @param v_s Vector containing vertices representing edges (two per edge).
+     * @param w_s Vector storing weights for each edge.
+     * @param offset Offset for vertex conversion.
+     * @return The sum of the weights of the edges in the subset that provides the upper bound.
+     */
+    TypeSF four_endpoints_lookup(VectorOfVectors<size_t> &v_s, std::vector<TypeSF> &w_s, size_t offset) {
         ASSERT(v_s.size == 0);
         ASSERT(w_s.empty());
         ASSERT(n_nodes >= 4);
-        ASSERT(n_nodes <= 10);
+        ASSERT(n_nodes <= valid_sets_max_n);
 
         size_t best_i = 0, best_j = n_edges - 1;
 
-        if (n_nodes == 4) {
-// 0
-            UPDATE(0, 5);
-// 1
-            UPDATE(1, 4);
-// 2
-            UPDATE(2, 3);
-// 3
-// 4
-// 5
-        } else if (n_nodes == 5) {
-// 0
-            UPDATE(0, 7);
-            UPDATE(0, 8);
-            UPDATE(0, 9);
-// 1
-            UPDATE(1, 5);
-            UPDATE(1, 6);
-            UPDATE(1, 9);
-// 2
-            UPDATE(2, 4);
-            UPDATE(2, 6);
-            UPDATE(2, 8);
-// 3
-            UPDATE(3, 4);
-            UPDATE(3, 5);
-            UPDATE(3, 7);
-// 4
-            UPDATE(4, 9);
-// 5
-            UPDATE(5, 8);
-// 6
-            UPDATE(6, 7);
-// 7
-// 8
-// 9
-        } else if (n_nodes == 6) {
-// 0
-            UPDATE(0, 9);
-            UPDATE(0, 10);
-            UPDATE(0, 11);
-            UPDATE(0, 12);
-            UPDATE(0, 13);
-            UPDATE(0, 14);
-// 1
-            UPDATE(1, 6);
-            UPDATE(1, 7);
-            UPDATE(1, 8);
-            UPDATE(1, 12);
-            UPDATE(1, 13);
-            UPDATE(1, 14);
-// 2
-            UPDATE(2, 5);
-            UPDATE(2, 7);
-            UPDATE(2, 8);
-            UPDATE(2, 10);
-            UPDATE(2, 11);
-            UPDATE(2, 14);
-// 3
-            UPDATE(3, 5);
-            UPDATE(3, 6);
-            UPDATE(3, 8);
-            UPDATE(3, 9);
-            UPDATE(3, 11);
-            UPDATE(3, 13);
-// 4
-            UPDATE(4, 5);
-            UPDATE(4, 6);
-            UPDATE(4, 7);
-            UPDATE(4, 9);
-            UPDATE(4, 10);
-            UPDATE(4, 12);
-// 5
-            UPDATE(5, 12);
-            UPDATE(5, 13);
-            UPDATE(5, 14);
-// 6
-            UPDATE(6, 10);
-            UPDATE(6, 11);
-            UPDATE(6, 14);
-// 7
-            UPDATE(7, 9);
-            UPDATE(7, 11);
-            UPDATE(7, 13);
-// 8
-            UPDATE(8, 9);
-            UPDATE(8, 10);
-            UPDATE(8, 12);
-// 9
-            UPDATE(9, 14);
-// 10
-            UPDATE(10, 13);
-// 11
-            UPDATE(11, 12);
-// 12
-// 13
-// 14
-        } else if (n_nodes == 7) {
-// 0
-            UPDATE(0, 11);
-            UPDATE(0, 12);
-            UPDATE(0, 13);
-            UPDATE(0, 14);
-            UPDATE(0, 15);
-            UPDATE(0, 16);
-            UPDATE(0, 17);
-            UPDATE(0, 18);
-            UPDATE(0, 19);
-            UPDATE(0, 20);
-// 1
-            UPDATE(1, 7);
-            UPDATE(1, 8);
-            UPDATE(1, 9);
-            UPDATE(1, 10);
-            UPDATE(1, 15);
-            UPDATE(1, 16);
-            UPDATE(1, 17);
-            UPDATE(1, 18);
-            UPDATE(1, 19);
-            UPDATE(1, 20);
-// 2
-            UPDATE(2, 6);
-            UPDATE(2, 8);
-            UPDATE(2, 9);
-            UPDATE(2, 10);
-            UPDATE(2, 12);
-            UPDATE(2, 13);
-            UPDATE(2, 14);
-            UPDATE(2, 18);
-            UPDATE(2, 19);
-            UPDATE(2, 20);
-// 3
-            UPDATE(3, 6);
-            UPDATE(3, 7);
-            UPDATE(3, 9);
-            UPDATE(3, 10);
-            UPDATE(3, 11);
-            UPDATE(3, 13);
-            UPDATE(3, 14);
-            UPDATE(3, 16);
-            UPDATE(3, 17);
-            UPDATE(3, 20);
-// 4
-            UPDATE(4, 6);
-            UPDATE(4, 7);
-            UPDATE(4, 8);
-            UPDATE(4, 10);
-            UPDATE(4, 11);
-            UPDATE(4, 12);
-            UPDATE(4, 14);
-            UPDATE(4, 15);
-            UPDATE(4, 17);
-            UPDATE(4, 19);
-// 5
-            UPDATE(5, 6);
-            UPDATE(5, 7);
-            UPDATE(5, 8);
-            UPDATE(5, 9);
-            UPDATE(5, 11);
-            UPDATE(5, 12);
-            UPDATE(5, 13);
-            UPDATE(5, 15);
-            UPDATE(5, 16);
-            UPDATE(5, 18);
-// 6
-            UPDATE(6, 15);
-            UPDATE(6, 16);
-            UPDATE(6, 17);
-            UPDATE(6, 18);
-            UPDATE(6, 19);
-            UPDATE(6, 20);
-// 7
-            UPDATE(7, 12);
-            UPDATE(7, 13);
-            UPDATE(7, 14);
-            UPDATE(7, 18);
-            UPDATE(7, 19);
-            UPDATE(7, 20);
-// 8
-            UPDATE(8, 11);
-            UPDATE(8, 13);
-            UPDATE(8, 14);
-            UPDATE(8, 16);
-            UPDATE(8, 17);
-            UPDATE(8, 20);
-// 9
-            UPDATE(9, 11);
-            UPDATE(9, 12);
-            UPDATE(9, 14);
-            UPDATE(9, 15);
-            UPDATE(9, 17);
-            UPDATE(9, 19);
-// 10
-            UPDATE(10, 11);
-            UPDATE(10, 12);
-            UPDATE(10, 13);
-            UPDATE(10, 15);
-            UPDATE(10, 16);
-            UPDATE(10, 18);
-// 11
-            UPDATE(11, 18);
-            UPDATE(11, 19);
-            UPDATE(11, 20);
-// 12
-            UPDATE(12, 16);
-            UPDATE(12, 17);
-            UPDATE(12, 20);
-// 13
-            UPDATE(13, 15);
-            UPDATE(13, 17);
-            UPDATE(13, 19);
-// 14
-            UPDATE(14, 15);
-            UPDATE(14, 16);
-            UPDATE(14, 18);
-// 15
-            UPDATE(15, 20);
-// 16
-            UPDATE(16, 19);
-// 17
-            UPDATE(17, 18);
-// 18
-// 19
-// 20
-        } else if (n_nodes == 8) {
-// 0
-            UPDATE(0, 13);
-            UPDATE(0, 14);
-            UPDATE(0, 15);
-            UPDATE(0, 16);
-            UPDATE(0, 17);
-            UPDATE(0, 18);
-            UPDATE(0, 19);
-            UPDATE(0, 20);
-            UPDATE(0, 21);
-            UPDATE(0, 22);
-            UPDATE(0, 23);
-            UPDATE(0, 24);
-            UPDATE(0, 25);
-            UPDATE(0, 26);
-            UPDATE(0, 27);
-// 1
-            UPDATE(1, 8);
-            UPDATE(1, 9);
-            UPDATE(1, 10);
-            UPDATE(1, 11);
-            UPDATE(1, 12);
-            UPDATE(1, 18);
-            UPDATE(1, 19);
-            UPDATE(1, 20);
-            UPDATE(1, 21);
-            UPDATE(1, 22);
-            UPDATE(1, 23);
-            UPDATE(1, 24);
-            UPDATE(1, 25);
-            UPDATE(1, 26);
-            UPDATE(1, 27);
-// 2
-            UPDATE(2, 7);
-            UPDATE(2, 9);
-            UPDATE(2, 10);
-            UPDATE(2, 11);
-            UPDATE(2, 12);
-            UPDATE(2, 14);
-            UPDATE(2, 15);
-            UPDATE(2, 16);
-            UPDATE(2, 17);
-            UPDATE(2, 22);
-            UPDATE(2, 23);
-            UPDATE(2, 24);
-            UPDATE(2, 25);
-            UPDATE(2, 26);
-            UPDATE(2, 27);
-// 3
-            UPDATE(3, 7);
-            UPDATE(3, 8);
-            UPDATE(3, 10);
-            UPDATE(3, 11);
-            UPDATE(3, 12);
-            UPDATE(3, 13);
-            UPDATE(3, 15);
-            UPDATE(3, 16);
-            UPDATE(3, 17);
-            UPDATE(3, 19);
-            UPDATE(3, 20);
-            UPDATE(3, 21);
-            UPDATE(3, 25);
-            UPDATE(3, 26);
-            UPDATE(3, 27);
-// 4
-            UPDATE(4, 7);
-            UPDATE(4, 8);
-            UPDATE(4, 9);
-            UPDATE(4, 11);
-            UPDATE(4, 12);
-            UPDATE(4, 13);
-            UPDATE(4, 14);
-            UPDATE(4, 16);
-            UPDATE(4, 17);
-            UPDATE(4, 18);
-            UPDATE(4, 20);
-            UPDATE(4, 21);
-            UPDATE(4, 23);
-            UPDATE(4, 24);
-            UPDATE(4, 27);
-// 5
-            UPDATE(5, 7);
-            UPDATE(5, 8);
-            UPDATE(5, 9);
-            UPDATE(5, 10);
-            UPDATE(5, 12);
-            UPDATE(5, 13);
-            UPDATE(5, 14);
-            UPDATE(5, 15);
-            UPDATE(5, 17);
-            UPDATE(5, 18);
-            UPDATE(5, 19);
-            UPDATE(5, 21);
-            UPDATE(5, 22);
-            UPDATE(5, 24);
-            UPDATE(5, 26);
-// 6
-            UPDATE(6, 7);
-            UPDATE(6, 8);
-            UPDATE(6, 9);
-            UPDATE(6, 10);
-            UPDATE(6, 11);
-            UPDATE(6, 13);
-            UPDATE(6, 14);
-            UPDATE(6, 15);
-            UPDATE(6, 16);
-            UPDATE(6, 18);
-            UPDATE(6, 19);
-            UPDATE(6, 20);
-            UPDATE(6, 22);
-            UPDATE(6, 23);
-            UPDATE(6, 25);
-// 7
-            UPDATE(7, 18);
-            UPDATE(7, 19);
-            UPDATE(7, 20);
-            UPDATE(7, 21);
-            UPDATE(7, 22);
-            UPDATE(7, 23);
-            UPDATE(7, 24);
-            UPDATE(7, 25);
-            UPDATE(7, 26);
-            UPDATE(7, 27);
-// 8
-            UPDATE(8, 14);
-            UPDATE(8, 15);
-            UPDATE(8, 16);
-            UPDATE(8, 17);
-            UPDATE(8, 22);
-            UPDATE(8, 23);
-            UPDATE(8, 24);
-            UPDATE(8, 25);
-            UPDATE(8, 26);
-            UPDATE(8, 27);
-// 9
-            UPDATE(9, 13);
-            UPDATE(9, 15);
-            UPDATE(9, 16);
-            UPDATE(9, 17);
-            UPDATE(9, 19);
-            UPDATE(9, 20);
-            UPDATE(9, 21);
-            UPDATE(9, 25);
-            UPDATE(9, 26);
-            UPDATE(9, 27);
-// 10
-            UPDATE(10, 13);
-            UPDATE(10, 14);
-            UPDATE(10, 16);
-            UPDATE(10, 17);
-            UPDATE(10, 18);
-            UPDATE(10, 20);
-            UPDATE(10, 21);
-            UPDATE(10, 23);
-            UPDATE(10, 24);
-            UPDATE(10, 27);
-// 11
-            UPDATE(11, 13);
-            UPDATE(11, 14);
-            UPDATE(11, 15);
-            UPDATE(11, 17);
-            UPDATE(11, 18);
-            UPDATE(11, 19);
-            UPDATE(11, 21);
-            UPDATE(11, 22);
-            UPDATE(11, 24);
-            UPDATE(11, 26);
-// 12
-            UPDATE(12, 13);
-            UPDATE(12, 14);
-            UPDATE(12, 15);
-            UPDATE(12, 16);
-            UPDATE(12, 18);
-            UPDATE(12, 19);
-            UPDATE(12, 20);
-            UPDATE(12, 22);
-            UPDATE(12, 23);
-            UPDATE(12, 25);
-// 13
-            UPDATE(13, 22);
-            UPDATE(13, 23);
-            UPDATE(13, 24);
-            UPDATE(13, 25);
-            UPDATE(13, 26);
-            UPDATE(13, 27);
-// 14
-            UPDATE(14, 19);
-            UPDATE(14, 20);
-            UPDATE(14, 21);
-            UPDATE(14, 25);
-            UPDATE(14, 26);
-            UPDATE(14, 27);
-// 15
-            UPDATE(15, 18);
-            UPDATE(15, 20);
-            UPDATE(15, 21);
-            UPDATE(15, 23);
-            UPDATE(15, 24);
-            UPDATE(15, 27);
-// 16
-            UPDATE(16, 18);
-            UPDATE(16, 19);
-            UPDATE(16, 21);
-            UPDATE(16, 22);
-            UPDATE(16, 24);
-            UPDATE(16, 26);
-// 17
-            UPDATE(17, 18);
-            UPDATE(17, 19);
-            UPDATE(17, 20);
-            UPDATE(17, 22);
-            UPDATE(17, 23);
-            UPDATE(17, 25);
-// 18
-            UPDATE(18, 25);
-            UPDATE(18, 26);
-            UPDATE(18, 27);
-// 19
-            UPDATE(19, 23);
-            UPDATE(19, 24);
-            UPDATE(19, 27);
-// 20
-            UPDATE(20, 22);
-            UPDATE(20, 24);
-            UPDATE(20, 26);
-// 21
-            UPDATE(21, 22);
-            UPDATE(21, 23);
-            UPDATE(21, 25);
-// 22
-            UPDATE(22, 27);
-// 23
-            UPDATE(23, 26);
-// 24
-            UPDATE(24, 25);
-// 25
-// 26
-// 27
-        } else if (n_nodes == 9) {
-// 0
-            UPDATE(0, 15);
-            UPDATE(0, 16);
-            UPDATE(0, 17);
-            UPDATE(0, 18);
-            UPDATE(0, 19);
-            UPDATE(0, 20);
-            UPDATE(0, 21);
-            UPDATE(0, 22);
-            UPDATE(0, 23);
-            UPDATE(0, 24);
-            UPDATE(0, 25);
-            UPDATE(0, 26);
-            UPDATE(0, 27);
-            UPDATE(0, 28);
-            UPDATE(0, 29);
-            UPDATE(0, 30);
-            UPDATE(0, 31);
-            UPDATE(0, 32);
-            UPDATE(0, 33);
-            UPDATE(0, 34);
-            UPDATE(0, 35);
-// 1
-            UPDATE(1, 9);
-            UPDATE(1, 10);
-            UPDATE(1, 11);
-            UPDATE(1, 12);
-            UPDATE(1, 13);
-            UPDATE(1, 14);
-            UPDATE(1, 21);
-            UPDATE(1, 22);
-            UPDATE(1, 23);
-            UPDATE(1, 24);
-            UPDATE(1, 25);
-            UPDATE(1, 26);
-            UPDATE(1, 27);
-            UPDATE(1, 28);
-            UPDATE(1, 29);
-            UPDATE(1, 30);
-            UPDATE(1, 31);
-            UPDATE(1, 32);
-            UPDATE(1, 33);
-            UPDATE(1, 34);
-            UPDATE(1, 35);
-// 2
-            UPDATE(2, 8);
-            UPDATE(2, 10);
-            UPDATE(2, 11);
-            UPDATE(2, 12);
-            UPDATE(2, 13);
-            UPDATE(2, 14);
-            UPDATE(2, 16);
-            UPDATE(2, 17);
-            UPDATE(2, 18);
-            UPDATE(2, 19);
-            UPDATE(2, 20);
-            UPDATE(2, 26);
-            UPDATE(2, 27);
-            UPDATE(2, 28);
-            UPDATE(2, 29);
-            UPDATE(2, 30);
-            UPDATE(2, 31);
-            UPDATE(2, 32);
-            UPDATE(2, 33);
-            UPDATE(2, 34);
-            UPDATE(2, 35);
-// 3
-            UPDATE(3, 8);
-            UPDATE(3, 9);
-            UPDATE(3, 11);
-            UPDATE(3, 12);
-            UPDATE(3, 13);
-            UPDATE(3, 14);
-            UPDATE(3, 15);
-            UPDATE(3, 17);
-            UPDATE(3, 18);
-            UPDATE(3, 19);
-            UPDATE(3, 20);
-            UPDATE(3, 22);
-            UPDATE(3, 23);
-            UPDATE(3, 24);
-            UPDATE(3, 25);
-            UPDATE(3, 30);
-            UPDATE(3, 31);
-            UPDATE(3, 32);
-            UPDATE(3, 33);
-            UPDATE(3, 34);
-            UPDATE(3, 35);
-// 4
-            UPDATE(4, 8);
-            UPDATE(4, 9);
-            UPDATE(4, 10);
-            UPDATE(4, 12);
-            UPDATE(4, 13);
-            UPDATE(4, 14);
-            UPDATE(4, 15);
-            UPDATE(4, 16);
-            UPDATE(4, 18);
-            UPDATE(4, 19);
-            UPDATE(4, 20);
-            UPDATE(4, 21);
-            UPDATE(4, 23);
-            UPDATE(4, 24);
-            UPDATE(4, 25);
-            UPDATE(4, 27);
-            UPDATE(4, 28);
-            UPDATE(4, 29);
-            UPDATE(4, 33);
-            UPDATE(4, 34);
-            UPDATE(4, 35);
-// 5
-            UPDATE(5, 8);
-            UPDATE(5, 9);
-            UPDATE(5, 10);
-            UPDATE(5, 11);
-            UPDATE(5, 13);
-            UPDATE(5, 14);
-            UPDATE(5, 15);
-            UPDATE(5, 16);
-            UPDATE(5, 17);
-            UPDATE(5, 19);
-            UPDATE(5, 20);
-            UPDATE(5, 21);
-            UPDATE(5, 22);
-            UPDATE(5, 24);
-            UPDATE(5, 25);
-            UPDATE(5, 26);
-            UPDATE(5, 28);
-            UPDATE(5, 29);
-            UPDATE(5, 31);
-            UPDATE(5, 32);
-            UPDATE(5, 35);
-// 6
-            UPDATE(6, 8);
-            UPDATE(6, 9);
-            UPDATE(6, 10);
-            UPDATE(6, 11);
-            UPDATE(6, 12);
-            UPDATE(6, 14);
-            UPDATE(6, 15);
-            UPDATE(6, 16);
-            UPDATE(6, 17);
-            UPDATE(6, 18);
-            UPDATE(6, 20);
-            UPDATE(6, 21);
-            UPDATE(6, 22);
-            UPDATE(6, 23);
-            UPDATE(6, 25);
-            UPDATE(6, 26);
-            UPDATE(6, 27);
-            UPDATE(6, 29);
-            UPDATE(6, 30);
-            UPDATE(6, 32);
-            UPDATE(6, 34);
-// 7
-            UPDATE(7, 8);
-            UPDATE(7, 9);
-            UPDATE(7, 10);
-            UPDATE(7, 11);
-            UPDATE(7, 12);
-            UPDATE(7, 13);
-            UPDATE(7, 15);
-            UPDATE(7, 16);
-            UPDATE(7, 17);
-            UPDATE(7, 18);
-            UPDATE(7, 19);
-            UPDATE(7, 21);
-            UPDATE(7, 22);
-            UPDATE(7, 23);
-            UPDATE(7, 24);
-            UPDATE(7, 26);
-            UPDATE(7, 27);
-            UPDATE(7, 28);
-            UPDATE(7, 30);
-            UPDATE(7, 31);
-            UPDATE(7, 33);
-// 8
-            UPDATE(8, 21);
-            UPDATE(8, 22);
-            UPDATE(8, 23);
-            UPDATE(8, 24);
-            UPDATE(8, 25);
-            UPDATE(8, 26);
-            UPDATE(8, 27);
-            UPDATE(8, 28);
-            UPDATE(8, 29);
-            UPDATE(8, 30);
-            UPDATE(8, 31);
-            UPDATE(8, 32);
-            UPDATE(8, 33);
-            UPDATE(8, 34);
-            UPDATE(8, 35);
-// 9
-            UPDATE(9, 16);
-            UPDATE(9, 17);
-            UPDATE(9, 18);
-            UPDATE(9, 19);
-            UPDATE(9, 20);
-            UPDATE(9, 26);
-            UPDATE(9, 27);
-            UPDATE(9, 28);
-            UPDATE(9, 29);
-            UPDATE(9, 30);
-            UPDATE(9, 31);
-            UPDATE(9, 32);
-            UPDATE(9, 33);
-            UPDATE(9, 34);
-            UPDATE(9, 35);
-// 10
-            UPDATE(10, 15);
-            UPDATE(10, 17);
-            UPDATE(10, 18);
-            UPDATE(10, 19);
-            UPDATE(10, 20);
-            UPDATE(10, 22);
-            UPDATE(10, 23);
-            UPDATE(10, 24);
-            UPDATE(10, 25);
-            UPDATE(10, 30);
-            UPDATE(10, 31);
-            UPDATE(10, 32);
-            UPDATE(10, 33);
-            UPDATE(10, 34);
-            UPDATE(10, 35);
-// 11
-            UPDATE(11, 15);
-            UPDATE(11, 16);
-            UPDATE(11, 18);
-            UPDATE(11, 19);
-            UPDATE(11, 20);
-            UPDATE(11, 21);
-            UPDATE(11, 23);
-            UPDATE(11, 24);
-            UPDATE(11, 25);
-            UPDATE(11, 27);
-            UPDATE(11, 28);
-            UPDATE(11, 29);
-            UPDATE(11, 33);
-            UPDATE(11, 34);
-            UPDATE(11, 35);
-// 12
-            UPDATE(12, 15);
-            UPDATE(12, 16);
-            UPDATE(12, 17);
-            UPDATE(12, 19);
-            UPDATE(12, 20);
-            UPDATE(12, 21);
-            UPDATE(12, 22);
-            UPDATE(12, 24);
-            UPDATE(12, 25);
-            UPDATE(12, 26);
-            UPDATE(12, 28);
-            UPDATE(12, 29);
-            UPDATE(12, 31);
-            UPDATE(12, 32);
-            UPDATE(12, 35);
-// 13
-            UPDATE(13, 15);
-            UPDATE(13, 16);
-            UPDATE(13, 17);
-            UPDATE(13, 18);
-            UPDATE(13, 20);
-            UPDATE(13, 21);
-            UPDATE(13, 22);
-            UPDATE(13, 23);
-            UPDATE(13, 25);
-            UPDATE(13, 26);
-            UPDATE(13, 27);
-            UPDATE(13, 29);
-            UPDATE(13, 30);
-            UPDATE(13, 32);
-            UPDATE(13, 34);
-// 14
-            UPDATE(14, 15);
-            UPDATE(14, 16);
-            UPDATE(14, 17);
-            UPDATE(14, 18);
-            UPDATE(14, 19);
-            UPDATE(14, 21);
-            UPDATE(14, 22);
-            UPDATE(14, 23);
-            UPDATE(14, 24);
-            UPDATE(14, 26);
-            UPDATE(14, 27);
-            UPDATE(14, 28);
-            UPDATE(14, 30);
-            UPDATE(14, 31);
-            UPDATE(14, 33);
-// 15
-            UPDATE(15, 26);
-            UPDATE(15, 27);
-            UPDATE(15, 28);
-            UPDATE(15, 29);
-            UPDATE(15, 30);
-            UPDATE(15, 31);
-            UPDATE(15, 32);
-            UPDATE(15, 33);
-            UPDATE(15, 34);
-            UPDATE(15, 35);
-// 16
-            UPDATE(16, 22);
-            UPDATE(16, 23);
-            UPDATE(16, 24);
-            UPDATE(16, 25);
-            UPDATE(16, 30);
-            UPDATE(16, 31);
-            UPDATE(16, 32);
-            UPDATE(16, 33);
-            UPDATE(16, 34);
-            UPDATE(16, 35);
-// 17
-            UPDATE(17, 21);
-            UPDATE(17, 23);
-            UPDATE(17, 24);
-            UPDATE(17, 25);
-            UPDATE(17, 27);
-            UPDATE(17, 28);
-            UPDATE(17, 29);
-            UPDATE(17, 33);
-            UPDATE(17, 34);
-            UPDATE(17, 35);
-// 18
-            UPDATE(18, 21);
-            UPDATE(18, 22);
-            UPDATE(18, 24);
-            UPDATE(18, 25);
-            UPDATE(18, 26);
-            UPDATE(18, 28);
-            UPDATE(18, 29);
-            UPDATE(18, 31);
-            UPDATE(18, 32);
-            UPDATE(18, 35);
-// 19
-            UPDATE(19, 21);
-            UPDATE(19, 22);
-            UPDATE(19, 23);
-            UPDATE(19, 25);
-            UPDATE(19, 26);
-            UPDATE(19, 27);
-            UPDATE(19, 29);
-            UPDATE(19, 30);
-            UPDATE(19, 32);
-            UPDATE(19, 34);
-// 20
-            UPDATE(20, 21);
-            UPDATE(20, 22);
-            UPDATE(20, 23);
-            UPDATE(20, 24);
-            UPDATE(20, 26);
-            UPDATE(20, 27);
-            UPDATE(20, 28);
-            UPDATE(20, 30);
-            UPDATE(20, 31);
-            UPDATE(20, 33);
-// 21
-            UPDATE(21, 30);
-            UPDATE(21, 31);
-            UPDATE(21, 32);
-            UPDATE(21, 33);
-            UPDATE(21, 34);
-            UPDATE(21, 35);
-// 22
-            UPDATE(22, 27);
-            UPDATE(22, 28);
-            UPDATE(22, 29);
-            UPDATE(22, 33);
-            UPDATE(22, 34);
-            UPDATE(22, 35);
-// 23
-            UPDATE(23, 26);
-            UPDATE(23, 28);
-            UPDATE(23, 29);
-            UPDATE(23, 31);
-            UPDATE(23, 32);
-            UPDATE(23, 35);
-// 24
-            UPDATE(24, 26);
-            UPDATE(24, 27);
-            UPDATE(24, 29);
-            UPDATE(24, 30);
-            UPDATE(24, 32);
-            UPDATE(24, 34);
-// 25
-            UPDATE(25, 26);
-            UPDATE(25, 27);
-            UPDATE(25, 28);
-            UPDATE(25, 30);
-            UPDATE(25, 31);
-            UPDATE(25, 33);
-// 26
-            UPDATE(26, 33);
-            UPDATE(26, 34);
-            UPDATE(26, 35);
-// 27
-            UPDATE(27, 31);
-            UPDATE(27, 32);
-            UPDATE(27, 35);
-// 28
-            UPDATE(28, 30);
-            UPDATE(28, 32);
-            UPDATE(28, 34);
-// 29
-            UPDATE(29, 30);
-            UPDATE(29, 31);
-            UPDATE(29, 33);
-// 30
-            UPDATE(30, 35);
-// 31
-            UPDATE(31, 34);
-// 32
-            UPDATE(32, 33);
-// 33
-// 34
-// 35
-        } else if (n_nodes == 10) {
-// 0
-            UPDATE(0, 17);
-            UPDATE(0, 18);
-            UPDATE(0, 19);
-            UPDATE(0, 20);
-            UPDATE(0, 21);
-            UPDATE(0, 22);
-            UPDATE(0, 23);
-            UPDATE(0, 24);
-            UPDATE(0, 25);
-            UPDATE(0, 26);
-            UPDATE(0, 27);
-            UPDATE(0, 28);
-            UPDATE(0, 29);
-            UPDATE(0, 30);
-            UPDATE(0, 31);
-            UPDATE(0, 32);
-            UPDATE(0, 33);
-            UPDATE(0, 34);
-            UPDATE(0, 35);
-            UPDATE(0, 36);
-            UPDATE(0, 37);
-            UPDATE(0, 38);
-            UPDATE(0, 39);
-            UPDATE(0, 40);
-            UPDATE(0, 41);
-            UPDATE(0, 42);
-            UPDATE(0, 43);
-            UPDATE(0, 44);
-// 1
-            UPDATE(1, 10);
-            UPDATE(1, 11);
-            UPDATE(1, 12);
-            UPDATE(1, 13);
-            UPDATE(1, 14);
-            UPDATE(1, 15);
-            UPDATE(1, 16);
-            UPDATE(1, 24);
-            UPDATE(1, 25);
-            UPDATE(1, 26);
-            UPDATE(1, 27);
-            UPDATE(1, 28);
-            UPDATE(1, 29);
-            UPDATE(1, 30);
-            UPDATE(1, 31);
-            UPDATE(1, 32);
-            UPDATE(1, 33);
-            UPDATE(1, 34);
-            UPDATE(1, 35);
-            UPDATE(1, 36);
-            UPDATE(1, 37);
-            UPDATE(1, 38);
-            UPDATE(1, 39);
-            UPDATE(1, 40);
-            UPDATE(1, 41);
-            UPDATE(1, 42);
-            UPDATE(1, 43);
-            UPDATE(1, 44);
-// 2
-            UPDATE(2, 9);
-            UPDATE(2, 11);
-            UPDATE(2, 12);
-            UPDATE(2, 13);
-            UPDATE(2, 14);
-            UPDATE(2, 15);
-            UPDATE(2, 16);
-            UPDATE(2, 18);
-            UPDATE(2, 19);
-            UPDATE(2, 20);
-            UPDATE(2, 21);
-            UPDATE(2, 22);
-            UPDATE(2, 23);
-            UPDATE(2, 30);
-            UPDATE(2, 31);
-            UPDATE(2, 32);
-            UPDATE(2, 33);
-            UPDATE(2, 34);
-            UPDATE(2, 35);
-            UPDATE(2, 36);
-            UPDATE(2, 37);
-            UPDATE(2, 38);
-            UPDATE(2, 39);
-            UPDATE(2, 40);
-            UPDATE(2, 41);
-            UPDATE(2, 42);
-            UPDATE(2, 43);
-            UPDATE(2, 44);
-// 3
-            UPDATE(3, 9);
-            UPDATE(3, 10);
-            UPDATE(3, 12);
-            UPDATE(3, 13);
-            UPDATE(3, 14);
-            UPDATE(3, 15);
-            UPDATE(3, 16);
-            UPDATE(3, 17);
-            UPDATE(3, 19);
-            UPDATE(3, 20);
-            UPDATE(3, 21);
-            UPDATE(3, 22);
-            UPDATE(3, 23);
-            UPDATE(3, 25);
-            UPDATE(3, 26);
-            UPDATE(3, 27);
-            UPDATE(3, 28);
-            UPDATE(3, 29);
-            UPDATE(3, 35);
-            UPDATE(3, 36);
-            UPDATE(3, 37);
-            UPDATE(3, 38);
-            UPDATE(3, 39);
-            UPDATE(3, 40);
-            UPDATE(3, 41);
-            UPDATE(3, 42);
-            UPDATE(3, 43);
-            UPDATE(3, 44);
-// 4
-            UPDATE(4, 9);
-            UPDATE(4, 10);
-            UPDATE(4, 11);
-            UPDATE(4, 13);
-            UPDATE(4, 14);
-            UPDATE(4, 15);
-            UPDATE(4, 16);
-            UPDATE(4, 17);
-            UPDATE(4, 18);
-            UPDATE(4, 20);
-            UPDATE(4, 21);
-            UPDATE(4, 22);
-            UPDATE(4, 23);
-            UPDATE(4, 24);
-            UPDATE(4, 26);
-            UPDATE(4, 27);
-            UPDATE(4, 28);
-            UPDATE(4, 29);
-            UPDATE(4, 31);
-            UPDATE(4, 32);
-            UPDATE(4, 33);
-            UPDATE(4, 34);
-            UPDATE(4, 39);
-            UPDATE(4, 40);
-            UPDATE(4, 41);
-            UPDATE(4, 42);
-            UPDATE(4, 43);
-            UPDATE(4, 44);
-// 5
-            UPDATE(5, 9);
-            UPDATE(5, 10);
-            UPDATE(5, 11);
-            UPDATE(5, 12);
-            UPDATE(5, 14);
-            UPDATE(5, 15);
-            UPDATE(5, 16);
-            UPDATE(5, 17);
-            UPDATE(5, 18);
-            UPDATE(5, 19);
-            UPDATE(5, 21);
-            UPDATE(5, 22);
-            UPDATE(5, 23);
-            UPDATE(5, 24);
-            UPDATE(5, 25);
-            UPDATE(5, 27);
-            UPDATE(5, 28);
-            UPDATE(5, 29);
-            UPDATE(5, 30);
-            UPDATE(5, 32);
-            UPDATE(5, 33);
-            UPDATE(5, 34);
-            UPDATE(5, 36);
-            UPDATE(5, 37);
-            UPDATE(5, 38);
-            UPDATE(5, 42);
-            UPDATE(5, 43);
-            UPDATE(5, 44);
-// 6
-            UPDATE(6, 9);
-            UPDATE(6, 10);
-            UPDATE(6, 11);
-            UPDATE(6, 12);
-            UPDATE(6, 13);
-            UPDATE(6, 15);
-            UPDATE(6, 16);
-            UPDATE(6, 17);
-            UPDATE(6, 18);
-            UPDATE(6, 19);
-            UPDATE(6, 20);
-            UPDATE(6, 22);
-            UPDATE(6, 23);
-            UPDATE(6, 24);
-            UPDATE(6, 25);
-            UPDATE(6, 26);
-            UPDATE(6, 28);
-            UPDATE(6, 29);
-            UPDATE(6, 30);
-            UPDATE(6, 31);
-            UPDATE(6, 33);
-            UPDATE(6, 34);
-            UPDATE(6, 35);
-            UPDATE(6, 37);
-            UPDATE(6, 38);
-            UPDATE(6, 40);
-            UPDATE(6, 41);
-            UPDATE(6, 44);
-// 7
-            UPDATE(7, 9);
-            UPDATE(7, 10);
-            UPDATE(7, 11);
-            UPDATE(7, 12);
-            UPDATE(7, 13);
-            UPDATE(7, 14);
-            UPDATE(7, 16);
-            UPDATE(7, 17);
-            UPDATE(7, 18);
-            UPDATE(7, 19);
-            UPDATE(7, 20);
-            UPDATE(7, 21);
-            UPDATE(7, 23);
-            UPDATE(7, 24);
-            UPDATE(7, 25);
-            UPDATE(7, 26);
-            UPDATE(7, 27);
-            UPDATE(7, 29);
-            UPDATE(7, 30);
-            UPDATE(7, 31);
-            UPDATE(7, 32);
-            UPDATE(7, 34);
-            UPDATE(7, 35);
-            UPDATE(7, 36);
-            UPDATE(7, 38);
-            UPDATE(7, 39);
-            UPDATE(7, 41);
-            UPDATE(7, 43);
-// 8
-            UPDATE(8, 9);
-            UPDATE(8, 10);
-            UPDATE(8, 11);
-            UPDATE(8, 12);
-            UPDATE(8, 13);
-            UPDATE(8, 14);
-            UPDATE(8, 15);
-            UPDATE(8, 17);
-            UPDATE(8, 18);
-            UPDATE(8, 19);
-            UPDATE(8, 20);
-            UPDATE(8, 21);
-            UPDATE(8, 22);
-            UPDATE(8, 24);
-            UPDATE(8, 25);
-            UPDATE(8, 26);
-            UPDATE(8, 27);
-            UPDATE(8, 28);
-            UPDATE(8, 30);
-            UPDATE(8, 31);
-            UPDATE(8, 32);
-            UPDATE(8, 33);
-            UPDATE(8, 35);
-            UPDATE(8, 36);
-            UPDATE(8, 37);
-            UPDATE(8, 39);
-            UPDATE(8, 40);
-            UPDATE(8, 42);
-// 9
-            UPDATE(9, 24);
-            UPDATE(9, 25);
-            UPDATE(9, 26);
-            UPDATE(9, 27);
-            UPDATE(9, 28);
-            UPDATE(9, 29);
-            UPDATE(9, 30);
-            UPDATE(9, 31);
-            UPDATE(9, 32);
-            UPDATE(9, 33);
-            UPDATE(9, 34);
-            UPDATE(9, 35);
-            UPDATE(9, 36);
-            UPDATE(9, 37);
-            UPDATE(9, 38);
-            UPDATE(9, 39);
-            UPDATE(9, 40);
-            UPDATE(9, 41);
-            UPDATE(9, 42);
-            UPDATE(9, 43);
-            UPDATE(9, 44);
-// 10
-            UPDATE(10, 18);
-            UPDATE(10, 19);
-            UPDATE(10, 20);
-            UPDATE(10, 21);
-            UPDATE(10, 22);
-            UPDATE(10, 23);
-            UPDATE(10, 30);
-            UPDATE(10, 31);
-            UPDATE(10, 32);
-            UPDATE(10, 33);
-            UPDATE(10, 34);
-            UPDATE(10, 35);
-            UPDATE(10, 36);
-            UPDATE(10, 37);
-            UPDATE(10, 38);
-            UPDATE(10, 39);
-            UPDATE(10, 40);
-            UPDATE(10, 41);
-            UPDATE(10, 42);
-            UPDATE(10, 43);
-            UPDATE(10, 44);
-// 11
-            UPDATE(11, 17);
-            UPDATE(11, 19);
-            UPDATE(11, 20);
-            UPDATE(11, 21);
-            UPDATE(11, 22);
-            UPDATE(11, 23);
-            UPDATE(11, 25);
-            UPDATE(11, 26);
-            UPDATE(11, 27);
-            UPDATE(11, 28);
-            UPDATE(11, 29);
-            UPDATE(11, 35);
-            UPDATE(11, 36);
-            UPDATE(11, 37);
-            UPDATE(11, 38);
-            UPDATE(11, 39);
-            UPDATE(11, 40);
-            UPDATE(11, 41);
-            UPDATE(11, 42);
-            UPDATE(11, 43);
-            UPDATE(11, 44);
-// 12
-            UPDATE(12, 17);
-            UPDATE(12, 18);
-            UPDATE(12, 20);
-            UPDATE(12, 21);
-            UPDATE(12, 22);
-            UPDATE(12, 23);
-            UPDATE(12, 24);
-            UPDATE(12, 26);
-            UPDATE(12, 27);
-            UPDATE(12, 28);
-            UPDATE(12, 29);
-            UPDATE(12, 31);
-            UPDATE(12, 32);
-            UPDATE(12, 33);
-            UPDATE(12, 34);
-            UPDATE(12, 39);
-            UPDATE(12, 40);
-            UPDATE(12, 41);
-            UPDATE(12, 42);
-            UPDATE(12, 43);
-            UPDATE(12, 44);
-// 13
-            UPDATE(13, 17);
-            UPDATE(13, 18);
-            UPDATE(13, 19);
-            UPDATE(13, 21);
-            UPDATE(13, 22);
-            UPDATE(13, 23);
-            UPDATE(13, 24);
-            UPDATE(13, 25);
-            UPDATE(13, 27);
-            UPDATE(13, 28);
-            UPDATE(13, 29);
-            UPDATE(13, 30);
-            UPDATE(13, 32);
-            UPDATE(13, 33);
-            UPDATE(13, 34);
-            UPDATE(13, 36);
-            UPDATE(13, 37);
-            UPDATE(13, 38);
-            UPDATE(13, 42);
-            UPDATE(13, 43);
-            UPDATE(13, 44);
-// 14
-            UPDATE(14, 17);
-            UPDATE(14, 18);
-            UPDATE(14, 19);
-            UPDATE(14, 20);
-            UPDATE(14, 22);
-            UPDATE(14, 23);
-            UPDATE(14, 24);
-            UPDATE(14, 25);
-            UPDATE(14, 26);
-            UPDATE(14, 28);
-            UPDATE(14, 29);
-            UPDATE(14, 30);
-            UPDATE(14, 31);
-            UPDATE(14, 33);
-            UPDATE(14, 34);
-            UPDATE(14, 35);
-            UPDATE(14, 37);
-            UPDATE(14, 38);
-            UPDATE(14, 40);
-            UPDATE(14, 41);
-            UPDATE(14, 44);
-// 15
-            UPDATE(15, 17);
-            UPDATE(15, 18);
-            UPDATE(15, 19);
-            UPDATE(15, 20);
-            UPDATE(15, 21);
-            UPDATE(15, 23);
-            UPDATE(15, 24);
-            UPDATE(15, 25);
-            UPDATE(15, 26);
-            UPDATE(15, 27);
-            UPDATE(15, 29);
-            UPDATE(15, 30);
-            UPDATE(15, 31);
-            UPDATE(15, 32);
-            UPDATE(15, 34);
-            UPDATE(15, 35);
-            UPDATE(15, 36);
-            UPDATE(15, 38);
-            UPDATE(15, 39);
-            UPDATE(15, 41);
-            UPDATE(15, 43);
-// 16
-            UPDATE(16, 17);
-            UPDATE(16, 18);
-            UPDATE(16, 19);
-            UPDATE(16, 20);
-            UPDATE(16, 21);
-            UPDATE(16, 22);
-            UPDATE(16, 24);
-            UPDATE(16, 25);
-            UPDATE(16, 26);
-            UPDATE(16, 27);
-            UPDATE(16, 28);
-            UPDATE(16, 30);
-            UPDATE(16, 31);
-            UPDATE(16, 32);
-            UPDATE(16, 33);
-            UPDATE(16, 35);
-            UPDATE(16, 36);
-            UPDATE(16, 37);
-            UPDATE(16, 39);
-            UPDATE(16, 40);
-            UPDATE(16, 42);
-// 17
-            UPDATE(17, 30);
-            UPDATE(17, 31);
-            UPDATE(17, 32);
-            UPDATE(17, 33);
-            UPDATE(17, 34);
-            UPDATE(17, 35);
-            UPDATE(17, 36);
-            UPDATE(17, 37);
-            UPDATE(17, 38);
-            UPDATE(17, 39);
-            UPDATE(17, 40);
-            UPDATE(17, 41);
-            UPDATE(17, 42);
-            UPDATE(17, 43);
-            UPDATE(17, 44);
-// 18
-            UPDATE(18, 25);
-            UPDATE(18, 26);
-            UPDATE(18, 27);
-            UPDATE(18, 28);
-            UPDATE(18, 29);
-            UPDATE(18, 35);
-            UPDATE(18, 36);
-            UPDATE(18, 37);
-            UPDATE(18, 38);
-            UPDATE(18, 39);
-            UPDATE(18, 40);
-            UPDATE(18, 41);
-            UPDATE(18, 42);
-            UPDATE(18, 43);
-            UPDATE(18, 44);
-// 19
-            UPDATE(19, 24);
-            UPDATE(19, 26);
-            UPDATE(19, 27);
-            UPDATE(19, 28);
-            UPDATE(19, 29);
-            UPDATE(19, 31);
-            UPDATE(19, 32);
-            UPDATE(19, 33);
-            UPDATE(19, 34);
-            UPDATE(19, 39);
-            UPDATE(19, 40);
-            UPDATE(19, 41);
-            UPDATE(19, 42);
-            UPDATE(19, 43);
-            UPDATE(19, 44);
-// 20
-            UPDATE(20, 24);
-            UPDATE(20, 25);
-            UPDATE(20, 27);
-            UPDATE(20, 28);
-            UPDATE(20, 29);
-            UPDATE(20, 30);
-            UPDATE(20, 32);
-            UPDATE(20, 33);
-            UPDATE(20, 34);
-            UPDATE(20, 36);
-            UPDATE(20, 37);
-            UPDATE(20, 38);
-            UPDATE(20, 42);
-            UPDATE(20, 43);
-            UPDATE(20, 44);
-// 21
-            UPDATE(21, 24);
-            UPDATE(21, 25);
-            UPDATE(21, 26);
-            UPDATE(21, 28);
-            UPDATE(21, 29);
-            UPDATE(21, 30);
-            UPDATE(21, 31);
-            UPDATE(21, 33);
-            UPDATE(21, 34);
-            UPDATE(21, 35);
-            UPDATE(21, 37);
-            UPDATE(21, 38);
-            UPDATE(21, 40);
-            UPDATE(21, 41);
-            UPDATE(21, 44);
-// 22
-            UPDATE(22, 24);
-            UPDATE(22, 25);
-            UPDATE(22, 26);
-            UPDATE(22, 27);
-            UPDATE(22, 29);
-            UPDATE(22, 30);
-            UPDATE(22, 31);
-            UPDATE(22, 32);
-            UPDATE(22, 34);
-            UPDATE(22, 35);
-            UPDATE(22, 36);
-            UPDATE(22, 38);
-            UPDATE(22, 39);
-            UPDATE(22, 41);
-            UPDATE(22, 43);
-// 23
-            UPDATE(23, 24);
-            UPDATE(23, 25);
-            UPDATE(23, 26);
-            UPDATE(23, 27);
-            UPDATE(23, 28);
-            UPDATE(23, 30);
-            UPDATE(23, 31);
-            UPDATE(23, 32);
-            UPDATE(23, 33);
-            UPDATE(23, 35);
-            UPDATE(23, 36);
-            UPDATE(23, 37);
-            UPDATE(23, 39);
-            UPDATE(23, 40);
-            UPDATE(23, 42);
-// 24
-            UPDATE(24, 35);
-            UPDATE(24, 36);
-            UPDATE(24, 37);
-            UPDATE(24, 38);
-            UPDATE(24, 39);
-            UPDATE(24, 40);
-            UPDATE(24, 41);
-            UPDATE(24, 42);
-            UPDATE(24, 43);
-            UPDATE(24, 44);
-// 25
-            UPDATE(25, 31);
-            UPDATE(25, 32);
-            UPDATE(25, 33);
-            UPDATE(25, 34);
-            UPDATE(25, 39);
-            UPDATE(25, 40);
-            UPDATE(25, 41);
-            UPDATE(25, 42);
-            UPDATE(25, 43);
-            UPDATE(25, 44);
-// 26
-            UPDATE(26, 30);
-            UPDATE(26, 32);
-            UPDATE(26, 33);
-            UPDATE(26, 34);
-            UPDATE(26, 36);
-            UPDATE(26, 37);
-            UPDATE(26, 38);
-            UPDATE(26, 42);
-            UPDATE(26, 43);
-            UPDATE(26, 44);
-// 27
-            UPDATE(27, 30);
-            UPDATE(27, 31);
-            UPDATE(27, 33);
-            UPDATE(27, 34);
-            UPDATE(27, 35);
-            UPDATE(27, 37);
-            UPDATE(27, 38);
-            UPDATE(27, 40);
-            UPDATE(27, 41);
-            UPDATE(27, 44);
-// 28
-            UPDATE(28, 30);
-            UPDATE(28, 31);
-            UPDATE(28, 32);
-            UPDATE(28, 34);
-            UPDATE(28, 35);
-            UPDATE(28, 36);
-            UPDATE(28, 38);
-            UPDATE(28, 39);
-            UPDATE(28, 41);
-            UPDATE(28, 43);
-// 29
-            UPDATE(29, 30);
-            UPDATE(29, 31);
-            UPDATE(29, 32);
-            UPDATE(29, 33);
-            UPDATE(29, 35);
-            UPDATE(29, 36);
-            UPDATE(29, 37);
-            UPDATE(29, 39);
-            UPDATE(29, 40);
-            UPDATE(29, 42);
-// 30
-            UPDATE(30, 39);
-            UPDATE(30, 40);
-            UPDATE(30, 41);
-            UPDATE(30, 42);
-            UPDATE(30, 43);
-            UPDATE(30, 44);
-// 31
-            UPDATE(31, 36);
-            UPDATE(31, 37);
-            UPDATE(31, 38);
-            UPDATE(31, 42);
-            UPDATE(31, 43);
-            UPDATE(31, 44);
-// 32
-            UPDATE(32, 35);
-            UPDATE(32, 37);
-            UPDATE(32, 38);
-            UPDATE(32, 40);
-            UPDATE(32, 41);
-            UPDATE(32, 44);
-// 33
-            UPDATE(33, 35);
-            UPDATE(33, 36);
-            UPDATE(33, 38);
-            UPDATE(33, 39);
-            UPDATE(33, 41);
-            UPDATE(33, 43);
-// 34
-            UPDATE(34, 35);
-            UPDATE(34, 36);
-            UPDATE(34, 37);
-            UPDATE(34, 39);
-            UPDATE(34, 40);
-            UPDATE(34, 42);
-// 35
-            UPDATE(35, 42);
-            UPDATE(35, 43);
-            UPDATE(35, 44);
-// 36
-            UPDATE(36, 40);
-            UPDATE(36, 41);
-            UPDATE(36, 44);
-// 37
-            UPDATE(37, 39);
-            UPDATE(37, 41);
-            UPDATE(37, 43);
-// 38
-            UPDATE(38, 39);
-            UPDATE(38, 40);
-            UPDATE(38, 42);
-// 39
-            UPDATE(39, 44);
-// 40
-            UPDATE(40, 43);
-// 41
-            UPDATE(41, 42);
-// 42
-// 43
-// 44
+        const uint8_t *sets = valid_sets.get(n_nodes, 2);
+        const size_t n_sets = valid_sets_count(n_nodes, 2);
+        if (n_sets > 0) {
+            TypeSF best_sum;
+            size_t best_idx = lookup_best_set(sets, n_sets, 2, 0, best_sum);
+            if (best_sum > edges[best_i].weight + edges[best_j].weight) {
+                best_i = sets[best_idx];
+                best_j = sets[n_sets + best_idx];
+            }
         }
 
         v_s.push_back(edges[best_i].n1 + offset, edges[best_i].n2 + offset);
@@ -2012,931 +573,24 @@ public:
      * @param offset Offset for vertex conversion.
      * @return The sum of the weights of the edges in the subset that provides the upper bound.
      */
-    TypeSF four_endpoints_10_skip_first(VectorOfVectors<size_t> &v_s, std::vector<TypeSF> &w_s, size_t offset) {
+    TypeSF four_endpoints_lookup_skip_first(VectorOfVectors<size_t> &v_s, std::vector<TypeSF> &w_s, size_t offset) {
         ASSERT(v_s.size == 0);
         ASSERT(w_s.empty());
         ASSERT(n_nodes >= 4);
-        ASSERT(n_nodes <= 10);
+        ASSERT(n_nodes - 1 <= valid_sets_max_n);
 
         size_t best_i = n_nodes, best_j = n_edges - 1;
 
-        if (n_nodes == 5) {
-// 0
-// 1
-// 2
-// 3
-// 4
-            UPDATE(4, 9)
-// 5
-            UPDATE(5, 8)
-// 6
-            UPDATE(6, 7)
-// 7
-// 8
-// 9
-        } else if (n_nodes == 6) {
-// 0
-// 1
-// 2
-// 3
-// 4
-// 5
-            UPDATE(5, 12)
-            UPDATE(5, 13)
-            UPDATE(5, 14)
-// 6
-            UPDATE(6, 10)
-            UPDATE(6, 11)
-            UPDATE(6, 14)
-// 7
-            UPDATE(7, 9)
-            UPDATE(7, 11)
-            UPDATE(7, 13)
-// 8
-            UPDATE(8, 9)
-            UPDATE(8, 10)
-            UPDATE(8, 12)
-// 9
-            UPDATE(9, 14)
-// 10
-            UPDATE(10, 13)
-// 11
-            UPDATE(11, 12)
-// 12
-// 13
-// 14
-        } else if (n_nodes == 7) {
-// 0
-// 1
-// 2
-// 3
-// 4
-// 5
-// 6
-            UPDATE(6, 15)
-            UPDATE(6, 16)
-            UPDATE(6, 17)
-            UPDATE(6, 18)
-            UPDATE(6, 19)
-            UPDATE(6, 20)
-// 7
-            UPDATE(7, 12)
-            UPDATE(7, 13)
-            UPDATE(7, 14)
-            UPDATE(7, 18)
-            UPDATE(7, 19)
-            UPDATE(7, 20)
-// 8
-            UPDATE(8, 11)
-            UPDATE(8, 13)
-            UPDATE(8, 14)
-            UPDATE(8, 16)
-            UPDATE(8, 17)
-            UPDATE(8, 20)
-// 9
-            UPDATE(9, 11)
-            UPDATE(9, 12)
-            UPDATE(9, 14)
-            UPDATE(9, 15)
-            UPDATE(9, 17)
-            UPDATE(9, 19)
-// 10
-            UPDATE(10, 11)
-            UPDATE(10, 12)
-            UPDATE(10, 13)
-            UPDATE(10, 15)
-            UPDATE(10, 16)
-            UPDATE(10, 18)
-// 11
-            UPDATE(11, 18)
-            UPDATE(11, 19)
-            UPDATE(11, 20)
-// 12
-            UPDATE(12, 16)
-            UPDATE(12, 17)
-            UPDATE(12, 20)
-// 13
-            UPDATE(13, 15)
-            UPDATE(13, 17)
-            UPDATE(13, 19)
-// 14
-            UPDATE(14, 15)
-            UPDATE(14, 16)
-            UPDATE(14, 18)
-// 15
-            UPDATE(15, 20)
-// 16
-            UPDATE(16, 19)
-// 17
-            UPDATE(17, 18)
-// 18
-// 19
-// 20
-        } else if (n_nodes == 8) {
-// 0
-// 1
-// 2
-// 3
-// 4
-// 5
-// 6
-// 7
-            UPDATE(7, 18)
-            UPDATE(7, 19)
-            UPDATE(7, 20)
-            UPDATE(7, 21)
-            UPDATE(7, 22)
-            UPDATE(7, 23)
-            UPDATE(7, 24)
-            UPDATE(7, 25)
-            UPDATE(7, 26)
-            UPDATE(7, 27)
-// 8
-            UPDATE(8, 14)
-            UPDATE(8, 15)
-            UPDATE(8, 16)
-            UPDATE(8, 17)
-            UPDATE(8, 22)
-            UPDATE(8, 23)
-            UPDATE(8, 24)
-            UPDATE(8, 25)
-            UPDATE(8, 26)
-            UPDATE(8, 27)
-// 9
-            UPDATE(9, 13)
-            UPDATE(9, 15)
-            UPDATE(9, 16)
-            UPDATE(9, 17)
-            UPDATE(9, 19)
-            UPDATE(9, 20)
-            UPDATE(9, 21)
-            UPDATE(9, 25)
-            UPDATE(9, 26)
-            UPDATE(9, 27)
-// 10
-            UPDATE(10, 13)
-            UPDATE(10, 14)
-            UPDATE(10, 16)
-            UPDATE(10, 17)
-            UPDATE(10, 18)
-            UPDATE(10, 20)
-            UPDATE(10, 21)
-            UPDATE(10, 23)
-            UPDATE(10, 24)
-            UPDATE(10, 27)
-// 11
-            UPDATE(11, 13)
-            UPDATE(11, 14)
-            UPDATE(11, 15)
-            UPDATE(11, 17)
-            UPDATE(11, 18)
-            UPDATE(11, 19)
-            UPDATE(11, 21)
-            UPDATE(11, 22)
-            UPDATE(11, 24)
-            UPDATE(11, 26)
-// 12
-            UPDATE(12, 13)
-            UPDATE(12, 14)
-            UPDATE(12, 15)
-            UPDATE(12, 16)
-            UPDATE(12, 18)
-            UPDATE(12, 19)
-            UPDATE(12, 20)
-            UPDATE(12, 22)
-            UPDATE(12, 23)
-            UPDATE(12, 25)
-// 13
-            UPDATE(13, 22)
-            UPDATE(13, 23)
-            UPDATE(13, 24)
-            UPDATE(13, 25)
-            UPDATE(13, 26)
-            UPDATE(13, 27)
-// 14
-            UPDATE(14, 19)
-            UPDATE(14, 20)
-            UPDATE(14, 21)
-            UPDATE(14, 25)
-            UPDATE(14, 26)
-            UPDATE(14, 27)
-// 15
-            UPDATE(15, 18)
-            UPDATE(15, 20)
-            UPDATE(15, 21)
-            UPDATE(15, 23)
-            UPDATE(15, 24)
-            UPDATE(15, 27)
-// 16
-            UPDATE(16, 18)
-            UPDATE(16, 19)
-            UPDATE(16, 21)
-            UPDATE(16, 22)
-            UPDATE(16, 24)
-            UPDATE(16, 26)
-// 17
-            UPDATE(17, 18)
-            UPDATE(17, 19)
-            UPDATE(17, 20)
-            UPDATE(17, 22)
-            UPDATE(17, 23)
-            UPDATE(17, 25)
-// 18
-            UPDATE(18, 25)
-            UPDATE(18, 26)
-            UPDATE(18, 27)
-// 19
-            UPDATE(19, 23)
-            UPDATE(19, 24)
-            UPDATE(19, 27)
-// 20
-            UPDATE(20, 22)
-            UPDATE(20, 24)
-            UPDATE(20, 26)
-// 21
-            UPDATE(21, 22)
-            UPDATE(21, 23)
-            UPDATE(21, 25)
-// 22
-            UPDATE(22, 27)
-// 23
-            UPDATE(23, 26)
-// 24
-            UPDATE(24, 25)
-// 25
-// 26
-// 27
-        } else if (n_nodes == 9) {
-// 0
-// 1
-// 2
-// 3
-// 4
-// 5
-// 6
-// 7
-// 8
-            UPDATE(8, 21)
-            UPDATE(8, 22)
-            UPDATE(8, 23)
-            UPDATE(8, 24)
-            UPDATE(8, 25)
-            UPDATE(8, 26)
-            UPDATE(8, 27)
-            UPDATE(8, 28)
-            UPDATE(8, 29)
-            UPDATE(8, 30)
-            UPDATE(8, 31)
-            UPDATE(8, 32)
-            UPDATE(8, 33)
-            UPDATE(8, 34)
-            UPDATE(8, 35)
-// 9
-            UPDATE(9, 16)
-            UPDATE(9, 17)
-            UPDATE(9, 18)
-            UPDATE(9, 19)
-            UPDATE(9, 20)
-            UPDATE(9, 26)
-            UPDATE(9, 27)
-            UPDATE(9, 28)
-            UPDATE(9, 29)
-            UPDATE(9, 30)
-            UPDATE(9, 31)
-            UPDATE(9, 32)
-            UPDATE(9, 33)
-            UPDATE(9, 34)
-            UPDATE(9, 35)
-// 10
-            UPDATE(10, 15)
-            UPDATE(10, 17)
-            UPDATE(10, 18)
-            UPDATE(10, 19)
-            UPDATE(10, 20)
-            UPDATE(10, 22)
-            UPDATE(10, 23)
-            UPDATE(10, 24)
-            UPDATE(10, 25)
-            UPDATE(10, 30)
-            UPDATE(10, 31)
-            UPDATE(10, 32)
-            UPDATE(10, 33)
-            UPDATE(10, 34)
-            UPDATE(10, 35)
-// 11
-            UPDATE(11, 15)
-            UPDATE(11, 16)
-            UPDATE(11, 18)
-            UPDATE(11, 19)
-            UPDATE(11, 20)
-            UPDATE(11, 21)
-            UPDATE(11, 23)
-            UPDATE(11, 24)
-            UPDATE(11, 25)
-            UPDATE(11, 27)
-            UPDATE(11, 28)
-            UPDATE(11, 29)
-            UPDATE(11, 33)
-            UPDATE(11, 34)
-            UPDATE(11, 35)
-// 12
-            UPDATE(12, 15)
-            UPDATE(12, 16)
-            UPDATE(12, 17)
-            UPDATE(12, 19)
-            UPDATE(12, 20)
-            UPDATE(12, 21)
-            UPDATE(12, 22)
-            UPDATE(12, 24)
-            UPDATE(12, 25)
-            UPDATE(12, 26)
-            UPDATE(12, 28)
-            UPDATE(12, 29)
-            UPDATE(12, 31)
-            UPDATE(12, 32)
-            UPDATE(12, 35)
-// 13
-            UPDATE(13, 15)
-            UPDATE(13, 16)
-            UPDATE(13, 17)
-            UPDATE(13, 18)
-            UPDATE(13, 20)
-            UPDATE(13, 21)
-            UPDATE(13, 22)
-            UPDATE(13, 23)
-            UPDATE(13, 25)
-            UPDATE(13, 26)
-            UPDATE(13, 27)
-            UPDATE(13, 29)
-            UPDATE(13, 30)
-            UPDATE(13, 32)
-            UPDATE(13, 34)
-// 14
-            UPDATE(14, 15)
-            UPDATE(14, 16)
-            UPDATE(14, 17)
-            UPDATE(14, 18)
-            UPDATE(14, 19)
-            UPDATE(14, 21)
-            UPDATE(14, 22)
-            UPDATE(14, 23)
-            UPDATE(14, 24)
-            UPDATE(14, 26)
-            UPDATE(14, 27)
-            UPDATE(14, 28)
-            UPDATE(14, 30)
-            UPDATE(14, 31)
-            UPDATE(14, 33)
-// 15
-            UPDATE(15, 26)
-            UPDATE(15, 27)
-            UPDATE(15, 28)
-            UPDATE(15, 29)
-            UPDATE(15, 30)
-            UPDATE(15, 31)
-            UPDATE(15, 32)
-            UPDATE(15, 33)
-            UPDATE(15, 34)
-            UPDATE(15, 35)
-// 16
-            UPDATE(16, 22)
-            UPDATE(16, 23)
-            UPDATE(16, 24)
-            UPDATE(16, 25)
-            UPDATE(16, 30)
-            UPDATE(16, 31)
-            UPDATE(16, 32)
-            UPDATE(16, 33)
-            UPDATE(16, 34)
-            UPDATE(16, 35)
-// 17
-            UPDATE(17, 21)
-            UPDATE(17, 23)
-            UPDATE(17, 24)
-            UPDATE(17, 25)
-            UPDATE(17, 27)
-            UPDATE(17, 28)
-            UPDATE(17, 29)
-            UPDATE(17, 33)
-            UPDATE(17, 34)
-            UPDATE(17, 35)
-// 18
-            UPDATE(18, 21)
-            UPDATE(18, 22)
-            UPDATE(18, 24)
-            UPDATE(18, 25)
-            UPDATE(18, 26)
-            UPDATE(18, 28)
-            UPDATE(18, 29)
-            UPDATE(18, 31)
-            UPDATE(18, 32)
-            UPDATE(18, 35)
-// 19
-            UPDATE(19, 21)
-            UPDATE(19, 22)
-            UPDATE(19, 23)
-            UPDATE(19, 25)
-            UPDATE(19, 26)
-            UPDATE(19, 27)
-            UPDATE(19, 29)
-            UPDATE(19, 30)
-            UPDATE(19, 32)
-            UPDATE(19, 34)
-// 20
-            UPDATE(20, 21)
-            UPDATE(20, 22)
-            UPDATE(20, 23)
-            UPDATE(20, 24)
-            UPDATE(20, 26)
-            UPDATE(20, 27)
-            UPDATE(20, 28)
-            UPDATE(20, 30)
-            UPDATE(20, 31)
-            UPDATE(20, 33)
-// 21
-            UPDATE(21, 30)
-            UPDATE(21, 31)
-            UPDATE(21, 32)
-            UPDATE(21, 33)
-            UPDATE(21, 34)
-            UPDATE(21, 35)
-// 22
-            UPDATE(22, 27)
-            UPDATE(22, 28)
-            UPDATE(22, 29)
-            UPDATE(22, 33)
-            UPDATE(22, 34)
-            UPDATE(22, 35)
-// 23
-            UPDATE(23, 26)
-            UPDATE(23, 28)
-            UPDATE(23, 29)
-            UPDATE(23, 31)
-            UPDATE(23, 32)
-            UPDATE(23, 35)
-// 24
-            UPDATE(24, 26)
-            UPDATE(24, 27)
-            UPDATE(24, 29)
-            UPDATE(24, 30)
-            UPDATE(24, 32)
-            UPDATE(24, 34)
-// 25
-            UPDATE(25, 26)
-            UPDATE(25, 27)
-            UPDATE(25, 28)
-            UPDATE(25, 30)
-            UPDATE(25, 31)
-            UPDATE(25, 33)
-// 26
-            UPDATE(26, 33)
-            UPDATE(26, 34)
-            UPDATE(26, 35)
-// 27
-            UPDATE(27, 31)
-            UPDATE(27, 32)
-            UPDATE(27, 35)
-// 28
-            UPDATE(28, 30)
-            UPDATE(28, 32)
-            UPDATE(28, 34)
-// 29
-            UPDATE(29, 30)
-            UPDATE(29, 31)
-            UPDATE(29, 33)
-// 30
-            UPDATE(30, 35)
-// 31
-            UPDATE(31, 34)
-// 32
-            UPDATE(32, 33)
-// 33
-// 34
-// 35
-        } else if (n_nodes == 10) {
-// 0
-// 1
-// 2
-// 3
-// 4
-// 5
-// 6
-// 7
-// 8
-// 9
-            UPDATE(9, 24)
-            UPDATE(9, 25)
-            UPDATE(9, 26)
-            UPDATE(9, 27)
-            UPDATE(9, 28)
-            UPDATE(9, 29)
-            UPDATE(9, 30)
-            UPDATE(9, 31)
-            UPDATE(9, 32)
-            UPDATE(9, 33)
-            UPDATE(9, 34)
-            UPDATE(9, 35)
-            UPDATE(9, 36)
-            UPDATE(9, 37)
-            UPDATE(9, 38)
-            UPDATE(9, 39)
-            UPDATE(9, 40)
-            UPDATE(9, 41)
-            UPDATE(9, 42)
-            UPDATE(9, 43)
-            UPDATE(9, 44)
-// 10
-            UPDATE(10, 18)
-            UPDATE(10, 19)
-            UPDATE(10, 20)
-            UPDATE(10, 21)
-            UPDATE(10, 22)
-            UPDATE(10, 23)
-            UPDATE(10, 30)
-            UPDATE(10, 31)
-            UPDATE(10, 32)
-            UPDATE(10, 33)
-            UPDATE(10, 34)
-            UPDATE(10, 35)
-            UPDATE(10, 36)
-            UPDATE(10, 37)
-            UPDATE(10, 38)
-            UPDATE(10, 39)
-            UPDATE(10, 40)
-            UPDATE(10, 41)
-            UPDATE(10, 42)
-            UPDATE(10, 43)
-            UPDATE(10, 44)
-// 11
-            UPDATE(11, 17)
-            UPDATE(11, 19)
-            UPDATE(11, 20)
-            UPDATE(11, 21)
-            UPDATE(11, 22)
-            UPDATE(11, 23)
-            UPDATE(11, 25)
-            UPDATE(11, 26)
-            UPDATE(11, 27)
-            UPDATE(11, 28)
-            UPDATE(11, 29)
-            UPDATE(11, 35)
-            UPDATE(11, 36)
-            UPDATE(11, 37)
-            UPDATE(11, 38)
-            UPDATE(11, 39)
-            UPDATE(11, 40)
-            UPDATE(11, 41)
-            UPDATE(11, 42)
-            UPDATE(11, 43)
-            UPDATE(11, 44)
-// 12
-            UPDATE(12, 17)
-            UPDATE(12, 18)
-            UPDATE(12, 20)
-            UPDATE(12, 21)
-            UPDATE(12, 22)
-            UPDATE(12, 23)
-            UPDATE(12, 24)
-            UPDATE(12, 26)
-            UPDATE(12, 27)
-            UPDATE(12, 28)
-            UPDATE(12, 29)
-            UPDATE(12, 31)
-            UPDATE(12, 32)
-            UPDATE(12, 33)
-            UPDATE(12, 34)
-            UPDATE(12, 39)
-            UPDATE(12, 40)
-            UPDATE(12, 41)
-            UPDATE(12, 42)
-            UPDATE(12, 43)
-            UPDATE(12, 44)
-// 13
-            UPDATE(13, 17)
-            UPDATE(13, 18)
-            UPDATE(13, 19)
-            UPDATE(13, 21)
-            UPDATE(13, 22)
-            UPDATE(13, 23)
-            UPDATE(13, 24)
-            UPDATE(13, 25)
-            UPDATE(13, 27)
-            UPDATE(13, 28)
-            UPDATE(13, 29)
-            UPDATE(13, 30)
-            UPDATE(13, 32)
-            UPDATE(13, 33)
-            UPDATE(13, 34)
-            UPDATE(13, 36)
-            UPDATE(13, 37)
-            UPDATE(13, 38)
-            UPDATE(13, 42)
-            UPDATE(13, 43)
-            UPDATE(13, 44)
-// 14
-            UPDATE(14, 17)
-            UPDATE(14, 18)
-            UPDATE(14, 19)
-            UPDATE(14, 20)
-            UPDATE(14, 22)
-            UPDATE(14, 23)
-            UPDATE(14, 24)
-            UPDATE(14, 25)
-            UPDATE(14, 26)
-            UPDATE(14, 28)
-            UPDATE(14, 29)
-            UPDATE(14, 30)
-            UPDATE(14, 31)
-            UPDATE(14, 33)
-            UPDATE(14, 34)
-            UPDATE(14, 35)
-            UPDATE(14, 37)
-            UPDATE(14, 38)
-            UPDATE(14, 40)
-            UPDATE(14, 41)
-            UPDATE(14, 44)
-// 15
-            UPDATE(15, 17)
-            UPDATE(15, 18)
-            UPDATE(15, 19)
-            UPDATE(15, 20)
-            UPDATE(15, 21)
-            UPDATE(15, 23)
-            UPDATE(15, 24)
-            UPDATE(15, 25)
-            UPDATE(15, 26)
-            UPDATE(15, 27)
-            UPDATE(15, 29)
-            UPDATE(15, 30)
-            UPDATE(15, 31)
-            UPDATE(15, 32)
-            UPDATE(15, 34)
-            UPDATE(15, 35)
-            UPDATE(15, 36)
-            UPDATE(15, 38)
-            UPDATE(15, 39)
-            UPDATE(15, 41)
-            UPDATE(15, 43)
-// 16
-            UPDATE(16, 17)
-            UPDATE(16, 18)
-            UPDATE(16, 19)
-            UPDATE(16, 20)
-            UPDATE(16, 21)
-            UPDATE(16, 22)
-            UPDATE(16, 24)
-            UPDATE(16, 25)
-            UPDATE(16, 26)
-            UPDATE(16, 27)
-            UPDATE(16, 28)
-            UPDATE(16, 30)
-            UPDATE(16, 31)
-            UPDATE(16, 32)
-            UPDATE(16, 33)
-            UPDATE(16, 35)
-            UPDATE(16, 36)
-            UPDATE(16, 37)
-            UPDATE(16, 39)
-            UPDATE(16, 40)
-            UPDATE(16, 42)
-// 17
-            UPDATE(17, 30)
-            UPDATE(17, 31)
-            UPDATE(17, 32)
-            UPDATE(17, 33)
-            UPDATE(17, 34)
-            UPDATE(17, 35)
-            UPDATE(17, 36)
-            UPDATE(17, 37)
-            UPDATE(17, 38)
-            UPDATE(17, 39)
-            UPDATE(17, 40)
-            UPDATE(17, 41)
-            UPDATE(17, 42)
-            UPDATE(17, 43)
-            UPDATE(17, 44)
-// 18
-            UPDATE(18, 25)
-            UPDATE(18, 26)
-            UPDATE(18, 27)
-            UPDATE(18, 28)
-            UPDATE(18, 29)
-            UPDATE(18, 35)
-            UPDATE(18, 36)
-            UPDATE(18, 37)
-            UPDATE(18, 38)
-            UPDATE(18, 39)
-            UPDATE(18, 40)
-            UPDATE(18, 41)
-            UPDATE(18, 42)
-            UPDATE(18, 43)
-            UPDATE(18, 44)
-// 19
-            UPDATE(19, 24)
-            UPDATE(19, 26)
-            UPDATE(19, 27)
-            UPDATE(19, 28)
-            UPDATE(19, 29)
-            UPDATE(19, 31)
-            UPDATE(19, 32)
-            UPDATE(19, 33)
-            UPDATE(19, 34)
-            UPDATE(19, 39)
-            UPDATE(19, 40)
-            UPDATE(19, 41)
-            UPDATE(19, 42)
-            UPDATE(19, 43)
-            UPDATE(19, 44)
-// 20
-            UPDATE(20, 24)
-            UPDATE(20, 25)
-            UPDATE(20, 27)
-            UPDATE(20, 28)
-            UPDATE(20, 29)
-            UPDATE(20, 30)
-            UPDATE(20, 32)
-            UPDATE(20, 33)
-            UPDATE(20, 34)
-            UPDATE(20, 36)
-            UPDATE(20, 37)
-            UPDATE(20, 38)
-            UPDATE(20, 42)
-            UPDATE(20, 43)
-            UPDATE(20, 44)
-// 21
-            UPDATE(21, 24)
-            UPDATE(21, 25)
-            UPDATE(21, 26)
-            UPDATE(21, 28)
-            UPDATE(21, 29)
-            UPDATE(21, 30)
-            UPDATE(21, 31)
-            UPDATE(21, 33)
-            UPDATE(21, 34)
-            UPDATE(21, 35)
-            UPDATE(21, 37)
-            UPDATE(21, 38)
-            UPDATE(21, 40)
-            UPDATE(21, 41)
-            UPDATE(21, 44)
-// 22
-            UPDATE(22, 24)
-            UPDATE(22, 25)
-            UPDATE(22, 26)
-            UPDATE(22, 27)
-            UPDATE(22, 29)
-            UPDATE(22, 30)
-            UPDATE(22, 31)
-            UPDATE(22, 32)
-            UPDATE(22, 34)
-            UPDATE(22, 35)
-            UPDATE(22, 36)
-            UPDATE(22, 38)
-            UPDATE(22, 39)
-            UPDATE(22, 41)
-            UPDATE(22, 43)
-// 23
-            UPDATE(23, 24)
-            UPDATE(23, 25)
-            UPDATE(23, 26)
-            UPDATE(23, 27)
-            UPDATE(23, 28)
-            UPDATE(23, 30)
-            UPDATE(23, 31)
-            UPDATE(23, 32)
-            UPDATE(23, 33)
-            UPDATE(23, 35)
-            UPDATE(23, 36)
-            UPDATE(23, 37)
-            UPDATE(23, 39)
-            UPDATE(23, 40)
-            UPDATE(23, 42)
-// 24
-            UPDATE(24, 35)
-            UPDATE(24, 36)
-            UPDATE(24, 37)
-            UPDATE(24, 38)
-            UPDATE(24, 39)
-            UPDATE(24, 40)
-            UPDATE(24, 41)
-            UPDATE(24, 42)
-            UPDATE(24, 43)
-            UPDATE(24, 44)
-// 25
-            UPDATE(25, 31)
-            UPDATE(25, 32)
-            UPDATE(25, 33)
-            UPDATE(25, 34)
-            UPDATE(25, 39)
-            UPDATE(25, 40)
-            UPDATE(25, 41)
-            UPDATE(25, 42)
-            UPDATE(25, 43)
-            UPDATE(25, 44)
-// 26
-            UPDATE(26, 30)
-            UPDATE(26, 32)
-            UPDATE(26, 33)
-            UPDATE(26, 34)
-            UPDATE(26, 36)
-            UPDATE(26, 37)
-            UPDATE(26, 38)
-            UPDATE(26, 42)
-            UPDATE(26, 43)
-            UPDATE(26, 44)
-// 27
-            UPDATE(27, 30)
-            UPDATE(27, 31)
-            UPDATE(27, 33)
-            UPDATE(27, 34)
-            UPDATE(27, 35)
-            UPDATE(27, 37)
-            UPDATE(27, 38)
-            UPDATE(27, 40)
-            UPDATE(27, 41)
-            UPDATE(27, 44)
-// 28
-            UPDATE(28, 30)
-            UPDATE(28, 31)
-            UPDATE(28, 32)
-            UPDATE(28, 34)
-            UPDATE(28, 35)
-            UPDATE(28, 36)
-            UPDATE(28, 38)
-            UPDATE(28, 39)
-            UPDATE(28, 41)
-            UPDATE(28, 43)
-// 29
-            UPDATE(29, 30)
-            UPDATE(29, 31)
-            UPDATE(29, 32)
-            UPDATE(29, 33)
-            UPDATE(29, 35)
-            UPDATE(29, 36)
-            UPDATE(29, 37)
-            UPDATE(29, 39)
-            UPDATE(29, 40)
-            UPDATE(29, 42)
-// 30
-            UPDATE(30, 39)
-            UPDATE(30, 40)
-            UPDATE(30, 41)
-            UPDATE(30, 42)
-            UPDATE(30, 43)
-            UPDATE(30, 44)
-// 31
-            UPDATE(31, 36)
-            UPDATE(31, 37)
-            UPDATE(31, 38)
-            UPDATE(31, 42)
-            UPDATE(31, 43)
-            UPDATE(31, 44)
-// 32
-            UPDATE(32, 35)
-            UPDATE(32, 37)
-            UPDATE(32, 38)
-            UPDATE(32, 40)
-            UPDATE(32, 41)
-            UPDATE(32, 44)
-// 33
-            UPDATE(33, 35)
-            UPDATE(33, 36)
-            UPDATE(33, 38)
-            UPDATE(33, 39)
-            UPDATE(33, 41)
-            UPDATE(33, 43)
-// 34
-            UPDATE(34, 35)
-            UPDATE(34, 36)
-            UPDATE(34, 37)
-            UPDATE(34, 39)
-            UPDATE(34, 40)
-            UPDATE(34, 42)
-// 35
-            UPDATE(35, 42)
-            UPDATE(35, 43)
-            UPDATE(35, 44)
-// 36
-            UPDATE(36, 40)
-            UPDATE(36, 41)
-            UPDATE(36, 44)
-// 37
-            UPDATE(37, 39)
-            UPDATE(37, 41)
-            UPDATE(37, 43)
-// 38
-            UPDATE(38, 39)
-            UPDATE(38, 40)
-            UPDATE(38, 42)
-// 39
-            UPDATE(39, 44)
-// 40
-            UPDATE(40, 43)
-// 41
-            UPDATE(41, 42)
-// 42
-// 43
-// 44
+        // the clique without the first node starts at edge n_nodes - 1
+        const uint8_t *sets = valid_sets.get(n_nodes - 1, 2);
+        const size_t n_sets = valid_sets_count(n_nodes - 1, 2);
+        if (n_sets > 0) {
+            TypeSF best_sum;
+            size_t best_idx = lookup_best_set(sets, n_sets, 2, n_nodes - 1, best_sum);
+            if (best_sum > edges[best_i].weight + edges[best_j].weight) {
+                best_i = n_nodes - 1 + sets[best_idx];
+                best_j = n_nodes - 1 + sets[n_sets + best_idx];
+            }
         }
 
         v_s.push_back(edges[best_i].n1 + offset, edges[best_i].n2 + offset);
@@ -3034,63 +688,125 @@ public:
     }
 
     /**
-     * Gets a maximum weight matching.
+     * Solves the matching problem on the clique without the first n_skip nodes,
+     * such that n_endpoints / 2 clique edges are chosen. The instance is built
+     * on the first call. Later calls only update the costs of the clique edges
+     * (if the weights changed) and switch the pair edges, so Blossom V starts
+     * from the previous dual solution.
      *
-     * @param v_s Vector containing vertices representing edges (two per edge).
-     * @param w_s Vector storing weights for each edge.
+     * @param wm The matching instance.
+     * @param n_skip Number of nodes at the start that are not part of the clique (0 or 1).
      * @param n_endpoints Number of endpoints in the clique (selecting n_endpoints / 2 edges).
-     * @param offset Offset for vertex conversion.
-     * @return The sum of the weights.
      */
-    TypeSF get_upper_bound_matching(VectorOfVectors<size_t> &v_s, std::vector<TypeSF> &w_s, size_t n_endpoints, size_t offset) {
-        ASSERT(v_s.size == 0);
-        ASSERT(w_s.empty());
-
-        size_t dummy_n_nodes = n_nodes;
-        size_t dummy_n_edges = dummy_n_nodes * n_nodes + ((1 + dummy_n_nodes) / 2);
-        size_t total_n_nodes = n_nodes + dummy_n_nodes;
-        size_t total_n_edges = n_edges + dummy_n_edges;
-
-        // create the graph if not already created
-        if (pm == nullptr) {
-            pm_last_n_endpoints = 0;
+    void solve_warm_matching(WarmMatching &wm, size_t n_skip, size_t n_endpoints) {
+        const size_t clique_n_nodes = n_nodes - n_skip;
+        const double pair_on = -(double) (2 * max_weight + 3);
+        const double pair_off = -pair_on;
+
+        // the edges must come in the same order, otherwise rebuild
+        if (wm.pm != nullptr && !wm.synced) {
+            for (size_t e = 0; e < wm.n_clique_edges; ++e) {
+                const Edge<TypeSF> &edge = edges[wm.clique_edge_idx[e]];
+                if (wm.clique_edge_idx[e] >= edges_size || edge.n1 != wm.clique_n1[e] || edge.n2 != wm.clique_n2[e]) {
+                    wm.reset();
+                    break;
+                }
+            }
+        }
 
-            // create the structure
-            pm = new PerfectMatching(total_n_nodes, total_n_edges);
-            pm->options = options;
+        if (wm.pm == nullptr) {
+            const size_t dummy_n_nodes = clique_n_nodes;
+            wm.n_clique_nodes = clique_n_nodes;
+            wm.n_pairs = dummy_n_nodes / 2;
 
-            // add the clique
-            for (size_t i = 0; i < n_edges; ++i) {
-                pm->AddEdge(edges[i].n1, edges[i].n2, -(double) edges[i].weight);
+            wm.clique_edge_idx.clear();
+            wm.clique_n1.clear();
+            wm.clique_n2.clear();
+            for (size_t i = 0; i < edges_size; ++i) {
+                if (edges[i].n1 < n_skip || edges[i].n2 < n_skip) {
+                    continue;
+                }
+                wm.clique_edge_idx.push_back(i);
+                wm.clique_n1.push_back(edges[i].n1);
+                wm.clique_n2.push_back(edges[i].n2);
+            }
+            wm.n_clique_edges = wm.clique_edge_idx.size();
+            wm.clique_cost.resize(wm.n_clique_edges);
+            wm.pair_cost.resize(wm.n_pairs);
+
+            size_t total_n_nodes = clique_n_nodes + dummy_n_nodes;
+            size_t total_n_edges = wm.n_clique_edges + dummy_n_nodes * clique_n_nodes + wm.n_pairs;
+            wm.pm = new PerfectMatching((int) total_n_nodes, (int) total_n_edges);
+            wm.pm->options = options;
+
+            // add the clique, edge ids 0, ..., n_clique_edges - 1
+            for (size_t e = 0; e < wm.n_clique_edges; ++e) {
+                const Edge<TypeSF> &edge = edges[wm.clique_edge_idx[e]];
+                wm.clique_cost[e] = -(double) edge.weight;
+                wm.pm->AddEdge((int) (edge.n1 - n_skip), (int) (edge.n2 - n_skip), wm.clique_cost[e]);
             }
 
             // add all dummy edges
             for (size_t i = 0; i < dummy_n_nodes; ++i) {
-                for (int j = 0; j < (int) n_nodes; ++j) {
-                    pm->AddEdge(n_nodes + i, j, -(double) (max_weight + 1));
+                for (size_t j = 0; j < clique_n_nodes; ++j) {
+                    wm.pm->AddEdge((int) (clique_n_nodes + i), (int) j, 0.0);
                 }
             }
 
-            // add the edges normally
-            for (size_t i = 0; i < n_endpoints / 2; ++i) {
-                pm->AddEdge(n_nodes + (2 * i), n_nodes + (2 * i) + 1, -(double) (2 * max_weight + 3));
+            // add the pair edges, edge ids follow the dummy edges
+            for (size_t i = 0; i < wm.n_pairs; ++i) {
+                wm.pair_cost[i] = i < n_endpoints / 2 ? pair_on : pair_off;
+                wm.pm->AddEdge((int) (clique_n_nodes + (2 * i)), (int) (clique_n_nodes + (2 * i) + 1), wm.pair_cost[i]);
             }
+            wm.synced = true;
         } else {
             // update the graph
-            pm->StartUpdate();
-            for (size_t i = pm_last_n_endpoints / 2; i < n_endpoints / 2; ++i) {
-                pm->AddNewEdge(n_nodes + (2 * i), n_nodes + (2 * i) + 1, -(double) (2 * max_weight + 3), false);
+            wm.pm->StartUpdate();
+            if (!wm.synced) {
+                for (size_t e = 0; e < wm.n_clique_edges; ++e) {
+                    double cost = -(double) edges[wm.clique_edge_idx[e]].weight;
+                    if (cost != wm.clique_cost[e]) {
+                        wm.pm->UpdateCost((int) e, cost - wm.clique_cost[e]);
+                        wm.clique_cost[e] = cost;
+                    }
+                }
+                wm.synced = true;
             }
-            pm->FinishUpdate();
+
+            const size_t pair_offset = wm.n_clique_edges + wm.n_clique_nodes * wm.n_clique_nodes;
+            for (size_t i = 0; i < wm.n_pairs; ++i) {
+                double cost = i < n_endpoints / 2 ? pair_on : pair_off;
+                if (cost != wm.pair_cost[i]) {
+                    wm.pm->UpdateCost((int) (pair_offset + i), cost - wm.pair_cost[i]);
+                    wm.pair_cost[i] = cost;
+                }
+            }
+            wm.pm->FinishUpdate();
         }
-        pm->Solve();
-        pm_last_n_endpoints = n_endpoints;
+
+        wm.pm->Solve();
+    }
+
+    /**
+     * Gets a maximum weight matching.
+     *
+     * @param v_s Vector containing vertices representing edges (two per edge).
+     * @param w_s Vector storing weights for each edge.
+     * @param n_endpoints Number of endpoints in the clique (selecting n_endpoints / 2 edges).
+     * @param offset Offset for vertex conversion.
+     * @return The sum of the weights.
+     */
+    TypeSF get_upper_bound_matching(VectorOfVectors<size_t> &v_s, std::vector<TypeSF> &w_s, size_t n_endpoints, size_t offset) {
+        ASSERT(v_s.size == 0);
+        ASSERT(w_s.empty());
+
+        solve_warm_matching(pm, 0, n_endpoints);
 
         // get solution
         TypeSF sum = 0;
         size_t j = 0;
         for (size_t i = 0; i < n_nodes; ++i) {
-            size_t match_i = pm->GetMatch(i);
+            size_t match_i = pm.pm->GetMatch(i);
             if (match_i >= n_nodes || match_i < i) {
                 continue;
             }
@@ -3126,74 +842,16 @@ public:
         ASSERT(w_s.empty());
 
         size_t clique_n_nodes = n_nodes - 1;
-        size_t clique_n_edges = (clique_n_nodes * (clique_n_nodes - 1)) / 2;
-        size_t dummy_n_nodes = clique_n_nodes;
-        size_t dummy_n_edges = dummy_n_nodes * clique_n_nodes + ((1 + dummy_n_nodes) / 2);
-        size_t total_n_nodes = clique_n_nodes + dummy_n_nodes;
-        size_t total_n_edges = clique_n_edges + dummy_n_edges;
-
-        if (pm_skip_first == nullptr) {
-            pm_skip_first_last_n_endpoints = 0;
 
-            pm_skip_first = new PerfectMatching(total_n_nodes, total_n_edges);
-            pm_skip_first->options = options;
-
-            // add normal edges to boost graph
-            for (size_t i = 0; i < n_edges; ++i) {
-                size_t node_1 = edges[i].n1;
-                size_t node_2 = edges[i].n2;
-
-                if (node_1 == 0 || node_2 == 0) {
-                    // skip edges with node_id 0
-                    continue;
-                }
-
-                // id 0 in this structure is not used, but we have to use it in the
-                // 3rd party structure. We shift each node 1 to the left, but later
-                // have to shift them back to normal
-                size_t node_1_shifted = node_1 - 1;
-                size_t node_2_shifted = node_2 - 1;
-                pm_skip_first->AddEdge(node_1_shifted, node_2_shifted, -(double) edges[i].weight);
-            }
-
-            // add dummy edges
-            for (size_t i = 0; i < dummy_n_nodes; ++i) {
-                for (size_t j = 0; j < n_nodes; ++j) {
-                    size_t node_1 = clique_n_nodes + i; // dummy after clique
-                    size_t node_2 = j;
-
-                    if (node_2 == 0) {
-                        // skip edges with node_id 0
-                        continue;
-                    }
-
-                    size_t node_1_shifted = node_1; // no shift, because dummy node
-                    size_t node_2_shifted = node_2 - 1;
-                    pm_skip_first->AddEdge(node_1_shifted, node_2_shifted, -(double) (max_weight + 1));
-                }
-            }
-
-            // add the edges normally
-            for (size_t i = 0; i < n_endpoints / 2; ++i) {
-                pm_skip_first->AddEdge(clique_n_nodes + (2 * i), clique_n_nodes + (2 * i) + 1, -(double) (2 * max_weight + 3));
-            }
-        } else {
-            // update the graph
-            pm_skip_first->StartUpdate();
-            for (size_t i = pm_skip_first_last_n_endpoints / 2; i < n_endpoints / 2; ++i) {
-                pm_skip_first->AddNewEdge(clique_n_nodes + (2 * i), clique_n_nodes + (2 * i) + 1, -(double) (2 * max_weight + 3), false);
-            }
-            pm_skip_first->FinishUpdate();
-        }
-
-        pm_skip_first->Solve();
-        pm_skip_first_last_n_endpoints = n_endpoints;
+        // id 0 in this structure is not used, but we have to use it in the
+        // 3rd party structure. Each node is shifted 1 to the left.
+        solve_warm_matching(pm_skip_first, 1, n_endpoints);
 
         // get solution
         TypeSF sum = 0;
         size_t j = 0;
         for (size_t i = 0; i < clique_n_nodes; ++i) {
-            size_t match_i = pm_skip_first->GetMatch(i);
+            size_t match_i = pm_skip_first.pm->GetMatch(i);
             if (match_i >= clique_n_nodes || match_i < i) {
                 continue;
             }
@@ -3212,6 +870,96 @@ public:
         return sum;
     }
 
+    /**
+     * Gets a maximum weight matching with n_endpoints / 2 edges. The matchings
+     * of all cardinalities are computed with the first call after the graph
+     * was built, later calls only read the solution.
+     *
+     * @param v_s Vector containing vertices representing edges (two per edge).
+     * @param w_s Vector storing weights for each edge.
+     * @param n_endpoints Number of endpoints in the clique (selecting n_endpoints / 2 edges).
+     * @param offset Offset for vertex conversion.
+     * @return The sum of the weights.
+     */
+    TypeSF get_upper_bound_native_matching(VectorOfVectors<size_t> &v_s, std::vector<TypeSF> &w_s, size_t n_endpoints, size_t offset) {
+        ASSERT(v_s.size == 0);
+        ASSERT(w_s.empty());
+
+        if (!native_solved) {
+            native_weights.assign(n_nodes * n_nodes, 0);
+            for (size_t i = 0; i < edges_size; ++i) {
+                native_weights[edges[i].n1 * n_nodes + edges[i].n2] = edges[i].weight;
+            }
+            native_matching.solve(n_nodes, native_weights);
+            native_solved = true;
+        }
+
+        return read_native_matching(native_matching, v_s, w_s, n_endpoints / 2, 0, offset);
+    }
+
+    /**
+     * Gets a maximum weight matching with n_endpoints / 2 edges, but skips
+     * vertex with id 0 and all its edges.
+     *
+     * @param v_s Vector containing vertices representing edges (two per edge).
+     * @param w_s Vector storing weights for each edge.
+     * @param n_endpoints Number of endpoints in the clique (selecting n_endpoints / 2 edges).
+     * @param offset Offset for vertex conversion.
+     * @return The sum of the weights.
+     */
+    TypeSF get_upper_bound_skip_first_native_matching(VectorOfVectors<size_t> &v_s, std::vector<TypeSF> &w_s, size_t n_endpoints, size_t offset) {
+        ASSERT(v_s.size == 0);
+        ASSERT(w_s.empty());
+
+        if (!native_skip_first_solved) {
+            // each node is shifted 1 to the left
+            size_t clique_n_nodes = n_nodes - 1;
+            native_weights.assign(clique_n_nodes * clique_n_nodes, 0);
+            for (size_t i = 0; i < edges_size; ++i) {
+                if (edges[i].n1 == 0) { continue; }
+                native_weights[(edges[i].n1 - 1) * clique_n_nodes + (edges[i].n2 - 1)] = edges[i].weight;
+            }
+            native_matching_skip_first.solve(clique_n_nodes, native_weights);
+            native_skip_first_solved = true;
+        }
+
+        return read_native_matching(native_matching_skip_first, v_s, w_s, n_endpoints / 2, 1, offset);
+    }
+
+    /**
+     * Reads the matching with the given number of edges.
+     *
+     * @param cm The solved matching.
+     * @param v_s Vector containing vertices representing edges (two per edge).
+     * @param w_s Vector storing weights for each edge.
+     * @param n_pairs Number of edges.
+     * @param shift Shift between the nodes of the matching and this graph.
+     * @param offset Offset for vertex conversion.
+     * @return The sum of the weights.
+     */
+    TypeSF read_native_matching(const CardinalityMatching<TypeSF> &cm, VectorOfVectors<size_t> &v_s, std::vector<TypeSF> &w_s, size_t n_pairs, size_t shift, size_t offset) {
+        ASSERT(n_pairs <= cm.max_cardinality());
+
+        const size_t *pairs = cm.pairs.data() + n_pairs * (n_pairs - 1);
+        for (size_t i = 0; i < n_pairs; ++i) {
+            size_t n1 = pairs[2 * i] + shift;
+            size_t n2 = pairs[2 * i + 1] + shift;
+            v_s.push_back(n1 + offset, n2 + offset);
+            w_s.push_back(native_weight(n1, n2));
+        }
+        return cm.weights[n_pairs];
+    }
+
+    /**
+     * @return The weight of the edge between n1 < n2.
+     */
+    inline TypeSF native_weight(size_t n1, size_t n2) const {
+        // edges are inserted row by row
+        size_t idx = n1 * n_nodes - (n1 * (n1 + 1)) / 2 + (n2 - n1 - 1);
+        ASSERT(edges[idx].n1 == n1 && edges[idx].n2 == n2);
+        return edges[idx].weight;
+    }
+
     /**
      * Calculates an upper bound for a given set of vertices and edges using a brute-force
      * iterative approach.
@@ -3283,22 +1031,14 @@ public:
 
         best_set.resize(n_to_choose);
         // Lookup precomputed valid sets of edges
-        const std::vector<size_t> &sets = valid_sets[n_nodes - 2][n_to_choose - 1];
-        const size_t n_sets = sets.size() / n_to_choose;
+        const uint8_t *sets = valid_sets.get(n_nodes, n_to_choose);
+        const size_t n_sets = valid_sets_count(n_nodes, n_to_choose);
+        ASSERT(n_sets > 0);
 
         // Find the subset with the maximum total weight
-        for (size_t i = 0; i < n_sets; ++i) {
-            TypeSF sum = 0;
-            for (size_t j = 0; j < n_to_choose; ++j) {
-                sum += edges[sets[i * n_to_choose + j]].weight;
-            }
-
-            if (sum > best_sum) {
-                best_sum = sum;
-                for (size_t j = 0; j < n_to_choose; ++j) {
-                    best_set[j] = sets[i * n_to_choose + j];
-                }
-            }
+        size_t best_idx = lookup_best_set(sets, n_sets, n_to_choose, 0, best_sum);
+        for (size_t j = 0; j < n_to_choose; ++j) {
+            best_set[j] = sets[j * n_sets + best_idx];
         }
 
         // Populate v_s and w_s with the selected edges
@@ -3383,21 +1123,13 @@ public:
 
         best_set.resize(n_to_choose);
 
-        const std::vector<size_t> &sets = valid_sets[n_nodes - 3][n_to_choose - 1];
-        const size_t n_sets = sets.size() / n_to_choose;
-
-        for (size_t i = 0; i < n_sets; ++i) {
-            TypeSF sum = 0;
-            for (size_t j = 0; j < n_to_choose; ++j) {
-                sum += edges[n_nodes - 1 + sets[i * n_to_choose + j]].weight;
-            }
+        const uint8_t *sets = valid_sets.get(n_nodes - 1, n_to_choose);
+        const size_t n_sets = valid_sets_count(n_nodes - 1, n_to_choose);
+        ASSERT(n_sets > 0);
 
-            if (sum > best_sum) {
-                best_sum = sum;
-                for (size_t j = 0; j < n_to_choose; ++j) {
-                    best_set[j] = sets[i * n_to_choose + j];
-                }
-            }
+        size_t best_idx = lookup_best_set(sets, n_sets, n_to_choose, n_nodes - 1, best_sum);
+        for (size_t j = 0; j < n_to_choose; ++j) {
+            best_set[j] = sets[j * n_sets + best_idx];
         }
 
         for (size_t i = 0; i < n_to_choose; ++i) {
@@ -3411,76 +1143,156 @@ public:
     }
 
     /**
-     * Initialize a dynamic array for caching edge weights and indices based on bitset representation.
+     * Storage of the subset dynamic program. Only one UB2D bound is computed
+     * at a time per thread, so all instances of a thread share the (possibly
+     * large) tables. The owner marks which instance the tables belong to.
+     */
+    struct DynamicWorkspace {
+        const UB2DAlgorithm *owner = nullptr;
+        std::vector<TypeSF> si; // best perfect matching of each even node subset
+        std::vector<uint8_t> partner; // partner of the lowest node in that matching
+    };
+
+    static DynamicWorkspace &dynamic_workspace() {
+        static thread_local DynamicWorkspace ws;
+        return ws;
+    }
+
+    /**
+     * Subsets with an even number of nodes are determined by all but their
+     * highest possible node, so the tables only store half of all subsets.
+     */
+    inline size_t dynamic_idx(size_t bitset) const {
+        return bitset & (pow_2(n_nodes - 1) - 1);
+    }
+
+    /**
+     * Returns the bitset with k nodes at the given rank in increasing numeric
+     * order, i.e. the order in which next_subset() enumerates them.
+     */
+    static size_t unrank_subset(size_t rank, size_t k) {
+        size_t bitset = 0;
+        for (size_t i = k; i > 0; --i) {
+            size_t c = i - 1;
+            while (n_choose_k(c + 1, i) <= rank) {
+                c += 1;
+            }
+            bitset |= size_t(1) << c;
+            rank -= n_choose_k(c, i);
+        }
+        return bitset;
+    }
+
+    /**
+     * Initialize the dynamic program with the empty set and the weight matrix.
      */
     void initialize_dynamic_array() {
         // Return if already initialized
-        if (solution_ready[0] == 1) {
+        DynamicWorkspace &ws = dynamic_workspace();
+        if (solution_ready[0] == 1 && ws.owner == this) {
             return;
         }
 
-        // Populate caches with edge data
-        for (size_t i = 0; i < edges.size(); ++i) {
-            size_t bitset = 0 | (1 << edges[i].n1) | (1 << edges[i].n2);
-            cache_si[bitset] = edges[i].weight;
-            cache_bitset_t1[bitset] = i;
-            cache_bitset_t2[bitset] = i;
+        std::fill(dp_weights.begin(), dp_weights.end(), 0);
+        for (size_t i = 0; i < edges_size; ++i) {
+            dp_weights[edges[i].n1 * n_nodes + edges[i].n2] = edges[i].weight;
+            dp_weights[edges[i].n2 * n_nodes + edges[i].n1] = edges[i].weight;
+        }
+
+        size_t cache_size = pow_2(n_nodes - 1);
+        if (ws.si.size() < cache_size) {
+            ws.si.resize(cache_size);
+            ws.partner.resize(cache_size);
         }
+        ws.si[0] = 0;
+        ws.owner = this;
 
-        // Mark initialization as complete
+        std::fill(solution_ready.begin(), solution_ready.end(), 0);
         solution_ready[0] = 1;
     }
 
     /**
-     * Update the dynamic array for caching edge weights and indices.
+     * Computes the maximum weight perfect matching of all node subsets with
+     * 2 * t nodes. A subset is only split at its lowest node, which is
+     * matched with one of the other nodes, the rest is a subset of the
+     * previous layer. Large layers are split into chunks, that are processed
+     * in parallel.
      *
-     * @param idx The index to update.
+     * @param t The number of pairs.
      */
-    void update_dynamic_array(size_t idx) {
+    void update_dynamic_array(size_t t) {
         // Return if already initialized
-        if (solution_ready[idx] == 1) {
+        if (solution_ready[t] == 1 && dynamic_workspace().owner == this) {
             return;
         }
 
-        // If idx is 0, initialize the dynamic array and return
-        if (idx == 0) {
+        // If t is 0, initialize the dynamic array and return
+        if (t == 0) {
             initialize_dynamic_array();
             return;
         }
 
-        // Recursively update dynamic array for previous index
-        update_dynamic_array(idx - 1);
-
-        size_t set_size = 2 + idx * 2;
-        size_t last_bitset = (pow_2(set_size) - 1) << (n_nodes - set_size);
-        size_t bitset0 = pow_2(set_size) - 1;
-
-        // iterate over all node subsets of size set_size
-        while (bitset0 <= last_bitset) {
-            // determine bitset for the node set
-            for (size_t i = 0; i < n_nodes; ++i) {
-                if (!((bitset0 >> i) & 1)) {
-                    continue;
-                }
-                for (size_t j = i + 1; j < n_nodes; ++j) {
-                    if (!((bitset0 >> j) & 1)) {
-                        continue;
-                    }
-                    // split node subset into two bitsets, one for T[0] and one for T[idx-1]
-                    size_t bitset1 = (1ULL << i) | (1LL << j); // set i and j to true
-                    size_t bitset2 = bitset0 & ~(1ULL << i) & ~(1ULL << j); // set i and j to false
-
-                    // check for new minimum
-                    if (cache_si[bitset1] + cache_si[bitset2] < cache_si[bitset0]) {
-                        cache_si[bitset0] = cache_si[bitset1] + cache_si[bitset2];
-                        cache_bitset_t1[bitset0] = bitset1;
-                        cache_bitset_t2[bitset0] = bitset2;
+        // Recursively update dynamic array for previous layer
+        update_dynamic_array(t - 1);
+
+        DynamicWorkspace &ws = dynamic_workspace();
+        TypeSF *si = ws.si.data();
+        uint8_t *partner = ws.partner.data();
+        const TypeSF *w = dp_weights.data();
+        const size_t n = n_nodes;
+        const size_t set_size = 2 * t;
+        const size_t n_subsets = n_choose_k(n, set_size);
+        const size_t idx_mask = pow_2(n - 1) - 1;
+
+        const long n_chunks = n_subsets >= 4096 ? 64 : 1;
+#pragma omp parallel for schedule(dynamic) if (n_chunks > 1)
+        for (long chunk = 0; chunk < n_chunks; ++chunk) {
+            size_t first = (n_subsets * (size_t) chunk) / (size_t) n_chunks;
+            size_t last = (n_subsets * (size_t) (chunk + 1)) / (size_t) n_chunks;
+            size_t bitset0 = unrank_subset(first, set_size);
+
+            for (size_t rank = first; rank < last; ++rank) {
+                // match the lowest node with every other node of the set
+                size_t low = (size_t) std::countr_zero(bitset0);
+                size_t rest = bitset0 ^ (size_t(1) << low);
+                const TypeSF *w_low = w + low * n;
+
+                TypeSF best = -std::numeric_limits<TypeSF>::max();
+                size_t best_j = 0;
+                for (size_t bits = rest; bits != 0; bits &= bits - 1) {
+                    size_t j = (size_t) std::countr_zero(bits);
+                    TypeSF value = w_low[j] + si[(rest ^ (size_t(1) << j)) & idx_mask];
+                    if (value > best) {
+                        best = value;
+                        best_j = j;
                     }
                 }
+                si[bitset0 & idx_mask] = best;
+                partner[bitset0 & idx_mask] = (uint8_t) best_j;
+
+                bitset0 = next_subset(bitset0, (int) set_size);
             }
-            bitset0 = next_subset(bitset0, set_size);
         }
-        solution_ready[idx] = 1;
+        solution_ready[t] = 1;
+    }
+
+    /**
+     * Adds the pairs of the best perfect matching of the given node subset.
+     *
+     * @param bitset The node subset.
+     * @param v_s Vector containing vertices representing edges (two per edge).
+     * @param w_s Vector storing weights for each edge.
+     * @param offset Offset for vertex conversion.
+     */
+    void add_dynamic_solution(size_t bitset, VectorOfVectors<size_t> &v_s, std::vector<TypeSF> &w_s, size_t offset) {
+        DynamicWorkspace &ws = dynamic_workspace();
+        while (bitset != 0) {
+            size_t low = (size_t) std::countr_zero(bitset);
+            size_t j = ws.partner[dynamic_idx(bitset)];
+            v_s.push_back(low + offset, j + offset);
+            w_s.push_back(dp_weights[low * n_nodes + j]);
+            bitset ^= (size_t(1) << low) | (size_t(1) << j);
+        }
     }
 
     /**
@@ -3496,11 +1308,12 @@ public:
         ASSERT(v_s.size == 0);
         ASSERT(w_s.empty());
 
-        size_t idx = (n_endpoints / 2) - 1;
-        update_dynamic_array(idx);
+        size_t t = n_endpoints / 2;
+        update_dynamic_array(t);
+        const TypeSF *si = dynamic_workspace().si.data();
 
         // iterate over all node subsets of size n_endpoints
-        size_t set_size = 2 + idx * 2;
+        size_t set_size = 2 * t;
         size_t last_bitset = (pow_2(set_size) - 1) << (n_nodes - set_size);
 
         TypeSF best_sum = -std::numeric_limits<TypeSF>::max();
@@ -3509,35 +1322,14 @@ public:
 
         while (bitset0 <= last_bitset) {
             // find maximum si
-            if (cache_si[bitset0] > best_sum) {
-                best_sum = cache_si[bitset0];
+            if (si[dynamic_idx(bitset0)] > best_sum) {
+                best_sum = si[dynamic_idx(bitset0)];
                 best_bitset = bitset0;
             }
-            bitset0 = next_subset(bitset0, set_size);
-        }
-
-        // get the pairs from best_edge_idx
-        size_t edge_idx;
-        size_t bitset_temp = best_bitset;
-        for (size_t i = 0; i < (n_endpoints / 2) - 2; ++i) {
-            edge_idx = cache_bitset_t1[bitset_temp];
-            bitset_temp = cache_bitset_t2[bitset_temp];
-
-            edge_idx = cache_bitset_t1[edge_idx];
-            v_s.push_back(edges[edge_idx].n1 + offset, edges[edge_idx].n2 + offset);
-            w_s.push_back(edges[edge_idx].weight);
+            bitset0 = next_subset(bitset0, (int) set_size);
         }
-        edge_idx = cache_bitset_t1[bitset_temp];
-        bitset_temp = cache_bitset_t2[bitset_temp];
-
-        edge_idx = cache_bitset_t1[edge_idx];
-        v_s.push_back(edges[edge_idx].n1 + offset, edges[edge_idx].n2 + offset);
-        w_s.push_back(edges[edge_idx].weight);
-
-        edge_idx = cache_bitset_t2[bitset_temp];
-        v_s.push_back(edges[edge_idx].n1 + offset, edges[edge_idx].n2 + offset);
-        w_s.push_back(edges[edge_idx].weight);
 
+        add_dynamic_solution(best_bitset, v_s, w_s, offset);
         return best_sum;
     }
 
@@ -3555,10 +1347,11 @@ public:
         ASSERT(v_s.size == 0);
         ASSERT(w_s.empty());
 
-        size_t idx = (n_endpoints / 2) - 1;
-        update_dynamic_array(idx);
+        size_t t = n_endpoints / 2;
+        update_dynamic_array(t);
+        const TypeSF *si = dynamic_workspace().si.data();
 
-        size_t set_size = 2 + idx * 2;
+        size_t set_size = 2 * t;
         size_t last_bitset = (pow_2(set_size) - 1) << (n_nodes - 1 - set_size);
 
         TypeSF best_sum = -std::numeric_limits<TypeSF>::max();
@@ -3568,35 +1361,14 @@ public:
         while (bitset0 <= last_bitset) {
             // find maximum si
             size_t temp = bitset0 << 1;
-            if (cache_si[temp] > best_sum) {
-                best_sum = cache_si[temp];
+            if (si[dynamic_idx(temp)] > best_sum) {
+                best_sum = si[dynamic_idx(temp)];
                 best_bitset = temp;
             }
-            bitset0 = next_subset(bitset0, set_size);
-        }
-
-        // get the pairs from best_edge_idx
-        size_t edge_idx;
-        size_t bitset_temp = best_bitset;
-        for (size_t i = 0; i < (n_endpoints / 2) - 2; ++i) {
-            edge_idx = cache_bitset_t1[bitset_temp];
-            bitset_temp = cache_bitset_t2[bitset_temp];
-
-            edge_idx = cache_bitset_t1[edge_idx];
-            v_s.push_back(edges[edge_idx].n1 + offset, edges[edge_idx].n2 + offset);
-            w_s.push_back(edges[edge_idx].weight);
+            bitset0 = next_subset(bitset0, (int) set_size);
         }
-        edge_idx = cache_bitset_t1[bitset_temp];
-        bitset_temp = cache_bitset_t2[bitset_temp];
-
-        edge_idx = cache_bitset_t1[edge_idx];
-        v_s.push_back(edges[edge_idx].n1 + offset, edges[edge_idx].n2 + offset);
-        w_s.push_back(edges[edge_idx].weight);
-
-        edge_idx = cache_bitset_t2[bitset_temp];
-        v_s.push_back(edges[edge_idx].n1 + offset, edges[edge_idx].n2 + offset);
-        w_s.push_back(edges[edge_idx].weight);
 
+        add_dynamic_solution(best_bitset, v_s, w_s, offset);
         return best_sum;
     }
 
@@ -1,13294 +0,0 @@
-#include "UB2DStorage.h"
-
-//n, n_to_choose, sets
-const std::vector<std::vector<std::vector<size_t>>> valid_sets = {
-        {
-                {
-                        0
-                }
-        },
-        {
-                {
-                        0,
-                        1,
-                        2
-                }
-        },
-        {
-                {
-                        0,
-                        1,
-                        2,
-                        3,
-                        4,
-                        5
-                },
-                {
-                        0, 5,
-                        1, 4,
-                        2, 3
-                }
-        },
-        {
-                {
-                        0,
-                        1,
-                        2,
-                        3,
-                        4,
-                        5,
-                        6,
-                        7,
-                        8,
-                        9
-                },
-                {
-                        0, 7,
-                        0, 8,
-                        0, 9,
-                        1, 5,
-                        1, 6,
-                        1, 9,
-                        2, 4,
-                        2, 6,
-                        2, 8,
-                        3, 4,
-                        3, 5,
-                        3, 7,
-                        4, 9,
-                        5, 8,
-                        6, 7
-                }
-        },
-        {
-                {
-                        0,
-                        1,
-                        2,
-                        3,
-                        4,
-                        5,
-                        6,
-                        7,
-                        8,
-                        9,
-                        10,
-                        11,
-                        12,
-                        13,
-                        14
-                },
-                {
-                        0, 9,
-                        0, 10,
-                        0, 11,
-                        0, 12,
-                        0, 13,
-                        0, 14,
-                        1, 6,
-                        1, 7,
-                        1, 8,
-                        1, 12,
-                        1, 13,
-                        1, 14,
-                        2, 5,
-                        2, 7,
-                        2, 8,
-                        2, 10,
-                        2, 11,
-                        2, 14,
-                        3, 5,
-                        3, 6,
-                        3, 8,
-                        3, 9,
-                        3, 11,
-                        3, 13,
-                        4, 5,
-                        4, 6,
-                        4, 7,
-                        4, 9,
-                        4, 10,
-                        4, 12,
-                        5, 12,
-                        5, 13,
-                        5, 14,
-                        6, 10,
-                        6, 11,
-                        6, 14,
-                        7, 9,
-                        7, 11,
-                        7, 13,
-                        8, 9,
-                        8, 10,
-                        8, 12,
-                        9, 14,
-                        10, 13,
-                        11, 12
-                },
-                {
-                        0, 9, 14,
-                        0, 10, 13,
-                        0, 11, 12,
-                        1, 6, 14,
-                        1, 7, 13,
-                        1, 8, 12,
-                        2, 5, 14,
-                        2, 7, 11,
-                        2, 8, 10,
-                        3, 5, 13,
-                        3, 6, 11,
-                        3, 8, 9,
-                        4, 5, 12,
-                        4, 6, 10,
-                        4, 7, 9
-                }
-        },
-        {
-                {
-                        0,
-                        1,
-                        2,
-                        3,
-                        4,
-                        5,
-                        6,
-                        7,
-                        8,
-                        9,
-                        10,
-                        11,
-                        12,
-                        13,
-                        14,
-                        15,
-                        16,
-                        17,
-                        18,
-                        19,
-                        20
-                },
-                {
-                        0, 11,
-                        0, 12,
-                        0, 13,
-                        0, 14,
-                        0, 15,
-                        0, 16,
-                        0, 17,
-                        0, 18,
-                        0, 19,
-                        0, 20,
-                        1, 7,
-                        1, 8,
-                        1, 9,
-                        1, 10,
-                        1, 15,
-                        1, 16,
-                        1, 17,
-                        1, 18,
-                        1, 19,
-                        1, 20,
-                        2, 6,
-                        2, 8,
-                        2, 9,
-                        2, 10,
-                        2, 12,
-                        2, 13,
-                        2, 14,
-                        2, 18,
-                        2, 19,
-                        2, 20,
-                        3, 6,
-                        3, 7,
-                        3, 9,
-                        3, 10,
-                        3, 11,
-                        3, 13,
-                        3, 14,
-                        3, 16,
-                        3, 17,
-                        3, 20,
-                        4, 6,
-                        4, 7,
-                        4, 8,
-                        4, 10,
-                        4, 11,
-                        4, 12,
-                        4, 14,
-                        4, 15,
-                        4, 17,
-                        4, 19,
-                        5, 6,
-                        5, 7,
-                        5, 8,
-                        5, 9,
-                        5, 11,
-                        5, 12,
-                        5, 13,
-                        5, 15,
-                        5, 16,
-                        5, 18,
-                        6, 15,
-                        6, 16,
-                        6, 17,
-                        6, 18,
-                        6, 19,
-                        6, 20,
-                        7, 12,
-                        7, 13,
-                        7, 14,
-                        7, 18,
-                        7, 19,
-                        7, 20,
-                        8, 11,
-                        8, 13,
-                        8, 14,
-                        8, 16,
-                        8, 17,
-                        8, 20,
-                        9, 11,
-                        9, 12,
-                        9, 14,
-                        9, 15,
-                        9, 17,
-                        9, 19,
-                        10, 11,
-                        10, 12,
-                        10, 13,
-                        10, 15,
-                        10, 16,
-                        10, 18,
-                        11, 18,
-                        11, 19,
-                        11, 20,
-                        12, 16,
-                        12, 17,
-                        12, 20,
-                        13, 15,
-                        13, 17,
-                        13, 19,
-                        14, 15,
-                        14, 16,
-                        14, 18,
-                        15, 20,
-                        16, 19,
-                        17, 18
-                },
-                {
-                        0, 11, 18,
-                        0, 11, 19,
-                        0, 11, 20,
-                        0, 12, 16,
-                        0, 12, 17,
-                        0, 12, 20,
-                        0, 13, 15,
-                        0, 13, 17,
-                        0, 13, 19,
-                        0, 14, 15,
-                        0, 14, 16,
-                        0, 14, 18,
-                        0, 15, 20,
-                        0, 16, 19,
-                        0, 17, 18,
-                        1, 7, 18,
-                        1, 7, 19,
-                        1, 7, 20,
-                        1, 8, 16,
-                        1, 8, 17,
-                        1, 8, 20,
-                        1, 9, 15,
-                        1, 9, 17,
-                        1, 9, 19,
-                        1, 10, 15,
-                        1, 10, 16,
-                        1, 10, 18,
-                        1, 15, 20,
-                        1, 16, 19,
-                        1, 17, 18,
-                        2, 6, 18,
-                        2, 6, 19,
-                        2, 6, 20,
-                        2, 8, 13,
-                        2, 8, 14,
-                        2, 8, 20,
-                        2, 9, 12,
-                        2, 9, 14,
-                        2, 9, 19,
-                        2, 10, 12,
-                        2, 10, 13,
-                        2, 10, 18,
-                        2, 12, 20,
-                        2, 13, 19,
-                        2, 14, 18,
-                        3, 6, 16,
-                        3, 6, 17,
-                        3, 6, 20,
-                        3, 7, 13,
-                        3, 7, 14,
-                        3, 7, 20,
-                        3, 9, 11,
-                        3, 9, 14,
-                        3, 9, 17,
-                        3, 10, 11,
-                        3, 10, 13,
-                        3, 10, 16,
-                        3, 11, 20,
-                        3, 13, 17,
-                        3, 14, 16,
-                        4, 6, 15,
-                        4, 6, 17,
-                        4, 6, 19,
-                        4, 7, 12,
-                        4, 7, 14,
-                        4, 7, 19,
-                        4, 8, 11,
-                        4, 8, 14,
-                        4, 8, 17,
-                        4, 10, 11,
-                        4, 10, 12,
-                        4, 10, 15,
-                        4, 11, 19,
-                        4, 12, 17,
-                        4, 14, 15,
-                        5, 6, 15,
-                        5, 6, 16,
-                        5, 6, 18,
-                        5, 7, 12,
-                        5, 7, 13,
-                        5, 7, 18,
-                        5, 8, 11,
-                        5, 8, 13,
-                        5, 8, 16,
-                        5, 9, 11,
-                        5, 9, 12,
-                        5, 9, 15,
-                        5, 11, 18,
-                        5, 12, 16,
-                        5, 13, 15,
-                        6, 15, 20,
-                        6, 16, 19,
-                        6, 17, 18,
-                        7, 12, 20,
-                        7, 13, 19,
-                        7, 14, 18,
-                        8, 11, 20,
-                        8, 13, 17,
-                        8, 14, 16,
-                        9, 11, 19,
-                        9, 12, 17,
-                        9, 14, 15,
-                        10, 11, 18,
-                        10, 12, 16,
-                        10, 13, 15
-                }
-        },
-        {
-                {
-                        0,
-                        1,
-                        2,
-                        3,
-                        4,
-                        5,
-                        6,
-                        7,
-                        8,
-                        9,
-                        10,
-                        11,
-                        12,
-                        13,
-                        14,
-                        15,
-                        16,
-                        17,
-                        18,
-                        19,
-                        20,
-                        21,
-                        22,
-                        23,
-                        24,
-                        25,
-                        26,
-                        27
-                },
-                {
-                        0, 13,
-                        0, 14,
-                        0, 15,
-                        0, 16,
-                        0, 17,
-                        0, 18,
-                        0, 19,
-                        0, 20,
-                        0, 21,
-                        0, 22,
-                        0, 23,
-                        0, 24,
-                        0, 25,
-                        0, 26,
-                        0, 27,
-                        1, 8,
-                        1, 9,
-                        1, 10,
-                        1, 11,
-                        1, 12,
-                        1, 18,
-                        1, 19,
-                        1, 20,
-                        1, 21,
-                        1, 22,
-                        1, 23,
-                        1, 24,
-                        1, 25,
-                        1, 26,
-                        1, 27,
-                        2, 7,
-                        2, 9,
-                        2, 10,
-                        2, 11,
-                        2, 12,
-                        2, 14,
-                        2, 15,
-                        2, 16,
-                        2, 17,
-                        2, 22,
-                        2, 23,
-                        2, 24,
-                        2, 25,
-                        2, 26,
-                        2, 27,
-                        3, 7,
-                        3, 8,
-                        3, 10,
-                        3, 11,
-                        3, 12,
-                        3, 13,
-                        3, 15,
-                        3, 16,
-                        3, 17,
-                        3, 19,
-                        3, 20,
-                        3, 21,
-                        3, 25,
-                        3, 26,
-                        3, 27,
-                        4, 7,
-                        4, 8,
-                        4, 9,
-                        4, 11,
-                        4, 12,
-                        4, 13,
-                        4, 14,
-                        4, 16,
-                        4, 17,
-                        4, 18,
-                        4, 20,
-                        4, 21,
-                        4, 23,
-                        4, 24,
-                        4, 27,
-                        5, 7,
-                        5, 8,
-                        5, 9,
-                        5, 10,
-                        5, 12,
-                        5, 13,
-                        5, 14,
-                        5, 15,
-                        5, 17,
-                        5, 18,
-                        5, 19,
-                        5, 21,
-                        5, 22,
-                        5, 24,
-                        5, 26,
-                        6, 7,
-                        6, 8,
-                        6, 9,
-                        6, 10,
-                        6, 11,
-                        6, 13,
-                        6, 14,
-                        6, 15,
-                        6, 16,
-                        6, 18,
-                        6, 19,
-                        6, 20,
-                        6, 22,
-                        6, 23,
-                        6, 25,
-                        7, 18,
-                        7, 19,
-                        7, 20,
-                        7, 21,
-                        7, 22,
-                        7, 23,
-                        7, 24,
-                        7, 25,
-                        7, 26,
-                        7, 27,
-                        8, 14,
-                        8, 15,
-                        8, 16,
-                        8, 17,
-                        8, 22,
-                        8, 23,
-                        8, 24,
-                        8, 25,
-                        8, 26,
-                        8, 27,
-                        9, 13,
-                        9, 15,
-                        9, 16,
-                        9, 17,
-                        9, 19,
-                        9, 20,
-                        9, 21,
-                        9, 25,
-                        9, 26,
-                        9, 27,
-                        10, 13,
-                        10, 14,
-                        10, 16,
-                        10, 17,
-                        10, 18,
-                        10, 20,
-                        10, 21,
-                        10, 23,
-                        10, 24,
-                        10, 27,
-                        11, 13,
-                        11, 14,
-                        11, 15,
-                        11, 17,
-                        11, 18,
-                        11, 19,
-                        11, 21,
-                        11, 22,
-                        11, 24,
-                        11, 26,
-                        12, 13,
-                        12, 14,
-                        12, 15,
-                        12, 16,
-                        12, 18,
-                        12, 19,
-                        12, 20,
-                        12, 22,
-                        12, 23,
-                        12, 25,
-                        13, 22,
-                        13, 23,
-                        13, 24,
-                        13, 25,
-                        13, 26,
-                        13, 27,
-                        14, 19,
-                        14, 20,
-                        14, 21,
-                        14, 25,
-                        14, 26,
-                        14, 27,
-                        15, 18,
-                        15, 20,
-                        15, 21,
-                        15, 23,
-                        15, 24,
-                        15, 27,
-                        16, 18,
-                        16, 19,
-                        16, 21,
-                        16, 22,
-                        16, 24,
-                        16, 26,
-                        17, 18,
-                        17, 19,
-                        17, 20,
-                        17, 22,
-                        17, 23,
-                        17, 25,
-                        18, 25,
-                        18, 26,
-                        18, 27,
-                        19, 23,
-                        19, 24,
-                        19, 27,
-                        20, 22,
-                        20, 24,
-                        20, 26,
-                        21, 22,
-                        21, 23,
-                        21, 25,
-                        22, 27,
-                        23, 26,
-                        24, 25
-                },
-                {
-                        0, 13, 22,
-                        0, 13, 23,
-                        0, 13, 24,
-                        0, 13, 25,
-                        0, 13, 26,
-                        0, 13, 27,
-                        0, 14, 19,
-                        0, 14, 20,
-                        0, 14, 21,
-                        0, 14, 25,
-                        0, 14, 26,
-                        0, 14, 27,
-                        0, 15, 18,
-                        0, 15, 20,
-                        0, 15, 21,
-                        0, 15, 23,
-                        0, 15, 24,
-                        0, 15, 27,
-                        0, 16, 18,
-                        0, 16, 19,
-                        0, 16, 21,
-                        0, 16, 22,
-                        0, 16, 24,
-                        0, 16, 26,
-                        0, 17, 18,
-                        0, 17, 19,
-                        0, 17, 20,
-                        0, 17, 22,
-                        0, 17, 23,
-                        0, 17, 25,
-                        0, 18, 25,
-                        0, 18, 26,
-                        0, 18, 27,
-                        0, 19, 23,
-                        0, 19, 24,
-                        0, 19, 27,
-                        0, 20, 22,
-                        0, 20, 24,
-                        0, 20, 26,
-                        0, 21, 22,
-                        0, 21, 23,
-                        0, 21, 25,
-                        0, 22, 27,
-                        0, 23, 26,
-                        0, 24, 25,
-                        1, 8, 22,
-                        1, 8, 23,
-                        1, 8, 24,
-                        1, 8, 25,
-                        1, 8, 26,
-                        1, 8, 27,
-                        1, 9, 19,
-                        1, 9, 20,
-                        1, 9, 21,
-                        1, 9, 25,
-                        1, 9, 26,
-                        1, 9, 27,
-                        1, 10, 18,
-                        1, 10, 20,
-                        1, 10, 21,
-                        1, 10, 23,
-                        1, 10, 24,
-                        1, 10, 27,
-                        1, 11, 18,
-                        1, 11, 19,
-                        1, 11, 21,
-                        1, 11, 22,
-                        1, 11, 24,
-                        1, 11, 26,
-                        1, 12, 18,
-                        1, 12, 19,
-                        1, 12, 20,
-                        1, 12, 22,
-                        1, 12, 23,
-                        1, 12, 25,
-                        1, 18, 25,
-                        1, 18, 26,
-                        1, 18, 27,
-                        1, 19, 23,
-                        1, 19, 24,
-                        1, 19, 27,
-                        1, 20, 22,
-                        1, 20, 24,
-                        1, 20, 26,
-                        1, 21, 22,
-                        1, 21, 23,
-                        1, 21, 25,
-                        1, 22, 27,
-                        1, 23, 26,
-                        1, 24, 25,
-                        2, 7, 22,
-                        2, 7, 23,
-                        2, 7, 24,
-                        2, 7, 25,
-                        2, 7, 26,
-                        2, 7, 27,
-                        2, 9, 15,
-                        2, 9, 16,
-                        2, 9, 17,
-                        2, 9, 25,
-                        2, 9, 26,
-                        2, 9, 27,
-                        2, 10, 14,
-                        2, 10, 16,
-                        2, 10, 17,
-                        2, 10, 23,
-                        2, 10, 24,
-                        2, 10, 27,
-                        2, 11, 14,
-                        2, 11, 15,
-                        2, 11, 17,
-                        2, 11, 22,
-                        2, 11, 24,
-                        2, 11, 26,
-                        2, 12, 14,
-                        2, 12, 15,
-                        2, 12, 16,
-                        2, 12, 22,
-                        2, 12, 23,
-                        2, 12, 25,
-                        2, 14, 25,
-                        2, 14, 26,
-                        2, 14, 27,
-                        2, 15, 23,
-                        2, 15, 24,
-                        2, 15, 27,
-                        2, 16, 22,
-                        2, 16, 24,
-                        2, 16, 26,
-                        2, 17, 22,
-                        2, 17, 23,
-                        2, 17, 25,
-                        2, 22, 27,
-                        2, 23, 26,
-                        2, 24, 25,
-                        3, 7, 19,
-                        3, 7, 20,
-                        3, 7, 21,
-                        3, 7, 25,
-                        3, 7, 26,
-                        3, 7, 27,
-                        3, 8, 15,
-                        3, 8, 16,
-                        3, 8, 17,
-                        3, 8, 25,
-                        3, 8, 26,
-                        3, 8, 27,
-                        3, 10, 13,
-                        3, 10, 16,
-                        3, 10, 17,
-                        3, 10, 20,
-                        3, 10, 21,
-                        3, 10, 27,
-                        3, 11, 13,
-                        3, 11, 15,
-                        3, 11, 17,
-                        3, 11, 19,
-                        3, 11, 21,
-                        3, 11, 26,
-                        3, 12, 13,
-                        3, 12, 15,
-                        3, 12, 16,
-                        3, 12, 19,
-                        3, 12, 20,
-                        3, 12, 25,
-                        3, 13, 25,
-                        3, 13, 26,
-                        3, 13, 27,
-                        3, 15, 20,
-                        3, 15, 21,
-                        3, 15, 27,
-                        3, 16, 19,
-                        3, 16, 21,
-                        3, 16, 26,
-                        3, 17, 19,
-                        3, 17, 20,
-                        3, 17, 25,
-                        3, 19, 27,
-                        3, 20, 26,
-                        3, 21, 25,
-                        4, 7, 18,
-                        4, 7, 20,
-                        4, 7, 21,
-                        4, 7, 23,
-                        4, 7, 24,
-                        4, 7, 27,
-                        4, 8, 14,
-                        4, 8, 16,
-                        4, 8, 17,
-                        4, 8, 23,
-                        4, 8, 24,
-                        4, 8, 27,
-                        4, 9, 13,
-                        4, 9, 16,
-                        4, 9, 17,
-                        4, 9, 20,
-                        4, 9, 21,
-                        4, 9, 27,
-                        4, 11, 13,
-                        4, 11, 14,
-                        4, 11, 17,
-                        4, 11, 18,
-                        4, 11, 21,
-                        4, 11, 24,
-                        4, 12, 13,
-                        4, 12, 14,
-                        4, 12, 16,
-                        4, 12, 18,
-                        4, 12, 20,
-                        4, 12, 23,
-                        4, 13, 23,
-                        4, 13, 24,
-                        4, 13, 27,
-                        4, 14, 20,
-                        4, 14, 21,
-                        4, 14, 27,
-                        4, 16, 18,
-                        4, 16, 21,
-                        4, 16, 24,
-                        4, 17, 18,
-                        4, 17, 20,
-                        4, 17, 23,
-                        4, 18, 27,
-                        4, 20, 24,
-                        4, 21, 23,
-                        5, 7, 18,
-                        5, 7, 19,
-                        5, 7, 21,
-                        5, 7, 22,
-                        5, 7, 24,
-                        5, 7, 26,
-                        5, 8, 14,
-                        5, 8, 15,
-                        5, 8, 17,
-                        5, 8, 22,
-                        5, 8, 24,
-                        5, 8, 26,
-                        5, 9, 13,
-                        5, 9, 15,
-                        5, 9, 17,
-                        5, 9, 19,
-                        5, 9, 21,
-                        5, 9, 26,
-                        5, 10, 13,
-                        5, 10, 14,
-                        5, 10, 17,
-                        5, 10, 18,
-                        5, 10, 21,
-                        5, 10, 24,
-                        5, 12, 13,
-                        5, 12, 14,
-                        5, 12, 15,
-                        5, 12, 18,
-                        5, 12, 19,
-                        5, 12, 22,
-                        5, 13, 22,
-                        5, 13, 24,
-                        5, 13, 26,
-                        5, 14, 19,
-                        5, 14, 21,
-                        5, 14, 26,
-                        5, 15, 18,
-                        5, 15, 21,
-                        5, 15, 24,
-                        5, 17, 18,
-                        5, 17, 19,
-                        5, 17, 22,
-                        5, 18, 26,
-                        5, 19, 24,
-                        5, 21, 22,
-                        6, 7, 18,
-                        6, 7, 19,
-                        6, 7, 20,
-                        6, 7, 22,
-                        6, 7, 23,
-                        6, 7, 25,
-                        6, 8, 14,
-                        6, 8, 15,
-                        6, 8, 16,
-                        6, 8, 22,
-                        6, 8, 23,
-                        6, 8, 25,
-                        6, 9, 13,
-                        6, 9, 15,
-                        6, 9, 16,
-                        6, 9, 19,
-                        6, 9, 20,
-                        6, 9, 25,
-                        6, 10, 13,
-                        6, 10, 14,
-                        6, 10, 16,
-                        6, 10, 18,
-                        6, 10, 20,
-                        6, 10, 23,
-                        6, 11, 13,
-                        6, 11, 14,
-                        6, 11, 15,
-                        6, 11, 18,
-                        6, 11, 19,
-                        6, 11, 22,
-                        6, 13, 22,
-                        6, 13, 23,
-                        6, 13, 25,
-                        6, 14, 19,
-                        6, 14, 20,
-                        6, 14, 25,
-                        6, 15, 18,
-                        6, 15, 20,
-                        6, 15, 23,
-                        6, 16, 18,
-                        6, 16, 19,
-                        6, 16, 22,
-                        6, 18, 25,
-                        6, 19, 23,
-                        6, 20, 22,
-                        7, 18, 25,
-                        7, 18, 26,
-                        7, 18, 27,
-                        7, 19, 23,
-                        7, 19, 24,
-                        7, 19, 27,
-                        7, 20, 22,
-                        7, 20, 24,
-                        7, 20, 26,
-                        7, 21, 22,
-                        7, 21, 23,
-                        7, 21, 25,
-                        7, 22, 27,
-                        7, 23, 26,
-                        7, 24, 25,
-                        8, 14, 25,
-                        8, 14, 26,
-                        8, 14, 27,
-                        8, 15, 23,
-                        8, 15, 24,
-                        8, 15, 27,
-                        8, 16, 22,
-                        8, 16, 24,
-                        8, 16, 26,
-                        8, 17, 22,
-                        8, 17, 23,
-                        8, 17, 25,
-                        8, 22, 27,
-                        8, 23, 26,
-                        8, 24, 25,
-                        9, 13, 25,
-                        9, 13, 26,
-                        9, 13, 27,
-                        9, 15, 20,
-                        9, 15, 21,
-                        9, 15, 27,
-                        9, 16, 19,
-                        9, 16, 21,
-                        9, 16, 26,
-                        9, 17, 19,
-                        9, 17, 20,
-                        9, 17, 25,
-                        9, 19, 27,
-                        9, 20, 26,
-                        9, 21, 25,
-                        10, 13, 23,
-                        10, 13, 24,
-                        10, 13, 27,
-                        10, 14, 20,
-                        10, 14, 21,
-                        10, 14, 27,
-                        10, 16, 18,
-                        10, 16, 21,
-                        10, 16, 24,
-                        10, 17, 18,
-                        10, 17, 20,
-                        10, 17, 23,
-                        10, 18, 27,
-                        10, 20, 24,
-                        10, 21, 23,
-                        11, 13, 22,
-                        11, 13, 24,
-                        11, 13, 26,
-                        11, 14, 19,
-                        11, 14, 21,
-                        11, 14, 26,
-                        11, 15, 18,
-                        11, 15, 21,
-                        11, 15, 24,
-                        11, 17, 18,
-                        11, 17, 19,
-                        11, 17, 22,
-                        11, 18, 26,
-                        11, 19, 24,
-                        11, 21, 22,
-                        12, 13, 22,
-                        12, 13, 23,
-                        12, 13, 25,
-                        12, 14, 19,
-                        12, 14, 20,
-                        12, 14, 25,
-                        12, 15, 18,
-                        12, 15, 20,
-                        12, 15, 23,
-                        12, 16, 18,
-                        12, 16, 19,
-                        12, 16, 22,
-                        12, 18, 25,
-                        12, 19, 23,
-                        12, 20, 22,
-                        13, 22, 27,
-                        13, 23, 26,
-                        13, 24, 25,
-                        14, 19, 27,
-                        14, 20, 26,
-                        14, 21, 25,
-                        15, 18, 27,
-                        15, 20, 24,
-                        15, 21, 23,
-                        16, 18, 26,
-                        16, 19, 24,
-                        16, 21, 22,
-                        17, 18, 25,
-                        17, 19, 23,
-                        17, 20, 22
-                },
-                {
-                        0, 13, 22, 27,
-                        0, 13, 23, 26,
-                        0, 13, 24, 25,
-                        0, 14, 19, 27,
-                        0, 14, 20, 26,
-                        0, 14, 21, 25,
-                        0, 15, 18, 27,
-                        0, 15, 20, 24,
-                        0, 15, 21, 23,
-                        0, 16, 18, 26,
-                        0, 16, 19, 24,
-                        0, 16, 21, 22,
-                        0, 17, 18, 25,
-                        0, 17, 19, 23,
-                        0, 17, 20, 22,
-                        1, 8, 22, 27,
-                        1, 8, 23, 26,
-                        1, 8, 24, 25,
-                        1, 9, 19, 27,
-                        1, 9, 20, 26,
-                        1, 9, 21, 25,
-                        1, 10, 18, 27,
-                        1, 10, 20, 24,
-                        1, 10, 21, 23,
-                        1, 11, 18, 26,
-                        1, 11, 19, 24,
-                        1, 11, 21, 22,
-                        1, 12, 18, 25,
-                        1, 12, 19, 23,
-                        1, 12, 20, 22,
-                        2, 7, 22, 27,
-                        2, 7, 23, 26,
-                        2, 7, 24, 25,
-                        2, 9, 15, 27,
-                        2, 9, 16, 26,
-                        2, 9, 17, 25,
-                        2, 10, 14, 27,
-                        2, 10, 16, 24,
-                        2, 10, 17, 23,
-                        2, 11, 14, 26,
-                        2, 11, 15, 24,
-                        2, 11, 17, 22,
-                        2, 12, 14, 25,
-                        2, 12, 15, 23,
-                        2, 12, 16, 22,
-                        3, 7, 19, 27,
-                        3, 7, 20, 26,
-                        3, 7, 21, 25,
-                        3, 8, 15, 27,
-                        3, 8, 16, 26,
-                        3, 8, 17, 25,
-                        3, 10, 13, 27,
-                        3, 10, 16, 21,
-                        3, 10, 17, 20,
-                        3, 11, 13, 26,
-                        3, 11, 15, 21,
-                        3, 11, 17, 19,
-                        3, 12, 13, 25,
-                        3, 12, 15, 20,
-                        3, 12, 16, 19,
-                        4, 7, 18, 27,
-                        4, 7, 20, 24,
-                        4, 7, 21, 23,
-                        4, 8, 14, 27,
-                        4, 8, 16, 24,
-                        4, 8, 17, 23,
-                        4, 9, 13, 27,
-                        4, 9, 16, 21,
-                        4, 9, 17, 20,
-                        4, 11, 13, 24,
-                        4, 11, 14, 21,
-                        4, 11, 17, 18,
-                        4, 12, 13, 23,
-                        4, 12, 14, 20,
-                        4, 12, 16, 18,
-                        5, 7, 18, 26,
-                        5, 7, 19, 24,
-                        5, 7, 21, 22,
-                        5, 8, 14, 26,
-                        5, 8, 15, 24,
-                        5, 8, 17, 22,
-                        5, 9, 13, 26,
-                        5, 9, 15, 21,
-                        5, 9, 17, 19,
-                        5, 10, 13, 24,
-                        5, 10, 14, 21,
-                        5, 10, 17, 18,
-                        5, 12, 13, 22,
-                        5, 12, 14, 19,
-                        5, 12, 15, 18,
-                        6, 7, 18, 25,
-                        6, 7, 19, 23,
-                        6, 7, 20, 22,
-                        6, 8, 14, 25,
-                        6, 8, 15, 23,
-                        6, 8, 16, 22,
-                        6, 9, 13, 25,
-                        6, 9, 15, 20,
-                        6, 9, 16, 19,
-                        6, 10, 13, 23,
-                        6, 10, 14, 20,
-                        6, 10, 16, 18,
-                        6, 11, 13, 22,
-                        6, 11, 14, 19,
-                        6, 11, 15, 18
-                }
-        },
-        {
-                {
-                        0,
-                        1,
-                        2,
-                        3,
-                        4,
-                        5,
-                        6,
-                        7,
-                        8,
-                        9,
-                        10,
-                        11,
-                        12,
-                        13,
-                        14,
-                        15,
-                        16,
-                        17,
-                        18,
-                        19,
-                        20,
-                        21,
-                        22,
-                        23,
-                        24,
-                        25,
-                        26,
-                        27,
-                        28,
-                        29,
-                        30,
-                        31,
-                        32,
-                        33,
-                        34,
-                        35
-                },
-                {
-                        0, 15,
-                        0, 16,
-                        0, 17,
-                        0, 18,
-                        0, 19,
-                        0, 20,
-                        0, 21,
-                        0, 22,
-                        0, 23,
-                        0, 24,
-                        0, 25,
-                        0, 26,
-                        0, 27,
-                        0, 28,
-                        0, 29,
-                        0, 30,
-                        0, 31,
-                        0, 32,
-                        0, 33,
-                        0, 34,
-                        0, 35,
-                        1, 9,
-                        1, 10,
-                        1, 11,
-                        1, 12,
-                        1, 13,
-                        1, 14,
-                        1, 21,
-                        1, 22,
-                        1, 23,
-                        1, 24,
-                        1, 25,
-                        1, 26,
-                        1, 27,
-                        1, 28,
-                        1, 29,
-                        1, 30,
-                        1, 31,
-                        1, 32,
-                        1, 33,
-                        1, 34,
-                        1, 35,
-                        2, 8,
-                        2, 10,
-                        2, 11,
-                        2, 12,
-                        2, 13,
-                        2, 14,
-                        2, 16,
-                        2, 17,
-                        2, 18,
-                        2, 19,
-                        2, 20,
-                        2, 26,
-                        2, 27,
-                        2, 28,
-                        2, 29,
-                        2, 30,
-                        2, 31,
-                        2, 32,
-                        2, 33,
-                        2, 34,
-                        2, 35,
-                        3, 8,
-                        3, 9,
-                        3, 11,
-                        3, 12,
-                        3, 13,
-                        3, 14,
-                        3, 15,
-                        3, 17,
-                        3, 18,
-                        3, 19,
-                        3, 20,
-                        3, 22,
-                        3, 23,
-                        3, 24,
-                        3, 25,
-                        3, 30,
-                        3, 31,
-                        3, 32,
-                        3, 33,
-                        3, 34,
-                        3, 35,
-                        4, 8,
-                        4, 9,
-                        4, 10,
-                        4, 12,
-                        4, 13,
-                        4, 14,
-                        4, 15,
-                        4, 16,
-                        4, 18,
-                        4, 19,
-                        4, 20,
-                        4, 21,
-                        4, 23,
-                        4, 24,
-                        4, 25,
-                        4, 27,
-                        4, 28,
-                        4, 29,
-                        4, 33,
-                        4, 34,
-                        4, 35,
-                        5, 8,
-                        5, 9,
-                        5, 10,
-                        5, 11,
-                        5, 13,
-                        5, 14,
-                        5, 15,
-                        5, 16,
-                        5, 17,
-                        5, 19,
-                        5, 20,
-                        5, 21,
-                        5, 22,
-                        5, 24,
-                        5, 25,
-                        5, 26,
-                        5, 28,
-                        5, 29,
-                        5, 31,
-                        5, 32,
-                        5, 35,
-                        6, 8,
-                        6, 9,
-                        6, 10,
-                        6, 11,
-                        6, 12,
-                        6, 14,
-                        6, 15,
-                        6, 16,
-                        6, 17,
-                        6, 18,
-                        6, 20,
-                        6, 21,
-                        6, 22,
-                        6, 23,
-                        6, 25,
-                        6, 26,
-                        6, 27,
-                        6, 29,
-                        6, 30,
-                        6, 32,
-                        6, 34,
-                        7, 8,
-                        7, 9,
-                        7, 10,
-                        7, 11,
-                        7, 12,
-                        7, 13,
-                        7, 15,
-                        7, 16,
-                        7, 17,
-                        7, 18,
-                        7, 19,
-                        7, 21,
-                        7, 22,
-                        7, 23,
-                        7, 24,
-                        7, 26,
-                        7, 27,
-                        7, 28,
-                        7, 30,
-                        7, 31,
-                        7, 33,
-                        8, 21,
-                        8, 22,
-                        8, 23,
-                        8, 24,
-                        8, 25,
-                        8, 26,
-                        8, 27,
-                        8, 28,
-                        8, 29,
-                        8, 30,
-                        8, 31,
-                        8, 32,
-                        8, 33,
-                        8, 34,
-                        8, 35,
-                        9, 16,
-                        9, 17,
-                        9, 18,
-                        9, 19,
-                        9, 20,
-                        9, 26,
-                        9, 27,
-                        9, 28,
-                        9, 29,
-                        9, 30,
-                        9, 31,
-                        9, 32,
-                        9, 33,
-                        9, 34,
-                        9, 35,
-                        10, 15,
-                        10, 17,
-                        10, 18,
-                        10, 19,
-                        10, 20,
-                        10, 22,
-                        10, 23,
-                        10, 24,
-                        10, 25,
-                        10, 30,
-                        10, 31,
-                        10, 32,
-                        10, 33,
-                        10, 34,
-                        10, 35,
-                        11, 15,
-                        11, 16,
-                        11, 18,
-                        11, 19,
-                        11, 20,
-                        11, 21,
-                        11, 23,
-                        11, 24,
-                        11, 25,
-                        11, 27,
-                        11, 28,
-                        11, 29,
-                        11, 33,
-                        11, 34,
-                        11, 35,
-                        12, 15,
-                        12, 16,
-                        12, 17,
-                        12, 19,
-                        12, 20,
-                        12, 21,
-                        12, 22,
-                        12, 24,
-                        12, 25,
-                        12, 26,
-                        12, 28,
-                        12, 29,
-                        12, 31,
-                        12, 32,
-                        12, 35,
-                        13, 15,
-                        13, 16,
-                        13, 17,
-                        13, 18,
-                        13, 20,
-                        13, 21,
-                        13, 22,
-                        13, 23,
-                        13, 25,
-                        13, 26,
-                        13, 27,
-                        13, 29,
-                        13, 30,
-                        13, 32,
-                        13, 34,
-                        14, 15,
-                        14, 16,
-                        14, 17,
-                        14, 18,
-                        14, 19,
-                        14, 21,
-                        14, 22,
-                        14, 23,
-                        14, 24,
-                        14, 26,
-                        14, 27,
-                        14, 28,
-                        14, 30,
-                        14, 31,
-                        14, 33,
-                        15, 26,
-                        15, 27,
-                        15, 28,
-                        15, 29,
-                        15, 30,
-                        15, 31,
-                        15, 32,
-                        15, 33,
-                        15, 34,
-                        15, 35,
-                        16, 22,
-                        16, 23,
-                        16, 24,
-                        16, 25,
-                        16, 30,
-                        16, 31,
-                        16, 32,
-                        16, 33,
-                        16, 34,
-                        16, 35,
-                        17, 21,
-                        17, 23,
-                        17, 24,
-                        17, 25,
-                        17, 27,
-                        17, 28,
-                        17, 29,
-                        17, 33,
-                        17, 34,
-                        17, 35,
-                        18, 21,
-                        18, 22,
-                        18, 24,
-                        18, 25,
-                        18, 26,
-                        18, 28,
-                        18, 29,
-                        18, 31,
-                        18, 32,
-                        18, 35,
-                        19, 21,
-                        19, 22,
-                        19, 23,
-                        19, 25,
-                        19, 26,
-                        19, 27,
-                        19, 29,
-                        19, 30,
-                        19, 32,
-                        19, 34,
-                        20, 21,
-                        20, 22,
-                        20, 23,
-                        20, 24,
-                        20, 26,
-                        20, 27,
-                        20, 28,
-                        20, 30,
-                        20, 31,
-                        20, 33,
-                        21, 30,
-                        21, 31,
-                        21, 32,
-                        21, 33,
-                        21, 34,
-                        21, 35,
-                        22, 27,
-                        22, 28,
-                        22, 29,
-                        22, 33,
-                        22, 34,
-                        22, 35,
-                        23, 26,
-                        23, 28,
-                        23, 29,
-                        23, 31,
-                        23, 32,
-                        23, 35,
-                        24, 26,
-                        24, 27,
-                        24, 29,
-                        24, 30,
-                        24, 32,
-                        24, 34,
-                        25, 26,
-                        25, 27,
-                        25, 28,
-                        25, 30,
-                        25, 31,
-                        25, 33,
-                        26, 33,
-                        26, 34,
-                        26, 35,
-                        27, 31,
-                        27, 32,
-                        27, 35,
-                        28, 30,
-                        28, 32,
-                        28, 34,
-                        29, 30,
-                        29, 31,
-                        29, 33,
-                        30, 35,
-                        31, 34,
-                        32, 33
-                },
-                {
-                        0, 15, 26,
-                        0, 15, 27,
-                        0, 15, 28,
-                        0, 15, 29,
-                        0, 15, 30,
-                        0, 15, 31,
-                        0, 15, 32,
-                        0, 15, 33,
-                        0, 15, 34,
-                        0, 15, 35,
-                        0, 16, 22,
-                        0, 16, 23,
-                        0, 16, 24,
-                        0, 16, 25,
-                        0, 16, 30,
-                        0, 16, 31,
-                        0, 16, 32,
-                        0, 16, 33,
-                        0, 16, 34,
-                        0, 16, 35,
-                        0, 17, 21,
-                        0, 17, 23,
-                        0, 17, 24,
-                        0, 17, 25,
-                        0, 17, 27,
-                        0, 17, 28,
-                        0, 17, 29,
-                        0, 17, 33,
-                        0, 17, 34,
-                        0, 17, 35,
-                        0, 18, 21,
-                        0, 18, 22,
-                        0, 18, 24,
-                        0, 18, 25,
-                        0, 18, 26,
-                        0, 18, 28,
-                        0, 18, 29,
-                        0, 18, 31,
-                        0, 18, 32,
-                        0, 18, 35,
-                        0, 19, 21,
-                        0, 19, 22,
-                        0, 19, 23,
-                        0, 19, 25,
-                        0, 19, 26,
-                        0, 19, 27,
-                        0, 19, 29,
-                        0, 19, 30,
-                        0, 19, 32,
-                        0, 19, 34,
-                        0, 20, 21,
-                        0, 20, 22,
-                        0, 20, 23,
-                        0, 20, 24,
-                        0, 20, 26,
-                        0, 20, 27,
-                        0, 20, 28,
-                        0, 20, 30,
-                        0, 20, 31,
-                        0, 20, 33,
-                        0, 21, 30,
-                        0, 21, 31,
-                        0, 21, 32,
-                        0, 21, 33,
-                        0, 21, 34,
-                        0, 21, 35,
-                        0, 22, 27,
-                        0, 22, 28,
-                        0, 22, 29,
-                        0, 22, 33,
-                        0, 22, 34,
-                        0, 22, 35,
-                        0, 23, 26,
-                        0, 23, 28,
-                        0, 23, 29,
-                        0, 23, 31,
-                        0, 23, 32,
-                        0, 23, 35,
-                        0, 24, 26,
-                        0, 24, 27,
-                        0, 24, 29,
-                        0, 24, 30,
-                        0, 24, 32,
-                        0, 24, 34,
-                        0, 25, 26,
-                        0, 25, 27,
-                        0, 25, 28,
-                        0, 25, 30,
-                        0, 25, 31,
-                        0, 25, 33,
-                        0, 26, 33,
-                        0, 26, 34,
-                        0, 26, 35,
-                        0, 27, 31,
-                        0, 27, 32,
-                        0, 27, 35,
-                        0, 28, 30,
-                        0, 28, 32,
-                        0, 28, 34,
-                        0, 29, 30,
-                        0, 29, 31,
-                        0, 29, 33,
-                        0, 30, 35,
-                        0, 31, 34,
-                        0, 32, 33,
-                        1, 9, 26,
-                        1, 9, 27,
-                        1, 9, 28,
-                        1, 9, 29,
-                        1, 9, 30,
-                        1, 9, 31,
-                        1, 9, 32,
-                        1, 9, 33,
-                        1, 9, 34,
-                        1, 9, 35,
-                        1, 10, 22,
-                        1, 10, 23,
-                        1, 10, 24,
-                        1, 10, 25,
-                        1, 10, 30,
-                        1, 10, 31,
-                        1, 10, 32,
-                        1, 10, 33,
-                        1, 10, 34,
-                        1, 10, 35,
-                        1, 11, 21,
-                        1, 11, 23,
-                        1, 11, 24,
-                        1, 11, 25,
-                        1, 11, 27,
-                        1, 11, 28,
-                        1, 11, 29,
-                        1, 11, 33,
-                        1, 11, 34,
-                        1, 11, 35,
-                        1, 12, 21,
-                        1, 12, 22,
-                        1, 12, 24,
-                        1, 12, 25,
-                        1, 12, 26,
-                        1, 12, 28,
-                        1, 12, 29,
-                        1, 12, 31,
-                        1, 12, 32,
-                        1, 12, 35,
-                        1, 13, 21,
-                        1, 13, 22,
-                        1, 13, 23,
-                        1, 13, 25,
-                        1, 13, 26,
-                        1, 13, 27,
-                        1, 13, 29,
-                        1, 13, 30,
-                        1, 13, 32,
-                        1, 13, 34,
-                        1, 14, 21,
-                        1, 14, 22,
-                        1, 14, 23,
-                        1, 14, 24,
-                        1, 14, 26,
-                        1, 14, 27,
-                        1, 14, 28,
-                        1, 14, 30,
-                        1, 14, 31,
-                        1, 14, 33,
-                        1, 21, 30,
-                        1, 21, 31,
-                        1, 21, 32,
-                        1, 21, 33,
-                        1, 21, 34,
-                        1, 21, 35,
-                        1, 22, 27,
-                        1, 22, 28,
-                        1, 22, 29,
-                        1, 22, 33,
-                        1, 22, 34,
-                        1, 22, 35,
-                        1, 23, 26,
-                        1, 23, 28,
-                        1, 23, 29,
-                        1, 23, 31,
-                        1, 23, 32,
-                        1, 23, 35,
-                        1, 24, 26,
-                        1, 24, 27,
-                        1, 24, 29,
-                        1, 24, 30,
-                        1, 24, 32,
-                        1, 24, 34,
-                        1, 25, 26,
-                        1, 25, 27,
-                        1, 25, 28,
-                        1, 25, 30,
-                        1, 25, 31,
-                        1, 25, 33,
-                        1, 26, 33,
-                        1, 26, 34,
-                        1, 26, 35,
-                        1, 27, 31,
-                        1, 27, 32,
-                        1, 27, 35,
-                        1, 28, 30,
-                        1, 28, 32,
-                        1, 28, 34,
-                        1, 29, 30,
-                        1, 29, 31,
-                        1, 29, 33,
-                        1, 30, 35,
-                        1, 31, 34,
-                        1, 32, 33,
-                        2, 8, 26,
-                        2, 8, 27,
-                        2, 8, 28,
-                        2, 8, 29,
-                        2, 8, 30,
-                        2, 8, 31,
-                        2, 8, 32,
-                        2, 8, 33,
-                        2, 8, 34,
-                        2, 8, 35,
-                        2, 10, 17,
-                        2, 10, 18,
-                        2, 10, 19,
-                        2, 10, 20,
-                        2, 10, 30,
-                        2, 10, 31,
-                        2, 10, 32,
-                        2, 10, 33,
-                        2, 10, 34,
-                        2, 10, 35,
-                        2, 11, 16,
-                        2, 11, 18,
-                        2, 11, 19,
-                        2, 11, 20,
-                        2, 11, 27,
-                        2, 11, 28,
-                        2, 11, 29,
-                        2, 11, 33,
-                        2, 11, 34,
-                        2, 11, 35,
-                        2, 12, 16,
-                        2, 12, 17,
-                        2, 12, 19,
-                        2, 12, 20,
-                        2, 12, 26,
-                        2, 12, 28,
-                        2, 12, 29,
-                        2, 12, 31,
-                        2, 12, 32,
-                        2, 12, 35,
-                        2, 13, 16,
-                        2, 13, 17,
-                        2, 13, 18,
-                        2, 13, 20,
-                        2, 13, 26,
-                        2, 13, 27,
-                        2, 13, 29,
-                        2, 13, 30,
-                        2, 13, 32,
-                        2, 13, 34,
-                        2, 14, 16,
-                        2, 14, 17,
-                        2, 14, 18,
-                        2, 14, 19,
-                        2, 14, 26,
-                        2, 14, 27,
-                        2, 14, 28,
-                        2, 14, 30,
-                        2, 14, 31,
-                        2, 14, 33,
-                        2, 16, 30,
-                        2, 16, 31,
-                        2, 16, 32,
-                        2, 16, 33,
-                        2, 16, 34,
-                        2, 16, 35,
-                        2, 17, 27,
-                        2, 17, 28,
-                        2, 17, 29,
-                        2, 17, 33,
-                        2, 17, 34,
-                        2, 17, 35,
-                        2, 18, 26,
-                        2, 18, 28,
-                        2, 18, 29,
-                        2, 18, 31,
-                        2, 18, 32,
-                        2, 18, 35,
-                        2, 19, 26,
-                        2, 19, 27,
-                        2, 19, 29,
-                        2, 19, 30,
-                        2, 19, 32,
-                        2, 19, 34,
-                        2, 20, 26,
-                        2, 20, 27,
-                        2, 20, 28,
-                        2, 20, 30,
-                        2, 20, 31,
-                        2, 20, 33,
-                        2, 26, 33,
-                        2, 26, 34,
-                        2, 26, 35,
-                        2, 27, 31,
-                        2, 27, 32,
-                        2, 27, 35,
-                        2, 28, 30,
-                        2, 28, 32,
-                        2, 28, 34,
-                        2, 29, 30,
-                        2, 29, 31,
-                        2, 29, 33,
-                        2, 30, 35,
-                        2, 31, 34,
-                        2, 32, 33,
-                        3, 8, 22,
-                        3, 8, 23,
-                        3, 8, 24,
-                        3, 8, 25,
-                        3, 8, 30,
-                        3, 8, 31,
-                        3, 8, 32,
-                        3, 8, 33,
-                        3, 8, 34,
-                        3, 8, 35,
-                        3, 9, 17,
-                        3, 9, 18,
-                        3, 9, 19,
-                        3, 9, 20,
-                        3, 9, 30,
-                        3, 9, 31,
-                        3, 9, 32,
-                        3, 9, 33,
-                        3, 9, 34,
-                        3, 9, 35,
-                        3, 11, 15,
-                        3, 11, 18,
-                        3, 11, 19,
-                        3, 11, 20,
-                        3, 11, 23,
-                        3, 11, 24,
-                        3, 11, 25,
-                        3, 11, 33,
-                        3, 11, 34,
-                        3, 11, 35,
-                        3, 12, 15,
-                        3, 12, 17,
-                        3, 12, 19,
-                        3, 12, 20,
-                        3, 12, 22,
-                        3, 12, 24,
-                        3, 12, 25,
-                        3, 12, 31,
-                        3, 12, 32,
-                        3, 12, 35,
-                        3, 13, 15,
-                        3, 13, 17,
-                        3, 13, 18,
-                        3, 13, 20,
-                        3, 13, 22,
-                        3, 13, 23,
-                        3, 13, 25,
-                        3, 13, 30,
-                        3, 13, 32,
-                        3, 13, 34,
-                        3, 14, 15,
-                        3, 14, 17,
-                        3, 14, 18,
-                        3, 14, 19,
-                        3, 14, 22,
-                        3, 14, 23,
-                        3, 14, 24,
-                        3, 14, 30,
-                        3, 14, 31,
-                        3, 14, 33,
-                        3, 15, 30,
-                        3, 15, 31,
-                        3, 15, 32,
-                        3, 15, 33,
-                        3, 15, 34,
-                        3, 15, 35,
-                        3, 17, 23,
-                        3, 17, 24,
-                        3, 17, 25,
-                        3, 17, 33,
-                        3, 17, 34,
-                        3, 17, 35,
-                        3, 18, 22,
-                        3, 18, 24,
-                        3, 18, 25,
-                        3, 18, 31,
-                        3, 18, 32,
-                        3, 18, 35,
-                        3, 19, 22,
-                        3, 19, 23,
-                        3, 19, 25,
-                        3, 19, 30,
-                        3, 19, 32,
-                        3, 19, 34,
-                        3, 20, 22,
-                        3, 20, 23,
-                        3, 20, 24,
-                        3, 20, 30,
-                        3, 20, 31,
-                        3, 20, 33,
-                        3, 22, 33,
-                        3, 22, 34,
-                        3, 22, 35,
-                        3, 23, 31,
-                        3, 23, 32,
-                        3, 23, 35,
-                        3, 24, 30,
-                        3, 24, 32,
-                        3, 24, 34,
-                        3, 25, 30,
-                        3, 25, 31,
-                        3, 25, 33,
-                        3, 30, 35,
-                        3, 31, 34,
-                        3, 32, 33,
-                        4, 8, 21,
-                        4, 8, 23,
-                        4, 8, 24,
-                        4, 8, 25,
-                        4, 8, 27,
-                        4, 8, 28,
-                        4, 8, 29,
-                        4, 8, 33,
-                        4, 8, 34,
-                        4, 8, 35,
-                        4, 9, 16,
-                        4, 9, 18,
-                        4, 9, 19,
-                        4, 9, 20,
-                        4, 9, 27,
-                        4, 9, 28,
-                        4, 9, 29,
-                        4, 9, 33,
-                        4, 9, 34,
-                        4, 9, 35,
-                        4, 10, 15,
-                        4, 10, 18,
-                        4, 10, 19,
-                        4, 10, 20,
-                        4, 10, 23,
-                        4, 10, 24,
-                        4, 10, 25,
-                        4, 10, 33,
-                        4, 10, 34,
-                        4, 10, 35,
-                        4, 12, 15,
-                        4, 12, 16,
-                        4, 12, 19,
-                        4, 12, 20,
-                        4, 12, 21,
-                        4, 12, 24,
-                        4, 12, 25,
-                        4, 12, 28,
-                        4, 12, 29,
-                        4, 12, 35,
-                        4, 13, 15,
-                        4, 13, 16,
-                        4, 13, 18,
-                        4, 13, 20,
-                        4, 13, 21,
-                        4, 13, 23,
-                        4, 13, 25,
-                        4, 13, 27,
-                        4, 13, 29,
-                        4, 13, 34,
-                        4, 14, 15,
-                        4, 14, 16,
-                        4, 14, 18,
-                        4, 14, 19,
-                        4, 14, 21,
-                        4, 14, 23,
-                        4, 14, 24,
-                        4, 14, 27,
-                        4, 14, 28,
-                        4, 14, 33,
-                        4, 15, 27,
-                        4, 15, 28,
-                        4, 15, 29,
-                        4, 15, 33,
-                        4, 15, 34,
-                        4, 15, 35,
-                        4, 16, 23,
-                        4, 16, 24,
-                        4, 16, 25,
-                        4, 16, 33,
-                        4, 16, 34,
-                        4, 16, 35,
-                        4, 18, 21,
-                        4, 18, 24,
-                        4, 18, 25,
-                        4, 18, 28,
-                        4, 18, 29,
-                        4, 18, 35,
-                        4, 19, 21,
-                        4, 19, 23,
-                        4, 19, 25,
-                        4, 19, 27,
-                        4, 19, 29,
-                        4, 19, 34,
-                        4, 20, 21,
-                        4, 20, 23,
-                        4, 20, 24,
-                        4, 20, 27,
-                        4, 20, 28,
-                        4, 20, 33,
-                        4, 21, 33,
-                        4, 21, 34,
-                        4, 21, 35,
-                        4, 23, 28,
-                        4, 23, 29,
-                        4, 23, 35,
-                        4, 24, 27,
-                        4, 24, 29,
-                        4, 24, 34,
-                        4, 25, 27,
-                        4, 25, 28,
-                        4, 25, 33,
-                        4, 27, 35,
-                        4, 28, 34,
-                        4, 29, 33,
-                        5, 8, 21,
-                        5, 8, 22,
-                        5, 8, 24,
-                        5, 8, 25,
-                        5, 8, 26,
-                        5, 8, 28,
-                        5, 8, 29,
-                        5, 8, 31,
-                        5, 8, 32,
-                        5, 8, 35,
-                        5, 9, 16,
-                        5, 9, 17,
-                        5, 9, 19,
-                        5, 9, 20,
-                        5, 9, 26,
-                        5, 9, 28,
-                        5, 9, 29,
-                        5, 9, 31,
-                        5, 9, 32,
-                        5, 9, 35,
-                        5, 10, 15,
-                        5, 10, 17,
-                        5, 10, 19,
-                        5, 10, 20,
-                        5, 10, 22,
-                        5, 10, 24,
-                        5, 10, 25,
-                        5, 10, 31,
-                        5, 10, 32,
-                        5, 10, 35,
-                        5, 11, 15,
-                        5, 11, 16,
-                        5, 11, 19,
-                        5, 11, 20,
-                        5, 11, 21,
-                        5, 11, 24,
-                        5, 11, 25,
-                        5, 11, 28,
-                        5, 11, 29,
-                        5, 11, 35,
-                        5, 13, 15,
-                        5, 13, 16,
-                        5, 13, 17,
-                        5, 13, 20,
-                        5, 13, 21,
-                        5, 13, 22,
-                        5, 13, 25,
-                        5, 13, 26,
-                        5, 13, 29,
-                        5, 13, 32,
-                        5, 14, 15,
-                        5, 14, 16,
-                        5, 14, 17,
-                        5, 14, 19,
-                        5, 14, 21,
-                        5, 14, 22,
-                        5, 14, 24,
-                        5, 14, 26,
-                        5, 14, 28,
-                        5, 14, 31,
-                        5, 15, 26,
-                        5, 15, 28,
-                        5, 15, 29,
-                        5, 15, 31,
-                        5, 15, 32,
-                        5, 15, 35,
-                        5, 16, 22,
-                        5, 16, 24,
-                        5, 16, 25,
-                        5, 16, 31,
-                        5, 16, 32,
-                        5, 16, 35,
-                        5, 17, 21,
-                        5, 17, 24,
-                        5, 17, 25,
-                        5, 17, 28,
-                        5, 17, 29,
-                        5, 17, 35,
-                        5, 19, 21,
-                        5, 19, 22,
-                        5, 19, 25,
-                        5, 19, 26,
-                        5, 19, 29,
-                        5, 19, 32,
-                        5, 20, 21,
-                        5, 20, 22,
-                        5, 20, 24,
-                        5, 20, 26,
-                        5, 20, 28,
-                        5, 20, 31,
-                        5, 21, 31,
-                        5, 21, 32,
-                        5, 21, 35,
-                        5, 22, 28,
-                        5, 22, 29,
-                        5, 22, 35,
-                        5, 24, 26,
-                        5, 24, 29,
-                        5, 24, 32,
-                        5, 25, 26,
-                        5, 25, 28,
-                        5, 25, 31,
-                        5, 26, 35,
-                        5, 28, 32,
-                        5, 29, 31,
-                        6, 8, 21,
-                        6, 8, 22,
-                        6, 8, 23,
-                        6, 8, 25,
-                        6, 8, 26,
-                        6, 8, 27,
-                        6, 8, 29,
-                        6, 8, 30,
-                        6, 8, 32,
-                        6, 8, 34,
-                        6, 9, 16,
-                        6, 9, 17,
-                        6, 9, 18,
-                        6, 9, 20,
-                        6, 9, 26,
-                        6, 9, 27,
-                        6, 9, 29,
-                        6, 9, 30,
-                        6, 9, 32,
-                        6, 9, 34,
-                        6, 10, 15,
-                        6, 10, 17,
-                        6, 10, 18,
-                        6, 10, 20,
-                        6, 10, 22,
-                        6, 10, 23,
-                        6, 10, 25,
-                        6, 10, 30,
-                        6, 10, 32,
-                        6, 10, 34,
-                        6, 11, 15,
-                        6, 11, 16,
-                        6, 11, 18,
-                        6, 11, 20,
-                        6, 11, 21,
-                        6, 11, 23,
-                        6, 11, 25,
-                        6, 11, 27,
-                        6, 11, 29,
-                        6, 11, 34,
-                        6, 12, 15,
-                        6, 12, 16,
-                        6, 12, 17,
-                        6, 12, 20,
-                        6, 12, 21,
-                        6, 12, 22,
-                        6, 12, 25,
-                        6, 12, 26,
-                        6, 12, 29,
-                        6, 12, 32,
-                        6, 14, 15,
-                        6, 14, 16,
-                        6, 14, 17,
-                        6, 14, 18,
-                        6, 14, 21,
-                        6, 14, 22,
-                        6, 14, 23,
-                        6, 14, 26,
-                        6, 14, 27,
-                        6, 14, 30,
-                        6, 15, 26,
-                        6, 15, 27,
-                        6, 15, 29,
-                        6, 15, 30,
-                        6, 15, 32,
-                        6, 15, 34,
-                        6, 16, 22,
-                        6, 16, 23,
-                        6, 16, 25,
-                        6, 16, 30,
-                        6, 16, 32,
-                        6, 16, 34,
-                        6, 17, 21,
-                        6, 17, 23,
-                        6, 17, 25,
-                        6, 17, 27,
-                        6, 17, 29,
-                        6, 17, 34,
-                        6, 18, 21,
-                        6, 18, 22,
-                        6, 18, 25,
-                        6, 18, 26,
-                        6, 18, 29,
-                        6, 18, 32,
-                        6, 20, 21,
-                        6, 20, 22,
-                        6, 20, 23,
-                        6, 20, 26,
-                        6, 20, 27,
-                        6, 20, 30,
-                        6, 21, 30,
-                        6, 21, 32,
-                        6, 21, 34,
-                        6, 22, 27,
-                        6, 22, 29,
-                        6, 22, 34,
-                        6, 23, 26,
-                        6, 23, 29,
-                        6, 23, 32,
-                        6, 25, 26,
-                        6, 25, 27,
-                        6, 25, 30,
-                        6, 26, 34,
-                        6, 27, 32,
-                        6, 29, 30,
-                        7, 8, 21,
-                        7, 8, 22,
-                        7, 8, 23,
-                        7, 8, 24,
-                        7, 8, 26,
-                        7, 8, 27,
-                        7, 8, 28,
-                        7, 8, 30,
-                        7, 8, 31,
-                        7, 8, 33,
-                        7, 9, 16,
-                        7, 9, 17,
-                        7, 9, 18,
-                        7, 9, 19,
-                        7, 9, 26,
-                        7, 9, 27,
-                        7, 9, 28,
-                        7, 9, 30,
-                        7, 9, 31,
-                        7, 9, 33,
-                        7, 10, 15,
-                        7, 10, 17,
-                        7, 10, 18,
-                        7, 10, 19,
-                        7, 10, 22,
-                        7, 10, 23,
-                        7, 10, 24,
-                        7, 10, 30,
-                        7, 10, 31,
-                        7, 10, 33,
-                        7, 11, 15,
-                        7, 11, 16,
-                        7, 11, 18,
-                        7, 11, 19,
-                        7, 11, 21,
-                        7, 11, 23,
-                        7, 11, 24,
-                        7, 11, 27,
-                        7, 11, 28,
-                        7, 11, 33,
-                        7, 12, 15,
-                        7, 12, 16,
-                        7, 12, 17,
-                        7, 12, 19,
-                        7, 12, 21,
-                        7, 12, 22,
-                        7, 12, 24,
-                        7, 12, 26,
-                        7, 12, 28,
-                        7, 12, 31,
-                        7, 13, 15,
-                        7, 13, 16,
-                        7, 13, 17,
-                        7, 13, 18,
-                        7, 13, 21,
-                        7, 13, 22,
-                        7, 13, 23,
-                        7, 13, 26,
-                        7, 13, 27,
-                        7, 13, 30,
-                        7, 15, 26,
-                        7, 15, 27,
-                        7, 15, 28,
-                        7, 15, 30,
-                        7, 15, 31,
-                        7, 15, 33,
-                        7, 16, 22,
-                        7, 16, 23,
-                        7, 16, 24,
-                        7, 16, 30,
-                        7, 16, 31,
-                        7, 16, 33,
-                        7, 17, 21,
-                        7, 17, 23,
-                        7, 17, 24,
-                        7, 17, 27,
-                        7, 17, 28,
-                        7, 17, 33,
-                        7, 18, 21,
-                        7, 18, 22,
-                        7, 18, 24,
-                        7, 18, 26,
-                        7, 18, 28,
-                        7, 18, 31,
-                        7, 19, 21,
-                        7, 19, 22,
-                        7, 19, 23,
-                        7, 19, 26,
-                        7, 19, 27,
-                        7, 19, 30,
-                        7, 21, 30,
-                        7, 21, 31,
-                        7, 21, 33,
-                        7, 22, 27,
-                        7, 22, 28,
-                        7, 22, 33,
-                        7, 23, 26,
-                        7, 23, 28,
-                        7, 23, 31,
-                        7, 24, 26,
-                        7, 24, 27,
-                        7, 24, 30,
-                        7, 26, 33,
-                        7, 27, 31,
-                        7, 28, 30,
-                        8, 21, 30,
-                        8, 21, 31,
-                        8, 21, 32,
-                        8, 21, 33,
-                        8, 21, 34,
-                        8, 21, 35,
-                        8, 22, 27,
-                        8, 22, 28,
-                        8, 22, 29,
-                        8, 22, 33,
-                        8, 22, 34,
-                        8, 22, 35,
-                        8, 23, 26,
-                        8, 23, 28,
-                        8, 23, 29,
-                        8, 23, 31,
-                        8, 23, 32,
-                        8, 23, 35,
-                        8, 24, 26,
-                        8, 24, 27,
-                        8, 24, 29,
-                        8, 24, 30,
-                        8, 24, 32,
-                        8, 24, 34,
-                        8, 25, 26,
-                        8, 25, 27,
-                        8, 25, 28,
-                        8, 25, 30,
-                        8, 25, 31,
-                        8, 25, 33,
-                        8, 26, 33,
-                        8, 26, 34,
-                        8, 26, 35,
-                        8, 27, 31,
-                        8, 27, 32,
-                        8, 27, 35,
-                        8, 28, 30,
-                        8, 28, 32,
-                        8, 28, 34,
-                        8, 29, 30,
-                        8, 29, 31,
-                        8, 29, 33,
-                        8, 30, 35,
-                        8, 31, 34,
-                        8, 32, 33,
-                        9, 16, 30,
-                        9, 16, 31,
-                        9, 16, 32,
-                        9, 16, 33,
-                        9, 16, 34,
-                        9, 16, 35,
-                        9, 17, 27,
-                        9, 17, 28,
-                        9, 17, 29,
-                        9, 17, 33,
-                        9, 17, 34,
-                        9, 17, 35,
-                        9, 18, 26,
-                        9, 18, 28,
-                        9, 18, 29,
-                        9, 18, 31,
-                        9, 18, 32,
-                        9, 18, 35,
-                        9, 19, 26,
-                        9, 19, 27,
-                        9, 19, 29,
-                        9, 19, 30,
-                        9, 19, 32,
-                        9, 19, 34,
-                        9, 20, 26,
-                        9, 20, 27,
-                        9, 20, 28,
-                        9, 20, 30,
-                        9, 20, 31,
-                        9, 20, 33,
-                        9, 26, 33,
-                        9, 26, 34,
-                        9, 26, 35,
-                        9, 27, 31,
-                        9, 27, 32,
-                        9, 27, 35,
-                        9, 28, 30,
-                        9, 28, 32,
-                        9, 28, 34,
-                        9, 29, 30,
-                        9, 29, 31,
-                        9, 29, 33,
-                        9, 30, 35,
-                        9, 31, 34,
-                        9, 32, 33,
-                        10, 15, 30,
-                        10, 15, 31,
-                        10, 15, 32,
-                        10, 15, 33,
-                        10, 15, 34,
-                        10, 15, 35,
-                        10, 17, 23,
-                        10, 17, 24,
-                        10, 17, 25,
-                        10, 17, 33,
-                        10, 17, 34,
-                        10, 17, 35,
-                        10, 18, 22,
-                        10, 18, 24,
-                        10, 18, 25,
-                        10, 18, 31,
-                        10, 18, 32,
-                        10, 18, 35,
-                        10, 19, 22,
-                        10, 19, 23,
-                        10, 19, 25,
-                        10, 19, 30,
-                        10, 19, 32,
-                        10, 19, 34,
-                        10, 20, 22,
-                        10, 20, 23,
-                        10, 20, 24,
-                        10, 20, 30,
-                        10, 20, 31,
-                        10, 20, 33,
-                        10, 22, 33,
-                        10, 22, 34,
-                        10, 22, 35,
-                        10, 23, 31,
-                        10, 23, 32,
-                        10, 23, 35,
-                        10, 24, 30,
-                        10, 24, 32,
-                        10, 24, 34,
-                        10, 25, 30,
-                        10, 25, 31,
-                        10, 25, 33,
-                        10, 30, 35,
-                        10, 31, 34,
-                        10, 32, 33,
-                        11, 15, 27,
-                        11, 15, 28,
-                        11, 15, 29,
-                        11, 15, 33,
-                        11, 15, 34,
-                        11, 15, 35,
-                        11, 16, 23,
-                        11, 16, 24,
-                        11, 16, 25,
-                        11, 16, 33,
-                        11, 16, 34,
-                        11, 16, 35,
-                        11, 18, 21,
-                        11, 18, 24,
-                        11, 18, 25,
-                        11, 18, 28,
-                        11, 18, 29,
-                        11, 18, 35,
-                        11, 19, 21,
-                        11, 19, 23,
-                        11, 19, 25,
-                        11, 19, 27,
-                        11, 19, 29,
-                        11, 19, 34,
-                        11, 20, 21,
-                        11, 20, 23,
-                        11, 20, 24,
-                        11, 20, 27,
-                        11, 20, 28,
-                        11, 20, 33,
-                        11, 21, 33,
-                        11, 21, 34,
-                        11, 21, 35,
-                        11, 23, 28,
-                        11, 23, 29,
-                        11, 23, 35,
-                        11, 24, 27,
-                        11, 24, 29,
-                        11, 24, 34,
-                        11, 25, 27,
-                        11, 25, 28,
-                        11, 25, 33,
-                        11, 27, 35,
-                        11, 28, 34,
-                        11, 29, 33,
-                        12, 15, 26,
-                        12, 15, 28,
-                        12, 15, 29,
-                        12, 15, 31,
-                        12, 15, 32,
-                        12, 15, 35,
-                        12, 16, 22,
-                        12, 16, 24,
-                        12, 16, 25,
-                        12, 16, 31,
-                        12, 16, 32,
-                        12, 16, 35,
-                        12, 17, 21,
-                        12, 17, 24,
-                        12, 17, 25,
-                        12, 17, 28,
-                        12, 17, 29,
-                        12, 17, 35,
-                        12, 19, 21,
-                        12, 19, 22,
-                        12, 19, 25,
-                        12, 19, 26,
-                        12, 19, 29,
-                        12, 19, 32,
-                        12, 20, 21,
-                        12, 20, 22,
-                        12, 20, 24,
-                        12, 20, 26,
-                        12, 20, 28,
-                        12, 20, 31,
-                        12, 21, 31,
-                        12, 21, 32,
-                        12, 21, 35,
-                        12, 22, 28,
-                        12, 22, 29,
-                        12, 22, 35,
-                        12, 24, 26,
-                        12, 24, 29,
-                        12, 24, 32,
-                        12, 25, 26,
-                        12, 25, 28,
-                        12, 25, 31,
-                        12, 26, 35,
-                        12, 28, 32,
-                        12, 29, 31,
-                        13, 15, 26,
-                        13, 15, 27,
-                        13, 15, 29,
-                        13, 15, 30,
-                        13, 15, 32,
-                        13, 15, 34,
-                        13, 16, 22,
-                        13, 16, 23,
-                        13, 16, 25,
-                        13, 16, 30,
-                        13, 16, 32,
-                        13, 16, 34,
-                        13, 17, 21,
-                        13, 17, 23,
-                        13, 17, 25,
-                        13, 17, 27,
-                        13, 17, 29,
-                        13, 17, 34,
-                        13, 18, 21,
-                        13, 18, 22,
-                        13, 18, 25,
-                        13, 18, 26,
-                        13, 18, 29,
-                        13, 18, 32,
-                        13, 20, 21,
-                        13, 20, 22,
-                        13, 20, 23,
-                        13, 20, 26,
-                        13, 20, 27,
-                        13, 20, 30,
-                        13, 21, 30,
-                        13, 21, 32,
-                        13, 21, 34,
-                        13, 22, 27,
-                        13, 22, 29,
-                        13, 22, 34,
-                        13, 23, 26,
-                        13, 23, 29,
-                        13, 23, 32,
-                        13, 25, 26,
-                        13, 25, 27,
-                        13, 25, 30,
-                        13, 26, 34,
-                        13, 27, 32,
-                        13, 29, 30,
-                        14, 15, 26,
-                        14, 15, 27,
-                        14, 15, 28,
-                        14, 15, 30,
-                        14, 15, 31,
-                        14, 15, 33,
-                        14, 16, 22,
-                        14, 16, 23,
-                        14, 16, 24,
-                        14, 16, 30,
-                        14, 16, 31,
-                        14, 16, 33,
-                        14, 17, 21,
-                        14, 17, 23,
-                        14, 17, 24,
-                        14, 17, 27,
-                        14, 17, 28,
-                        14, 17, 33,
-                        14, 18, 21,
-                        14, 18, 22,
-                        14, 18, 24,
-                        14, 18, 26,
-                        14, 18, 28,
-                        14, 18, 31,
-                        14, 19, 21,
-                        14, 19, 22,
-                        14, 19, 23,
-                        14, 19, 26,
-                        14, 19, 27,
-                        14, 19, 30,
-                        14, 21, 30,
-                        14, 21, 31,
-                        14, 21, 33,
-                        14, 22, 27,
-                        14, 22, 28,
-                        14, 22, 33,
-                        14, 23, 26,
-                        14, 23, 28,
-                        14, 23, 31,
-                        14, 24, 26,
-                        14, 24, 27,
-                        14, 24, 30,
-                        14, 26, 33,
-                        14, 27, 31,
-                        14, 28, 30,
-                        15, 26, 33,
-                        15, 26, 34,
-                        15, 26, 35,
-                        15, 27, 31,
-                        15, 27, 32,
-                        15, 27, 35,
-                        15, 28, 30,
-                        15, 28, 32,
-                        15, 28, 34,
-                        15, 29, 30,
-                        15, 29, 31,
-                        15, 29, 33,
-                        15, 30, 35,
-                        15, 31, 34,
-                        15, 32, 33,
-                        16, 22, 33,
-                        16, 22, 34,
-                        16, 22, 35,
-                        16, 23, 31,
-                        16, 23, 32,
-                        16, 23, 35,
-                        16, 24, 30,
-                        16, 24, 32,
-                        16, 24, 34,
-                        16, 25, 30,
-                        16, 25, 31,
-                        16, 25, 33,
-                        16, 30, 35,
-                        16, 31, 34,
-                        16, 32, 33,
-                        17, 21, 33,
-                        17, 21, 34,
-                        17, 21, 35,
-                        17, 23, 28,
-                        17, 23, 29,
-                        17, 23, 35,
-                        17, 24, 27,
-                        17, 24, 29,
-                        17, 24, 34,
-                        17, 25, 27,
-                        17, 25, 28,
-                        17, 25, 33,
-                        17, 27, 35,
-                        17, 28, 34,
-                        17, 29, 33,
-                        18, 21, 31,
-                        18, 21, 32,
-                        18, 21, 35,
-                        18, 22, 28,
-                        18, 22, 29,
-                        18, 22, 35,
-                        18, 24, 26,
-                        18, 24, 29,
-                        18, 24, 32,
-                        18, 25, 26,
-                        18, 25, 28,
-                        18, 25, 31,
-                        18, 26, 35,
-                        18, 28, 32,
-                        18, 29, 31,
-                        19, 21, 30,
-                        19, 21, 32,
-                        19, 21, 34,
-                        19, 22, 27,
-                        19, 22, 29,
-                        19, 22, 34,
-                        19, 23, 26,
-                        19, 23, 29,
-                        19, 23, 32,
-                        19, 25, 26,
-                        19, 25, 27,
-                        19, 25, 30,
-                        19, 26, 34,
-                        19, 27, 32,
-                        19, 29, 30,
-                        20, 21, 30,
-                        20, 21, 31,
-                        20, 21, 33,
-                        20, 22, 27,
-                        20, 22, 28,
-                        20, 22, 33,
-                        20, 23, 26,
-                        20, 23, 28,
-                        20, 23, 31,
-                        20, 24, 26,
-                        20, 24, 27,
-                        20, 24, 30,
-                        20, 26, 33,
-                        20, 27, 31,
-                        20, 28, 30,
-                        21, 30, 35,
-                        21, 31, 34,
-                        21, 32, 33,
-                        22, 27, 35,
-                        22, 28, 34,
-                        22, 29, 33,
-                        23, 26, 35,
-                        23, 28, 32,
-                        23, 29, 31,
-                        24, 26, 34,
-                        24, 27, 32,
-                        24, 29, 30,
-                        25, 26, 33,
-                        25, 27, 31,
-                        25, 28, 30
-                },
-                {
-                        0, 15, 26, 33,
-                        0, 15, 26, 34,
-                        0, 15, 26, 35,
-                        0, 15, 27, 31,
-                        0, 15, 27, 32,
-                        0, 15, 27, 35,
-                        0, 15, 28, 30,
-                        0, 15, 28, 32,
-                        0, 15, 28, 34,
-                        0, 15, 29, 30,
-                        0, 15, 29, 31,
-                        0, 15, 29, 33,
-                        0, 15, 30, 35,
-                        0, 15, 31, 34,
-                        0, 15, 32, 33,
-                        0, 16, 22, 33,
-                        0, 16, 22, 34,
-                        0, 16, 22, 35,
-                        0, 16, 23, 31,
-                        0, 16, 23, 32,
-                        0, 16, 23, 35,
-                        0, 16, 24, 30,
-                        0, 16, 24, 32,
-                        0, 16, 24, 34,
-                        0, 16, 25, 30,
-                        0, 16, 25, 31,
-                        0, 16, 25, 33,
-                        0, 16, 30, 35,
-                        0, 16, 31, 34,
-                        0, 16, 32, 33,
-                        0, 17, 21, 33,
-                        0, 17, 21, 34,
-                        0, 17, 21, 35,
-                        0, 17, 23, 28,
-                        0, 17, 23, 29,
-                        0, 17, 23, 35,
-                        0, 17, 24, 27,
-                        0, 17, 24, 29,
-                        0, 17, 24, 34,
-                        0, 17, 25, 27,
-                        0, 17, 25, 28,
-                        0, 17, 25, 33,
-                        0, 17, 27, 35,
-                        0, 17, 28, 34,
-                        0, 17, 29, 33,
-                        0, 18, 21, 31,
-                        0, 18, 21, 32,
-                        0, 18, 21, 35,
-                        0, 18, 22, 28,
-                        0, 18, 22, 29,
-                        0, 18, 22, 35,
-                        0, 18, 24, 26,
-                        0, 18, 24, 29,
-                        0, 18, 24, 32,
-                        0, 18, 25, 26,
-                        0, 18, 25, 28,
-                        0, 18, 25, 31,
-                        0, 18, 26, 35,
-                        0, 18, 28, 32,
-                        0, 18, 29, 31,
-                        0, 19, 21, 30,
-                        0, 19, 21, 32,
-                        0, 19, 21, 34,
-                        0, 19, 22, 27,
-                        0, 19, 22, 29,
-                        0, 19, 22, 34,
-                        0, 19, 23, 26,
-                        0, 19, 23, 29,
-                        0, 19, 23, 32,
-                        0, 19, 25, 26,
-                        0, 19, 25, 27,
-                        0, 19, 25, 30,
-                        0, 19, 26, 34,
-                        0, 19, 27, 32,
-                        0, 19, 29, 30,
-                        0, 20, 21, 30,
-                        0, 20, 21, 31,
-                        0, 20, 21, 33,
-                        0, 20, 22, 27,
-                        0, 20, 22, 28,
-                        0, 20, 22, 33,
-                        0, 20, 23, 26,
-                        0, 20, 23, 28,
-                        0, 20, 23, 31,
-                        0, 20, 24, 26,
-                        0, 20, 24, 27,
-                        0, 20, 24, 30,
-                        0, 20, 26, 33,
-                        0, 20, 27, 31,
-                        0, 20, 28, 30,
-                        0, 21, 30, 35,
-                        0, 21, 31, 34,
-                        0, 21, 32, 33,
-                        0, 22, 27, 35,
-                        0, 22, 28, 34,
-                        0, 22, 29, 33,
-                        0, 23, 26, 35,
-                        0, 23, 28, 32,
-                        0, 23, 29, 31,
-                        0, 24, 26, 34,
-                        0, 24, 27, 32,
-                        0, 24, 29, 30,
-                        0, 25, 26, 33,
-                        0, 25, 27, 31,
-                        0, 25, 28, 30,
-                        1, 9, 26, 33,
-                        1, 9, 26, 34,
-                        1, 9, 26, 35,
-                        1, 9, 27, 31,
-                        1, 9, 27, 32,
-                        1, 9, 27, 35,
-                        1, 9, 28, 30,
-                        1, 9, 28, 32,
-                        1, 9, 28, 34,
-                        1, 9, 29, 30,
-                        1, 9, 29, 31,
-                        1, 9, 29, 33,
-                        1, 9, 30, 35,
-                        1, 9, 31, 34,
-                        1, 9, 32, 33,
-                        1, 10, 22, 33,
-                        1, 10, 22, 34,
-                        1, 10, 22, 35,
-                        1, 10, 23, 31,
-                        1, 10, 23, 32,
-                        1, 10, 23, 35,
-                        1, 10, 24, 30,
-                        1, 10, 24, 32,
-                        1, 10, 24, 34,
-                        1, 10, 25, 30,
-                        1, 10, 25, 31,
-                        1, 10, 25, 33,
-                        1, 10, 30, 35,
-                        1, 10, 31, 34,
-                        1, 10, 32, 33,
-                        1, 11, 21, 33,
-                        1, 11, 21, 34,
-                        1, 11, 21, 35,
-                        1, 11, 23, 28,
-                        1, 11, 23, 29,
-                        1, 11, 23, 35,
-                        1, 11, 24, 27,
-                        1, 11, 24, 29,
-                        1, 11, 24, 34,
-                        1, 11, 25, 27,
-                        1, 11, 25, 28,
-                        1, 11, 25, 33,
-                        1, 11, 27, 35,
-                        1, 11, 28, 34,
-                        1, 11, 29, 33,
-                        1, 12, 21, 31,
-                        1, 12, 21, 32,
-                        1, 12, 21, 35,
-                        1, 12, 22, 28,
-                        1, 12, 22, 29,
-                        1, 12, 22, 35,
-                        1, 12, 24, 26,
-                        1, 12, 24, 29,
-                        1, 12, 24, 32,
-                        1, 12, 25, 26,
-                        1, 12, 25, 28,
-                        1, 12, 25, 31,
-                        1, 12, 26, 35,
-                        1, 12, 28, 32,
-                        1, 12, 29, 31,
-                        1, 13, 21, 30,
-                        1, 13, 21, 32,
-                        1, 13, 21, 34,
-                        1, 13, 22, 27,
-                        1, 13, 22, 29,
-                        1, 13, 22, 34,
-                        1, 13, 23, 26,
-                        1, 13, 23, 29,
-                        1, 13, 23, 32,
-                        1, 13, 25, 26,
-                        1, 13, 25, 27,
-                        1, 13, 25, 30,
-                        1, 13, 26, 34,
-                        1, 13, 27, 32,
-                        1, 13, 29, 30,
-                        1, 14, 21, 30,
-                        1, 14, 21, 31,
-                        1, 14, 21, 33,
-                        1, 14, 22, 27,
-                        1, 14, 22, 28,
-                        1, 14, 22, 33,
-                        1, 14, 23, 26,
-                        1, 14, 23, 28,
-                        1, 14, 23, 31,
-                        1, 14, 24, 26,
-                        1, 14, 24, 27,
-                        1, 14, 24, 30,
-                        1, 14, 26, 33,
-                        1, 14, 27, 31,
-                        1, 14, 28, 30,
-                        1, 21, 30, 35,
-                        1, 21, 31, 34,
-                        1, 21, 32, 33,
-                        1, 22, 27, 35,
-                        1, 22, 28, 34,
-                        1, 22, 29, 33,
-                        1, 23, 26, 35,
-                        1, 23, 28, 32,
-                        1, 23, 29, 31,
-                        1, 24, 26, 34,
-                        1, 24, 27, 32,
-                        1, 24, 29, 30,
-                        1, 25, 26, 33,
-                        1, 25, 27, 31,
-                        1, 25, 28, 30,
-                        2, 8, 26, 33,
-                        2, 8, 26, 34,
-                        2, 8, 26, 35,
-                        2, 8, 27, 31,
-                        2, 8, 27, 32,
-                        2, 8, 27, 35,
-                        2, 8, 28, 30,
-                        2, 8, 28, 32,
-                        2, 8, 28, 34,
-                        2, 8, 29, 30,
-                        2, 8, 29, 31,
-                        2, 8, 29, 33,
-                        2, 8, 30, 35,
-                        2, 8, 31, 34,
-                        2, 8, 32, 33,
-                        2, 10, 17, 33,
-                        2, 10, 17, 34,
-                        2, 10, 17, 35,
-                        2, 10, 18, 31,
-                        2, 10, 18, 32,
-                        2, 10, 18, 35,
-                        2, 10, 19, 30,
-                        2, 10, 19, 32,
-                        2, 10, 19, 34,
-                        2, 10, 20, 30,
-                        2, 10, 20, 31,
-                        2, 10, 20, 33,
-                        2, 10, 30, 35,
-                        2, 10, 31, 34,
-                        2, 10, 32, 33,
-                        2, 11, 16, 33,
-                        2, 11, 16, 34,
-                        2, 11, 16, 35,
-                        2, 11, 18, 28,
-                        2, 11, 18, 29,
-                        2, 11, 18, 35,
-                        2, 11, 19, 27,
-                        2, 11, 19, 29,
-                        2, 11, 19, 34,
-                        2, 11, 20, 27,
-                        2, 11, 20, 28,
-                        2, 11, 20, 33,
-                        2, 11, 27, 35,
-                        2, 11, 28, 34,
-                        2, 11, 29, 33,
-                        2, 12, 16, 31,
-                        2, 12, 16, 32,
-                        2, 12, 16, 35,
-                        2, 12, 17, 28,
-                        2, 12, 17, 29,
-                        2, 12, 17, 35,
-                        2, 12, 19, 26,
-                        2, 12, 19, 29,
-                        2, 12, 19, 32,
-                        2, 12, 20, 26,
-                        2, 12, 20, 28,
-                        2, 12, 20, 31,
-                        2, 12, 26, 35,
-                        2, 12, 28, 32,
-                        2, 12, 29, 31,
-                        2, 13, 16, 30,
-                        2, 13, 16, 32,
-                        2, 13, 16, 34,
-                        2, 13, 17, 27,
-                        2, 13, 17, 29,
-                        2, 13, 17, 34,
-                        2, 13, 18, 26,
-                        2, 13, 18, 29,
-                        2, 13, 18, 32,
-                        2, 13, 20, 26,
-                        2, 13, 20, 27,
-                        2, 13, 20, 30,
-                        2, 13, 26, 34,
-                        2, 13, 27, 32,
-                        2, 13, 29, 30,
-                        2, 14, 16, 30,
-                        2, 14, 16, 31,
-                        2, 14, 16, 33,
-                        2, 14, 17, 27,
-                        2, 14, 17, 28,
-                        2, 14, 17, 33,
-                        2, 14, 18, 26,
-                        2, 14, 18, 28,
-                        2, 14, 18, 31,
-                        2, 14, 19, 26,
-                        2, 14, 19, 27,
-                        2, 14, 19, 30,
-                        2, 14, 26, 33,
-                        2, 14, 27, 31,
-                        2, 14, 28, 30,
-                        2, 16, 30, 35,
-                        2, 16, 31, 34,
-                        2, 16, 32, 33,
-                        2, 17, 27, 35,
-                        2, 17, 28, 34,
-                        2, 17, 29, 33,
-                        2, 18, 26, 35,
-                        2, 18, 28, 32,
-                        2, 18, 29, 31,
-                        2, 19, 26, 34,
-                        2, 19, 27, 32,
-                        2, 19, 29, 30,
-                        2, 20, 26, 33,
-                        2, 20, 27, 31,
-                        2, 20, 28, 30,
-                        3, 8, 22, 33,
-                        3, 8, 22, 34,
-                        3, 8, 22, 35,
-                        3, 8, 23, 31,
-                        3, 8, 23, 32,
-                        3, 8, 23, 35,
-                        3, 8, 24, 30,
-                        3, 8, 24, 32,
-                        3, 8, 24, 34,
-                        3, 8, 25, 30,
-                        3, 8, 25, 31,
-                        3, 8, 25, 33,
-                        3, 8, 30, 35,
-                        3, 8, 31, 34,
-                        3, 8, 32, 33,
-                        3, 9, 17, 33,
-                        3, 9, 17, 34,
-                        3, 9, 17, 35,
-                        3, 9, 18, 31,
-                        3, 9, 18, 32,
-                        3, 9, 18, 35,
-                        3, 9, 19, 30,
-                        3, 9, 19, 32,
-                        3, 9, 19, 34,
-                        3, 9, 20, 30,
-                        3, 9, 20, 31,
-                        3, 9, 20, 33,
-                        3, 9, 30, 35,
-                        3, 9, 31, 34,
-                        3, 9, 32, 33,
-                        3, 11, 15, 33,
-                        3, 11, 15, 34,
-                        3, 11, 15, 35,
-                        3, 11, 18, 24,
-                        3, 11, 18, 25,
-                        3, 11, 18, 35,
-                        3, 11, 19, 23,
-                        3, 11, 19, 25,
-                        3, 11, 19, 34,
-                        3, 11, 20, 23,
-                        3, 11, 20, 24,
-                        3, 11, 20, 33,
-                        3, 11, 23, 35,
-                        3, 11, 24, 34,
-                        3, 11, 25, 33,
-                        3, 12, 15, 31,
-                        3, 12, 15, 32,
-                        3, 12, 15, 35,
-                        3, 12, 17, 24,
-                        3, 12, 17, 25,
-                        3, 12, 17, 35,
-                        3, 12, 19, 22,
-                        3, 12, 19, 25,
-                        3, 12, 19, 32,
-                        3, 12, 20, 22,
-                        3, 12, 20, 24,
-                        3, 12, 20, 31,
-                        3, 12, 22, 35,
-                        3, 12, 24, 32,
-                        3, 12, 25, 31,
-                        3, 13, 15, 30,
-                        3, 13, 15, 32,
-                        3, 13, 15, 34,
-                        3, 13, 17, 23,
-                        3, 13, 17, 25,
-                        3, 13, 17, 34,
-                        3, 13, 18, 22,
-                        3, 13, 18, 25,
-                        3, 13, 18, 32,
-                        3, 13, 20, 22,
-                        3, 13, 20, 23,
-                        3, 13, 20, 30,
-                        3, 13, 22, 34,
-                        3, 13, 23, 32,
-                        3, 13, 25, 30,
-                        3, 14, 15, 30,
-                        3, 14, 15, 31,
-                        3, 14, 15, 33,
-                        3, 14, 17, 23,
-                        3, 14, 17, 24,
-                        3, 14, 17, 33,
-                        3, 14, 18, 22,
-                        3, 14, 18, 24,
-                        3, 14, 18, 31,
-                        3, 14, 19, 22,
-                        3, 14, 19, 23,
-                        3, 14, 19, 30,
-                        3, 14, 22, 33,
-                        3, 14, 23, 31,
-                        3, 14, 24, 30,
-                        3, 15, 30, 35,
-                        3, 15, 31, 34,
-                        3, 15, 32, 33,
-                        3, 17, 23, 35,
-                        3, 17, 24, 34,
-                        3, 17, 25, 33,
-                        3, 18, 22, 35,
-                        3, 18, 24, 32,
-                        3, 18, 25, 31,
-                        3, 19, 22, 34,
-                        3, 19, 23, 32,
-                        3, 19, 25, 30,
-                        3, 20, 22, 33,
-                        3, 20, 23, 31,
-                        3, 20, 24, 30,
-                        4, 8, 21, 33,
-                        4, 8, 21, 34,
-                        4, 8, 21, 35,
-                        4, 8, 23, 28,
-                        4, 8, 23, 29,
-                        4, 8, 23, 35,
-                        4, 8, 24, 27,
-                        4, 8, 24, 29,
-                        4, 8, 24, 34,
-                        4, 8, 25, 27,
-                        4, 8, 25, 28,
-                        4, 8, 25, 33,
-                        4, 8, 27, 35,
-                        4, 8, 28, 34,
-                        4, 8, 29, 33,
-                        4, 9, 16, 33,
-                        4, 9, 16, 34,
-                        4, 9, 16, 35,
-                        4, 9, 18, 28,
-                        4, 9, 18, 29,
-                        4, 9, 18, 35,
-                        4, 9, 19, 27,
-                        4, 9, 19, 29,
-                        4, 9, 19, 34,
-                        4, 9, 20, 27,
-                        4, 9, 20, 28,
-                        4, 9, 20, 33,
-                        4, 9, 27, 35,
-                        4, 9, 28, 34,
-                        4, 9, 29, 33,
-                        4, 10, 15, 33,
-                        4, 10, 15, 34,
-                        4, 10, 15, 35,
-                        4, 10, 18, 24,
-                        4, 10, 18, 25,
-                        4, 10, 18, 35,
-                        4, 10, 19, 23,
-                        4, 10, 19, 25,
-                        4, 10, 19, 34,
-                        4, 10, 20, 23,
-                        4, 10, 20, 24,
-                        4, 10, 20, 33,
-                        4, 10, 23, 35,
-                        4, 10, 24, 34,
-                        4, 10, 25, 33,
-                        4, 12, 15, 28,
-                        4, 12, 15, 29,
-                        4, 12, 15, 35,
-                        4, 12, 16, 24,
-                        4, 12, 16, 25,
-                        4, 12, 16, 35,
-                        4, 12, 19, 21,
-                        4, 12, 19, 25,
-                        4, 12, 19, 29,
-                        4, 12, 20, 21,
-                        4, 12, 20, 24,
-                        4, 12, 20, 28,
-                        4, 12, 21, 35,
-                        4, 12, 24, 29,
-                        4, 12, 25, 28,
-                        4, 13, 15, 27,
-                        4, 13, 15, 29,
-                        4, 13, 15, 34,
-                        4, 13, 16, 23,
-                        4, 13, 16, 25,
-                        4, 13, 16, 34,
-                        4, 13, 18, 21,
-                        4, 13, 18, 25,
-                        4, 13, 18, 29,
-                        4, 13, 20, 21,
-                        4, 13, 20, 23,
-                        4, 13, 20, 27,
-                        4, 13, 21, 34,
-                        4, 13, 23, 29,
-                        4, 13, 25, 27,
-                        4, 14, 15, 27,
-                        4, 14, 15, 28,
-                        4, 14, 15, 33,
-                        4, 14, 16, 23,
-                        4, 14, 16, 24,
-                        4, 14, 16, 33,
-                        4, 14, 18, 21,
-                        4, 14, 18, 24,
-                        4, 14, 18, 28,
-                        4, 14, 19, 21,
-                        4, 14, 19, 23,
-                        4, 14, 19, 27,
-                        4, 14, 21, 33,
-                        4, 14, 23, 28,
-                        4, 14, 24, 27,
-                        4, 15, 27, 35,
-                        4, 15, 28, 34,
-                        4, 15, 29, 33,
-                        4, 16, 23, 35,
-                        4, 16, 24, 34,
-                        4, 16, 25, 33,
-                        4, 18, 21, 35,
-                        4, 18, 24, 29,
-                        4, 18, 25, 28,
-                        4, 19, 21, 34,
-                        4, 19, 23, 29,
-                        4, 19, 25, 27,
-                        4, 20, 21, 33,
-                        4, 20, 23, 28,
-                        4, 20, 24, 27,
-                        5, 8, 21, 31,
-                        5, 8, 21, 32,
-                        5, 8, 21, 35,
-                        5, 8, 22, 28,
-                        5, 8, 22, 29,
-                        5, 8, 22, 35,
-                        5, 8, 24, 26,
-                        5, 8, 24, 29,
-                        5, 8, 24, 32,
-                        5, 8, 25, 26,
-                        5, 8, 25, 28,
-                        5, 8, 25, 31,
-                        5, 8, 26, 35,
-                        5, 8, 28, 32,
-                        5, 8, 29, 31,
-                        5, 9, 16, 31,
-                        5, 9, 16, 32,
-                        5, 9, 16, 35,
-                        5, 9, 17, 28,
-                        5, 9, 17, 29,
-                        5, 9, 17, 35,
-                        5, 9, 19, 26,
-                        5, 9, 19, 29,
-                        5, 9, 19, 32,
-                        5, 9, 20, 26,
-                        5, 9, 20, 28,
-                        5, 9, 20, 31,
-                        5, 9, 26, 35,
-                        5, 9, 28, 32,
-                        5, 9, 29, 31,
-                        5, 10, 15, 31,
-                        5, 10, 15, 32,
-                        5, 10, 15, 35,
-                        5, 10, 17, 24,
-                        5, 10, 17, 25,
-                        5, 10, 17, 35,
-                        5, 10, 19, 22,
-                        5, 10, 19, 25,
-                        5, 10, 19, 32,
-                        5, 10, 20, 22,
-                        5, 10, 20, 24,
-                        5, 10, 20, 31,
-                        5, 10, 22, 35,
-                        5, 10, 24, 32,
-                        5, 10, 25, 31,
-                        5, 11, 15, 28,
-                        5, 11, 15, 29,
-                        5, 11, 15, 35,
-                        5, 11, 16, 24,
-                        5, 11, 16, 25,
-                        5, 11, 16, 35,
-                        5, 11, 19, 21,
-                        5, 11, 19, 25,
-                        5, 11, 19, 29,
-                        5, 11, 20, 21,
-                        5, 11, 20, 24,
-                        5, 11, 20, 28,
-                        5, 11, 21, 35,
-                        5, 11, 24, 29,
-                        5, 11, 25, 28,
-                        5, 13, 15, 26,
-                        5, 13, 15, 29,
-                        5, 13, 15, 32,
-                        5, 13, 16, 22,
-                        5, 13, 16, 25,
-                        5, 13, 16, 32,
-                        5, 13, 17, 21,
-                        5, 13, 17, 25,
-                        5, 13, 17, 29,
-                        5, 13, 20, 21,
-                        5, 13, 20, 22,
-                        5, 13, 20, 26,
-                        5, 13, 21, 32,
-                        5, 13, 22, 29,
-                        5, 13, 25, 26,
-                        5, 14, 15, 26,
-                        5, 14, 15, 28,
-                        5, 14, 15, 31,
-                        5, 14, 16, 22,
-                        5, 14, 16, 24,
-                        5, 14, 16, 31,
-                        5, 14, 17, 21,
-                        5, 14, 17, 24,
-                        5, 14, 17, 28,
-                        5, 14, 19, 21,
-                        5, 14, 19, 22,
-                        5, 14, 19, 26,
-                        5, 14, 21, 31,
-                        5, 14, 22, 28,
-                        5, 14, 24, 26,
-                        5, 15, 26, 35,
-                        5, 15, 28, 32,
-                        5, 15, 29, 31,
-                        5, 16, 22, 35,
-                        5, 16, 24, 32,
-                        5, 16, 25, 31,
-                        5, 17, 21, 35,
-                        5, 17, 24, 29,
-                        5, 17, 25, 28,
-                        5, 19, 21, 32,
-                        5, 19, 22, 29,
-                        5, 19, 25, 26,
-                        5, 20, 21, 31,
-                        5, 20, 22, 28,
-                        5, 20, 24, 26,
-                        6, 8, 21, 30,
-                        6, 8, 21, 32,
-                        6, 8, 21, 34,
-                        6, 8, 22, 27,
-                        6, 8, 22, 29,
-                        6, 8, 22, 34,
-                        6, 8, 23, 26,
-                        6, 8, 23, 29,
-                        6, 8, 23, 32,
-                        6, 8, 25, 26,
-                        6, 8, 25, 27,
-                        6, 8, 25, 30,
-                        6, 8, 26, 34,
-                        6, 8, 27, 32,
-                        6, 8, 29, 30,
-                        6, 9, 16, 30,
-                        6, 9, 16, 32,
-                        6, 9, 16, 34,
-                        6, 9, 17, 27,
-                        6, 9, 17, 29,
-                        6, 9, 17, 34,
-                        6, 9, 18, 26,
-                        6, 9, 18, 29,
-                        6, 9, 18, 32,
-                        6, 9, 20, 26,
-                        6, 9, 20, 27,
-                        6, 9, 20, 30,
-                        6, 9, 26, 34,
-                        6, 9, 27, 32,
-                        6, 9, 29, 30,
-                        6, 10, 15, 30,
-                        6, 10, 15, 32,
-                        6, 10, 15, 34,
-                        6, 10, 17, 23,
-                        6, 10, 17, 25,
-                        6, 10, 17, 34,
-                        6, 10, 18, 22,
-                        6, 10, 18, 25,
-                        6, 10, 18, 32,
-                        6, 10, 20, 22,
-                        6, 10, 20, 23,
-                        6, 10, 20, 30,
-                        6, 10, 22, 34,
-                        6, 10, 23, 32,
-                        6, 10, 25, 30,
-                        6, 11, 15, 27,
-                        6, 11, 15, 29,
-                        6, 11, 15, 34,
-                        6, 11, 16, 23,
-                        6, 11, 16, 25,
-                        6, 11, 16, 34,
-                        6, 11, 18, 21,
-                        6, 11, 18, 25,
-                        6, 11, 18, 29,
-                        6, 11, 20, 21,
-                        6, 11, 20, 23,
-                        6, 11, 20, 27,
-                        6, 11, 21, 34,
-                        6, 11, 23, 29,
-                        6, 11, 25, 27,
-                        6, 12, 15, 26,
-                        6, 12, 15, 29,
-                        6, 12, 15, 32,
-                        6, 12, 16, 22,
-                        6, 12, 16, 25,
-                        6, 12, 16, 32,
-                        6, 12, 17, 21,
-                        6, 12, 17, 25,
-                        6, 12, 17, 29,
-                        6, 12, 20, 21,
-                        6, 12, 20, 22,
-                        6, 12, 20, 26,
-                        6, 12, 21, 32,
-                        6, 12, 22, 29,
-                        6, 12, 25, 26,
-                        6, 14, 15, 26,
-                        6, 14, 15, 27,
-                        6, 14, 15, 30,
-                        6, 14, 16, 22,
-                        6, 14, 16, 23,
-                        6, 14, 16, 30,
-                        6, 14, 17, 21,
-                        6, 14, 17, 23,
-                        6, 14, 17, 27,
-                        6, 14, 18, 21,
-                        6, 14, 18, 22,
-                        6, 14, 18, 26,
-                        6, 14, 21, 30,
-                        6, 14, 22, 27,
-                        6, 14, 23, 26,
-                        6, 15, 26, 34,
-                        6, 15, 27, 32,
-                        6, 15, 29, 30,
-                        6, 16, 22, 34,
-                        6, 16, 23, 32,
-                        6, 16, 25, 30,
-                        6, 17, 21, 34,
-                        6, 17, 23, 29,
-                        6, 17, 25, 27,
-                        6, 18, 21, 32,
-                        6, 18, 22, 29,
-                        6, 18, 25, 26,
-                        6, 20, 21, 30,
-                        6, 20, 22, 27,
-                        6, 20, 23, 26,
-                        7, 8, 21, 30,
-                        7, 8, 21, 31,
-                        7, 8, 21, 33,
-                        7, 8, 22, 27,
-                        7, 8, 22, 28,
-                        7, 8, 22, 33,
-                        7, 8, 23, 26,
-                        7, 8, 23, 28,
-                        7, 8, 23, 31,
-                        7, 8, 24, 26,
-                        7, 8, 24, 27,
-                        7, 8, 24, 30,
-                        7, 8, 26, 33,
-                        7, 8, 27, 31,
-                        7, 8, 28, 30,
-                        7, 9, 16, 30,
-                        7, 9, 16, 31,
-                        7, 9, 16, 33,
-                        7, 9, 17, 27,
-                        7, 9, 17, 28,
-                        7, 9, 17, 33,
-                        7, 9, 18, 26,
-                        7, 9, 18, 28,
-                        7, 9, 18, 31,
-                        7, 9, 19, 26,
-                        7, 9, 19, 27,
-                        7, 9, 19, 30,
-                        7, 9, 26, 33,
-                        7, 9, 27, 31,
-                        7, 9, 28, 30,
-                        7, 10, 15, 30,
-                        7, 10, 15, 31,
-                        7, 10, 15, 33,
-                        7, 10, 17, 23,
-                        7, 10, 17, 24,
-                        7, 10, 17, 33,
-                        7, 10, 18, 22,
-                        7, 10, 18, 24,
-                        7, 10, 18, 31,
-                        7, 10, 19, 22,
-                        7, 10, 19, 23,
-                        7, 10, 19, 30,
-                        7, 10, 22, 33,
-                        7, 10, 23, 31,
-                        7, 10, 24, 30,
-                        7, 11, 15, 27,
-                        7, 11, 15, 28,
-                        7, 11, 15, 33,
-                        7, 11, 16, 23,
-                        7, 11, 16, 24,
-                        7, 11, 16, 33,
-                        7, 11, 18, 21,
-                        7, 11, 18, 24,
-                        7, 11, 18, 28,
-                        7, 11, 19, 21,
-                        7, 11, 19, 23,
-                        7, 11, 19, 27,
-                        7, 11, 21, 33,
-                        7, 11, 23, 28,
-                        7, 11, 24, 27,
-                        7, 12, 15, 26,
-                        7, 12, 15, 28,
-                        7, 12, 15, 31,
-                        7, 12, 16, 22,
-                        7, 12, 16, 24,
-                        7, 12, 16, 31,
-                        7, 12, 17, 21,
-                        7, 12, 17, 24,
-                        7, 12, 17, 28,
-                        7, 12, 19, 21,
-                        7, 12, 19, 22,
-                        7, 12, 19, 26,
-                        7, 12, 21, 31,
-                        7, 12, 22, 28,
-                        7, 12, 24, 26,
-                        7, 13, 15, 26,
-                        7, 13, 15, 27,
-                        7, 13, 15, 30,
-                        7, 13, 16, 22,
-                        7, 13, 16, 23,
-                        7, 13, 16, 30,
-                        7, 13, 17, 21,
-                        7, 13, 17, 23,
-                        7, 13, 17, 27,
-                        7, 13, 18, 21,
-                        7, 13, 18, 22,
-                        7, 13, 18, 26,
-                        7, 13, 21, 30,
-                        7, 13, 22, 27,
-                        7, 13, 23, 26,
-                        7, 15, 26, 33,
-                        7, 15, 27, 31,
-                        7, 15, 28, 30,
-                        7, 16, 22, 33,
-                        7, 16, 23, 31,
-                        7, 16, 24, 30,
-                        7, 17, 21, 33,
-                        7, 17, 23, 28,
-                        7, 17, 24, 27,
-                        7, 18, 21, 31,
-                        7, 18, 22, 28,
-                        7, 18, 24, 26,
-                        7, 19, 21, 30,
-                        7, 19, 22, 27,
-                        7, 19, 23, 26,
-                        8, 21, 30, 35,
-                        8, 21, 31, 34,
-                        8, 21, 32, 33,
-                        8, 22, 27, 35,
-                        8, 22, 28, 34,
-                        8, 22, 29, 33,
-                        8, 23, 26, 35,
-                        8, 23, 28, 32,
-                        8, 23, 29, 31,
-                        8, 24, 26, 34,
-                        8, 24, 27, 32,
-                        8, 24, 29, 30,
-                        8, 25, 26, 33,
-                        8, 25, 27, 31,
-                        8, 25, 28, 30,
-                        9, 16, 30, 35,
-                        9, 16, 31, 34,
-                        9, 16, 32, 33,
-                        9, 17, 27, 35,
-                        9, 17, 28, 34,
-                        9, 17, 29, 33,
-                        9, 18, 26, 35,
-                        9, 18, 28, 32,
-                        9, 18, 29, 31,
-                        9, 19, 26, 34,
-                        9, 19, 27, 32,
-                        9, 19, 29, 30,
-                        9, 20, 26, 33,
-                        9, 20, 27, 31,
-                        9, 20, 28, 30,
-                        10, 15, 30, 35,
-                        10, 15, 31, 34,
-                        10, 15, 32, 33,
-                        10, 17, 23, 35,
-                        10, 17, 24, 34,
-                        10, 17, 25, 33,
-                        10, 18, 22, 35,
-                        10, 18, 24, 32,
-                        10, 18, 25, 31,
-                        10, 19, 22, 34,
-                        10, 19, 23, 32,
-                        10, 19, 25, 30,
-                        10, 20, 22, 33,
-                        10, 20, 23, 31,
-                        10, 20, 24, 30,
-                        11, 15, 27, 35,
-                        11, 15, 28, 34,
-                        11, 15, 29, 33,
-                        11, 16, 23, 35,
-                        11, 16, 24, 34,
-                        11, 16, 25, 33,
-                        11, 18, 21, 35,
-                        11, 18, 24, 29,
-                        11, 18, 25, 28,
-                        11, 19, 21, 34,
-                        11, 19, 23, 29,
-                        11, 19, 25, 27,
-                        11, 20, 21, 33,
-                        11, 20, 23, 28,
-                        11, 20, 24, 27,
-                        12, 15, 26, 35,
-                        12, 15, 28, 32,
-                        12, 15, 29, 31,
-                        12, 16, 22, 35,
-                        12, 16, 24, 32,
-                        12, 16, 25, 31,
-                        12, 17, 21, 35,
-                        12, 17, 24, 29,
-                        12, 17, 25, 28,
-                        12, 19, 21, 32,
-                        12, 19, 22, 29,
-                        12, 19, 25, 26,
-                        12, 20, 21, 31,
-                        12, 20, 22, 28,
-                        12, 20, 24, 26,
-                        13, 15, 26, 34,
-                        13, 15, 27, 32,
-                        13, 15, 29, 30,
-                        13, 16, 22, 34,
-                        13, 16, 23, 32,
-                        13, 16, 25, 30,
-                        13, 17, 21, 34,
-                        13, 17, 23, 29,
-                        13, 17, 25, 27,
-                        13, 18, 21, 32,
-                        13, 18, 22, 29,
-                        13, 18, 25, 26,
-                        13, 20, 21, 30,
-                        13, 20, 22, 27,
-                        13, 20, 23, 26,
-                        14, 15, 26, 33,
-                        14, 15, 27, 31,
-                        14, 15, 28, 30,
-                        14, 16, 22, 33,
-                        14, 16, 23, 31,
-                        14, 16, 24, 30,
-                        14, 17, 21, 33,
-                        14, 17, 23, 28,
-                        14, 17, 24, 27,
-                        14, 18, 21, 31,
-                        14, 18, 22, 28,
-                        14, 18, 24, 26,
-                        14, 19, 21, 30,
-                        14, 19, 22, 27,
-                        14, 19, 23, 26
-                }
-        },
-        {
-                {
-                        0,
-                        1,
-                        2,
-                        3,
-                        4,
-                        5,
-                        6,
-                        7,
-                        8,
-                        9,
-                        10,
-                        11,
-                        12,
-                        13,
-                        14,
-                        15,
-                        16,
-                        17,
-                        18,
-                        19,
-                        20,
-                        21,
-                        22,
-                        23,
-                        24,
-                        25,
-                        26,
-                        27,
-                        28,
-                        29,
-                        30,
-                        31,
-                        32,
-                        33,
-                        34,
-                        35,
-                        36,
-                        37,
-                        38,
-                        39,
-                        40,
-                        41,
-                        42,
-                        43,
-                        44
-                },
-                {
-                        0, 17,
-                        0, 18,
-                        0, 19,
-                        0, 20,
-                        0, 21,
-                        0, 22,
-                        0, 23,
-                        0, 24,
-                        0, 25,
-                        0, 26,
-                        0, 27,
-                        0, 28,
-                        0, 29,
-                        0, 30,
-                        0, 31,
-                        0, 32,
-                        0, 33,
-                        0, 34,
-                        0, 35,
-                        0, 36,
-                        0, 37,
-                        0, 38,
-                        0, 39,
-                        0, 40,
-                        0, 41,
-                        0, 42,
-                        0, 43,
-                        0, 44,
-                        1, 10,
-                        1, 11,
-                        1, 12,
-                        1, 13,
-                        1, 14,
-                        1, 15,
-                        1, 16,
-                        1, 24,
-                        1, 25,
-                        1, 26,
-                        1, 27,
-                        1, 28,
-                        1, 29,
-                        1, 30,
-                        1, 31,
-                        1, 32,
-                        1, 33,
-                        1, 34,
-                        1, 35,
-                        1, 36,
-                        1, 37,
-                        1, 38,
-                        1, 39,
-                        1, 40,
-                        1, 41,
-                        1, 42,
-                        1, 43,
-                        1, 44,
-                        2, 9,
-                        2, 11,
-                        2, 12,
-                        2, 13,
-                        2, 14,
-                        2, 15,
-                        2, 16,
-                        2, 18,
-                        2, 19,
-                        2, 20,
-                        2, 21,
-                        2, 22,
-                        2, 23,
-                        2, 30,
-                        2, 31,
-                        2, 32,
-                        2, 33,
-                        2, 34,
-                        2, 35,
-                        2, 36,
-                        2, 37,
-                        2, 38,
-                        2, 39,
-                        2, 40,
-                        2, 41,
-                        2, 42,
-                        2, 43,
-                        2, 44,
-                        3, 9,
-                        3, 10,
-                        3, 12,
-                        3, 13,
-                        3, 14,
-                        3, 15,
-                        3, 16,
-                        3, 17,
-                        3, 19,
-                        3, 20,
-                        3, 21,
-                        3, 22,
-                        3, 23,
-                        3, 25,
-                        3, 26,
-                        3, 27,
-                        3, 28,
-                        3, 29,
-                        3, 35,
-                        3, 36,
-                        3, 37,
-                        3, 38,
-                        3, 39,
-                        3, 40,
-                        3, 41,
-                        3, 42,
-                        3, 43,
-                        3, 44,
-                        4, 9,
-                        4, 10,
-                        4, 11,
-                        4, 13,
-                        4, 14,
-                        4, 15,
-                        4, 16,
-                        4, 17,
-                        4, 18,
-                        4, 20,
-                        4, 21,
-                        4, 22,
-                        4, 23,
-                        4, 24,
-                        4, 26,
-                        4, 27,
-                        4, 28,
-                        4, 29,
-                        4, 31,
-                        4, 32,
-                        4, 33,
-                        4, 34,
-                        4, 39,
-                        4, 40,
-                        4, 41,
-                        4, 42,
-                        4, 43,
-                        4, 44,
-                        5, 9,
-                        5, 10,
-                        5, 11,
-                        5, 12,
-                        5, 14,
-                        5, 15,
-                        5, 16,
-                        5, 17,
-                        5, 18,
-                        5, 19,
-                        5, 21,
-                        5, 22,
-                        5, 23,
-                        5, 24,
-                        5, 25,
-                        5, 27,
-                        5, 28,
-                        5, 29,
-                        5, 30,
-                        5, 32,
-                        5, 33,
-                        5, 34,
-                        5, 36,
-                        5, 37,
-                        5, 38,
-                        5, 42,
-                        5, 43,
-                        5, 44,
-                        6, 9,
-                        6, 10,
-                        6, 11,
-                        6, 12,
-                        6, 13,
-                        6, 15,
-                        6, 16,
-                        6, 17,
-                        6, 18,
-                        6, 19,
-                        6, 20,
-                        6, 22,
-                        6, 23,
-                        6, 24,
-                        6, 25,
-                        6, 26,
-                        6, 28,
-                        6, 29,
-                        6, 30,
-                        6, 31,
-                        6, 33,
-                        6, 34,
-                        6, 35,
-                        6, 37,
-                        6, 38,
-                        6, 40,
-                        6, 41,
-                        6, 44,
-                        7, 9,
-                        7, 10,
-                        7, 11,
-                        7, 12,
-                        7, 13,
-                        7, 14,
-                        7, 16,
-                        7, 17,
-                        7, 18,
-                        7, 19,
-                        7, 20,
-                        7, 21,
-                        7, 23,
-                        7, 24,
-                        7, 25,
-                        7, 26,
-                        7, 27,
-                        7, 29,
-                        7, 30,
-                        7, 31,
-                        7, 32,
-                        7, 34,
-                        7, 35,
-                        7, 36,
-                        7, 38,
-                        7, 39,
-                        7, 41,
-                        7, 43,
-                        8, 9,
-                        8, 10,
-                        8, 11,
-                        8, 12,
-                        8, 13,
-                        8, 14,
-                        8, 15,
-                        8, 17,
-                        8, 18,
-                        8, 19,
-                        8, 20,
-                        8, 21,
-                        8, 22,
-                        8, 24,
-                        8, 25,
-                        8, 26,
-                        8, 27,
-                        8, 28,
-                        8, 30,
-                        8, 31,
-                        8, 32,
-                        8, 33,
-                        8, 35,
-                        8, 36,
-                        8, 37,
-                        8, 39,
-                        8, 40,
-                        8, 42,
-                        9, 24,
-                        9, 25,
-                        9, 26,
-                        9, 27,
-                        9, 28,
-                        9, 29,
-                        9, 30,
-                        9, 31,
-                        9, 32,
-                        9, 33,
-                        9, 34,
-                        9, 35,
-                        9, 36,
-                        9, 37,
-                        9, 38,
-                        9, 39,
-                        9, 40,
-                        9, 41,
-                        9, 42,
-                        9, 43,
-                        9, 44,
-                        10, 18,
-                        10, 19,
-                        10, 20,
-                        10, 21,
-                        10, 22,
-                        10, 23,
-                        10, 30,
-                        10, 31,
-                        10, 32,
-                        10, 33,
-                        10, 34,
-                        10, 35,
-                        10, 36,
-                        10, 37,
-                        10, 38,
-                        10, 39,
-                        10, 40,
-                        10, 41,
-                        10, 42,
-                        10, 43,
-                        10, 44,
-                        11, 17,
-                        11, 19,
-                        11, 20,
-                        11, 21,
-                        11, 22,
-                        11, 23,
-                        11, 25,
-                        11, 26,
-                        11, 27,
-                        11, 28,
-                        11, 29,
-                        11, 35,
-                        11, 36,
-                        11, 37,
-                        11, 38,
-                        11, 39,
-                        11, 40,
-                        11, 41,
-                        11, 42,
-                        11, 43,
-                        11, 44,
-                        12, 17,
-                        12, 18,
-                        12, 20,
-                        12, 21,
-                        12, 22,
-                        12, 23,
-                        12, 24,
-                        12, 26,
-                        12, 27,
-                        12, 28,
-                        12, 29,
-                        12, 31,
-                        12, 32,
-                        12, 33,
-                        12, 34,
-                        12, 39,
-                        12, 40,
-                        12, 41,
-                        12, 42,
-                        12, 43,
-                        12, 44,
-                        13, 17,
-                        13, 18,
-                        13, 19,
-                        13, 21,
-                        13, 22,
-                        13, 23,
-                        13, 24,
-                        13, 25,
-                        13, 27,
-                        13, 28,
-                        13, 29,
-                        13, 30,
-                        13, 32,
-                        13, 33,
-                        13, 34,
-                        13, 36,
-                        13, 37,
-                        13, 38,
-                        13, 42,
-                        13, 43,
-                        13, 44,
-                        14, 17,
-                        14, 18,
-                        14, 19,
-                        14, 20,
-                        14, 22,
-                        14, 23,
-                        14, 24,
-                        14, 25,
-                        14, 26,
-                        14, 28,
-                        14, 29,
-                        14, 30,
-                        14, 31,
-                        14, 33,
-                        14, 34,
-                        14, 35,
-                        14, 37,
-                        14, 38,
-                        14, 40,
-                        14, 41,
-                        14, 44,
-                        15, 17,
-                        15, 18,
-                        15, 19,
-                        15, 20,
-                        15, 21,
-                        15, 23,
-                        15, 24,
-                        15, 25,
-                        15, 26,
-                        15, 27,
-                        15, 29,
-                        15, 30,
-                        15, 31,
-                        15, 32,
-                        15, 34,
-                        15, 35,
-                        15, 36,
-                        15, 38,
-                        15, 39,
-                        15, 41,
-                        15, 43,
-                        16, 17,
-                        16, 18,
-                        16, 19,
-                        16, 20,
-                        16, 21,
-                        16, 22,
-                        16, 24,
-                        16, 25,
-                        16, 26,
-                        16, 27,
-                        16, 28,
-                        16, 30,
-                        16, 31,
-                        16, 32,
-                        16, 33,
-                        16, 35,
-                        16, 36,
-                        16, 37,
-                        16, 39,
-                        16, 40,
-                        16, 42,
-                        17, 30,
-                        17, 31,
-                        17, 32,
-                        17, 33,
-                        17, 34,
-                        17, 35,
-                        17, 36,
-                        17, 37,
-                        17, 38,
-                        17, 39,
-                        17, 40,
-                        17, 41,
-                        17, 42,
-                        17, 43,
-                        17, 44,
-                        18, 25,
-                        18, 26,
-                        18, 27,
-                        18, 28,
-                        18, 29,
-                        18, 35,
-                        18, 36,
-                        18, 37,
-                        18, 38,
-                        18, 39,
-                        18, 40,
-                        18, 41,
-                        18, 42,
-                        18, 43,
-                        18, 44,
-                        19, 24,
-                        19, 26,
-                        19, 27,
-                        19, 28,
-                        19, 29,
-                        19, 31,
-                        19, 32,
-                        19, 33,
-                        19, 34,
-                        19, 39,
-                        19, 40,
-                        19, 41,
-                        19, 42,
-                        19, 43,
-                        19, 44,
-                        20, 24,
-                        20, 25,
-                        20, 27,
-                        20, 28,
-                        20, 29,
-                        20, 30,
-                        20, 32,
-                        20, 33,
-                        20, 34,
-                        20, 36,
-                        20, 37,
-                        20, 38,
-                        20, 42,
-                        20, 43,
-                        20, 44,
-                        21, 24,
-                        21, 25,
-                        21, 26,
-                        21, 28,
-                        21, 29,
-                        21, 30,
-                        21, 31,
-                        21, 33,
-                        21, 34,
-                        21, 35,
-                        21, 37,
-                        21, 38,
-                        21, 40,
-                        21, 41,
-                        21, 44,
-                        22, 24,
-                        22, 25,
-                        22, 26,
-                        22, 27,
-                        22, 29,
-                        22, 30,
-                        22, 31,
-                        22, 32,
-                        22, 34,
-                        22, 35,
-                        22, 36,
-                        22, 38,
-                        22, 39,
-                        22, 41,
-                        22, 43,
-                        23, 24,
-                        23, 25,
-                        23, 26,
-                        23, 27,
-                        23, 28,
-                        23, 30,
-                        23, 31,
-                        23, 32,
-                        23, 33,
-                        23, 35,
-                        23, 36,
-                        23, 37,
-                        23, 39,
-                        23, 40,
-                        23, 42,
-                        24, 35,
-                        24, 36,
-                        24, 37,
-                        24, 38,
-                        24, 39,
-                        24, 40,
-                        24, 41,
-                        24, 42,
-                        24, 43,
-                        24, 44,
-                        25, 31,
-                        25, 32,
-                        25, 33,
-                        25, 34,
-                        25, 39,
-                        25, 40,
-                        25, 41,
-                        25, 42,
-                        25, 43,
-                        25, 44,
-                        26, 30,
-                        26, 32,
-                        26, 33,
-                        26, 34,
-                        26, 36,
-                        26, 37,
-                        26, 38,
-                        26, 42,
-                        26, 43,
-                        26, 44,
-                        27, 30,
-                        27, 31,
-                        27, 33,
-                        27, 34,
-                        27, 35,
-                        27, 37,
-                        27, 38,
-                        27, 40,
-                        27, 41,
-                        27, 44,
-                        28, 30,
-                        28, 31,
-                        28, 32,
-                        28, 34,
-                        28, 35,
-                        28, 36,
-                        28, 38,
-                        28, 39,
-                        28, 41,
-                        28, 43,
-                        29, 30,
-                        29, 31,
-                        29, 32,
-                        29, 33,
-                        29, 35,
-                        29, 36,
-                        29, 37,
-                        29, 39,
-                        29, 40,
-                        29, 42,
-                        30, 39,
-                        30, 40,
-                        30, 41,
-                        30, 42,
-                        30, 43,
-                        30, 44,
-                        31, 36,
-                        31, 37,
-                        31, 38,
-                        31, 42,
-                        31, 43,
-                        31, 44,
-                        32, 35,
-                        32, 37,
-                        32, 38,
-                        32, 40,
-                        32, 41,
-                        32, 44,
-                        33, 35,
-                        33, 36,
-                        33, 38,
-                        33, 39,
-                        33, 41,
-                        33, 43,
-                        34, 35,
-                        34, 36,
-                        34, 37,
-                        34, 39,
-                        34, 40,
-                        34, 42,
-                        35, 42,
-                        35, 43,
-                        35, 44,
-                        36, 40,
-                        36, 41,
-                        36, 44,
-                        37, 39,
-                        37, 41,
-                        37, 43,
-                        38, 39,
-                        38, 40,
-                        38, 42,
-                        39, 44,
-                        40, 43,
-                        41, 42
-                },
-                {
-                        0, 17, 30,
-                        0, 17, 31,
-                        0, 17, 32,
-                        0, 17, 33,
-                        0, 17, 34,
-                        0, 17, 35,
-                        0, 17, 36,
-                        0, 17, 37,
-                        0, 17, 38,
-                        0, 17, 39,
-                        0, 17, 40,
-                        0, 17, 41,
-                        0, 17, 42,
-                        0, 17, 43,
-                        0, 17, 44,
-                        0, 18, 25,
-                        0, 18, 26,
-                        0, 18, 27,
-                        0, 18, 28,
-                        0, 18, 29,
-                        0, 18, 35,
-                        0, 18, 36,
-                        0, 18, 37,
-                        0, 18, 38,
-                        0, 18, 39,
-                        0, 18, 40,
-                        0, 18, 41,
-                        0, 18, 42,
-                        0, 18, 43,
-                        0, 18, 44,
-                        0, 19, 24,
-                        0, 19, 26,
-                        0, 19, 27,
-                        0, 19, 28,
-                        0, 19, 29,
-                        0, 19, 31,
-                        0, 19, 32,
-                        0, 19, 33,
-                        0, 19, 34,
-                        0, 19, 39,
-                        0, 19, 40,
-                        0, 19, 41,
-                        0, 19, 42,
-                        0, 19, 43,
-                        0, 19, 44,
-                        0, 20, 24,
-                        0, 20, 25,
-                        0, 20, 27,
-                        0, 20, 28,
-                        0, 20, 29,
-                        0, 20, 30,
-                        0, 20, 32,
-                        0, 20, 33,
-                        0, 20, 34,
-                        0, 20, 36,
-                        0, 20, 37,
-                        0, 20, 38,
-                        0, 20, 42,
-                        0, 20, 43,
-                        0, 20, 44,
-                        0, 21, 24,
-                        0, 21, 25,
-                        0, 21, 26,
-                        0, 21, 28,
-                        0, 21, 29,
-                        0, 21, 30,
-                        0, 21, 31,
-                        0, 21, 33,
-                        0, 21, 34,
-                        0, 21, 35,
-                        0, 21, 37,
-                        0, 21, 38,
-                        0, 21, 40,
-                        0, 21, 41,
-                        0, 21, 44,
-                        0, 22, 24,
-                        0, 22, 25,
-                        0, 22, 26,
-                        0, 22, 27,
-                        0, 22, 29,
-                        0, 22, 30,
-                        0, 22, 31,
-                        0, 22, 32,
-                        0, 22, 34,
-                        0, 22, 35,
-                        0, 22, 36,
-                        0, 22, 38,
-                        0, 22, 39,
-                        0, 22, 41,
-                        0, 22, 43,
-                        0, 23, 24,
-                        0, 23, 25,
-                        0, 23, 26,
-                        0, 23, 27,
-                        0, 23, 28,
-                        0, 23, 30,
-                        0, 23, 31,
-                        0, 23, 32,
-                        0, 23, 33,
-                        0, 23, 35,
-                        0, 23, 36,
-                        0, 23, 37,
-                        0, 23, 39,
-                        0, 23, 40,
-                        0, 23, 42,
-                        0, 24, 35,
-                        0, 24, 36,
-                        0, 24, 37,
-                        0, 24, 38,
-                        0, 24, 39,
-                        0, 24, 40,
-                        0, 24, 41,
-                        0, 24, 42,
-                        0, 24, 43,
-                        0, 24, 44,
-                        0, 25, 31,
-                        0, 25, 32,
-                        0, 25, 33,
-                        0, 25, 34,
-                        0, 25, 39,
-                        0, 25, 40,
-                        0, 25, 41,
-                        0, 25, 42,
-                        0, 25, 43,
-                        0, 25, 44,
-                        0, 26, 30,
-                        0, 26, 32,
-                        0, 26, 33,
-                        0, 26, 34,
-                        0, 26, 36,
-                        0, 26, 37,
-                        0, 26, 38,
-                        0, 26, 42,
-                        0, 26, 43,
-                        0, 26, 44,
-                        0, 27, 30,
-                        0, 27, 31,
-                        0, 27, 33,
-                        0, 27, 34,
-                        0, 27, 35,
-                        0, 27, 37,
-                        0, 27, 38,
-                        0, 27, 40,
-                        0, 27, 41,
-                        0, 27, 44,
-                        0, 28, 30,
-                        0, 28, 31,
-                        0, 28, 32,
-                        0, 28, 34,
-                        0, 28, 35,
-                        0, 28, 36,
-                        0, 28, 38,
-                        0, 28, 39,
-                        0, 28, 41,
-                        0, 28, 43,
-                        0, 29, 30,
-                        0, 29, 31,
-                        0, 29, 32,
-                        0, 29, 33,
-                        0, 29, 35,
-                        0, 29, 36,
-                        0, 29, 37,
-                        0, 29, 39,
-                        0, 29, 40,
-                        0, 29, 42,
-                        0, 30, 39,
-                        0, 30, 40,
-                        0, 30, 41,
-                        0, 30, 42,
-                        0, 30, 43,
-                        0, 30, 44,
-                        0, 31, 36,
-                        0, 31, 37,
-                        0, 31, 38,
-                        0, 31, 42,
-                        0, 31, 43,
-                        0, 31, 44,
-                        0, 32, 35,
-                        0, 32, 37,
-                        0, 32, 38,
-                        0, 32, 40,
-                        0, 32, 41,
-                        0, 32, 44,
-                        0, 33, 35,
-                        0, 33, 36,
-                        0, 33, 38,
-                        0, 33, 39,
-                        0, 33, 41,
-                        0, 33, 43,
-                        0, 34, 35,
-                        0, 34, 36,
-                        0, 34, 37,
-                        0, 34, 39,
-                        0, 34, 40,
-                        0, 34, 42,
-                        0, 35, 42,
-                        0, 35, 43,
-                        0, 35, 44,
-                        0, 36, 40,
-                        0, 36, 41,
-                        0, 36, 44,
-                        0, 37, 39,
-                        0, 37, 41,
-                        0, 37, 43,
-                        0, 38, 39,
-                        0, 38, 40,
-                        0, 38, 42,
-                        0, 39, 44,
-                        0, 40, 43,
-                        0, 41, 42,
-                        1, 10, 30,
-                        1, 10, 31,
-                        1, 10, 32,
-                        1, 10, 33,
-                        1, 10, 34,
-                        1, 10, 35,
-                        1, 10, 36,
-                        1, 10, 37,
-                        1, 10, 38,
-                        1, 10, 39,
-                        1, 10, 40,
-                        1, 10, 41,
-                        1, 10, 42,
-                        1, 10, 43,
-                        1, 10, 44,
-                        1, 11, 25,
-                        1, 11, 26,
-                        1, 11, 27,
-                        1, 11, 28,
-                        1, 11, 29,
-                        1, 11, 35,
-                        1, 11, 36,
-                        1, 11, 37,
-                        1, 11, 38,
-                        1, 11, 39,
-                        1, 11, 40,
-                        1, 11, 41,
-                        1, 11, 42,
-                        1, 11, 43,
-                        1, 11, 44,
-                        1, 12, 24,
-                        1, 12, 26,
-                        1, 12, 27,
-                        1, 12, 28,
-                        1, 12, 29,
-                        1, 12, 31,
-                        1, 12, 32,
-                        1, 12, 33,
-                        1, 12, 34,
-                        1, 12, 39,
-                        1, 12, 40,
-                        1, 12, 41,
-                        1, 12, 42,
-                        1, 12, 43,
-                        1, 12, 44,
-                        1, 13, 24,
-                        1, 13, 25,
-                        1, 13, 27,
-                        1, 13, 28,
-                        1, 13, 29,
-                        1, 13, 30,
-                        1, 13, 32,
-                        1, 13, 33,
-                        1, 13, 34,
-                        1, 13, 36,
-                        1, 13, 37,
-                        1, 13, 38,
-                        1, 13, 42,
-                        1, 13, 43,
-                        1, 13, 44,
-                        1, 14, 24,
-                        1, 14, 25,
-                        1, 14, 26,
-                        1, 14, 28,
-                        1, 14, 29,
-                        1, 14, 30,
-                        1, 14, 31,
-                        1, 14, 33,
-                        1, 14, 34,
-                        1, 14, 35,
-                        1, 14, 37,
-                        1, 14, 38,
-                        1, 14, 40,
-                        1, 14, 41,
-                        1, 14, 44,
-                        1, 15, 24,
-                        1, 15, 25,
-                        1, 15, 26,
-                        1, 15, 27,
-                        1, 15, 29,
-                        1, 15, 30,
-                        1, 15, 31,
-                        1, 15, 32,
-                        1, 15, 34,
-                        1, 15, 35,
-                        1, 15, 36,
-                        1, 15, 38,
-                        1, 15, 39,
-                        1, 15, 41,
-                        1, 15, 43,
-                        1, 16, 24,
-                        1, 16, 25,
-                        1, 16, 26,
-                        1, 16, 27,
-                        1, 16, 28,
-                        1, 16, 30,
-                        1, 16, 31,
-                        1, 16, 32,
-                        1, 16, 33,
-                        1, 16, 35,
-                        1, 16, 36,
-                        1, 16, 37,
-                        1, 16, 39,
-                        1, 16, 40,
-                        1, 16, 42,
-                        1, 24, 35,
-                        1, 24, 36,
-                        1, 24, 37,
-                        1, 24, 38,
-                        1, 24, 39,
-                        1, 24, 40,
-                        1, 24, 41,
-                        1, 24, 42,
-                        1, 24, 43,
-                        1, 24, 44,
-                        1, 25, 31,
-                        1, 25, 32,
-                        1, 25, 33,
-                        1, 25, 34,
-                        1, 25, 39,
-                        1, 25, 40,
-                        1, 25, 41,
-                        1, 25, 42,
-                        1, 25, 43,
-                        1, 25, 44,
-                        1, 26, 30,
-                        1, 26, 32,
-                        1, 26, 33,
-                        1, 26, 34,
-                        1, 26, 36,
-                        1, 26, 37,
-                        1, 26, 38,
-                        1, 26, 42,
-                        1, 26, 43,
-                        1, 26, 44,
-                        1, 27, 30,
-                        1, 27, 31,
-                        1, 27, 33,
-                        1, 27, 34,
-                        1, 27, 35,
-                        1, 27, 37,
-                        1, 27, 38,
-                        1, 27, 40,
-                        1, 27, 41,
-                        1, 27, 44,
-                        1, 28, 30,
-                        1, 28, 31,
-                        1, 28, 32,
-                        1, 28, 34,
-                        1, 28, 35,
-                        1, 28, 36,
-                        1, 28, 38,
-                        1, 28, 39,
-                        1, 28, 41,
-                        1, 28, 43,
-                        1, 29, 30,
-                        1, 29, 31,
-                        1, 29, 32,
-                        1, 29, 33,
-                        1, 29, 35,
-                        1, 29, 36,
-                        1, 29, 37,
-                        1, 29, 39,
-                        1, 29, 40,
-                        1, 29, 42,
-                        1, 30, 39,
-                        1, 30, 40,
-                        1, 30, 41,
-                        1, 30, 42,
-                        1, 30, 43,
-                        1, 30, 44,
-                        1, 31, 36,
-                        1, 31, 37,
-                        1, 31, 38,
-                        1, 31, 42,
-                        1, 31, 43,
-                        1, 31, 44,
-                        1, 32, 35,
-                        1, 32, 37,
-                        1, 32, 38,
-                        1, 32, 40,
-                        1, 32, 41,
-                        1, 32, 44,
-                        1, 33, 35,
-                        1, 33, 36,
-                        1, 33, 38,
-                        1, 33, 39,
-                        1, 33, 41,
-                        1, 33, 43,
-                        1, 34, 35,
-                        1, 34, 36,
-                        1, 34, 37,
-                        1, 34, 39,
-                        1, 34, 40,
-                        1, 34, 42,
-                        1, 35, 42,
-                        1, 35, 43,
-                        1, 35, 44,
-                        1, 36, 40,
-                        1, 36, 41,
-                        1, 36, 44,
-                        1, 37, 39,
-                        1, 37, 41,
-                        1, 37, 43,
-                        1, 38, 39,
-                        1, 38, 40,
-                        1, 38, 42,
-                        1, 39, 44,
-                        1, 40, 43,
-                        1, 41, 42,
-                        2, 9, 30,
-                        2, 9, 31,
-                        2, 9, 32,
-                        2, 9, 33,
-                        2, 9, 34,
-                        2, 9, 35,
-                        2, 9, 36,
-                        2, 9, 37,
-                        2, 9, 38,
-                        2, 9, 39,
-                        2, 9, 40,
-                        2, 9, 41,
-                        2, 9, 42,
-                        2, 9, 43,
-                        2, 9, 44,
-                        2, 11, 19,
-                        2, 11, 20,
-                        2, 11, 21,
-                        2, 11, 22,
-                        2, 11, 23,
-                        2, 11, 35,
-                        2, 11, 36,
-                        2, 11, 37,
-                        2, 11, 38,
-                        2, 11, 39,
-                        2, 11, 40,
-                        2, 11, 41,
-                        2, 11, 42,
-                        2, 11, 43,
-                        2, 11, 44,
-                        2, 12, 18,
-                        2, 12, 20,
-                        2, 12, 21,
-                        2, 12, 22,
-                        2, 12, 23,
-                        2, 12, 31,
-                        2, 12, 32,
-                        2, 12, 33,
-                        2, 12, 34,
-                        2, 12, 39,
-                        2, 12, 40,
-                        2, 12, 41,
-                        2, 12, 42,
-                        2, 12, 43,
-                        2, 12, 44,
-                        2, 13, 18,
-                        2, 13, 19,
-                        2, 13, 21,
-                        2, 13, 22,
-                        2, 13, 23,
-                        2, 13, 30,
-                        2, 13, 32,
-                        2, 13, 33,
-                        2, 13, 34,
-                        2, 13, 36,
-                        2, 13, 37,
-                        2, 13, 38,
-                        2, 13, 42,
-                        2, 13, 43,
-                        2, 13, 44,
-                        2, 14, 18,
-                        2, 14, 19,
-                        2, 14, 20,
-                        2, 14, 22,
-                        2, 14, 23,
-                        2, 14, 30,
-                        2, 14, 31,
-                        2, 14, 33,
-                        2, 14, 34,
-                        2, 14, 35,
-                        2, 14, 37,
-                        2, 14, 38,
-                        2, 14, 40,
-                        2, 14, 41,
-                        2, 14, 44,
-                        2, 15, 18,
-                        2, 15, 19,
-                        2, 15, 20,
-                        2, 15, 21,
-                        2, 15, 23,
-                        2, 15, 30,
-                        2, 15, 31,
-                        2, 15, 32,
-                        2, 15, 34,
-                        2, 15, 35,
-                        2, 15, 36,
-                        2, 15, 38,
-                        2, 15, 39,
-                        2, 15, 41,
-                        2, 15, 43,
-                        2, 16, 18,
-                        2, 16, 19,
-                        2, 16, 20,
-                        2, 16, 21,
-                        2, 16, 22,
-                        2, 16, 30,
-                        2, 16, 31,
-                        2, 16, 32,
-                        2, 16, 33,
-                        2, 16, 35,
-                        2, 16, 36,
-                        2, 16, 37,
-                        2, 16, 39,
-                        2, 16, 40,
-                        2, 16, 42,
-                        2, 18, 35,
-                        2, 18, 36,
-                        2, 18, 37,
-                        2, 18, 38,
-                        2, 18, 39,
-                        2, 18, 40,
-                        2, 18, 41,
-                        2, 18, 42,
-                        2, 18, 43,
-                        2, 18, 44,
-                        2, 19, 31,
-                        2, 19, 32,
-                        2, 19, 33,
-                        2, 19, 34,
-                        2, 19, 39,
-                        2, 19, 40,
-                        2, 19, 41,
-                        2, 19, 42,
-                        2, 19, 43,
-                        2, 19, 44,
-                        2, 20, 30,
-                        2, 20, 32,
-                        2, 20, 33,
-                        2, 20, 34,
-                        2, 20, 36,
-                        2, 20, 37,
-                        2, 20, 38,
-                        2, 20, 42,
-                        2, 20, 43,
-                        2, 20, 44,
-                        2, 21, 30,
-                        2, 21, 31,
-                        2, 21, 33,
-                        2, 21, 34,
-                        2, 21, 35,
-                        2, 21, 37,
-                        2, 21, 38,
-                        2, 21, 40,
-                        2, 21, 41,
-                        2, 21, 44,
-                        2, 22, 30,
-                        2, 22, 31,
-                        2, 22, 32,
-                        2, 22, 34,
-                        2, 22, 35,
-                        2, 22, 36,
-                        2, 22, 38,
-                        2, 22, 39,
-                        2, 22, 41,
-                        2, 22, 43,
-                        2, 23, 30,
-                        2, 23, 31,
-                        2, 23, 32,
-                        2, 23, 33,
-                        2, 23, 35,
-                        2, 23, 36,
-                        2, 23, 37,
-                        2, 23, 39,
-                        2, 23, 40,
-                        2, 23, 42,
-                        2, 30, 39,
-                        2, 30, 40,
-                        2, 30, 41,
-                        2, 30, 42,
-                        2, 30, 43,
-                        2, 30, 44,
-                        2, 31, 36,
-                        2, 31, 37,
-                        2, 31, 38,
-                        2, 31, 42,
-                        2, 31, 43,
-                        2, 31, 44,
-                        2, 32, 35,
-                        2, 32, 37,
-                        2, 32, 38,
-                        2, 32, 40,
-                        2, 32, 41,
-                        2, 32, 44,
-                        2, 33, 35,
-                        2, 33, 36,
-                        2, 33, 38,
-                        2, 33, 39,
-                        2, 33, 41,
-                        2, 33, 43,
-                        2, 34, 35,
-                        2, 34, 36,
-                        2, 34, 37,
-                        2, 34, 39,
-                        2, 34, 40,
-                        2, 34, 42,
-                        2, 35, 42,
-                        2, 35, 43,
-                        2, 35, 44,
-                        2, 36, 40,
-                        2, 36, 41,
-                        2, 36, 44,
-                        2, 37, 39,
-                        2, 37, 41,
-                        2, 37, 43,
-                        2, 38, 39,
-                        2, 38, 40,
-                        2, 38, 42,
-                        2, 39, 44,
-                        2, 40, 43,
-                        2, 41, 42,
-                        3, 9, 25,
-                        3, 9, 26,
-                        3, 9, 27,
-                        3, 9, 28,
-                        3, 9, 29,
-                        3, 9, 35,
-                        3, 9, 36,
-                        3, 9, 37,
-                        3, 9, 38,
-                        3, 9, 39,
-                        3, 9, 40,
-                        3, 9, 41,
-                        3, 9, 42,
-                        3, 9, 43,
-                        3, 9, 44,
-                        3, 10, 19,
-                        3, 10, 20,
-                        3, 10, 21,
-                        3, 10, 22,
-                        3, 10, 23,
-                        3, 10, 35,
-                        3, 10, 36,
-                        3, 10, 37,
-                        3, 10, 38,
-                        3, 10, 39,
-                        3, 10, 40,
-                        3, 10, 41,
-                        3, 10, 42,
-                        3, 10, 43,
-                        3, 10, 44,
-                        3, 12, 17,
-                        3, 12, 20,
-                        3, 12, 21,
-                        3, 12, 22,
-                        3, 12, 23,
-                        3, 12, 26,
-                        3, 12, 27,
-                        3, 12, 28,
-                        3, 12, 29,
-                        3, 12, 39,
-                        3, 12, 40,
-                        3, 12, 41,
-                        3, 12, 42,
-                        3, 12, 43,
-                        3, 12, 44,
-                        3, 13, 17,
-                        3, 13, 19,
-                        3, 13, 21,
-                        3, 13, 22,
-                        3, 13, 23,
-                        3, 13, 25,
-                        3, 13, 27,
-                        3, 13, 28,
-                        3, 13, 29,
-                        3, 13, 36,
-                        3, 13, 37,
-                        3, 13, 38,
-                        3, 13, 42,
-                        3, 13, 43,
-                        3, 13, 44,
-                        3, 14, 17,
-                        3, 14, 19,
-                        3, 14, 20,
-                        3, 14, 22,
-                        3, 14, 23,
-                        3, 14, 25,
-                        3, 14, 26,
-                        3, 14, 28,
-                        3, 14, 29,
-                        3, 14, 35,
-                        3, 14, 37,
-                        3, 14, 38,
-                        3, 14, 40,
-                        3, 14, 41,
-                        3, 14, 44,
-                        3, 15, 17,
-                        3, 15, 19,
-                        3, 15, 20,
-                        3, 15, 21,
-                        3, 15, 23,
-                        3, 15, 25,
-                        3, 15, 26,
-                        3, 15, 27,
-                        3, 15, 29,
-                        3, 15, 35,
-                        3, 15, 36,
-                        3, 15, 38,
-                        3, 15, 39,
-                        3, 15, 41,
-                        3, 15, 43,
-                        3, 16, 17,
-                        3, 16, 19,
-                        3, 16, 20,
-                        3, 16, 21,
-                        3, 16, 22,
-                        3, 16, 25,
-                        3, 16, 26,
-                        3, 16, 27,
-                        3, 16, 28,
-                        3, 16, 35,
-                        3, 16, 36,
-                        3, 16, 37,
-                        3, 16, 39,
-                        3, 16, 40,
-                        3, 16, 42,
-                        3, 17, 35,
-                        3, 17, 36,
-                        3, 17, 37,
-                        3, 17, 38,
-                        3, 17, 39,
-                        3, 17, 40,
-                        3, 17, 41,
-                        3, 17, 42,
-                        3, 17, 43,
-                        3, 17, 44,
-                        3, 19, 26,
-                        3, 19, 27,
-                        3, 19, 28,
-                        3, 19, 29,
-                        3, 19, 39,
-                        3, 19, 40,
-                        3, 19, 41,
-                        3, 19, 42,
-                        3, 19, 43,
-                        3, 19, 44,
-                        3, 20, 25,
-                        3, 20, 27,
-                        3, 20, 28,
-                        3, 20, 29,
-                        3, 20, 36,
-                        3, 20, 37,
-                        3, 20, 38,
-                        3, 20, 42,
-                        3, 20, 43,
-                        3, 20, 44,
-                        3, 21, 25,
-                        3, 21, 26,
-                        3, 21, 28,
-                        3, 21, 29,
-                        3, 21, 35,
-                        3, 21, 37,
-                        3, 21, 38,
-                        3, 21, 40,
-                        3, 21, 41,
-                        3, 21, 44,
-                        3, 22, 25,
-                        3, 22, 26,
-                        3, 22, 27,
-                        3, 22, 29,
-                        3, 22, 35,
-                        3, 22, 36,
-                        3, 22, 38,
-                        3, 22, 39,
-                        3, 22, 41,
-                        3, 22, 43,
-                        3, 23, 25,
-                        3, 23, 26,
-                        3, 23, 27,
-                        3, 23, 28,
-                        3, 23, 35,
-                        3, 23, 36,
-                        3, 23, 37,
-                        3, 23, 39,
-                        3, 23, 40,
-                        3, 23, 42,
-                        3, 25, 39,
-                        3, 25, 40,
-                        3, 25, 41,
-                        3, 25, 42,
-                        3, 25, 43,
-                        3, 25, 44,
-                        3, 26, 36,
-                        3, 26, 37,
-                        3, 26, 38,
-                        3, 26, 42,
-                        3, 26, 43,
-                        3, 26, 44,
-                        3, 27, 35,
-                        3, 27, 37,
-                        3, 27, 38,
-                        3, 27, 40,
-                        3, 27, 41,
-                        3, 27, 44,
-                        3, 28, 35,
-                        3, 28, 36,
-                        3, 28, 38,
-                        3, 28, 39,
-                        3, 28, 41,
-                        3, 28, 43,
-                        3, 29, 35,
-                        3, 29, 36,
-                        3, 29, 37,
-                        3, 29, 39,
-                        3, 29, 40,
-                        3, 29, 42,
-                        3, 35, 42,
-                        3, 35, 43,
-                        3, 35, 44,
-                        3, 36, 40,
-                        3, 36, 41,
-                        3, 36, 44,
-                        3, 37, 39,
-                        3, 37, 41,
-                        3, 37, 43,
-                        3, 38, 39,
-                        3, 38, 40,
-                        3, 38, 42,
-                        3, 39, 44,
-                        3, 40, 43,
-                        3, 41, 42,
-                        4, 9, 24,
-                        4, 9, 26,
-                        4, 9, 27,
-                        4, 9, 28,
-                        4, 9, 29,
-                        4, 9, 31,
-                        4, 9, 32,
-                        4, 9, 33,
-                        4, 9, 34,
-                        4, 9, 39,
-                        4, 9, 40,
-                        4, 9, 41,
-                        4, 9, 42,
-                        4, 9, 43,
-                        4, 9, 44,
-                        4, 10, 18,
-                        4, 10, 20,
-                        4, 10, 21,
-                        4, 10, 22,
-                        4, 10, 23,
-                        4, 10, 31,
-                        4, 10, 32,
-                        4, 10, 33,
-                        4, 10, 34,
-                        4, 10, 39,
-                        4, 10, 40,
-                        4, 10, 41,
-                        4, 10, 42,
-                        4, 10, 43,
-                        4, 10, 44,
-                        4, 11, 17,
-                        4, 11, 20,
-                        4, 11, 21,
-                        4, 11, 22,
-                        4, 11, 23,
-                        4, 11, 26,
-                        4, 11, 27,
-                        4, 11, 28,
-                        4, 11, 29,
-                        4, 11, 39,
-                        4, 11, 40,
-                        4, 11, 41,
-                        4, 11, 42,
-                        4, 11, 43,
-                        4, 11, 44,
-                        4, 13, 17,
-                        4, 13, 18,
-                        4, 13, 21,
-                        4, 13, 22,
-                        4, 13, 23,
-                        4, 13, 24,
-                        4, 13, 27,
-                        4, 13, 28,
-                        4, 13, 29,
-                        4, 13, 32,
-                        4, 13, 33,
-                        4, 13, 34,
-                        4, 13, 42,
-                        4, 13, 43,
-                        4, 13, 44,
-                        4, 14, 17,
-                        4, 14, 18,
-                        4, 14, 20,
-                        4, 14, 22,
-                        4, 14, 23,
-                        4, 14, 24,
-                        4, 14, 26,
-                        4, 14, 28,
-                        4, 14, 29,
-                        4, 14, 31,
-                        4, 14, 33,
-                        4, 14, 34,
-                        4, 14, 40,
-                        4, 14, 41,
-                        4, 14, 44,
-                        4, 15, 17,
-                        4, 15, 18,
-                        4, 15, 20,
-                        4, 15, 21,
-                        4, 15, 23,
-                        4, 15, 24,
-                        4, 15, 26,
-                        4, 15, 27,
-                        4, 15, 29,
-                        4, 15, 31,
-                        4, 15, 32,
-                        4, 15, 34,
-                        4, 15, 39,
-                        4, 15, 41,
-                        4, 15, 43,
-                        4, 16, 17,
-                        4, 16, 18,
-                        4, 16, 20,
-                        4, 16, 21,
-                        4, 16, 22,
-                        4, 16, 24,
-                        4, 16, 26,
-                        4, 16, 27,
-                        4, 16, 28,
-                        4, 16, 31,
-                        4, 16, 32,
-                        4, 16, 33,
-                        4, 16, 39,
-                        4, 16, 40,
-                        4, 16, 42,
-                        4, 17, 31,
-                        4, 17, 32,
-                        4, 17, 33,
-                        4, 17, 34,
-                        4, 17, 39,
-                        4, 17, 40,
-                        4, 17, 41,
-                        4, 17, 42,
-                        4, 17, 43,
-                        4, 17, 44,
-                        4, 18, 26,
-                        4, 18, 27,
-                        4, 18, 28,
-                        4, 18, 29,
-                        4, 18, 39,
-                        4, 18, 40,
-                        4, 18, 41,
-                        4, 18, 42,
-                        4, 18, 43,
-                        4, 18, 44,
-                        4, 20, 24,
-                        4, 20, 27,
-                        4, 20, 28,
-                        4, 20, 29,
-                        4, 20, 32,
-                        4, 20, 33,
-                        4, 20, 34,
-                        4, 20, 42,
-                        4, 20, 43,
-                        4, 20, 44,
-                        4, 21, 24,
-                        4, 21, 26,
-                        4, 21, 28,
-                        4, 21, 29,
-                        4, 21, 31,
-                        4, 21, 33,
-                        4, 21, 34,
-                        4, 21, 40,
-                        4, 21, 41,
-                        4, 21, 44,
-                        4, 22, 24,
-                        4, 22, 26,
-                        4, 22, 27,
-                        4, 22, 29,
-                        4, 22, 31,
-                        4, 22, 32,
-                        4, 22, 34,
-                        4, 22, 39,
-                        4, 22, 41,
-                        4, 22, 43,
-                        4, 23, 24,
-                        4, 23, 26,
-                        4, 23, 27,
-                        4, 23, 28,
-                        4, 23, 31,
-                        4, 23, 32,
-                        4, 23, 33,
-                        4, 23, 39,
-                        4, 23, 40,
-                        4, 23, 42,
-                        4, 24, 39,
-                        4, 24, 40,
-                        4, 24, 41,
-                        4, 24, 42,
-                        4, 24, 43,
-                        4, 24, 44,
-                        4, 26, 32,
-                        4, 26, 33,
-                        4, 26, 34,
-                        4, 26, 42,
-                        4, 26, 43,
-                        4, 26, 44,
-                        4, 27, 31,
-                        4, 27, 33,
-                        4, 27, 34,
-                        4, 27, 40,
-                        4, 27, 41,
-                        4, 27, 44,
-                        4, 28, 31,
-                        4, 28, 32,
-                        4, 28, 34,
-                        4, 28, 39,
-                        4, 28, 41,
-                        4, 28, 43,
-                        4, 29, 31,
-                        4, 29, 32,
-                        4, 29, 33,
-                        4, 29, 39,
-                        4, 29, 40,
-                        4, 29, 42,
-                        4, 31, 42,
-                        4, 31, 43,
-                        4, 31, 44,
-                        4, 32, 40,
-                        4, 32, 41,
-                        4, 32, 44,
-                        4, 33, 39,
-                        4, 33, 41,
-                        4, 33, 43,
-                        4, 34, 39,
-                        4, 34, 40,
-                        4, 34, 42,
-                        4, 39, 44,
-                        4, 40, 43,
-                        4, 41, 42,
-                        5, 9, 24,
-                        5, 9, 25,
-                        5, 9, 27,
-                        5, 9, 28,
-                        5, 9, 29,
-                        5, 9, 30,
-                        5, 9, 32,
-                        5, 9, 33,
-                        5, 9, 34,
-                        5, 9, 36,
-                        5, 9, 37,
-                        5, 9, 38,
-                        5, 9, 42,
-                        5, 9, 43,
-                        5, 9, 44,
-                        5, 10, 18,
-                        5, 10, 19,
-                        5, 10, 21,
-                        5, 10, 22,
-                        5, 10, 23,
-                        5, 10, 30,
-                        5, 10, 32,
-                        5, 10, 33,
-                        5, 10, 34,
-                        5, 10, 36,
-                        5, 10, 37,
-                        5, 10, 38,
-                        5, 10, 42,
-                        5, 10, 43,
-                        5, 10, 44,
-                        5, 11, 17,
-                        5, 11, 19,
-                        5, 11, 21,
-                        5, 11, 22,
-                        5, 11, 23,
-                        5, 11, 25,
-                        5, 11, 27,
-                        5, 11, 28,
-                        5, 11, 29,
-                        5, 11, 36,
-                        5, 11, 37,
-                        5, 11, 38,
-                        5, 11, 42,
-                        5, 11, 43,
-                        5, 11, 44,
-                        5, 12, 17,
-                        5, 12, 18,
-                        5, 12, 21,
-                        5, 12, 22,
-                        5, 12, 23,
-                        5, 12, 24,
-                        5, 12, 27,
-                        5, 12, 28,
-                        5, 12, 29,
-                        5, 12, 32,
-                        5, 12, 33,
-                        5, 12, 34,
-                        5, 12, 42,
-                        5, 12, 43,
-                        5, 12, 44,
-                        5, 14, 17,
-                        5, 14, 18,
-                        5, 14, 19,
-                        5, 14, 22,
-                        5, 14, 23,
-                        5, 14, 24,
-                        5, 14, 25,
-                        5, 14, 28,
-                        5, 14, 29,
-                        5, 14, 30,
-                        5, 14, 33,
-                        5, 14, 34,
-                        5, 14, 37,
-                        5, 14, 38,
-                        5, 14, 44,
-                        5, 15, 17,
-                        5, 15, 18,
-                        5, 15, 19,
-                        5, 15, 21,
-                        5, 15, 23,
-                        5, 15, 24,
-                        5, 15, 25,
-                        5, 15, 27,
-                        5, 15, 29,
-                        5, 15, 30,
-                        5, 15, 32,
-                        5, 15, 34,
-                        5, 15, 36,
-                        5, 15, 38,
-                        5, 15, 43,
-                        5, 16, 17,
-                        5, 16, 18,
-                        5, 16, 19,
-                        5, 16, 21,
-                        5, 16, 22,
-                        5, 16, 24,
-                        5, 16, 25,
-                        5, 16, 27,
-                        5, 16, 28,
-                        5, 16, 30,
-                        5, 16, 32,
-                        5, 16, 33,
-                        5, 16, 36,
-                        5, 16, 37,
-                        5, 16, 42,
-                        5, 17, 30,
-                        5, 17, 32,
-                        5, 17, 33,
-                        5, 17, 34,
-                        5, 17, 36,
-                        5, 17, 37,
-                        5, 17, 38,
-                        5, 17, 42,
-                        5, 17, 43,
-                        5, 17, 44,
-                        5, 18, 25,
-                        5, 18, 27,
-                        5, 18, 28,
-                        5, 18, 29,
-                        5, 18, 36,
-                        5, 18, 37,
-                        5, 18, 38,
-                        5, 18, 42,
-                        5, 18, 43,
-                        5, 18, 44,
-                        5, 19, 24,
-                        5, 19, 27,
-                        5, 19, 28,
-                        5, 19, 29,
-                        5, 19, 32,
-                        5, 19, 33,
-                        5, 19, 34,
-                        5, 19, 42,
-                        5, 19, 43,
-                        5, 19, 44,
-                        5, 21, 24,
-                        5, 21, 25,
-                        5, 21, 28,
-                        5, 21, 29,
-                        5, 21, 30,
-                        5, 21, 33,
-                        5, 21, 34,
-                        5, 21, 37,
-                        5, 21, 38,
-                        5, 21, 44,
-                        5, 22, 24,
-                        5, 22, 25,
-                        5, 22, 27,
-                        5, 22, 29,
-                        5, 22, 30,
-                        5, 22, 32,
-                        5, 22, 34,
-                        5, 22, 36,
-                        5, 22, 38,
-                        5, 22, 43,
-                        5, 23, 24,
-                        5, 23, 25,
-                        5, 23, 27,
-                        5, 23, 28,
-                        5, 23, 30,
-                        5, 23, 32,
-                        5, 23, 33,
-                        5, 23, 36,
-                        5, 23, 37,
-                        5, 23, 42,
-                        5, 24, 36,
-                        5, 24, 37,
-                        5, 24, 38,
-                        5, 24, 42,
-                        5, 24, 43,
-                        5, 24, 44,
-                        5, 25, 32,
-                        5, 25, 33,
-                        5, 25, 34,
-                        5, 25, 42,
-                        5, 25, 43,
-                        5, 25, 44,
-                        5, 27, 30,
-                        5, 27, 33,
-                        5, 27, 34,
-                        5, 27, 37,
-                        5, 27, 38,
-                        5, 27, 44,
-                        5, 28, 30,
-                        5, 28, 32,
-                        5, 28, 34,
-                        5, 28, 36,
-                        5, 28, 38,
-                        5, 28, 43,
-                        5, 29, 30,
-                        5, 29, 32,
-                        5, 29, 33,
-                        5, 29, 36,
-                        5, 29, 37,
-                        5, 29, 42,
-                        5, 30, 42,
-                        5, 30, 43,
-                        5, 30, 44,
-                        5, 32, 37,
-                        5, 32, 38,
-                        5, 32, 44,
-                        5, 33, 36,
-                        5, 33, 38,
-                        5, 33, 43,
-                        5, 34, 36,
-                        5, 34, 37,
-                        5, 34, 42,
-                        5, 36, 44,
-                        5, 37, 43,
-                        5, 38, 42,
-                        6, 9, 24,
-                        6, 9, 25,
-                        6, 9, 26,
-                        6, 9, 28,
-                        6, 9, 29,
-                        6, 9, 30,
-                        6, 9, 31,
-                        6, 9, 33,
-                        6, 9, 34,
-                        6, 9, 35,
-                        6, 9, 37,
-                        6, 9, 38,
-                        6, 9, 40,
-                        6, 9, 41,
-                        6, 9, 44,
-                        6, 10, 18,
-                        6, 10, 19,
-                        6, 10, 20,
-                        6, 10, 22,
-                        6, 10, 23,
-                        6, 10, 30,
-                        6, 10, 31,
-                        6, 10, 33,
-                        6, 10, 34,
-                        6, 10, 35,
-                        6, 10, 37,
-                        6, 10, 38,
-                        6, 10, 40,
-                        6, 10, 41,
-                        6, 10, 44,
-                        6, 11, 17,
-                        6, 11, 19,
-                        6, 11, 20,
-                        6, 11, 22,
-                        6, 11, 23,
-                        6, 11, 25,
-                        6, 11, 26,
-                        6, 11, 28,
-                        6, 11, 29,
-                        6, 11, 35,
-                        6, 11, 37,
-                        6, 11, 38,
-                        6, 11, 40,
-                        6, 11, 41,
-                        6, 11, 44,
-                        6, 12, 17,
-                        6, 12, 18,
-                        6, 12, 20,
-                        6, 12, 22,
-                        6, 12, 23,
-                        6, 12, 24,
-                        6, 12, 26,
-                        6, 12, 28,
-                        6, 12, 29,
-                        6, 12, 31,
-                        6, 12, 33,
-                        6, 12, 34,
-                        6, 12, 40,
-                        6, 12, 41,
-                        6, 12, 44,
-                        6, 13, 17,
-                        6, 13, 18,
-                        6, 13, 19,
-                        6, 13, 22,
-                        6, 13, 23,
-                        6, 13, 24,
-                        6, 13, 25,
-                        6, 13, 28,
-                        6, 13, 29,
-                        6, 13, 30,
-                        6, 13, 33,
-                        6, 13, 34,
-                        6, 13, 37,
-                        6, 13, 38,
-                        6, 13, 44,
-                        6, 15, 17,
-                        6, 15, 18,
-                        6, 15, 19,
-                        6, 15, 20,
-                        6, 15, 23,
-                        6, 15, 24,
-                        6, 15, 25,
-                        6, 15, 26,
-                        6, 15, 29,
-                        6, 15, 30,
-                        6, 15, 31,
-                        6, 15, 34,
-                        6, 15, 35,
-                        6, 15, 38,
-                        6, 15, 41,
-                        6, 16, 17,
-                        6, 16, 18,
-                        6, 16, 19,
-                        6, 16, 20,
-                        6, 16, 22,
-                        6, 16, 24,
-                        6, 16, 25,
-                        6, 16, 26,
-                        6, 16, 28,
-                        6, 16, 30,
-                        6, 16, 31,
-                        6, 16, 33,
-                        6, 16, 35,
-                        6, 16, 37,
-                        6, 16, 40,
-                        6, 17, 30,
-                        6, 17, 31,
-                        6, 17, 33,
-                        6, 17, 34,
-                        6, 17, 35,
-                        6, 17, 37,
-                        6, 17, 38,
-                        6, 17, 40,
-                        6, 17, 41,
-                        6, 17, 44,
-                        6, 18, 25,
-                        6, 18, 26,
-                        6, 18, 28,
-                        6, 18, 29,
-                        6, 18, 35,
-                        6, 18, 37,
-                        6, 18, 38,
-                        6, 18, 40,
-                        6, 18, 41,
-                        6, 18, 44,
-                        6, 19, 24,
-                        6, 19, 26,
-                        6, 19, 28,
-                        6, 19, 29,
-                        6, 19, 31,
-                        6, 19, 33,
-                        6, 19, 34,
-                        6, 19, 40,
-                        6, 19, 41,
-                        6, 19, 44,
-                        6, 20, 24,
-                        6, 20, 25,
-                        6, 20, 28,
-                        6, 20, 29,
-                        6, 20, 30,
-                        6, 20, 33,
-                        6, 20, 34,
-                        6, 20, 37,
-                        6, 20, 38,
-                        6, 20, 44,
-                        6, 22, 24,
-                        6, 22, 25,
-                        6, 22, 26,
-                        6, 22, 29,
-                        6, 22, 30,
-                        6, 22, 31,
-                        6, 22, 34,
-                        6, 22, 35,
-                        6, 22, 38,
-                        6, 22, 41,
-                        6, 23, 24,
-                        6, 23, 25,
-                        6, 23, 26,
-                        6, 23, 28,
-                        6, 23, 30,
-                        6, 23, 31,
-                        6, 23, 33,
-                        6, 23, 35,
-                        6, 23, 37,
-                        6, 23, 40,
-                        6, 24, 35,
-                        6, 24, 37,
-                        6, 24, 38,
-                        6, 24, 40,
-                        6, 24, 41,
-                        6, 24, 44,
-                        6, 25, 31,
-                        6, 25, 33,
-                        6, 25, 34,
-                        6, 25, 40,
-                        6, 25, 41,
-                        6, 25, 44,
-                        6, 26, 30,
-                        6, 26, 33,
-                        6, 26, 34,
-                        6, 26, 37,
-                        6, 26, 38,
-                        6, 26, 44,
-                        6, 28, 30,
-                        6, 28, 31,
-                        6, 28, 34,
-                        6, 28, 35,
-                        6, 28, 38,
-                        6, 28, 41,
-                        6, 29, 30,
-                        6, 29, 31,
-                        6, 29, 33,
-                        6, 29, 35,
-                        6, 29, 37,
-                        6, 29, 40,
-                        6, 30, 40,
-                        6, 30, 41,
-                        6, 30, 44,
-                        6, 31, 37,
-                        6, 31, 38,
-                        6, 31, 44,
-                        6, 33, 35,
-                        6, 33, 38,
-                        6, 33, 41,
-                        6, 34, 35,
-                        6, 34, 37,
-                        6, 34, 40,
-                        6, 35, 44,
-                        6, 37, 41,
-                        6, 38, 40,
-                        7, 9, 24,
-                        7, 9, 25,
-                        7, 9, 26,
-                        7, 9, 27,
-                        7, 9, 29,
-                        7, 9, 30,
-                        7, 9, 31,
-                        7, 9, 32,
-                        7, 9, 34,
-                        7, 9, 35,
-                        7, 9, 36,
-                        7, 9, 38,
-                        7, 9, 39,
-                        7, 9, 41,
-                        7, 9, 43,
-                        7, 10, 18,
-                        7, 10, 19,
-                        7, 10, 20,
-                        7, 10, 21,
-                        7, 10, 23,
-                        7, 10, 30,
-                        7, 10, 31,
-                        7, 10, 32,
-                        7, 10, 34,
-                        7, 10, 35,
-                        7, 10, 36,
-                        7, 10, 38,
-                        7, 10, 39,
-                        7, 10, 41,
-                        7, 10, 43,
-                        7, 11, 17,
-                        7, 11, 19,
-                        7, 11, 20,
-                        7, 11, 21,
-                        7, 11, 23,
-                        7, 11, 25,
-                        7, 11, 26,
-                        7, 11, 27,
-                        7, 11, 29,
-                        7, 11, 35,
-                        7, 11, 36,
-                        7, 11, 38,
-                        7, 11, 39,
-                        7, 11, 41,
-                        7, 11, 43,
-                        7, 12, 17,
-                        7, 12, 18,
-                        7, 12, 20,
-                        7, 12, 21,
-                        7, 12, 23,
-                        7, 12, 24,
-                        7, 12, 26,
-                        7, 12, 27,
-                        7, 12, 29,
-                        7, 12, 31,
-                        7, 12, 32,
-                        7, 12, 34,
-                        7, 12, 39,
-                        7, 12, 41,
-                        7, 12, 43,
-                        7, 13, 17,
-                        7, 13, 18,
-                        7, 13, 19,
-                        7, 13, 21,
-                        7, 13, 23,
-                        7, 13, 24,
-                        7, 13, 25,
-                        7, 13, 27,
-                        7, 13, 29,
-                        7, 13, 30,
-                        7, 13, 32,
-                        7, 13, 34,
-                        7, 13, 36,
-                        7, 13, 38,
-                        7, 13, 43,
-                        7, 14, 17,
-                        7, 14, 18,
-                        7, 14, 19,
-                        7, 14, 20,
-                        7, 14, 23,
-                        7, 14, 24,
-                        7, 14, 25,
-                        7, 14, 26,
-                        7, 14, 29,
-                        7, 14, 30,
-                        7, 14, 31,
-                        7, 14, 34,
-                        7, 14, 35,
-                        7, 14, 38,
-                        7, 14, 41,
-                        7, 16, 17,
-                        7, 16, 18,
-                        7, 16, 19,
-                        7, 16, 20,
-                        7, 16, 21,
-                        7, 16, 24,
-                        7, 16, 25,
-                        7, 16, 26,
-                        7, 16, 27,
-                        7, 16, 30,
-                        7, 16, 31,
-                        7, 16, 32,
-                        7, 16, 35,
-                        7, 16, 36,
-                        7, 16, 39,
-                        7, 17, 30,
-                        7, 17, 31,
-                        7, 17, 32,
-                        7, 17, 34,
-                        7, 17, 35,
-                        7, 17, 36,
-                        7, 17, 38,
-                        7, 17, 39,
-                        7, 17, 41,
-                        7, 17, 43,
-                        7, 18, 25,
-                        7, 18, 26,
-                        7, 18, 27,
-                        7, 18, 29,
-                        7, 18, 35,
-                        7, 18, 36,
-                        7, 18, 38,
-                        7, 18, 39,
-                        7, 18, 41,
-                        7, 18, 43,
-                        7, 19, 24,
-                        7, 19, 26,
-                        7, 19, 27,
-                        7, 19, 29,
-                        7, 19, 31,
-                        7, 19, 32,
-                        7, 19, 34,
-                        7, 19, 39,
-                        7, 19, 41,
-                        7, 19, 43,
-                        7, 20, 24,
-                        7, 20, 25,
-                        7, 20, 27,
-                        7, 20, 29,
-                        7, 20, 30,
-                        7, 20, 32,
-                        7, 20, 34,
-                        7, 20, 36,
-                        7, 20, 38,
-                        7, 20, 43,
-                        7, 21, 24,
-                        7, 21, 25,
-                        7, 21, 26,
-                        7, 21, 29,
-                        7, 21, 30,
-                        7, 21, 31,
-                        7, 21, 34,
-                        7, 21, 35,
-                        7, 21, 38,
-                        7, 21, 41,
-                        7, 23, 24,
-                        7, 23, 25,
-                        7, 23, 26,
-                        7, 23, 27,
-                        7, 23, 30,
-                        7, 23, 31,
-                        7, 23, 32,
-                        7, 23, 35,
-                        7, 23, 36,
-                        7, 23, 39,
-                        7, 24, 35,
-                        7, 24, 36,
-                        7, 24, 38,
-                        7, 24, 39,
-                        7, 24, 41,
-                        7, 24, 43,
-                        7, 25, 31,
-                        7, 25, 32,
-                        7, 25, 34,
-                        7, 25, 39,
-                        7, 25, 41,
-                        7, 25, 43,
-                        7, 26, 30,
-                        7, 26, 32,
-                        7, 26, 34,
-                        7, 26, 36,
-                        7, 26, 38,
-                        7, 26, 43,
-                        7, 27, 30,
-                        7, 27, 31,
-                        7, 27, 34,
-                        7, 27, 35,
-                        7, 27, 38,
-                        7, 27, 41,
-                        7, 29, 30,
-                        7, 29, 31,
-                        7, 29, 32,
-                        7, 29, 35,
-                        7, 29, 36,
-                        7, 29, 39,
-                        7, 30, 39,
-                        7, 30, 41,
-                        7, 30, 43,
-                        7, 31, 36,
-                        7, 31, 38,
-                        7, 31, 43,
-                        7, 32, 35,
-                        7, 32, 38,
-                        7, 32, 41,
-                        7, 34, 35,
-                        7, 34, 36,
-                        7, 34, 39,
-                        7, 35, 43,
-                        7, 36, 41,
-                        7, 38, 39,
-                        8, 9, 24,
-                        8, 9, 25,
-                        8, 9, 26,
-                        8, 9, 27,
-                        8, 9, 28,
-                        8, 9, 30,
-                        8, 9, 31,
-                        8, 9, 32,
-                        8, 9, 33,
-                        8, 9, 35,
-                        8, 9, 36,
-                        8, 9, 37,
-                        8, 9, 39,
-                        8, 9, 40,
-                        8, 9, 42,
-                        8, 10, 18,
-                        8, 10, 19,
-                        8, 10, 20,
-                        8, 10, 21,
-                        8, 10, 22,
-                        8, 10, 30,
-                        8, 10, 31,
-                        8, 10, 32,
-                        8, 10, 33,
-                        8, 10, 35,
-                        8, 10, 36,
-                        8, 10, 37,
-                        8, 10, 39,
-                        8, 10, 40,
-                        8, 10, 42,
-                        8, 11, 17,
-                        8, 11, 19,
-                        8, 11, 20,
-                        8, 11, 21,
-                        8, 11, 22,
-                        8, 11, 25,
-                        8, 11, 26,
-                        8, 11, 27,
-                        8, 11, 28,
-                        8, 11, 35,
-                        8, 11, 36,
-                        8, 11, 37,
-                        8, 11, 39,
-                        8, 11, 40,
-                        8, 11, 42,
-                        8, 12, 17,
-                        8, 12, 18,
-                        8, 12, 20,
-                        8, 12, 21,
-                        8, 12, 22,
-                        8, 12, 24,
-                        8, 12, 26,
-                        8, 12, 27,
-                        8, 12, 28,
-                        8, 12, 31,
-                        8, 12, 32,
-                        8, 12, 33,
-                        8, 12, 39,
-                        8, 12, 40,
-                        8, 12, 42,
-                        8, 13, 17,
-                        8, 13, 18,
-                        8, 13, 19,
-                        8, 13, 21,
-                        8, 13, 22,
-                        8, 13, 24,
-                        8, 13, 25,
-                        8, 13, 27,
-                        8, 13, 28,
-                        8, 13, 30,
-                        8, 13, 32,
-                        8, 13, 33,
-                        8, 13, 36,
-                        8, 13, 37,
-                        8, 13, 42,
-                        8, 14, 17,
-                        8, 14, 18,
-                        8, 14, 19,
-                        8, 14, 20,
-                        8, 14, 22,
-                        8, 14, 24,
-                        8, 14, 25,
-                        8, 14, 26,
-                        8, 14, 28,
-                        8, 14, 30,
-                        8, 14, 31,
-                        8, 14, 33,
-                        8, 14, 35,
-                        8, 14, 37,
-                        8, 14, 40,
-                        8, 15, 17,
-                        8, 15, 18,
-                        8, 15, 19,
-                        8, 15, 20,
-                        8, 15, 21,
-                        8, 15, 24,
-                        8, 15, 25,
-                        8, 15, 26,
-                        8, 15, 27,
-                        8, 15, 30,
-                        8, 15, 31,
-                        8, 15, 32,
-                        8, 15, 35,
-                        8, 15, 36,
-                        8, 15, 39,
-                        8, 17, 30,
-                        8, 17, 31,
-                        8, 17, 32,
-                        8, 17, 33,
-                        8, 17, 35,
-                        8, 17, 36,
-                        8, 17, 37,
-                        8, 17, 39,
-                        8, 17, 40,
-                        8, 17, 42,
-                        8, 18, 25,
-                        8, 18, 26,
-                        8, 18, 27,
-                        8, 18, 28,
-                        8, 18, 35,
-                        8, 18, 36,
-                        8, 18, 37,
-                        8, 18, 39,
-                        8, 18, 40,
-                        8, 18, 42,
-                        8, 19, 24,
-                        8, 19, 26,
-                        8, 19, 27,
-                        8, 19, 28,
-                        8, 19, 31,
-                        8, 19, 32,
-                        8, 19, 33,
-                        8, 19, 39,
-                        8, 19, 40,
-                        8, 19, 42,
-                        8, 20, 24,
-                        8, 20, 25,
-                        8, 20, 27,
-                        8, 20, 28,
-                        8, 20, 30,
-                        8, 20, 32,
-                        8, 20, 33,
-                        8, 20, 36,
-                        8, 20, 37,
-                        8, 20, 42,
-                        8, 21, 24,
-                        8, 21, 25,
-                        8, 21, 26,
-                        8, 21, 28,
-                        8, 21, 30,
-                        8, 21, 31,
-                        8, 21, 33,
-                        8, 21, 35,
-                        8, 21, 37,
-                        8, 21, 40,
-                        8, 22, 24,
-                        8, 22, 25,
-                        8, 22, 26,
-                        8, 22, 27,
-                        8, 22, 30,
-                        8, 22, 31,
-                        8, 22, 32,
-                        8, 22, 35,
-                        8, 22, 36,
-                        8, 22, 39,
-                        8, 24, 35,
-                        8, 24, 36,
-                        8, 24, 37,
-                        8, 24, 39,
-                        8, 24, 40,
-                        8, 24, 42,
-                        8, 25, 31,
-                        8, 25, 32,
-                        8, 25, 33,
-                        8, 25, 39,
-                        8, 25, 40,
-                        8, 25, 42,
-                        8, 26, 30,
-                        8, 26, 32,
-                        8, 26, 33,
-                        8, 26, 36,
-                        8, 26, 37,
-                        8, 26, 42,
-                        8, 27, 30,
-                        8, 27, 31,
-                        8, 27, 33,
-                        8, 27, 35,
-                        8, 27, 37,
-                        8, 27, 40,
-                        8, 28, 30,
-                        8, 28, 31,
-                        8, 28, 32,
-                        8, 28, 35,
-                        8, 28, 36,
-                        8, 28, 39,
-                        8, 30, 39,
-                        8, 30, 40,
-                        8, 30, 42,
-                        8, 31, 36,
-                        8, 31, 37,
-                        8, 31, 42,
-                        8, 32, 35,
-                        8, 32, 37,
-                        8, 32, 40,
-                        8, 33, 35,
-                        8, 33, 36,
-                        8, 33, 39,
-                        8, 35, 42,
-                        8, 36, 40,
-                        8, 37, 39,
-                        9, 24, 35,
-                        9, 24, 36,
-                        9, 24, 37,
-                        9, 24, 38,
-                        9, 24, 39,
-                        9, 24, 40,
-                        9, 24, 41,
-                        9, 24, 42,
-                        9, 24, 43,
-                        9, 24, 44,
-                        9, 25, 31,
-                        9, 25, 32,
-                        9, 25, 33,
-                        9, 25, 34,
-                        9, 25, 39,
-                        9, 25, 40,
-                        9, 25, 41,
-                        9, 25, 42,
-                        9, 25, 43,
-                        9, 25, 44,
-                        9, 26, 30,
-                        9, 26, 32,
-                        9, 26, 33,
-                        9, 26, 34,
-                        9, 26, 36,
-                        9, 26, 37,
-                        9, 26, 38,
-                        9, 26, 42,
-                        9, 26, 43,
-                        9, 26, 44,
-                        9, 27, 30,
-                        9, 27, 31,
-                        9, 27, 33,
-                        9, 27, 34,
-                        9, 27, 35,
-                        9, 27, 37,
-                        9, 27, 38,
-                        9, 27, 40,
-                        9, 27, 41,
-                        9, 27, 44,
-                        9, 28, 30,
-                        9, 28, 31,
-                        9, 28, 32,
-                        9, 28, 34,
-                        9, 28, 35,
-                        9, 28, 36,
-                        9, 28, 38,
-                        9, 28, 39,
-                        9, 28, 41,
-                        9, 28, 43,
-                        9, 29, 30,
-                        9, 29, 31,
-                        9, 29, 32,
-                        9, 29, 33,
-                        9, 29, 35,
-                        9, 29, 36,
-                        9, 29, 37,
-                        9, 29, 39,
-                        9, 29, 40,
-                        9, 29, 42,
-                        9, 30, 39,
-                        9, 30, 40,
-                        9, 30, 41,
-                        9, 30, 42,
-                        9, 30, 43,
-                        9, 30, 44,
-                        9, 31, 36,
-                        9, 31, 37,
-                        9, 31, 38,
-                        9, 31, 42,
-                        9, 31, 43,
-                        9, 31, 44,
-                        9, 32, 35,
-                        9, 32, 37,
-                        9, 32, 38,
-                        9, 32, 40,
-                        9, 32, 41,
-                        9, 32, 44,
-                        9, 33, 35,
-                        9, 33, 36,
-                        9, 33, 38,
-                        9, 33, 39,
-                        9, 33, 41,
-                        9, 33, 43,
-                        9, 34, 35,
-                        9, 34, 36,
-                        9, 34, 37,
-                        9, 34, 39,
-                        9, 34, 40,
-                        9, 34, 42,
-                        9, 35, 42,
-                        9, 35, 43,
-                        9, 35, 44,
-                        9, 36, 40,
-                        9, 36, 41,
-                        9, 36, 44,
-                        9, 37, 39,
-                        9, 37, 41,
-                        9, 37, 43,
-                        9, 38, 39,
-                        9, 38, 40,
-                        9, 38, 42,
-                        9, 39, 44,
-                        9, 40, 43,
-                        9, 41, 42,
-                        10, 18, 35,
-                        10, 18, 36,
-                        10, 18, 37,
-                        10, 18, 38,
-                        10, 18, 39,
-                        10, 18, 40,
-                        10, 18, 41,
-                        10, 18, 42,
-                        10, 18, 43,
-                        10, 18, 44,
-                        10, 19, 31,
-                        10, 19, 32,
-                        10, 19, 33,
-                        10, 19, 34,
-                        10, 19, 39,
-                        10, 19, 40,
-                        10, 19, 41,
-                        10, 19, 42,
-                        10, 19, 43,
-                        10, 19, 44,
-                        10, 20, 30,
-                        10, 20, 32,
-                        10, 20, 33,
-                        10, 20, 34,
-                        10, 20, 36,
-                        10, 20, 37,
-                        10, 20, 38,
-                        10, 20, 42,
-                        10, 20, 43,
-                        10, 20, 44,
-                        10, 21, 30,
-                        10, 21, 31,
-                        10, 21, 33,
-                        10, 21, 34,
-                        10, 21, 35,
-                        10, 21, 37,
-                        10, 21, 38,
-                        10, 21, 40,
-                        10, 21, 41,
-                        10, 21, 44,
-                        10, 22, 30,
-                        10, 22, 31,
-                        10, 22, 32,
-                        10, 22, 34,
-                        10, 22, 35,
-                        10, 22, 36,
-                        10, 22, 38,
-                        10, 22, 39,
-                        10, 22, 41,
-                        10, 22, 43,
-                        10, 23, 30,
-                        10, 23, 31,
-                        10, 23, 32,
-                        10, 23, 33,
-                        10, 23, 35,
-                        10, 23, 36,
-                        10, 23, 37,
-                        10, 23, 39,
-                        10, 23, 40,
-                        10, 23, 42,
-                        10, 30, 39,
-                        10, 30, 40,
-                        10, 30, 41,
-                        10, 30, 42,
-                        10, 30, 43,
-                        10, 30, 44,
-                        10, 31, 36,
-                        10, 31, 37,
-                        10, 31, 38,
-                        10, 31, 42,
-                        10, 31, 43,
-                        10, 31, 44,
-                        10, 32, 35,
-                        10, 32, 37,
-                        10, 32, 38,
-                        10, 32, 40,
-                        10, 32, 41,
-                        10, 32, 44,
-                        10, 33, 35,
-                        10, 33, 36,
-                        10, 33, 38,
-                        10, 33, 39,
-                        10, 33, 41,
-                        10, 33, 43,
-                        10, 34, 35,
-                        10, 34, 36,
-                        10, 34, 37,
-                        10, 34, 39,
-                        10, 34, 40,
-                        10, 34, 42,
-                        10, 35, 42,
-                        10, 35, 43,
-                        10, 35, 44,
-                        10, 36, 40,
-                        10, 36, 41,
-                        10, 36, 44,
-                        10, 37, 39,
-                        10, 37, 41,
-                        10, 37, 43,
-                        10, 38, 39,
-                        10, 38, 40,
-                        10, 38, 42,
-                        10, 39, 44,
-                        10, 40, 43,
-                        10, 41, 42,
-                        11, 17, 35,
-                        11, 17, 36,
-                        11, 17, 37,
-                        11, 17, 38,
-                        11, 17, 39,
-                        11, 17, 40,
-                        11, 17, 41,
-                        11, 17, 42,
-                        11, 17, 43,
-                        11, 17, 44,
-                        11, 19, 26,
-                        11, 19, 27,
-                        11, 19, 28,
-                        11, 19, 29,
-                        11, 19, 39,
-                        11, 19, 40,
-                        11, 19, 41,
-                        11, 19, 42,
-                        11, 19, 43,
-                        11, 19, 44,
-                        11, 20, 25,
-                        11, 20, 27,
-                        11, 20, 28,
-                        11, 20, 29,
-                        11, 20, 36,
-                        11, 20, 37,
-                        11, 20, 38,
-                        11, 20, 42,
-                        11, 20, 43,
-                        11, 20, 44,
-                        11, 21, 25,
-                        11, 21, 26,
-                        11, 21, 28,
-                        11, 21, 29,
-                        11, 21, 35,
-                        11, 21, 37,
-                        11, 21, 38,
-                        11, 21, 40,
-                        11, 21, 41,
-                        11, 21, 44,
-                        11, 22, 25,
-                        11, 22, 26,
-                        11, 22, 27,
-                        11, 22, 29,
-                        11, 22, 35,
-                        11, 22, 36,
-                        11, 22, 38,
-                        11, 22, 39,
-                        11, 22, 41,
-                        11, 22, 43,
-                        11, 23, 25,
-                        11, 23, 26,
-                        11, 23, 27,
-                        11, 23, 28,
-                        11, 23, 35,
-                        11, 23, 36,
-                        11, 23, 37,
-                        11, 23, 39,
-                        11, 23, 40,
-                        11, 23, 42,
-                        11, 25, 39,
-                        11, 25, 40,
-                        11, 25, 41,
-                        11, 25, 42,
-                        11, 25, 43,
-                        11, 25, 44,
-                        11, 26, 36,
-                        11, 26, 37,
-                        11, 26, 38,
-                        11, 26, 42,
-                        11, 26, 43,
-                        11, 26, 44,
-                        11, 27, 35,
-                        11, 27, 37,
-                        11, 27, 38,
-                        11, 27, 40,
-                        11, 27, 41,
-                        11, 27, 44,
-                        11, 28, 35,
-                        11, 28, 36,
-                        11, 28, 38,
-                        11, 28, 39,
-                        11, 28, 41,
-                        11, 28, 43,
-                        11, 29, 35,
-                        11, 29, 36,
-                        11, 29, 37,
-                        11, 29, 39,
-                        11, 29, 40,
-                        11, 29, 42,
-                        11, 35, 42,
-                        11, 35, 43,
-                        11, 35, 44,
-                        11, 36, 40,
-                        11, 36, 41,
-                        11, 36, 44,
-                        11, 37, 39,
-                        11, 37, 41,
-                        11, 37, 43,
-                        11, 38, 39,
-                        11, 38, 40,
-                        11, 38, 42,
-                        11, 39, 44,
-                        11, 40, 43,
-                        11, 41, 42,
-                        12, 17, 31,
-                        12, 17, 32,
-                        12, 17, 33,
-                        12, 17, 34,
-                        12, 17, 39,
-                        12, 17, 40,
-                        12, 17, 41,
-                        12, 17, 42,
-                        12, 17, 43,
-                        12, 17, 44,
-                        12, 18, 26,
-                        12, 18, 27,
-                        12, 18, 28,
-                        12, 18, 29,
-                        12, 18, 39,
-                        12, 18, 40,
-                        12, 18, 41,
-                        12, 18, 42,
-                        12, 18, 43,
-                        12, 18, 44,
-                        12, 20, 24,
-                        12, 20, 27,
-                        12, 20, 28,
-                        12, 20, 29,
-                        12, 20, 32,
-                        12, 20, 33,
-                        12, 20, 34,
-                        12, 20, 42,
-                        12, 20, 43,
-                        12, 20, 44,
-                        12, 21, 24,
-                        12, 21, 26,
-                        12, 21, 28,
-                        12, 21, 29,
-                        12, 21, 31,
-                        12, 21, 33,
-                        12, 21, 34,
-                        12, 21, 40,
-                        12, 21, 41,
-                        12, 21, 44,
-                        12, 22, 24,
-                        12, 22, 26,
-                        12, 22, 27,
-                        12, 22, 29,
-                        12, 22, 31,
-                        12, 22, 32,
-                        12, 22, 34,
-                        12, 22, 39,
-                        12, 22, 41,
-                        12, 22, 43,
-                        12, 23, 24,
-                        12, 23, 26,
-                        12, 23, 27,
-                        12, 23, 28,
-                        12, 23, 31,
-                        12, 23, 32,
-                        12, 23, 33,
-                        12, 23, 39,
-                        12, 23, 40,
-                        12, 23, 42,
-                        12, 24, 39,
-                        12, 24, 40,
-                        12, 24, 41,
-                        12, 24, 42,
-                        12, 24, 43,
-                        12, 24, 44,
-                        12, 26, 32,
-                        12, 26, 33,
-                        12, 26, 34,
-                        12, 26, 42,
-                        12, 26, 43,
-                        12, 26, 44,
-                        12, 27, 31,
-                        12, 27, 33,
-                        12, 27, 34,
-                        12, 27, 40,
-                        12, 27, 41,
-                        12, 27, 44,
-                        12, 28, 31,
-                        12, 28, 32,
-                        12, 28, 34,
-                        12, 28, 39,
-                        12, 28, 41,
-                        12, 28, 43,
-                        12, 29, 31,
-                        12, 29, 32,
-                        12, 29, 33,
-                        12, 29, 39,
-                        12, 29, 40,
-                        12, 29, 42,
-                        12, 31, 42,
-                        12, 31, 43,
-                        12, 31, 44,
-                        12, 32, 40,
-                        12, 32, 41,
-                        12, 32, 44,
-                        12, 33, 39,
-                        12, 33, 41,
-                        12, 33, 43,
-                        12, 34, 39,
-                        12, 34, 40,
-                        12, 34, 42,
-                        12, 39, 44,
-                        12, 40, 43,
-                        12, 41, 42,
-                        13, 17, 30,
-                        13, 17, 32,
-                        13, 17, 33,
-                        13, 17, 34,
-                        13, 17, 36,
-                        13, 17, 37,
-                        13, 17, 38,
-                        13, 17, 42,
-                        13, 17, 43,
-                        13, 17, 44,
-                        13, 18, 25,
-                        13, 18, 27,
-                        13, 18, 28,
-                        13, 18, 29,
-                        13, 18, 36,
-                        13, 18, 37,
-                        13, 18, 38,
-                        13, 18, 42,
-                        13, 18, 43,
-                        13, 18, 44,
-                        13, 19, 24,
-                        13, 19, 27,
-                        13, 19, 28,
-                        13, 19, 29,
-                        13, 19, 32,
-                        13, 19, 33,
-                        13, 19, 34,
-                        13, 19, 42,
-                        13, 19, 43,
-                        13, 19, 44,
-                        13, 21, 24,
-                        13, 21, 25,
-                        13, 21, 28,
-                        13, 21, 29,
-                        13, 21, 30,
-                        13, 21, 33,
-                        13, 21, 34,
-                        13, 21, 37,
-                        13, 21, 38,
-                        13, 21, 44,
-                        13, 22, 24,
-                        13, 22, 25,
-                        13, 22, 27,
-                        13, 22, 29,
-                        13, 22, 30,
-                        13, 22, 32,
-                        13, 22, 34,
-                        13, 22, 36,
-                        13, 22, 38,
-                        13, 22, 43,
-                        13, 23, 24,
-                        13, 23, 25,
-                        13, 23, 27,
-                        13, 23, 28,
-                        13, 23, 30,
-                        13, 23, 32,
-                        13, 23, 33,
-                        13, 23, 36,
-                        13, 23, 37,
-                        13, 23, 42,
-                        13, 24, 36,
-                        13, 24, 37,
-                        13, 24, 38,
-                        13, 24, 42,
-                        13, 24, 43,
-                        13, 24, 44,
-                        13, 25, 32,
-                        13, 25, 33,
-                        13, 25, 34,
-                        13, 25, 42,
-                        13, 25, 43,
-                        13, 25, 44,
-                        13, 27, 30,
-                        13, 27, 33,
-                        13, 27, 34,
-                        13, 27, 37,
-                        13, 27, 38,
-                        13, 27, 44,
-                        13, 28, 30,
-                        13, 28, 32,
-                        13, 28, 34,
-                        13, 28, 36,
-                        13, 28, 38,
-                        13, 28, 43,
-                        13, 29, 30,
-                        13, 29, 32,
-                        13, 29, 33,
-                        13, 29, 36,
-                        13, 29, 37,
-                        13, 29, 42,
-                        13, 30, 42,
-                        13, 30, 43,
-                        13, 30, 44,
-                        13, 32, 37,
-                        13, 32, 38,
-                        13, 32, 44,
-                        13, 33, 36,
-                        13, 33, 38,
-                        13, 33, 43,
-                        13, 34, 36,
-                        13, 34, 37,
-                        13, 34, 42,
-                        13, 36, 44,
-                        13, 37, 43,
-                        13, 38, 42,
-                        14, 17, 30,
-                        14, 17, 31,
-                        14, 17, 33,
-                        14, 17, 34,
-                        14, 17, 35,
-                        14, 17, 37,
-                        14, 17, 38,
-                        14, 17, 40,
-                        14, 17, 41,
-                        14, 17, 44,
-                        14, 18, 25,
-                        14, 18, 26,
-                        14, 18, 28,
-                        14, 18, 29,
-                        14, 18, 35,
-                        14, 18, 37,
-                        14, 18, 38,
-                        14, 18, 40,
-                        14, 18, 41,
-                        14, 18, 44,
-                        14, 19, 24,
-                        14, 19, 26,
-                        14, 19, 28,
-                        14, 19, 29,
-                        14, 19, 31,
-                        14, 19, 33,
-                        14, 19, 34,
-                        14, 19, 40,
-                        14, 19, 41,
-                        14, 19, 44,
-                        14, 20, 24,
-                        14, 20, 25,
-                        14, 20, 28,
-                        14, 20, 29,
-                        14, 20, 30,
-                        14, 20, 33,
-                        14, 20, 34,
-                        14, 20, 37,
-                        14, 20, 38,
-                        14, 20, 44,
-                        14, 22, 24,
-                        14, 22, 25,
-                        14, 22, 26,
-                        14, 22, 29,
-                        14, 22, 30,
-                        14, 22, 31,
-                        14, 22, 34,
-                        14, 22, 35,
-                        14, 22, 38,
-                        14, 22, 41,
-                        14, 23, 24,
-                        14, 23, 25,
-                        14, 23, 26,
-                        14, 23, 28,
-                        14, 23, 30,
-                        14, 23, 31,
-                        14, 23, 33,
-                        14, 23, 35,
-                        14, 23, 37,
-                        14, 23, 40,
-                        14, 24, 35,
-                        14, 24, 37,
-                        14, 24, 38,
-                        14, 24, 40,
-                        14, 24, 41,
-                        14, 24, 44,
-                        14, 25, 31,
-                        14, 25, 33,
-                        14, 25, 34,
-                        14, 25, 40,
-                        14, 25, 41,
-                        14, 25, 44,
-                        14, 26, 30,
-                        14, 26, 33,
-                        14, 26, 34,
-                        14, 26, 37,
-                        14, 26, 38,
-                        14, 26, 44,
-                        14, 28, 30,
-                        14, 28, 31,
-                        14, 28, 34,
-                        14, 28, 35,
-                        14, 28, 38,
-                        14, 28, 41,
-                        14, 29, 30,
-                        14, 29, 31,
-                        14, 29, 33,
-                        14, 29, 35,
-                        14, 29, 37,
-                        14, 29, 40,
-                        14, 30, 40,
-                        14, 30, 41,
-                        14, 30, 44,
-                        14, 31, 37,
-                        14, 31, 38,
-                        14, 31, 44,
-                        14, 33, 35,
-                        14, 33, 38,
-                        14, 33, 41,
-                        14, 34, 35,
-                        14, 34, 37,
-                        14, 34, 40,
-                        14, 35, 44,
-                        14, 37, 41,
-                        14, 38, 40,
-                        15, 17, 30,
-                        15, 17, 31,
-                        15, 17, 32,
-                        15, 17, 34,
-                        15, 17, 35,
-                        15, 17, 36,
-                        15, 17, 38,
-                        15, 17, 39,
-                        15, 17, 41,
-                        15, 17, 43,
-                        15, 18, 25,
-                        15, 18, 26,
-                        15, 18, 27,
-                        15, 18, 29,
-                        15, 18, 35,
-                        15, 18, 36,
-                        15, 18, 38,
-                        15, 18, 39,
-                        15, 18, 41,
-                        15, 18, 43,
-                        15, 19, 24,
-                        15, 19, 26,
-                        15, 19, 27,
-                        15, 19, 29,
-                        15, 19, 31,
-                        15, 19, 32,
-                        15, 19, 34,
-                        15, 19, 39,
-                        15, 19, 41,
-                        15, 19, 43,
-                        15, 20, 24,
-                        15, 20, 25,
-                        15, 20, 27,
-                        15, 20, 29,
-                        15, 20, 30,
-                        15, 20, 32,
-                        15, 20, 34,
-                        15, 20, 36,
-                        15, 20, 38,
-                        15, 20, 43,
-                        15, 21, 24,
-                        15, 21, 25,
-                        15, 21, 26,
-                        15, 21, 29,
-                        15, 21, 30,
-                        15, 21, 31,
-                        15, 21, 34,
-                        15, 21, 35,
-                        15, 21, 38,
-                        15, 21, 41,
-                        15, 23, 24,
-                        15, 23, 25,
-                        15, 23, 26,
-                        15, 23, 27,
-                        15, 23, 30,
-                        15, 23, 31,
-                        15, 23, 32,
-                        15, 23, 35,
-                        15, 23, 36,
-                        15, 23, 39,
-                        15, 24, 35,
-                        15, 24, 36,
-                        15, 24, 38,
-                        15, 24, 39,
-                        15, 24, 41,
-                        15, 24, 43,
-                        15, 25, 31,
-                        15, 25, 32,
-                        15, 25, 34,
-                        15, 25, 39,
-                        15, 25, 41,
-                        15, 25, 43,
-                        15, 26, 30,
-                        15, 26, 32,
-                        15, 26, 34,
-                        15, 26, 36,
-                        15, 26, 38,
-                        15, 26, 43,
-                        15, 27, 30,
-                        15, 27, 31,
-                        15, 27, 34,
-                        15, 27, 35,
-                        15, 27, 38,
-                        15, 27, 41,
-                        15, 29, 30,
-                        15, 29, 31,
-                        15, 29, 32,
-                        15, 29, 35,
-                        15, 29, 36,
-                        15, 29, 39,
-                        15, 30, 39,
-                        15, 30, 41,
-                        15, 30, 43,
-                        15, 31, 36,
-                        15, 31, 38,
-                        15, 31, 43,
-                        15, 32, 35,
-                        15, 32, 38,
-                        15, 32, 41,
-                        15, 34, 35,
-                        15, 34, 36,
-                        15, 34, 39,
-                        15, 35, 43,
-                        15, 36, 41,
-                        15, 38, 39,
-                        16, 17, 30,
-                        16, 17, 31,
-                        16, 17, 32,
-                        16, 17, 33,
-                        16, 17, 35,
-                        16, 17, 36,
-                        16, 17, 37,
-                        16, 17, 39,
-                        16, 17, 40,
-                        16, 17, 42,
-                        16, 18, 25,
-                        16, 18, 26,
-                        16, 18, 27,
-                        16, 18, 28,
-                        16, 18, 35,
-                        16, 18, 36,
-                        16, 18, 37,
-                        16, 18, 39,
-                        16, 18, 40,
-                        16, 18, 42,
-                        16, 19, 24,
-                        16, 19, 26,
-                        16, 19, 27,
-                        16, 19, 28,
-                        16, 19, 31,
-                        16, 19, 32,
-                        16, 19, 33,
-                        16, 19, 39,
-                        16, 19, 40,
-                        16, 19, 42,
-                        16, 20, 24,
-                        16, 20, 25,
-                        16, 20, 27,
-                        16, 20, 28,
-                        16, 20, 30,
-                        16, 20, 32,
-                        16, 20, 33,
-                        16, 20, 36,
-                        16, 20, 37,
-                        16, 20, 42,
-                        16, 21, 24,
-                        16, 21, 25,
-                        16, 21, 26,
-                        16, 21, 28,
-                        16, 21, 30,
-                        16, 21, 31,
-                        16, 21, 33,
-                        16, 21, 35,
-                        16, 21, 37,
-                        16, 21, 40,
-                        16, 22, 24,
-                        16, 22, 25,
-                        16, 22, 26,
-                        16, 22, 27,
-                        16, 22, 30,
-                        16, 22, 31,
-                        16, 22, 32,
-                        16, 22, 35,
-                        16, 22, 36,
-                        16, 22, 39,
-                        16, 24, 35,
-                        16, 24, 36,
-                        16, 24, 37,
-                        16, 24, 39,
-                        16, 24, 40,
-                        16, 24, 42,
-                        16, 25, 31,
-                        16, 25, 32,
-                        16, 25, 33,
-                        16, 25, 39,
-                        16, 25, 40,
-                        16, 25, 42,
-                        16, 26, 30,
-                        16, 26, 32,
-                        16, 26, 33,
-                        16, 26, 36,
-                        16, 26, 37,
-                        16, 26, 42,
-                        16, 27, 30,
-                        16, 27, 31,
-                        16, 27, 33,
-                        16, 27, 35,
-                        16, 27, 37,
-                        16, 27, 40,
-                        16, 28, 30,
-                        16, 28, 31,
-                        16, 28, 32,
-                        16, 28, 35,
-                        16, 28, 36,
-                        16, 28, 39,
-                        16, 30, 39,
-                        16, 30, 40,
-                        16, 30, 42,
-                        16, 31, 36,
-                        16, 31, 37,
-                        16, 31, 42,
-                        16, 32, 35,
-                        16, 32, 37,
-                        16, 32, 40,
-                        16, 33, 35,
-                        16, 33, 36,
-                        16, 33, 39,
-                        16, 35, 42,
-                        16, 36, 40,
-                        16, 37, 39,
-                        17, 30, 39,
-                        17, 30, 40,
-                        17, 30, 41,
-                        17, 30, 42,
-                        17, 30, 43,
-                        17, 30, 44,
-                        17, 31, 36,
-                        17, 31, 37,
-                        17, 31, 38,
-                        17, 31, 42,
-                        17, 31, 43,
-                        17, 31, 44,
-                        17, 32, 35,
-                        17, 32, 37,
-                        17, 32, 38,
-                        17, 32, 40,
-                        17, 32, 41,
-                        17, 32, 44,
-                        17, 33, 35,
-                        17, 33, 36,
-                        17, 33, 38,
-                        17, 33, 39,
-                        17, 33, 41,
-                        17, 33, 43,
-                        17, 34, 35,
-                        17, 34, 36,
-                        17, 34, 37,
-                        17, 34, 39,
-                        17, 34, 40,
-                        17, 34, 42,
-                        17, 35, 42,
-                        17, 35, 43,
-                        17, 35, 44,
-                        17, 36, 40,
-                        17, 36, 41,
-                        17, 36, 44,
-                        17, 37, 39,
-                        17, 37, 41,
-                        17, 37, 43,
-                        17, 38, 39,
-                        17, 38, 40,
-                        17, 38, 42,
-                        17, 39, 44,
-                        17, 40, 43,
-                        17, 41, 42,
-                        18, 25, 39,
-                        18, 25, 40,
-                        18, 25, 41,
-                        18, 25, 42,
-                        18, 25, 43,
-                        18, 25, 44,
-                        18, 26, 36,
-                        18, 26, 37,
-                        18, 26, 38,
-                        18, 26, 42,
-                        18, 26, 43,
-                        18, 26, 44,
-                        18, 27, 35,
-                        18, 27, 37,
-                        18, 27, 38,
-                        18, 27, 40,
-                        18, 27, 41,
-                        18, 27, 44,
-                        18, 28, 35,
-                        18, 28, 36,
-                        18, 28, 38,
-                        18, 28, 39,
-                        18, 28, 41,
-                        18, 28, 43,
-                        18, 29, 35,
-                        18, 29, 36,
-                        18, 29, 37,
-                        18, 29, 39,
-                        18, 29, 40,
-                        18, 29, 42,
-                        18, 35, 42,
-                        18, 35, 43,
-                        18, 35, 44,
-                        18, 36, 40,
-                        18, 36, 41,
-                        18, 36, 44,
-                        18, 37, 39,
-                        18, 37, 41,
-                        18, 37, 43,
-                        18, 38, 39,
-                        18, 38, 40,
-                        18, 38, 42,
-                        18, 39, 44,
-                        18, 40, 43,
-                        18, 41, 42,
-                        19, 24, 39,
-                        19, 24, 40,
-                        19, 24, 41,
-                        19, 24, 42,
-                        19, 24, 43,
-                        19, 24, 44,
-                        19, 26, 32,
-                        19, 26, 33,
-                        19, 26, 34,
-                        19, 26, 42,
-                        19, 26, 43,
-                        19, 26, 44,
-                        19, 27, 31,
-                        19, 27, 33,
-                        19, 27, 34,
-                        19, 27, 40,
-                        19, 27, 41,
-                        19, 27, 44,
-                        19, 28, 31,
-                        19, 28, 32,
-                        19, 28, 34,
-                        19, 28, 39,
-                        19, 28, 41,
-                        19, 28, 43,
-                        19, 29, 31,
-                        19, 29, 32,
-                        19, 29, 33,
-                        19, 29, 39,
-                        19, 29, 40,
-                        19, 29, 42,
-                        19, 31, 42,
-                        19, 31, 43,
-                        19, 31, 44,
-                        19, 32, 40,
-                        19, 32, 41,
-                        19, 32, 44,
-                        19, 33, 39,
-                        19, 33, 41,
-                        19, 33, 43,
-                        19, 34, 39,
-                        19, 34, 40,
-                        19, 34, 42,
-                        19, 39, 44,
-                        19, 40, 43,
-                        19, 41, 42,
-                        20, 24, 36,
-                        20, 24, 37,
-                        20, 24, 38,
-                        20, 24, 42,
-                        20, 24, 43,
-                        20, 24, 44,
-                        20, 25, 32,
-                        20, 25, 33,
-                        20, 25, 34,
-                        20, 25, 42,
-                        20, 25, 43,
-                        20, 25, 44,
-                        20, 27, 30,
-                        20, 27, 33,
-                        20, 27, 34,
-                        20, 27, 37,
-                        20, 27, 38,
-                        20, 27, 44,
-                        20, 28, 30,
-                        20, 28, 32,
-                        20, 28, 34,
-                        20, 28, 36,
-                        20, 28, 38,
-                        20, 28, 43,
-                        20, 29, 30,
-                        20, 29, 32,
-                        20, 29, 33,
-                        20, 29, 36,
-                        20, 29, 37,
-                        20, 29, 42,
-                        20, 30, 42,
-                        20, 30, 43,
-                        20, 30, 44,
-                        20, 32, 37,
-                        20, 32, 38,
-                        20, 32, 44,
-                        20, 33, 36,
-                        20, 33, 38,
-                        20, 33, 43,
-                        20, 34, 36,
-                        20, 34, 37,
-                        20, 34, 42,
-                        20, 36, 44,
-                        20, 37, 43,
-                        20, 38, 42,
-                        21, 24, 35,
-                        21, 24, 37,
-                        21, 24, 38,
-                        21, 24, 40,
-                        21, 24, 41,
-                        21, 24, 44,
-                        21, 25, 31,
-                        21, 25, 33,
-                        21, 25, 34,
-                        21, 25, 40,
-                        21, 25, 41,
-                        21, 25, 44,
-                        21, 26, 30,
-                        21, 26, 33,
-                        21, 26, 34,
-                        21, 26, 37,
-                        21, 26, 38,
-                        21, 26, 44,
-                        21, 28, 30,
-                        21, 28, 31,
-                        21, 28, 34,
-                        21, 28, 35,
-                        21, 28, 38,
-                        21, 28, 41,
-                        21, 29, 30,
-                        21, 29, 31,
-                        21, 29, 33,
-                        21, 29, 35,
-                        21, 29, 37,
-                        21, 29, 40,
-                        21, 30, 40,
-                        21, 30, 41,
-                        21, 30, 44,
-                        21, 31, 37,
-                        21, 31, 38,
-                        21, 31, 44,
-                        21, 33, 35,
-                        21, 33, 38,
-                        21, 33, 41,
-                        21, 34, 35,
-                        21, 34, 37,
-                        21, 34, 40,
-                        21, 35, 44,
-                        21, 37, 41,
-                        21, 38, 40,
-                        22, 24, 35,
-                        22, 24, 36,
-                        22, 24, 38,
-                        22, 24, 39,
-                        22, 24, 41,
-                        22, 24, 43,
-                        22, 25, 31,
-                        22, 25, 32,
-                        22, 25, 34,
-                        22, 25, 39,
-                        22, 25, 41,
-                        22, 25, 43,
-                        22, 26, 30,
-                        22, 26, 32,
-                        22, 26, 34,
-                        22, 26, 36,
-                        22, 26, 38,
-                        22, 26, 43,
-                        22, 27, 30,
-                        22, 27, 31,
-                        22, 27, 34,
-                        22, 27, 35,
-                        22, 27, 38,
-                        22, 27, 41,
-                        22, 29, 30,
-                        22, 29, 31,
-                        22, 29, 32,
-                        22, 29, 35,
-                        22, 29, 36,
-                        22, 29, 39,
-                        22, 30, 39,
-                        22, 30, 41,
-                        22, 30, 43,
-                        22, 31, 36,
-                        22, 31, 38,
-                        22, 31, 43,
-                        22, 32, 35,
-                        22, 32, 38,
-                        22, 32, 41,
-                        22, 34, 35,
-                        22, 34, 36,
-                        22, 34, 39,
-                        22, 35, 43,
-                        22, 36, 41,
-                        22, 38, 39,
-                        23, 24, 35,
-                        23, 24, 36,
-                        23, 24, 37,
-                        23, 24, 39,
-                        23, 24, 40,
-                        23, 24, 42,
-                        23, 25, 31,
-                        23, 25, 32,
-                        23, 25, 33,
-                        23, 25, 39,
-                        23, 25, 40,
-                        23, 25, 42,
-                        23, 26, 30,
-                        23, 26, 32,
-                        23, 26, 33,
-                        23, 26, 36,
-                        23, 26, 37,
-                        23, 26, 42,
-                        23, 27, 30,
-                        23, 27, 31,
-                        23, 27, 33,
-                        23, 27, 35,
-                        23, 27, 37,
-                        23, 27, 40,
-                        23, 28, 30,
-                        23, 28, 31,
-                        23, 28, 32,
-                        23, 28, 35,
-                        23, 28, 36,
-                        23, 28, 39,
-                        23, 30, 39,
-                        23, 30, 40,
-                        23, 30, 42,
-                        23, 31, 36,
-                        23, 31, 37,
-                        23, 31, 42,
-                        23, 32, 35,
-                        23, 32, 37,
-                        23, 32, 40,
-                        23, 33, 35,
-                        23, 33, 36,
-                        23, 33, 39,
-                        23, 35, 42,
-                        23, 36, 40,
-                        23, 37, 39,
-                        24, 35, 42,
-                        24, 35, 43,
-                        24, 35, 44,
-                        24, 36, 40,
-                        24, 36, 41,
-                        24, 36, 44,
-                        24, 37, 39,
-                        24, 37, 41,
-                        24, 37, 43,
-                        24, 38, 39,
-                        24, 38, 40,
-                        24, 38, 42,
-                        24, 39, 44,
-                        24, 40, 43,
-                        24, 41, 42,
-                        25, 31, 42,
-                        25, 31, 43,
-                        25, 31, 44,
-                        25, 32, 40,
-                        25, 32, 41,
-                        25, 32, 44,
-                        25, 33, 39,
-                        25, 33, 41,
-                        25, 33, 43,
-                        25, 34, 39,
-                        25, 34, 40,
-                        25, 34, 42,
-                        25, 39, 44,
-                        25, 40, 43,
-                        25, 41, 42,
-                        26, 30, 42,
-                        26, 30, 43,
-                        26, 30, 44,
-                        26, 32, 37,
-                        26, 32, 38,
-                        26, 32, 44,
-                        26, 33, 36,
-                        26, 33, 38,
-                        26, 33, 43,
-                        26, 34, 36,
-                        26, 34, 37,
-                        26, 34, 42,
-                        26, 36, 44,
-                        26, 37, 43,
-                        26, 38, 42,
-                        27, 30, 40,
-                        27, 30, 41,
-                        27, 30, 44,
-                        27, 31, 37,
-                        27, 31, 38,
-                        27, 31, 44,
-                        27, 33, 35,
-                        27, 33, 38,
-                        27, 33, 41,
-                        27, 34, 35,
-                        27, 34, 37,
-                        27, 34, 40,
-                        27, 35, 44,
-                        27, 37, 41,
-                        27, 38, 40,
-                        28, 30, 39,
-                        28, 30, 41,
-                        28, 30, 43,
-                        28, 31, 36,
-                        28, 31, 38,
-                        28, 31, 43,
-                        28, 32, 35,
-                        28, 32, 38,
-                        28, 32, 41,
-                        28, 34, 35,
-                        28, 34, 36,
-                        28, 34, 39,
-                        28, 35, 43,
-                        28, 36, 41,
-                        28, 38, 39,
-                        29, 30, 39,
-                        29, 30, 40,
-                        29, 30, 42,
-                        29, 31, 36,
-                        29, 31, 37,
-                        29, 31, 42,
-                        29, 32, 35,
-                        29, 32, 37,
-                        29, 32, 40,
-                        29, 33, 35,
-                        29, 33, 36,
-                        29, 33, 39,
-                        29, 35, 42,
-                        29, 36, 40,
-                        29, 37, 39,
-                        30, 39, 44,
-                        30, 40, 43,
-                        30, 41, 42,
-                        31, 36, 44,
-                        31, 37, 43,
-                        31, 38, 42,
-                        32, 35, 44,
-                        32, 37, 41,
-                        32, 38, 40,
-                        33, 35, 43,
-                        33, 36, 41,
-                        33, 38, 39,
-                        34, 35, 42,
-                        34, 36, 40,
-                        34, 37, 39
-                },
-                {
-                        0, 17, 30, 39,
-                        0, 17, 30, 40,
-                        0, 17, 30, 41,
-                        0, 17, 30, 42,
-                        0, 17, 30, 43,
-                        0, 17, 30, 44,
-                        0, 17, 31, 36,
-                        0, 17, 31, 37,
-                        0, 17, 31, 38,
-                        0, 17, 31, 42,
-                        0, 17, 31, 43,
-                        0, 17, 31, 44,
-                        0, 17, 32, 35,
-                        0, 17, 32, 37,
-                        0, 17, 32, 38,
-                        0, 17, 32, 40,
-                        0, 17, 32, 41,
-                        0, 17, 32, 44,
-                        0, 17, 33, 35,
-                        0, 17, 33, 36,
-                        0, 17, 33, 38,
-                        0, 17, 33, 39,
-                        0, 17, 33, 41,
-                        0, 17, 33, 43,
-                        0, 17, 34, 35,
-                        0, 17, 34, 36,
-                        0, 17, 34, 37,
-                        0, 17, 34, 39,
-                        0, 17, 34, 40,
-                        0, 17, 34, 42,
-                        0, 17, 35, 42,
-                        0, 17, 35, 43,
-                        0, 17, 35, 44,
-                        0, 17, 36, 40,
-                        0, 17, 36, 41,
-                        0, 17, 36, 44,
-                        0, 17, 37, 39,
-                        0, 17, 37, 41,
-                        0, 17, 37, 43,
-                        0, 17, 38, 39,
-                        0, 17, 38, 40,
-                        0, 17, 38, 42,
-                        0, 17, 39, 44,
-                        0, 17, 40, 43,
-                        0, 17, 41, 42,
-                        0, 18, 25, 39,
-                        0, 18, 25, 40,
-                        0, 18, 25, 41,
-                        0, 18, 25, 42,
-                        0, 18, 25, 43,
-                        0, 18, 25, 44,
-                        0, 18, 26, 36,
-                        0, 18, 26, 37,
-                        0, 18, 26, 38,
-                        0, 18, 26, 42,
-                        0, 18, 26, 43,
-                        0, 18, 26, 44,
-                        0, 18, 27, 35,
-                        0, 18, 27, 37,
-                        0, 18, 27, 38,
-                        0, 18, 27, 40,
-                        0, 18, 27, 41,
-                        0, 18, 27, 44,
-                        0, 18, 28, 35,
-                        0, 18, 28, 36,
-                        0, 18, 28, 38,
-                        0, 18, 28, 39,
-                        0, 18, 28, 41,
-                        0, 18, 28, 43,
-                        0, 18, 29, 35,
-                        0, 18, 29, 36,
-                        0, 18, 29, 37,
-                        0, 18, 29, 39,
-                        0, 18, 29, 40,
-                        0, 18, 29, 42,
-                        0, 18, 35, 42,
-                        0, 18, 35, 43,
-                        0, 18, 35, 44,
-                        0, 18, 36, 40,
-                        0, 18, 36, 41,
-                        0, 18, 36, 44,
-                        0, 18, 37, 39,
-                        0, 18, 37, 41,
-                        0, 18, 37, 43,
-                        0, 18, 38, 39,
-                        0, 18, 38, 40,
-                        0, 18, 38, 42,
-                        0, 18, 39, 44,
-                        0, 18, 40, 43,
-                        0, 18, 41, 42,
-                        0, 19, 24, 39,
-                        0, 19, 24, 40,
-                        0, 19, 24, 41,
-                        0, 19, 24, 42,
-                        0, 19, 24, 43,
-                        0, 19, 24, 44,
-                        0, 19, 26, 32,
-                        0, 19, 26, 33,
-                        0, 19, 26, 34,
-                        0, 19, 26, 42,
-                        0, 19, 26, 43,
-                        0, 19, 26, 44,
-                        0, 19, 27, 31,
-                        0, 19, 27, 33,
-                        0, 19, 27, 34,
-                        0, 19, 27, 40,
-                        0, 19, 27, 41,
-                        0, 19, 27, 44,
-                        0, 19, 28, 31,
-                        0, 19, 28, 32,
-                        0, 19, 28, 34,
-                        0, 19, 28, 39,
-                        0, 19, 28, 41,
-                        0, 19, 28, 43,
-                        0, 19, 29, 31,
-                        0, 19, 29, 32,
-                        0, 19, 29, 33,
-                        0, 19, 29, 39,
-                        0, 19, 29, 40,
-                        0, 19, 29, 42,
-                        0, 19, 31, 42,
-                        0, 19, 31, 43,
-                        0, 19, 31, 44,
-                        0, 19, 32, 40,
-                        0, 19, 32, 41,
-                        0, 19, 32, 44,
-                        0, 19, 33, 39,
-                        0, 19, 33, 41,
-                        0, 19, 33, 43,
-                        0, 19, 34, 39,
-                        0, 19, 34, 40,
-                        0, 19, 34, 42,
-                        0, 19, 39, 44,
-                        0, 19, 40, 43,
-                        0, 19, 41, 42,
-                        0, 20, 24, 36,
-                        0, 20, 24, 37,
-                        0, 20, 24, 38,
-                        0, 20, 24, 42,
-                        0, 20, 24, 43,
-                        0, 20, 24, 44,
-                        0, 20, 25, 32,
-                        0, 20, 25, 33,
-                        0, 20, 25, 34,
-                        0, 20, 25, 42,
-                        0, 20, 25, 43,
-                        0, 20, 25, 44,
-                        0, 20, 27, 30,
-                        0, 20, 27, 33,
-                        0, 20, 27, 34,
-                        0, 20, 27, 37,
-                        0, 20, 27, 38,
-                        0, 20, 27, 44,
-                        0, 20, 28, 30,
-                        0, 20, 28, 32,
-                        0, 20, 28, 34,
-                        0, 20, 28, 36,
-                        0, 20, 28, 38,
-                        0, 20, 28, 43,
-                        0, 20, 29, 30,
-                        0, 20, 29, 32,
-                        0, 20, 29, 33,
-                        0, 20, 29, 36,
-                        0, 20, 29, 37,
-                        0, 20, 29, 42,
-                        0, 20, 30, 42,
-                        0, 20, 30, 43,
-                        0, 20, 30, 44,
-                        0, 20, 32, 37,
-                        0, 20, 32, 38,
-                        0, 20, 32, 44,
-                        0, 20, 33, 36,
-                        0, 20, 33, 38,
-                        0, 20, 33, 43,
-                        0, 20, 34, 36,
-                        0, 20, 34, 37,
-                        0, 20, 34, 42,
-                        0, 20, 36, 44,
-                        0, 20, 37, 43,
-                        0, 20, 38, 42,
-                        0, 21, 24, 35,
-                        0, 21, 24, 37,
-                        0, 21, 24, 38,
-                        0, 21, 24, 40,
-                        0, 21, 24, 41,
-                        0, 21, 24, 44,
-                        0, 21, 25, 31,
-                        0, 21, 25, 33,
-                        0, 21, 25, 34,
-                        0, 21, 25, 40,
-                        0, 21, 25, 41,
-                        0, 21, 25, 44,
-                        0, 21, 26, 30,
-                        0, 21, 26, 33,
-                        0, 21, 26, 34,
-                        0, 21, 26, 37,
-                        0, 21, 26, 38,
-                        0, 21, 26, 44,
-                        0, 21, 28, 30,
-                        0, 21, 28, 31,
-                        0, 21, 28, 34,
-                        0, 21, 28, 35,
-                        0, 21, 28, 38,
-                        0, 21, 28, 41,
-                        0, 21, 29, 30,
-                        0, 21, 29, 31,
-                        0, 21, 29, 33,
-                        0, 21, 29, 35,
-                        0, 21, 29, 37,
-                        0, 21, 29, 40,
-                        0, 21, 30, 40,
-                        0, 21, 30, 41,
-                        0, 21, 30, 44,
-                        0, 21, 31, 37,
-                        0, 21, 31, 38,
-                        0, 21, 31, 44,
-                        0, 21, 33, 35,
-                        0, 21, 33, 38,
-                        0, 21, 33, 41,
-                        0, 21, 34, 35,
-                        0, 21, 34, 37,
-                        0, 21, 34, 40,
-                        0, 21, 35, 44,
-                        0, 21, 37, 41,
-                        0, 21, 38, 40,
-                        0, 22, 24, 35,
-                        0, 22, 24, 36,
-                        0, 22, 24, 38,
-                        0, 22, 24, 39,
-                        0, 22, 24, 41,
-                        0, 22, 24, 43,
-                        0, 22, 25, 31,
-                        0, 22, 25, 32,
-                        0, 22, 25, 34,
-                        0, 22, 25, 39,
-                        0, 22, 25, 41,
-                        0, 22, 25, 43,
-                        0, 22, 26, 30,
-                        0, 22, 26, 32,
-                        0, 22, 26, 34,
-                        0, 22, 26, 36,
-                        0, 22, 26, 38,
-                        0, 22, 26, 43,
-                        0, 22, 27, 30,
-                        0, 22, 27, 31,
-                        0, 22, 27, 34,
-                        0, 22, 27, 35,
-                        0, 22, 27, 38,
-                        0, 22, 27, 41,
-                        0, 22, 29, 30,
-                        0, 22, 29, 31,
-                        0, 22, 29, 32,
-                        0, 22, 29, 35,
-                        0, 22, 29, 36,
-                        0, 22, 29, 39,
-                        0, 22, 30, 39,
-                        0, 22, 30, 41,
-                        0, 22, 30, 43,
-                        0, 22, 31, 36,
-                        0, 22, 31, 38,
-                        0, 22, 31, 43,
-                        0, 22, 32, 35,
-                        0, 22, 32, 38,
-                        0, 22, 32, 41,
-                        0, 22, 34, 35,
-                        0, 22, 34, 36,
-                        0, 22, 34, 39,
-                        0, 22, 35, 43,
-                        0, 22, 36, 41,
-                        0, 22, 38, 39,
-                        0, 23, 24, 35,
-                        0, 23, 24, 36,
-                        0, 23, 24, 37,
-                        0, 23, 24, 39,
-                        0, 23, 24, 40,
-                        0, 23, 24, 42,
-                        0, 23, 25, 31,
-                        0, 23, 25, 32,
-                        0, 23, 25, 33,
-                        0, 23, 25, 39,
-                        0, 23, 25, 40,
-                        0, 23, 25, 42,
-                        0, 23, 26, 30,
-                        0, 23, 26, 32,
-                        0, 23, 26, 33,
-                        0, 23, 26, 36,
-                        0, 23, 26, 37,
-                        0, 23, 26, 42,
-                        0, 23, 27, 30,
-                        0, 23, 27, 31,
-                        0, 23, 27, 33,
-                        0, 23, 27, 35,
-                        0, 23, 27, 37,
-                        0, 23, 27, 40,
-                        0, 23, 28, 30,
-                        0, 23, 28, 31,
-                        0, 23, 28, 32,
-                        0, 23, 28, 35,
-                        0, 23, 28, 36,
-                        0, 23, 28, 39,
-                        0, 23, 30, 39,
-                        0, 23, 30, 40,
-                        0, 23, 30, 42,
-                        0, 23, 31, 36,
-                        0, 23, 31, 37,
-                        0, 23, 31, 42,
-                        0, 23, 32, 35,
-                        0, 23, 32, 37,
-                        0, 23, 32, 40,
-                        0, 23, 33, 35,
-                        0, 23, 33, 36,
-                        0, 23, 33, 39,
-                        0, 23, 35, 42,
-                        0, 23, 36, 40,
-                        0, 23, 37, 39,
-                        0, 24, 35, 42,
-                        0, 24, 35, 43,
-                        0, 24, 35, 44,
-                        0, 24, 36, 40,
-                        0, 24, 36, 41,
-                        0, 24, 36, 44,
-                        0, 24, 37, 39,
-                        0, 24, 37, 41,
-                        0, 24, 37, 43,
-                        0, 24, 38, 39,
-                        0, 24, 38, 40,
-                        0, 24, 38, 42,
-                        0, 24, 39, 44,
-                        0, 24, 40, 43,
-                        0, 24, 41, 42,
-                        0, 25, 31, 42,
-                        0, 25, 31, 43,
-                        0, 25, 31, 44,
-                        0, 25, 32, 40,
-                        0, 25, 32, 41,
-                        0, 25, 32, 44,
-                        0, 25, 33, 39,
-                        0, 25, 33, 41,
-                        0, 25, 33, 43,
-                        0, 25, 34, 39,
-                        0, 25, 34, 40,
-                        0, 25, 34, 42,
-                        0, 25, 39, 44,
-                        0, 25, 40, 43,
-                        0, 25, 41, 42,
-                        0, 26, 30, 42,
-                        0, 26, 30, 43,
-                        0, 26, 30, 44,
-                        0, 26, 32, 37,
-                        0, 26, 32, 38,
-                        0, 26, 32, 44,
-                        0, 26, 33, 36,
-                        0, 26, 33, 38,
-                        0, 26, 33, 43,
-                        0, 26, 34, 36,
-                        0, 26, 34, 37,
-                        0, 26, 34, 42,
-                        0, 26, 36, 44,
-                        0, 26, 37, 43,
-                        0, 26, 38, 42,
-                        0, 27, 30, 40,
-                        0, 27, 30, 41,
-                        0, 27, 30, 44,
-                        0, 27, 31, 37,
-                        0, 27, 31, 38,
-                        0, 27, 31, 44,
-                        0, 27, 33, 35,
-                        0, 27, 33, 38,
-                        0, 27, 33, 41,
-                        0, 27, 34, 35,
-                        0, 27, 34, 37,
-                        0, 27, 34, 40,
-                        0, 27, 35, 44,
-                        0, 27, 37, 41,
-                        0, 27, 38, 40,
-                        0, 28, 30, 39,
-                        0, 28, 30, 41,
-                        0, 28, 30, 43,
-                        0, 28, 31, 36,
-                        0, 28, 31, 38,
-                        0, 28, 31, 43,
-                        0, 28, 32, 35,
-                        0, 28, 32, 38,
-                        0, 28, 32, 41,
-                        0, 28, 34, 35,
-                        0, 28, 34, 36,
-                        0, 28, 34, 39,
-                        0, 28, 35, 43,
-                        0, 28, 36, 41,
-                        0, 28, 38, 39,
-                        0, 29, 30, 39,
-                        0, 29, 30, 40,
-                        0, 29, 30, 42,
-                        0, 29, 31, 36,
-                        0, 29, 31, 37,
-                        0, 29, 31, 42,
-                        0, 29, 32, 35,
-                        0, 29, 32, 37,
-                        0, 29, 32, 40,
-                        0, 29, 33, 35,
-                        0, 29, 33, 36,
-                        0, 29, 33, 39,
-                        0, 29, 35, 42,
-                        0, 29, 36, 40,
-                        0, 29, 37, 39,
-                        0, 30, 39, 44,
-                        0, 30, 40, 43,
-                        0, 30, 41, 42,
-                        0, 31, 36, 44,
-                        0, 31, 37, 43,
-                        0, 31, 38, 42,
-                        0, 32, 35, 44,
-                        0, 32, 37, 41,
-                        0, 32, 38, 40,
-                        0, 33, 35, 43,
-                        0, 33, 36, 41,
-                        0, 33, 38, 39,
-                        0, 34, 35, 42,
-                        0, 34, 36, 40,
-                        0, 34, 37, 39,
-                        1, 10, 30, 39,
-                        1, 10, 30, 40,
-                        1, 10, 30, 41,
-                        1, 10, 30, 42,
-                        1, 10, 30, 43,
-                        1, 10, 30, 44,
-                        1, 10, 31, 36,
-                        1, 10, 31, 37,
-                        1, 10, 31, 38,
-                        1, 10, 31, 42,
-                        1, 10, 31, 43,
-                        1, 10, 31, 44,
-                        1, 10, 32, 35,
-                        1, 10, 32, 37,
-                        1, 10, 32, 38,
-                        1, 10, 32, 40,
-                        1, 10, 32, 41,
-                        1, 10, 32, 44,
-                        1, 10, 33, 35,
-                        1, 10, 33, 36,
-                        1, 10, 33, 38,
-                        1, 10, 33, 39,
-                        1, 10, 33, 41,
-                        1, 10, 33, 43,
-                        1, 10, 34, 35,
-                        1, 10, 34, 36,
-                        1, 10, 34, 37,
-                        1, 10, 34, 39,
-                        1, 10, 34, 40,
-                        1, 10, 34, 42,
-                        1, 10, 35, 42,
-                        1, 10, 35, 43,
-                        1, 10, 35, 44,
-                        1, 10, 36, 40,
-                        1, 10, 36, 41,
-                        1, 10, 36, 44,
-                        1, 10, 37, 39,
-                        1, 10, 37, 41,
-                        1, 10, 37, 43,
-                        1, 10, 38, 39,
-                        1, 10, 38, 40,
-                        1, 10, 38, 42,
-                        1, 10, 39, 44,
-                        1, 10, 40, 43,
-                        1, 10, 41, 42,
-                        1, 11, 25, 39,
-                        1, 11, 25, 40,
-                        1, 11, 25, 41,
-                        1, 11, 25, 42,
-                        1, 11, 25, 43,
-                        1, 11, 25, 44,
-                        1, 11, 26, 36,
-                        1, 11, 26, 37,
-                        1, 11, 26, 38,
-                        1, 11, 26, 42,
-                        1, 11, 26, 43,
-                        1, 11, 26, 44,
-                        1, 11, 27, 35,
-                        1, 11, 27, 37,
-                        1, 11, 27, 38,
-                        1, 11, 27, 40,
-                        1, 11, 27, 41,
-                        1, 11, 27, 44,
-                        1, 11, 28, 35,
-                        1, 11, 28, 36,
-                        1, 11, 28, 38,
-                        1, 11, 28, 39,
-                        1, 11, 28, 41,
-                        1, 11, 28, 43,
-                        1, 11, 29, 35,
-                        1, 11, 29, 36,
-                        1, 11, 29, 37,
-                        1, 11, 29, 39,
-                        1, 11, 29, 40,
-                        1, 11, 29, 42,
-                        1, 11, 35, 42,
-                        1, 11, 35, 43,
-                        1, 11, 35, 44,
-                        1, 11, 36, 40,
-                        1, 11, 36, 41,
-                        1, 11, 36, 44,
-                        1, 11, 37, 39,
-                        1, 11, 37, 41,
-                        1, 11, 37, 43,
-                        1, 11, 38, 39,
-                        1, 11, 38, 40,
-                        1, 11, 38, 42,
-                        1, 11, 39, 44,
-                        1, 11, 40, 43,
-                        1, 11, 41, 42,
-                        1, 12, 24, 39,
-                        1, 12, 24, 40,
-                        1, 12, 24, 41,
-                        1, 12, 24, 42,
-                        1, 12, 24, 43,
-                        1, 12, 24, 44,
-                        1, 12, 26, 32,
-                        1, 12, 26, 33,
-                        1, 12, 26, 34,
-                        1, 12, 26, 42,
-                        1, 12, 26, 43,
-                        1, 12, 26, 44,
-                        1, 12, 27, 31,
-                        1, 12, 27, 33,
-                        1, 12, 27, 34,
-                        1, 12, 27, 40,
-                        1, 12, 27, 41,
-                        1, 12, 27, 44,
-                        1, 12, 28, 31,
-                        1, 12, 28, 32,
-                        1, 12, 28, 34,
-                        1, 12, 28, 39,
-                        1, 12, 28, 41,
-                        1, 12, 28, 43,
-                        1, 12, 29, 31,
-                        1, 12, 29, 32,
-                        1, 12, 29, 33,
-                        1, 12, 29, 39,
-                        1, 12, 29, 40,
-                        1, 12, 29, 42,
-                        1, 12, 31, 42,
-                        1, 12, 31, 43,
-                        1, 12, 31, 44,
-                        1, 12, 32, 40,
-                        1, 12, 32, 41,
-                        1, 12, 32, 44,
-                        1, 12, 33, 39,
-                        1, 12, 33, 41,
-                        1, 12, 33, 43,
-                        1, 12, 34, 39,
-                        1, 12, 34, 40,
-                        1, 12, 34, 42,
-                        1, 12, 39, 44,
-                        1, 12, 40, 43,
-                        1, 12, 41, 42,
-                        1, 13, 24, 36,
-                        1, 13, 24, 37,
-                        1, 13, 24, 38,
-                        1, 13, 24, 42,
-                        1, 13, 24, 43,
-                        1, 13, 24, 44,
-                        1, 13, 25, 32,
-                        1, 13, 25, 33,
-                        1, 13, 25, 34,
-                        1, 13, 25, 42,
-                        1, 13, 25, 43,
-                        1, 13, 25, 44,
-                        1, 13, 27, 30,
-                        1, 13, 27, 33,
-                        1, 13, 27, 34,
-                        1, 13, 27, 37,
-                        1, 13, 27, 38,
-                        1, 13, 27, 44,
-                        1, 13, 28, 30,
-                        1, 13, 28, 32,
-                        1, 13, 28, 34,
-                        1, 13, 28, 36,
-                        1, 13, 28, 38,
-                        1, 13, 28, 43,
-                        1, 13, 29, 30,
-                        1, 13, 29, 32,
-                        1, 13, 29, 33,
-                        1, 13, 29, 36,
-                        1, 13, 29, 37,
-                        1, 13, 29, 42,
-                        1, 13, 30, 42,
-                        1, 13, 30, 43,
-                        1, 13, 30, 44,
-                        1, 13, 32, 37,
-                        1, 13, 32, 38,
-                        1, 13, 32, 44,
-                        1, 13, 33, 36,
-                        1, 13, 33, 38,
-                        1, 13, 33, 43,
-                        1, 13, 34, 36,
-                        1, 13, 34, 37,
-                        1, 13, 34, 42,
-                        1, 13, 36, 44,
-                        1, 13, 37, 43,
-                        1, 13, 38, 42,
-                        1, 14, 24, 35,
-                        1, 14, 24, 37,
-                        1, 14, 24, 38,
-                        1, 14, 24, 40,
-                        1, 14, 24, 41,
-                        1, 14, 24, 44,
-                        1, 14, 25, 31,
-                        1, 14, 25, 33,
-                        1, 14, 25, 34,
-                        1, 14, 25, 40,
-                        1, 14, 25, 41,
-                        1, 14, 25, 44,
-                        1, 14, 26, 30,
-                        1, 14, 26, 33,
-                        1, 14, 26, 34,
-                        1, 14, 26, 37,
-                        1, 14, 26, 38,
-                        1, 14, 26, 44,
-                        1, 14, 28, 30,
-                        1, 14, 28, 31,
-                        1, 14, 28, 34,
-                        1, 14, 28, 35,
-                        1, 14, 28, 38,
-                        1, 14, 28, 41,
-                        1, 14, 29, 30,
-                        1, 14, 29, 31,
-                        1, 14, 29, 33,
-                        1, 14, 29, 35,
-                        1, 14, 29, 37,
-                        1, 14, 29, 40,
-                        1, 14, 30, 40,
-                        1, 14, 30, 41,
-                        1, 14, 30, 44,
-                        1, 14, 31, 37,
-                        1, 14, 31, 38,
-                        1, 14, 31, 44,
-                        1, 14, 33, 35,
-                        1, 14, 33, 38,
-                        1, 14, 33, 41,
-                        1, 14, 34, 35,
-                        1, 14, 34, 37,
-                        1, 14, 34, 40,
-                        1, 14, 35, 44,
-                        1, 14, 37, 41,
-                        1, 14, 38, 40,
-                        1, 15, 24, 35,
-                        1, 15, 24, 36,
-                        1, 15, 24, 38,
-                        1, 15, 24, 39,
-                        1, 15, 24, 41,
-                        1, 15, 24, 43,
-                        1, 15, 25, 31,
-                        1, 15, 25, 32,
-                        1, 15, 25, 34,
-                        1, 15, 25, 39,
-                        1, 15, 25, 41,
-                        1, 15, 25, 43,
-                        1, 15, 26, 30,
-                        1, 15, 26, 32,
-                        1, 15, 26, 34,
-                        1, 15, 26, 36,
-                        1, 15, 26, 38,
-                        1, 15, 26, 43,
-                        1, 15, 27, 30,
-                        1, 15, 27, 31,
-                        1, 15, 27, 34,
-                        1, 15, 27, 35,
-                        1, 15, 27, 38,
-                        1, 15, 27, 41,
-                        1, 15, 29, 30,
-                        1, 15, 29, 31,
-                        1, 15, 29, 32,
-                        1, 15, 29, 35,
-                        1, 15, 29, 36,
-                        1, 15, 29, 39,
-                        1, 15, 30, 39,
-                        1, 15, 30, 41,
-                        1, 15, 30, 43,
-                        1, 15, 31, 36,
-                        1, 15, 31, 38,
-                        1, 15, 31, 43,
-                        1, 15, 32, 35,
-                        1, 15, 32, 38,
-                        1, 15, 32, 41,
-                        1, 15, 34, 35,
-                        1, 15, 34, 36,
-                        1, 15, 34, 39,
-                        1, 15, 35, 43,
-                        1, 15, 36, 41,
-                        1, 15, 38, 39,
-                        1, 16, 24, 35,
-                        1, 16, 24, 36,
-                        1, 16, 24, 37,
-                        1, 16, 24, 39,
-                        1, 16, 24, 40,
-                        1, 16, 24, 42,
-                        1, 16, 25, 31,
-                        1, 16, 25, 32,
-                        1, 16, 25, 33,
-                        1, 16, 25, 39,
-                        1, 16, 25, 40,
-                        1, 16, 25, 42,
-                        1, 16, 26, 30,
-                        1, 16, 26, 32,
-                        1, 16, 26, 33,
-                        1, 16, 26, 36,
-                        1, 16, 26, 37,
-                        1, 16, 26, 42,
-                        1, 16, 27, 30,
-                        1, 16, 27, 31,
-                        1, 16, 27, 33,
-                        1, 16, 27, 35,
-                        1, 16, 27, 37,
-                        1, 16, 27, 40,
-                        1, 16, 28, 30,
-                        1, 16, 28, 31,
-                        1, 16, 28, 32,
-                        1, 16, 28, 35,
-                        1, 16, 28, 36,
-                        1, 16, 28, 39,
-                        1, 16, 30, 39,
-                        1, 16, 30, 40,
-                        1, 16, 30, 42,
-                        1, 16, 31, 36,
-                        1, 16, 31, 37,
-                        1, 16, 31, 42,
-                        1, 16, 32, 35,
-                        1, 16, 32, 37,
-                        1, 16, 32, 40,
-                        1, 16, 33, 35,
-                        1, 16, 33, 36,
-                        1, 16, 33, 39,
-                        1, 16, 35, 42,
-                        1, 16, 36, 40,
-                        1, 16, 37, 39,
-                        1, 24, 35, 42,
-                        1, 24, 35, 43,
-                        1, 24, 35, 44,
-                        1, 24, 36, 40,
-                        1, 24, 36, 41,
-                        1, 24, 36, 44,
-                        1, 24, 37, 39,
-                        1, 24, 37, 41,
-                        1, 24, 37, 43,
-                        1, 24, 38, 39,
-                        1, 24, 38, 40,
-                        1, 24, 38, 42,
-                        1, 24, 39, 44,
-                        1, 24, 40, 43,
-                        1, 24, 41, 42,
-                        1, 25, 31, 42,
-                        1, 25, 31, 43,
-                        1, 25, 31, 44,
-                        1, 25, 32, 40,
-                        1, 25, 32, 41,
-                        1, 25, 32, 44,
-                        1, 25, 33, 39,
-                        1, 25, 33, 41,
-                        1, 25, 33, 43,
-                        1, 25, 34, 39,
-                        1, 25, 34, 40,
-                        1, 25, 34, 42,
-                        1, 25, 39, 44,
-                        1, 25, 40, 43,
-                        1, 25, 41, 42,
-                        1, 26, 30, 42,
-                        1, 26, 30, 43,
-                        1, 26, 30, 44,
-                        1, 26, 32, 37,
-                        1, 26, 32, 38,
-                        1, 26, 32, 44,
-                        1, 26, 33, 36,
-                        1, 26, 33, 38,
-                        1, 26, 33, 43,
-                        1, 26, 34, 36,
-                        1, 26, 34, 37,
-                        1, 26, 34, 42,
-                        1, 26, 36, 44,
-                        1, 26, 37, 43,
-                        1, 26, 38, 42,
-                        1, 27, 30, 40,
-                        1, 27, 30, 41,
-                        1, 27, 30, 44,
-                        1, 27, 31, 37,
-                        1, 27, 31, 38,
-                        1, 27, 31, 44,
-                        1, 27, 33, 35,
-                        1, 27, 33, 38,
-                        1, 27, 33, 41,
-                        1, 27, 34, 35,
-                        1, 27, 34, 37,
-                        1, 27, 34, 40,
-                        1, 27, 35, 44,
-                        1, 27, 37, 41,
-                        1, 27, 38, 40,
-                        1, 28, 30, 39,
-                        1, 28, 30, 41,
-                        1, 28, 30, 43,
-                        1, 28, 31, 36,
-                        1, 28, 31, 38,
-                        1, 28, 31, 43,
-                        1, 28, 32, 35,
-                        1, 28, 32, 38,
-                        1, 28, 32, 41,
-                        1, 28, 34, 35,
-                        1, 28, 34, 36,
-                        1, 28, 34, 39,
-                        1, 28, 35, 43,
-                        1, 28, 36, 41,
-                        1, 28, 38, 39,
-                        1, 29, 30, 39,
-                        1, 29, 30, 40,
-                        1, 29, 30, 42,
-                        1, 29, 31, 36,
-                        1, 29, 31, 37,
-                        1, 29, 31, 42,
-                        1, 29, 32, 35,
-                        1, 29, 32, 37,
-                        1, 29, 32, 40,
-                        1, 29, 33, 35,
-                        1, 29, 33, 36,
-                        1, 29, 33, 39,
-                        1, 29, 35, 42,
-                        1, 29, 36, 40,
-                        1, 29, 37, 39,
-                        1, 30, 39, 44,
-                        1, 30, 40, 43,
-                        1, 30, 41, 42,
-                        1, 31, 36, 44,
-                        1, 31, 37, 43,
-                        1, 31, 38, 42,
-                        1, 32, 35, 44,
-                        1, 32, 37, 41,
-                        1, 32, 38, 40,
-                        1, 33, 35, 43,
-                        1, 33, 36, 41,
-                        1, 33, 38, 39,
-                        1, 34, 35, 42,
-                        1, 34, 36, 40,
-                        1, 34, 37, 39,
-                        2, 9, 30, 39,
-                        2, 9, 30, 40,
-                        2, 9, 30, 41,
-                        2, 9, 30, 42,
-                        2, 9, 30, 43,
-                        2, 9, 30, 44,
-                        2, 9, 31, 36,
-                        2, 9, 31, 37,
-                        2, 9, 31, 38,
-                        2, 9, 31, 42,
-                        2, 9, 31, 43,
-                        2, 9, 31, 44,
-                        2, 9, 32, 35,
-                        2, 9, 32, 37,
-                        2, 9, 32, 38,
-                        2, 9, 32, 40,
-                        2, 9, 32, 41,
-                        2, 9, 32, 44,
-                        2, 9, 33, 35,
-                        2, 9, 33, 36,
-                        2, 9, 33, 38,
-                        2, 9, 33, 39,
-                        2, 9, 33, 41,
-                        2, 9, 33, 43,
-                        2, 9, 34, 35,
-                        2, 9, 34, 36,
-                        2, 9, 34, 37,
-                        2, 9, 34, 39,
-                        2, 9, 34, 40,
-                        2, 9, 34, 42,
-                        2, 9, 35, 42,
-                        2, 9, 35, 43,
-                        2, 9, 35, 44,
-                        2, 9, 36, 40,
-                        2, 9, 36, 41,
-                        2, 9, 36, 44,
-                        2, 9, 37, 39,
-                        2, 9, 37, 41,
-                        2, 9, 37, 43,
-                        2, 9, 38, 39,
-                        2, 9, 38, 40,
-                        2, 9, 38, 42,
-                        2, 9, 39, 44,
-                        2, 9, 40, 43,
-                        2, 9, 41, 42,
-                        2, 11, 19, 39,
-                        2, 11, 19, 40,
-                        2, 11, 19, 41,
-                        2, 11, 19, 42,
-                        2, 11, 19, 43,
-                        2, 11, 19, 44,
-                        2, 11, 20, 36,
-                        2, 11, 20, 37,
-                        2, 11, 20, 38,
-                        2, 11, 20, 42,
-                        2, 11, 20, 43,
-                        2, 11, 20, 44,
-                        2, 11, 21, 35,
-                        2, 11, 21, 37,
-                        2, 11, 21, 38,
-                        2, 11, 21, 40,
-                        2, 11, 21, 41,
-                        2, 11, 21, 44,
-                        2, 11, 22, 35,
-                        2, 11, 22, 36,
-                        2, 11, 22, 38,
-                        2, 11, 22, 39,
-                        2, 11, 22, 41,
-                        2, 11, 22, 43,
-                        2, 11, 23, 35,
-                        2, 11, 23, 36,
-                        2, 11, 23, 37,
-                        2, 11, 23, 39,
-                        2, 11, 23, 40,
-                        2, 11, 23, 42,
-                        2, 11, 35, 42,
-                        2, 11, 35, 43,
-                        2, 11, 35, 44,
-                        2, 11, 36, 40,
-                        2, 11, 36, 41,
-                        2, 11, 36, 44,
-                        2, 11, 37, 39,
-                        2, 11, 37, 41,
-                        2, 11, 37, 43,
-                        2, 11, 38, 39,
-                        2, 11, 38, 40,
-                        2, 11, 38, 42,
-                        2, 11, 39, 44,
-                        2, 11, 40, 43,
-                        2, 11, 41, 42,
-                        2, 12, 18, 39,
-                        2, 12, 18, 40,
-                        2, 12, 18, 41,
-                        2, 12, 18, 42,
-                        2, 12, 18, 43,
-                        2, 12, 18, 44,
-                        2, 12, 20, 32,
-                        2, 12, 20, 33,
-                        2, 12, 20, 34,
-                        2, 12, 20, 42,
-                        2, 12, 20, 43,
-                        2, 12, 20, 44,
-                        2, 12, 21, 31,
-                        2, 12, 21, 33,
-                        2, 12, 21, 34,
-                        2, 12, 21, 40,
-                        2, 12, 21, 41,
-                        2, 12, 21, 44,
-                        2, 12, 22, 31,
-                        2, 12, 22, 32,
-                        2, 12, 22, 34,
-                        2, 12, 22, 39,
-                        2, 12, 22, 41,
-                        2, 12, 22, 43,
-                        2, 12, 23, 31,
-                        2, 12, 23, 32,
-                        2, 12, 23, 33,
-                        2, 12, 23, 39,
-                        2, 12, 23, 40,
-                        2, 12, 23, 42,
-                        2, 12, 31, 42,
-                        2, 12, 31, 43,
-                        2, 12, 31, 44,
-                        2, 12, 32, 40,
-                        2, 12, 32, 41,
-                        2, 12, 32, 44,
-                        2, 12, 33, 39,
-                        2, 12, 33, 41,
-                        2, 12, 33, 43,
-                        2, 12, 34, 39,
-                        2, 12, 34, 40,
-                        2, 12, 34, 42,
-                        2, 12, 39, 44,
-                        2, 12, 40, 43,
-                        2, 12, 41, 42,
-                        2, 13, 18, 36,
-                        2, 13, 18, 37,
-                        2, 13, 18, 38,
-                        2, 13, 18, 42,
-                        2, 13, 18, 43,
-                        2, 13, 18, 44,
-                        2, 13, 19, 32,
-                        2, 13, 19, 33,
-                        2, 13, 19, 34,
-                        2, 13, 19, 42,
-                        2, 13, 19, 43,
-                        2, 13, 19, 44,
-                        2, 13, 21, 30,
-                        2, 13, 21, 33,
-                        2, 13, 21, 34,
-                        2, 13, 21, 37,
-                        2, 13, 21, 38,
-                        2, 13, 21, 44,
-                        2, 13, 22, 30,
-                        2, 13, 22, 32,
-                        2, 13, 22, 34,
-                        2, 13, 22, 36,
-                        2, 13, 22, 38,
-                        2, 13, 22, 43,
-                        2, 13, 23, 30,
-                        2, 13, 23, 32,
-                        2, 13, 23, 33,
-                        2, 13, 23, 36,
-                        2, 13, 23, 37,
-                        2, 13, 23, 42,
-                        2, 13, 30, 42,
-                        2, 13, 30, 43,
-                        2, 13, 30, 44,
-                        2, 13, 32, 37,
-                        2, 13, 32, 38,
-                        2, 13, 32, 44,
-                        2, 13, 33, 36,
-                        2, 13, 33, 38,
-                        2, 13, 33, 43,
-                        2, 13, 34, 36,
-                        2, 13, 34, 37,
-                        2, 13, 34, 42,
-                        2, 13, 36, 44,
-                        2, 13, 37, 43,
-                        2, 13, 38, 42,
-                        2, 14, 18, 35,
-                        2, 14, 18, 37,
-                        2, 14, 18, 38,
-                        2, 14, 18, 40,
-                        2, 14, 18, 41,
-                        2, 14, 18, 44,
-                        2, 14, 19, 31,
-                        2, 14, 19, 33,
-                        2, 14, 19, 34,
-                        2, 14, 19, 40,
-                        2, 14, 19, 41,
-                        2, 14, 19, 44,
-                        2, 14, 20, 30,
-                        2, 14, 20, 33,
-                        2, 14, 20, 34,
-                        2, 14, 20, 37,
-                        2, 14, 20, 38,
-                        2, 14, 20, 44,
-                        2, 14, 22, 30,
-                        2, 14, 22, 31,
-                        2, 14, 22, 34,
-                        2, 14, 22, 35,
-                        2, 14, 22, 38,
-                        2, 14, 22, 41,
-                        2, 14, 23, 30,
-                        2, 14, 23, 31,
-                        2, 14, 23, 33,
-                        2, 14, 23, 35,
-                        2, 14, 23, 37,
-                        2, 14, 23, 40,
-                        2, 14, 30, 40,
-                        2, 14, 30, 41,
-                        2, 14, 30, 44,
-                        2, 14, 31, 37,
-                        2, 14, 31, 38,
-                        2, 14, 31, 44,
-                        2, 14, 33, 35,
-                        2, 14, 33, 38,
-                        2, 14, 33, 41,
-                        2, 14, 34, 35,
-                        2, 14, 34, 37,
-                        2, 14, 34, 40,
-                        2, 14, 35, 44,
-                        2, 14, 37, 41,
-                        2, 14, 38, 40,
-                        2, 15, 18, 35,
-                        2, 15, 18, 36,
-                        2, 15, 18, 38,
-                        2, 15, 18, 39,
-                        2, 15, 18, 41,
-                        2, 15, 18, 43,
-                        2, 15, 19, 31,
-                        2, 15, 19, 32,
-                        2, 15, 19, 34,
-                        2, 15, 19, 39,
-                        2, 15, 19, 41,
-                        2, 15, 19, 43,
-                        2, 15, 20, 30,
-                        2, 15, 20, 32,
-                        2, 15, 20, 34,
-                        2, 15, 20, 36,
-                        2, 15, 20, 38,
-                        2, 15, 20, 43,
-                        2, 15, 21, 30,
-                        2, 15, 21, 31,
-                        2, 15, 21, 34,
-                        2, 15, 21, 35,
-                        2, 15, 21, 38,
-                        2, 15, 21, 41,
-                        2, 15, 23, 30,
-                        2, 15, 23, 31,
-                        2, 15, 23, 32,
-                        2, 15, 23, 35,
-                        2, 15, 23, 36,
-                        2, 15, 23, 39,
-                        2, 15, 30, 39,
-                        2, 15, 30, 41,
-                        2, 15, 30, 43,
-                        2, 15, 31, 36,
-                        2, 15, 31, 38,
-                        2, 15, 31, 43,
-                        2, 15, 32, 35,
-                        2, 15, 32, 38,
-                        2, 15, 32, 41,
-                        2, 15, 34, 35,
-                        2, 15, 34, 36,
-                        2, 15, 34, 39,
-                        2, 15, 35, 43,
-                        2, 15, 36, 41,
-                        2, 15, 38, 39,
-                        2, 16, 18, 35,
-                        2, 16, 18, 36,
-                        2, 16, 18, 37,
-                        2, 16, 18, 39,
-                        2, 16, 18, 40,
-                        2, 16, 18, 42,
-                        2, 16, 19, 31,
-                        2, 16, 19, 32,
-                        2, 16, 19, 33,
-                        2, 16, 19, 39,
-                        2, 16, 19, 40,
-                        2, 16, 19, 42,
-                        2, 16, 20, 30,
-                        2, 16, 20, 32,
-                        2, 16, 20, 33,
-                        2, 16, 20, 36,
-                        2, 16, 20, 37,
-                        2, 16, 20, 42,
-                        2, 16, 21, 30,
-                        2, 16, 21, 31,
-                        2, 16, 21, 33,
-                        2, 16, 21, 35,
-                        2, 16, 21, 37,
-                        2, 16, 21, 40,
-                        2, 16, 22, 30,
-                        2, 16, 22, 31,
-                        2, 16, 22, 32,
-                        2, 16, 22, 35,
-                        2, 16, 22, 36,
-                        2, 16, 22, 39,
-                        2, 16, 30, 39,
-                        2, 16, 30, 40,
-                        2, 16, 30, 42,
-                        2, 16, 31, 36,
-                        2, 16, 31, 37,
-                        2, 16, 31, 42,
-                        2, 16, 32, 35,
-                        2, 16, 32, 37,
-                        2, 16, 32, 40,
-                        2, 16, 33, 35,
-                        2, 16, 33, 36,
-                        2, 16, 33, 39,
-                        2, 16, 35, 42,
-                        2, 16, 36, 40,
-                        2, 16, 37, 39,
-                        2, 18, 35, 42,
-                        2, 18, 35, 43,
-                        2, 18, 35, 44,
-                        2, 18, 36, 40,
-                        2, 18, 36, 41,
-                        2, 18, 36, 44,
-                        2, 18, 37, 39,
-                        2, 18, 37, 41,
-                        2, 18, 37, 43,
-                        2, 18, 38, 39,
-                        2, 18, 38, 40,
-                        2, 18, 38, 42,
-                        2, 18, 39, 44,
-                        2, 18, 40, 43,
-                        2, 18, 41, 42,
-                        2, 19, 31, 42,
-                        2, 19, 31, 43,
-                        2, 19, 31, 44,
-                        2, 19, 32, 40,
-                        2, 19, 32, 41,
-                        2, 19, 32, 44,
-                        2, 19, 33, 39,
-                        2, 19, 33, 41,
-                        2, 19, 33, 43,
-                        2, 19, 34, 39,
-                        2, 19, 34, 40,
-                        2, 19, 34, 42,
-                        2, 19, 39, 44,
-                        2, 19, 40, 43,
-                        2, 19, 41, 42,
-                        2, 20, 30, 42,
-                        2, 20, 30, 43,
-                        2, 20, 30, 44,
-                        2, 20, 32, 37,
-                        2, 20, 32, 38,
-                        2, 20, 32, 44,
-                        2, 20, 33, 36,
-                        2, 20, 33, 38,
-                        2, 20, 33, 43,
-                        2, 20, 34, 36,
-                        2, 20, 34, 37,
-                        2, 20, 34, 42,
-                        2, 20, 36, 44,
-                        2, 20, 37, 43,
-                        2, 20, 38, 42,
-                        2, 21, 30, 40,
-                        2, 21, 30, 41,
-                        2, 21, 30, 44,
-                        2, 21, 31, 37,
-                        2, 21, 31, 38,
-                        2, 21, 31, 44,
-                        2, 21, 33, 35,
-                        2, 21, 33, 38,
-                        2, 21, 33, 41,
-                        2, 21, 34, 35,
-                        2, 21, 34, 37,
-                        2, 21, 34, 40,
-                        2, 21, 35, 44,
-                        2, 21, 37, 41,
-                        2, 21, 38, 40,
-                        2, 22, 30, 39,
-                        2, 22, 30, 41,
-                        2, 22, 30, 43,
-                        2, 22, 31, 36,
-                        2, 22, 31, 38,
-                        2, 22, 31, 43,
-                        2, 22, 32, 35,
-                        2, 22, 32, 38,
-                        2, 22, 32, 41,
-                        2, 22, 34, 35,
-                        2, 22, 34, 36,
-                        2, 22, 34, 39,
-                        2, 22, 35, 43,
-                        2, 22, 36, 41,
-                        2, 22, 38, 39,
-                        2, 23, 30, 39,
-                        2, 23, 30, 40,
-                        2, 23, 30, 42,
-                        2, 23, 31, 36,
-                        2, 23, 31, 37,
-                        2, 23, 31, 42,
-                        2, 23, 32, 35,
-                        2, 23, 32, 37,
-                        2, 23, 32, 40,
-                        2, 23, 33, 35,
-                        2, 23, 33, 36,
-                        2, 23, 33, 39,
-                        2, 23, 35, 42,
-                        2, 23, 36, 40,
-                        2, 23, 37, 39,
-                        2, 30, 39, 44,
-                        2, 30, 40, 43,
-                        2, 30, 41, 42,
-                        2, 31, 36, 44,
-                        2, 31, 37, 43,
-                        2, 31, 38, 42,
-                        2, 32, 35, 44,
-                        2, 32, 37, 41,
-                        2, 32, 38, 40,
-                        2, 33, 35, 43,
-                        2, 33, 36, 41,
-                        2, 33, 38, 39,
-                        2, 34, 35, 42,
-                        2, 34, 36, 40,
-                        2, 34, 37, 39,
-                        3, 9, 25, 39,
-                        3, 9, 25, 40,
-                        3, 9, 25, 41,
-                        3, 9, 25, 42,
-                        3, 9, 25, 43,
-                        3, 9, 25, 44,
-                        3, 9, 26, 36,
-                        3, 9, 26, 37,
-                        3, 9, 26, 38,
-                        3, 9, 26, 42,
-                        3, 9, 26, 43,
-                        3, 9, 26, 44,
-                        3, 9, 27, 35,
-                        3, 9, 27, 37,
-                        3, 9, 27, 38,
-                        3, 9, 27, 40,
-                        3, 9, 27, 41,
-                        3, 9, 27, 44,
-                        3, 9, 28, 35,
-                        3, 9, 28, 36,
-                        3, 9, 28, 38,
-                        3, 9, 28, 39,
-                        3, 9, 28, 41,
-                        3, 9, 28, 43,
-                        3, 9, 29, 35,
-                        3, 9, 29, 36,
-                        3, 9, 29, 37,
-                        3, 9, 29, 39,
-                        3, 9, 29, 40,
-                        3, 9, 29, 42,
-                        3, 9, 35, 42,
-                        3, 9, 35, 43,
-                        3, 9, 35, 44,
-                        3, 9, 36, 40,
-                        3, 9, 36, 41,
-                        3, 9, 36, 44,
-                        3, 9, 37, 39,
-                        3, 9, 37, 41,
-                        3, 9, 37, 43,
-                        3, 9, 38, 39,
-                        3, 9, 38, 40,
-                        3, 9, 38, 42,
-                        3, 9, 39, 44,
-                        3, 9, 40, 43,
-                        3, 9, 41, 42,
-                        3, 10, 19, 39,
-                        3, 10, 19, 40,
-                        3, 10, 19, 41,
-                        3, 10, 19, 42,
-                        3, 10, 19, 43,
-                        3, 10, 19, 44,
-                        3, 10, 20, 36,
-                        3, 10, 20, 37,
-                        3, 10, 20, 38,
-                        3, 10, 20, 42,
-                        3, 10, 20, 43,
-                        3, 10, 20, 44,
-                        3, 10, 21, 35,
-                        3, 10, 21, 37,
-                        3, 10, 21, 38,
-                        3, 10, 21, 40,
-                        3, 10, 21, 41,
-                        3, 10, 21, 44,
-                        3, 10, 22, 35,
-                        3, 10, 22, 36,
-                        3, 10, 22, 38,
-                        3, 10, 22, 39,
-                        3, 10, 22, 41,
-                        3, 10, 22, 43,
-                        3, 10, 23, 35,
-                        3, 10, 23, 36,
-                        3, 10, 23, 37,
-                        3, 10, 23, 39,
-                        3, 10, 23, 40,
-                        3, 10, 23, 42,
-                        3, 10, 35, 42,
-                        3, 10, 35, 43,
-                        3, 10, 35, 44,
-                        3, 10, 36, 40,
-                        3, 10, 36, 41,
-                        3, 10, 36, 44,
-                        3, 10, 37, 39,
-                        3, 10, 37, 41,
-                        3, 10, 37, 43,
-                        3, 10, 38, 39,
-                        3, 10, 38, 40,
-                        3, 10, 38, 42,
-                        3, 10, 39, 44,
-                        3, 10, 40, 43,
-                        3, 10, 41, 42,
-                        3, 12, 17, 39,
-                        3, 12, 17, 40,
-                        3, 12, 17, 41,
-                        3, 12, 17, 42,
-                        3, 12, 17, 43,
-                        3, 12, 17, 44,
-                        3, 12, 20, 27,
-                        3, 12, 20, 28,
-                        3, 12, 20, 29,
-                        3, 12, 20, 42,
-                        3, 12, 20, 43,
-                        3, 12, 20, 44,
-                        3, 12, 21, 26,
-                        3, 12, 21, 28,
-                        3, 12, 21, 29,
-                        3, 12, 21, 40,
-                        3, 12, 21, 41,
-                        3, 12, 21, 44,
-                        3, 12, 22, 26,
-                        3, 12, 22, 27,
-                        3, 12, 22, 29,
-                        3, 12, 22, 39,
-                        3, 12, 22, 41,
-                        3, 12, 22, 43,
-                        3, 12, 23, 26,
-                        3, 12, 23, 27,
-                        3, 12, 23, 28,
-                        3, 12, 23, 39,
-                        3, 12, 23, 40,
-                        3, 12, 23, 42,
-                        3, 12, 26, 42,
-                        3, 12, 26, 43,
-                        3, 12, 26, 44,
-                        3, 12, 27, 40,
-                        3, 12, 27, 41,
-                        3, 12, 27, 44,
-                        3, 12, 28, 39,
-                        3, 12, 28, 41,
-                        3, 12, 28, 43,
-                        3, 12, 29, 39,
-                        3, 12, 29, 40,
-                        3, 12, 29, 42,
-                        3, 12, 39, 44,
-                        3, 12, 40, 43,
-                        3, 12, 41, 42,
-                        3, 13, 17, 36,
-                        3, 13, 17, 37,
-                        3, 13, 17, 38,
-                        3, 13, 17, 42,
-                        3, 13, 17, 43,
-                        3, 13, 17, 44,
-                        3, 13, 19, 27,
-                        3, 13, 19, 28,
-                        3, 13, 19, 29,
-                        3, 13, 19, 42,
-                        3, 13, 19, 43,
-                        3, 13, 19, 44,
-                        3, 13, 21, 25,
-                        3, 13, 21, 28,
-                        3, 13, 21, 29,
-                        3, 13, 21, 37,
-                        3, 13, 21, 38,
-                        3, 13, 21, 44,
-                        3, 13, 22, 25,
-                        3, 13, 22, 27,
-                        3, 13, 22, 29,
-                        3, 13, 22, 36,
-                        3, 13, 22, 38,
-                        3, 13, 22, 43,
-                        3, 13, 23, 25,
-                        3, 13, 23, 27,
-                        3, 13, 23, 28,
-                        3, 13, 23, 36,
-                        3, 13, 23, 37,
-                        3, 13, 23, 42,
-                        3, 13, 25, 42,
-                        3, 13, 25, 43,
-                        3, 13, 25, 44,
-                        3, 13, 27, 37,
-                        3, 13, 27, 38,
-                        3, 13, 27, 44,
-                        3, 13, 28, 36,
-                        3, 13, 28, 38,
-                        3, 13, 28, 43,
-                        3, 13, 29, 36,
-                        3, 13, 29, 37,
-                        3, 13, 29, 42,
-                        3, 13, 36, 44,
-                        3, 13, 37, 43,
-                        3, 13, 38, 42,
-                        3, 14, 17, 35,
-                        3, 14, 17, 37,
-                        3, 14, 17, 38,
-                        3, 14, 17, 40,
-                        3, 14, 17, 41,
-                        3, 14, 17, 44,
-                        3, 14, 19, 26,
-                        3, 14, 19, 28,
-                        3, 14, 19, 29,
-                        3, 14, 19, 40,
-                        3, 14, 19, 41,
-                        3, 14, 19, 44,
-                        3, 14, 20, 25,
-                        3, 14, 20, 28,
-                        3, 14, 20, 29,
-                        3, 14, 20, 37,
-                        3, 14, 20, 38,
-                        3, 14, 20, 44,
-                        3, 14, 22, 25,
-                        3, 14, 22, 26,
-                        3, 14, 22, 29,
-                        3, 14, 22, 35,
-                        3, 14, 22, 38,
-                        3, 14, 22, 41,
-                        3, 14, 23, 25,
-                        3, 14, 23, 26,
-                        3, 14, 23, 28,
-                        3, 14, 23, 35,
-                        3, 14, 23, 37,
-                        3, 14, 23, 40,
-                        3, 14, 25, 40,
-                        3, 14, 25, 41,
-                        3, 14, 25, 44,
-                        3, 14, 26, 37,
-                        3, 14, 26, 38,
-                        3, 14, 26, 44,
-                        3, 14, 28, 35,
-                        3, 14, 28, 38,
-                        3, 14, 28, 41,
-                        3, 14, 29, 35,
-                        3, 14, 29, 37,
-                        3, 14, 29, 40,
-                        3, 14, 35, 44,
-                        3, 14, 37, 41,
-                        3, 14, 38, 40,
-                        3, 15, 17, 35,
-                        3, 15, 17, 36,
-                        3, 15, 17, 38,
-                        3, 15, 17, 39,
-                        3, 15, 17, 41,
-                        3, 15, 17, 43,
-                        3, 15, 19, 26,
-                        3, 15, 19, 27,
-                        3, 15, 19, 29,
-                        3, 15, 19, 39,
-                        3, 15, 19, 41,
-                        3, 15, 19, 43,
-                        3, 15, 20, 25,
-                        3, 15, 20, 27,
-                        3, 15, 20, 29,
-                        3, 15, 20, 36,
-                        3, 15, 20, 38,
-                        3, 15, 20, 43,
-                        3, 15, 21, 25,
-                        3, 15, 21, 26,
-                        3, 15, 21, 29,
-                        3, 15, 21, 35,
-                        3, 15, 21, 38,
-                        3, 15, 21, 41,
-                        3, 15, 23, 25,
-                        3, 15, 23, 26,
-                        3, 15, 23, 27,
-                        3, 15, 23, 35,
-                        3, 15, 23, 36,
-                        3, 15, 23, 39,
-                        3, 15, 25, 39,
-                        3, 15, 25, 41,
-                        3, 15, 25, 43,
-                        3, 15, 26, 36,
-                        3, 15, 26, 38,
-                        3, 15, 26, 43,
-                        3, 15, 27, 35,
-                        3, 15, 27, 38,
-                        3, 15, 27, 41,
-                        3, 15, 29, 35,
-                        3, 15, 29, 36,
-                        3, 15, 29, 39,
-                        3, 15, 35, 43,
-                        3, 15, 36, 41,
-                        3, 15, 38, 39,
-                        3, 16, 17, 35,
-                        3, 16, 17, 36,
-                        3, 16, 17, 37,
-                        3, 16, 17, 39,
-                        3, 16, 17, 40,
-                        3, 16, 17, 42,
-                        3, 16, 19, 26,
-                        3, 16, 19, 27,
-                        3, 16, 19, 28,
-                        3, 16, 19, 39,
-                        3, 16, 19, 40,
-                        3, 16, 19, 42,
-                        3, 16, 20, 25,
-                        3, 16, 20, 27,
-                        3, 16, 20, 28,
-                        3, 16, 20, 36,
-                        3, 16, 20, 37,
-                        3, 16, 20, 42,
-                        3, 16, 21, 25,
-                        3, 16, 21, 26,
-                        3, 16, 21, 28,
-                        3, 16, 21, 35,
-                        3, 16, 21, 37,
-                        3, 16, 21, 40,
-                        3, 16, 22, 25,
-                        3, 16, 22, 26,
-                        3, 16, 22, 27,
-                        3, 16, 22, 35,
-                        3, 16, 22, 36,
-                        3, 16, 22, 39,
-                        3, 16, 25, 39,
-                        3, 16, 25, 40,
-                        3, 16, 25, 42,
-                        3, 16, 26, 36,
-                        3, 16, 26, 37,
-                        3, 16, 26, 42,
-                        3, 16, 27, 35,
-                        3, 16, 27, 37,
-                        3, 16, 27, 40,
-                        3, 16, 28, 35,
-                        3, 16, 28, 36,
-                        3, 16, 28, 39,
-                        3, 16, 35, 42,
-                        3, 16, 36, 40,
-                        3, 16, 37, 39,
-                        3, 17, 35, 42,
-                        3, 17, 35, 43,
-                        3, 17, 35, 44,
-                        3, 17, 36, 40,
-                        3, 17, 36, 41,
-                        3, 17, 36, 44,
-                        3, 17, 37, 39,
-                        3, 17, 37, 41,
-                        3, 17, 37, 43,
-                        3, 17, 38, 39,
-                        3, 17, 38, 40,
-                        3, 17, 38, 42,
-                        3, 17, 39, 44,
-                        3, 17, 40, 43,
-                        3, 17, 41, 42,
-                        3, 19, 26, 42,
-                        3, 19, 26, 43,
-                        3, 19, 26, 44,
-                        3, 19, 27, 40,
-                        3, 19, 27, 41,
-                        3, 19, 27, 44,
-                        3, 19, 28, 39,
-                        3, 19, 28, 41,
-                        3, 19, 28, 43,
-                        3, 19, 29, 39,
-                        3, 19, 29, 40,
-                        3, 19, 29, 42,
-                        3, 19, 39, 44,
-                        3, 19, 40, 43,
-                        3, 19, 41, 42,
-                        3, 20, 25, 42,
-                        3, 20, 25, 43,
-                        3, 20, 25, 44,
-                        3, 20, 27, 37,
-                        3, 20, 27, 38,
-                        3, 20, 27, 44,
-                        3, 20, 28, 36,
-                        3, 20, 28, 38,
-                        3, 20, 28, 43,
-                        3, 20, 29, 36,
-                        3, 20, 29, 37,
-                        3, 20, 29, 42,
-                        3, 20, 36, 44,
-                        3, 20, 37, 43,
-                        3, 20, 38, 42,
-                        3, 21, 25, 40,
-                        3, 21, 25, 41,
-                        3, 21, 25, 44,
-                        3, 21, 26, 37,
-                        3, 21, 26, 38,
-                        3, 21, 26, 44,
-                        3, 21, 28, 35,
-                        3, 21, 28, 38,
-                        3, 21, 28, 41,
-                        3, 21, 29, 35,
-                        3, 21, 29, 37,
-                        3, 21, 29, 40,
-                        3, 21, 35, 44,
-                        3, 21, 37, 41,
-                        3, 21, 38, 40,
-                        3, 22, 25, 39,
-                        3, 22, 25, 41,
-                        3, 22, 25, 43,
-                        3, 22, 26, 36,
-                        3, 22, 26, 38,
-                        3, 22, 26, 43,
-                        3, 22, 27, 35,
-                        3, 22, 27, 38,
-                        3, 22, 27, 41,
-                        3, 22, 29, 35,
-                        3, 22, 29, 36,
-                        3, 22, 29, 39,
-                        3, 22, 35, 43,
-                        3, 22, 36, 41,
-                        3, 22, 38, 39,
-                        3, 23, 25, 39,
-                        3, 23, 25, 40,
-                        3, 23, 25, 42,
-                        3, 23, 26, 36,
-                        3, 23, 26, 37,
-                        3, 23, 26, 42,
-                        3, 23, 27, 35,
-                        3, 23, 27, 37,
-                        3, 23, 27, 40,
-                        3, 23, 28, 35,
-                        3, 23, 28, 36,
-                        3, 23, 28, 39,
-                        3, 23, 35, 42,
-                        3, 23, 36, 40,
-                        3, 23, 37, 39,
-                        3, 25, 39, 44,
-                        3, 25, 40, 43,
-                        3, 25, 41, 42,
-                        3, 26, 36, 44,
-                        3, 26, 37, 43,
-                        3, 26, 38, 42,
-                        3, 27, 35, 44,
-                        3, 27, 37, 41,
-                        3, 27, 38, 40,
-                        3, 28, 35, 43,
-                        3, 28, 36, 41,
-                        3, 28, 38, 39,
-                        3, 29, 35, 42,
-                        3, 29, 36, 40,
-                        3, 29, 37, 39,
-                        4, 9, 24, 39,
-                        4, 9, 24, 40,
-                        4, 9, 24, 41,
-                        4, 9, 24, 42,
-                        4, 9, 24, 43,
-                        4, 9, 24, 44,
-                        4, 9, 26, 32,
-                        4, 9, 26, 33,
-                        4, 9, 26, 34,
-                        4, 9, 26, 42,
-                        4, 9, 26, 43,
-                        4, 9, 26, 44,
-                        4, 9, 27, 31,
-                        4, 9, 27, 33,
-                        4, 9, 27, 34,
-                        4, 9, 27, 40,
-                        4, 9, 27, 41,
-                        4, 9, 27, 44,
-                        4, 9, 28, 31,
-                        4, 9, 28, 32,
-                        4, 9, 28, 34,
-                        4, 9, 28, 39,
-                        4, 9, 28, 41,
-                        4, 9, 28, 43,
-                        4, 9, 29, 31,
-                        4, 9, 29, 32,
-                        4, 9, 29, 33,
-                        4, 9, 29, 39,
-                        4, 9, 29, 40,
-                        4, 9, 29, 42,
-                        4, 9, 31, 42,
-                        4, 9, 31, 43,
-                        4, 9, 31, 44,
-                        4, 9, 32, 40,
-                        4, 9, 32, 41,
-                        4, 9, 32, 44,
-                        4, 9, 33, 39,
-                        4, 9, 33, 41,
-                        4, 9, 33, 43,
-                        4, 9, 34, 39,
-                        4, 9, 34, 40,
-                        4, 9, 34, 42,
-                        4, 9, 39, 44,
-                        4, 9, 40, 43,
-                        4, 9, 41, 42,
-                        4, 10, 18, 39,
-                        4, 10, 18, 40,
-                        4, 10, 18, 41,
-                        4, 10, 18, 42,
-                        4, 10, 18, 43,
-                        4, 10, 18, 44,
-                        4, 10, 20, 32,
-                        4, 10, 20, 33,
-                        4, 10, 20, 34,
-                        4, 10, 20, 42,
-                        4, 10, 20, 43,
-                        4, 10, 20, 44,
-                        4, 10, 21, 31,
-                        4, 10, 21, 33,
-                        4, 10, 21, 34,
-                        4, 10, 21, 40,
-                        4, 10, 21, 41,
-                        4, 10, 21, 44,
-                        4, 10, 22, 31,
-                        4, 10, 22, 32,
-                        4, 10, 22, 34,
-                        4, 10, 22, 39,
-                        4, 10, 22, 41,
-                        4, 10, 22, 43,
-                        4, 10, 23, 31,
-                        4, 10, 23, 32,
-                        4, 10, 23, 33,
-                        4, 10, 23, 39,
-                        4, 10, 23, 40,
-                        4, 10, 23, 42,
-                        4, 10, 31, 42,
-                        4, 10, 31, 43,
-                        4, 10, 31, 44,
-                        4, 10, 32, 40,
-                        4, 10, 32, 41,
-                        4, 10, 32, 44,
-                        4, 10, 33, 39,
-                        4, 10, 33, 41,
-                        4, 10, 33, 43,
-                        4, 10, 34, 39,
-                        4, 10, 34, 40,
-                        4, 10, 34, 42,
-                        4, 10, 39, 44,
-                        4, 10, 40, 43,
-                        4, 10, 41, 42,
-                        4, 11, 17, 39,
-                        4, 11, 17, 40,
-                        4, 11, 17, 41,
-                        4, 11, 17, 42,
-                        4, 11, 17, 43,
-                        4, 11, 17, 44,
-                        4, 11, 20, 27,
-                        4, 11, 20, 28,
-                        4, 11, 20, 29,
-                        4, 11, 20, 42,
-                        4, 11, 20, 43,
-                        4, 11, 20, 44,
-                        4, 11, 21, 26,
-                        4, 11, 21, 28,
-                        4, 11, 21, 29,
-                        4, 11, 21, 40,
-                        4, 11, 21, 41,
-                        4, 11, 21, 44,
-                        4, 11, 22, 26,
-                        4, 11, 22, 27,
-                        4, 11, 22, 29,
-                        4, 11, 22, 39,
-                        4, 11, 22, 41,
-                        4, 11, 22, 43,
-                        4, 11, 23, 26,
-                        4, 11, 23, 27,
-                        4, 11, 23, 28,
-                        4, 11, 23, 39,
-                        4, 11, 23, 40,
-                        4, 11, 23, 42,
-                        4, 11, 26, 42,
-                        4, 11, 26, 43,
-                        4, 11, 26, 44,
-                        4, 11, 27, 40,
-                        4, 11, 27, 41,
-                        4, 11, 27, 44,
-                        4, 11, 28, 39,
-                        4, 11, 28, 41,
-                        4, 11, 28, 43,
-                        4, 11, 29, 39,
-                        4, 11, 29, 40,
-                        4, 11, 29, 42,
-                        4, 11, 39, 44,
-                        4, 11, 40, 43,
-                        4, 11, 41, 42,
-                        4, 13, 17, 32,
-                        4, 13, 17, 33,
-                        4, 13, 17, 34,
-                        4, 13, 17, 42,
-                        4, 13, 17, 43,
-                        4, 13, 17, 44,
-                        4, 13, 18, 27,
-                        4, 13, 18, 28,
-                        4, 13, 18, 29,
-                        4, 13, 18, 42,
-                        4, 13, 18, 43,
-                        4, 13, 18, 44,
-                        4, 13, 21, 24,
-                        4, 13, 21, 28,
-                        4, 13, 21, 29,
-                        4, 13, 21, 33,
-                        4, 13, 21, 34,
-                        4, 13, 21, 44,
-                        4, 13, 22, 24,
-                        4, 13, 22, 27,
-                        4, 13, 22, 29,
-                        4, 13, 22, 32,
-                        4, 13, 22, 34,
-                        4, 13, 22, 43,
-                        4, 13, 23, 24,
-                        4, 13, 23, 27,
-                        4, 13, 23, 28,
-                        4, 13, 23, 32,
-                        4, 13, 23, 33,
-                        4, 13, 23, 42,
-                        4, 13, 24, 42,
-                        4, 13, 24, 43,
-                        4, 13, 24, 44,
-                        4, 13, 27, 33,
-                        4, 13, 27, 34,
-                        4, 13, 27, 44,
-                        4, 13, 28, 32,
-                        4, 13, 28, 34,
-                        4, 13, 28, 43,
-                        4, 13, 29, 32,
-                        4, 13, 29, 33,
-                        4, 13, 29, 42,
-                        4, 13, 32, 44,
-                        4, 13, 33, 43,
-                        4, 13, 34, 42,
-                        4, 14, 17, 31,
-                        4, 14, 17, 33,
-                        4, 14, 17, 34,
-                        4, 14, 17, 40,
-                        4, 14, 17, 41,
-                        4, 14, 17, 44,
-                        4, 14, 18, 26,
-                        4, 14, 18, 28,
-                        4, 14, 18, 29,
-                        4, 14, 18, 40,
-                        4, 14, 18, 41,
-                        4, 14, 18, 44,
-                        4, 14, 20, 24,
-                        4, 14, 20, 28,
-                        4, 14, 20, 29,
-                        4, 14, 20, 33,
-                        4, 14, 20, 34,
-                        4, 14, 20, 44,
-                        4, 14, 22, 24,
-                        4, 14, 22, 26,
-                        4, 14, 22, 29,
-                        4, 14, 22, 31,
-                        4, 14, 22, 34,
-                        4, 14, 22, 41,
-                        4, 14, 23, 24,
-                        4, 14, 23, 26,
-                        4, 14, 23, 28,
-                        4, 14, 23, 31,
-                        4, 14, 23, 33,
-                        4, 14, 23, 40,
-                        4, 14, 24, 40,
-                        4, 14, 24, 41,
-                        4, 14, 24, 44,
-                        4, 14, 26, 33,
-                        4, 14, 26, 34,
-                        4, 14, 26, 44,
-                        4, 14, 28, 31,
-                        4, 14, 28, 34,
-                        4, 14, 28, 41,
-                        4, 14, 29, 31,
-                        4, 14, 29, 33,
-                        4, 14, 29, 40,
-                        4, 14, 31, 44,
-                        4, 14, 33, 41,
-                        4, 14, 34, 40,
-                        4, 15, 17, 31,
-                        4, 15, 17, 32,
-                        4, 15, 17, 34,
-                        4, 15, 17, 39,
-                        4, 15, 17, 41,
-                        4, 15, 17, 43,
-                        4, 15, 18, 26,
-                        4, 15, 18, 27,
-                        4, 15, 18, 29,
-                        4, 15, 18, 39,
-                        4, 15, 18, 41,
-                        4, 15, 18, 43,
-                        4, 15, 20, 24,
-                        4, 15, 20, 27,
-                        4, 15, 20, 29,
-                        4, 15, 20, 32,
-                        4, 15, 20, 34,
-                        4, 15, 20, 43,
-                        4, 15, 21, 24,
-                        4, 15, 21, 26,
-                        4, 15, 21, 29,
-                        4, 15, 21, 31,
-                        4, 15, 21, 34,
-                        4, 15, 21, 41,
-                        4, 15, 23, 24,
-                        4, 15, 23, 26,
-                        4, 15, 23, 27,
-                        4, 15, 23, 31,
-                        4, 15, 23, 32,
-                        4, 15, 23, 39,
-                        4, 15, 24, 39,
-                        4, 15, 24, 41,
-                        4, 15, 24, 43,
-                        4, 15, 26, 32,
-                        4, 15, 26, 34,
-                        4, 15, 26, 43,
-                        4, 15, 27, 31,
-                        4, 15, 27, 34,
-                        4, 15, 27, 41,
-                        4, 15, 29, 31,
-                        4, 15, 29, 32,
-                        4, 15, 29, 39,
-                        4, 15, 31, 43,
-                        4, 15, 32, 41,
-                        4, 15, 34, 39,
-                        4, 16, 17, 31,
-                        4, 16, 17, 32,
-                        4, 16, 17, 33,
-                        4, 16, 17, 39,
-                        4, 16, 17, 40,
-                        4, 16, 17, 42,
-                        4, 16, 18, 26,
-                        4, 16, 18, 27,
-                        4, 16, 18, 28,
-                        4, 16, 18, 39,
-                        4, 16, 18, 40,
-                        4, 16, 18, 42,
-                        4, 16, 20, 24,
-                        4, 16, 20, 27,
-                        4, 16, 20, 28,
-                        4, 16, 20, 32,
-                        4, 16, 20, 33,
-                        4, 16, 20, 42,
-                        4, 16, 21, 24,
-                        4, 16, 21, 26,
-                        4, 16, 21, 28,
-                        4, 16, 21, 31,
-                        4, 16, 21, 33,
-                        4, 16, 21, 40,
-                        4, 16, 22, 24,
-                        4, 16, 22, 26,
-                        4, 16, 22, 27,
-                        4, 16, 22, 31,
-                        4, 16, 22, 32,
-                        4, 16, 22, 39,
-                        4, 16, 24, 39,
-                        4, 16, 24, 40,
-                        4, 16, 24, 42,
-                        4, 16, 26, 32,
-                        4, 16, 26, 33,
-                        4, 16, 26, 42,
-                        4, 16, 27, 31,
-                        4, 16, 27, 33,
-                        4, 16, 27, 40,
-                        4, 16, 28, 31,
-                        4, 16, 28, 32,
-                        4, 16, 28, 39,
-                        4, 16, 31, 42,
-                        4, 16, 32, 40,
-                        4, 16, 33, 39,
-                        4, 17, 31, 42,
-                        4, 17, 31, 43,
-                        4, 17, 31, 44,
-                        4, 17, 32, 40,
-                        4, 17, 32, 41,
-                        4, 17, 32, 44,
-                        4, 17, 33, 39,
-                        4, 17, 33, 41,
-                        4, 17, 33, 43,
-                        4, 17, 34, 39,
-                        4, 17, 34, 40,
-                        4, 17, 34, 42,
-                        4, 17, 39, 44,
-                        4, 17, 40, 43,
-                        4, 17, 41, 42,
-                        4, 18, 26, 42,
-                        4, 18, 26, 43,
-                        4, 18, 26, 44,
-                        4, 18, 27, 40,
-                        4, 18, 27, 41,
-                        4, 18, 27, 44,
-                        4, 18, 28, 39,
-                        4, 18, 28, 41,
-                        4, 18, 28, 43,
-                        4, 18, 29, 39,
-                        4, 18, 29, 40,
-                        4, 18, 29, 42,
-                        4, 18, 39, 44,
-                        4, 18, 40, 43,
-                        4, 18, 41, 42,
-                        4, 20, 24, 42,
-                        4, 20, 24, 43,
-                        4, 20, 24, 44,
-                        4, 20, 27, 33,
-                        4, 20, 27, 34,
-                        4, 20, 27, 44,
-                        4, 20, 28, 32,
-                        4, 20, 28, 34,
-                        4, 20, 28, 43,
-                        4, 20, 29, 32,
-                        4, 20, 29, 33,
-                        4, 20, 29, 42,
-                        4, 20, 32, 44,
-                        4, 20, 33, 43,
-                        4, 20, 34, 42,
-                        4, 21, 24, 40,
-                        4, 21, 24, 41,
-                        4, 21, 24, 44,
-                        4, 21, 26, 33,
-                        4, 21, 26, 34,
-                        4, 21, 26, 44,
-                        4, 21, 28, 31,
-                        4, 21, 28, 34,
-                        4, 21, 28, 41,
-                        4, 21, 29, 31,
-                        4, 21, 29, 33,
-                        4, 21, 29, 40,
-                        4, 21, 31, 44,
-                        4, 21, 33, 41,
-                        4, 21, 34, 40,
-                        4, 22, 24, 39,
-                        4, 22, 24, 41,
-                        4, 22, 24, 43,
-                        4, 22, 26, 32,
-                        4, 22, 26, 34,
-                        4, 22, 26, 43,
-                        4, 22, 27, 31,
-                        4, 22, 27, 34,
-                        4, 22, 27, 41,
-                        4, 22, 29, 31,
-                        4, 22, 29, 32,
-                        4, 22, 29, 39,
-                        4, 22, 31, 43,
-                        4, 22, 32, 41,
-                        4, 22, 34, 39,
-                        4, 23, 24, 39,
-                        4, 23, 24, 40,
-                        4, 23, 24, 42,
-                        4, 23, 26, 32,
-                        4, 23, 26, 33,
-                        4, 23, 26, 42,
-                        4, 23, 27, 31,
-                        4, 23, 27, 33,
-                        4, 23, 27, 40,
-                        4, 23, 28, 31,
-                        4, 23, 28, 32,
-                        4, 23, 28, 39,
-                        4, 23, 31, 42,
-                        4, 23, 32, 40,
-                        4, 23, 33, 39,
-                        4, 24, 39, 44,
-                        4, 24, 40, 43,
-                        4, 24, 41, 42,
-                        4, 26, 32, 44,
-                        4, 26, 33, 43,
-                        4, 26, 34, 42,
-                        4, 27, 31, 44,
-                        4, 27, 33, 41,
-                        4, 27, 34, 40,
-                        4, 28, 31, 43,
-                        4, 28, 32, 41,
-                        4, 28, 34, 39,
-                        4, 29, 31, 42,
-                        4, 29, 32, 40,
-                        4, 29, 33, 39,
-                        5, 9, 24, 36,
-                        5, 9, 24, 37,
-                        5, 9, 24, 38,
-                        5, 9, 24, 42,
-                        5, 9, 24, 43,
-                        5, 9, 24, 44,
-                        5, 9, 25, 32,
-                        5, 9, 25, 33,
-                        5, 9, 25, 34,
-                        5, 9, 25, 42,
-                        5, 9, 25, 43,
-                        5, 9, 25, 44,
-                        5, 9, 27, 30,
-                        5, 9, 27, 33,
-                        5, 9, 27, 34,
-                        5, 9, 27, 37,
-                        5, 9, 27, 38,
-                        5, 9, 27, 44,
-                        5, 9, 28, 30,
-                        5, 9, 28, 32,
-                        5, 9, 28, 34,
-                        5, 9, 28, 36,
-                        5, 9, 28, 38,
-                        5, 9, 28, 43,
-                        5, 9, 29, 30,
-                        5, 9, 29, 32,
-                        5, 9, 29, 33,
-                        5, 9, 29, 36,
-                        5, 9, 29, 37,
-                        5, 9, 29, 42,
-                        5, 9, 30, 42,
-                        5, 9, 30, 43,
-                        5, 9, 30, 44,
-                        5, 9, 32, 37,
-                        5, 9, 32, 38,
-                        5, 9, 32, 44,
-                        5, 9, 33, 36,
-                        5, 9, 33, 38,
-                        5, 9, 33, 43,
-                        5, 9, 34, 36,
-                        5, 9, 34, 37,
-                        5, 9, 34, 42,
-                        5, 9, 36, 44,
-                        5, 9, 37, 43,
-                        5, 9, 38, 42,
-                        5, 10, 18, 36,
-                        5, 10, 18, 37,
-                        5, 10, 18, 38,
-                        5, 10, 18, 42,
-                        5, 10, 18, 43,
-                        5, 10, 18, 44,
-                        5, 10, 19, 32,
-                        5, 10, 19, 33,
-                        5, 10, 19, 34,
-                        5, 10, 19, 42,
-                        5, 10, 19, 43,
-                        5, 10, 19, 44,
-                        5, 10, 21, 30,
-                        5, 10, 21, 33,
-                        5, 10, 21, 34,
-                        5, 10, 21, 37,
-                        5, 10, 21, 38,
-                        5, 10, 21, 44,
-                        5, 10, 22, 30,
-                        5, 10, 22, 32,
-                        5, 10, 22, 34,
-                        5, 10, 22, 36,
-                        5, 10, 22, 38,
-                        5, 10, 22, 43,
-                        5, 10, 23, 30,
-                        5, 10, 23, 32,
-                        5, 10, 23, 33,
-                        5, 10, 23, 36,
-                        5, 10, 23, 37,
-                        5, 10, 23, 42,
-                        5, 10, 30, 42,
-                        5, 10, 30, 43,
-                        5, 10, 30, 44,
-                        5, 10, 32, 37,
-                        5, 10, 32, 38,
-                        5, 10, 32, 44,
-                        5, 10, 33, 36,
-                        5, 10, 33, 38,
-                        5, 10, 33, 43,
-                        5, 10, 34, 36,
-                        5, 10, 34, 37,
-                        5, 10, 34, 42,
-                        5, 10, 36, 44,
-                        5, 10, 37, 43,
-                        5, 10, 38, 42,
-                        5, 11, 17, 36,
-                        5, 11, 17, 37,
-                        5, 11, 17, 38,
-                        5, 11, 17, 42,
-                        5, 11, 17, 43,
-                        5, 11, 17, 44,
-                        5, 11, 19, 27,
-                        5, 11, 19, 28,
-                        5, 11, 19, 29,
-                        5, 11, 19, 42,
-                        5, 11, 19, 43,
-                        5, 11, 19, 44,
-                        5, 11, 21, 25,
-                        5, 11, 21, 28,
-                        5, 11, 21, 29,
-                        5, 11, 21, 37,
-                        5, 11, 21, 38,
-                        5, 11, 21, 44,
-                        5, 11, 22, 25,
-                        5, 11, 22, 27,
-                        5, 11, 22, 29,
-                        5, 11, 22, 36,
-                        5, 11, 22, 38,
-                        5, 11, 22, 43,
-                        5, 11, 23, 25,
-                        5, 11, 23, 27,
-                        5, 11, 23, 28,
-                        5, 11, 23, 36,
-                        5, 11, 23, 37,
-                        5, 11, 23, 42,
-                        5, 11, 25, 42,
-                        5, 11, 25, 43,
-                        5, 11, 25, 44,
-                        5, 11, 27, 37,
-                        5, 11, 27, 38,
-                        5, 11, 27, 44,
-                        5, 11, 28, 36,
-                        5, 11, 28, 38,
-                        5, 11, 28, 43,
-                        5, 11, 29, 36,
-                        5, 11, 29, 37,
-                        5, 11, 29, 42,
-                        5, 11, 36, 44,
-                        5, 11, 37, 43,
-                        5, 11, 38, 42,
-                        5, 12, 17, 32,
-                        5, 12, 17, 33,
-                        5, 12, 17, 34,
-                        5, 12, 17, 42,
-                        5, 12, 17, 43,
-                        5, 12, 17, 44,
-                        5, 12, 18, 27,
-                        5, 12, 18, 28,
-                        5, 12, 18, 29,
-                        5, 12, 18, 42,
-                        5, 12, 18, 43,
-                        5, 12, 18, 44,
-                        5, 12, 21, 24,
-                        5, 12, 21, 28,
-                        5, 12, 21, 29,
-                        5, 12, 21, 33,
-                        5, 12, 21, 34,
-                        5, 12, 21, 44,
-                        5, 12, 22, 24,
-                        5, 12, 22, 27,
-                        5, 12, 22, 29,
-                        5, 12, 22, 32,
-                        5, 12, 22, 34,
-                        5, 12, 22, 43,
-                        5, 12, 23, 24,
-                        5, 12, 23, 27,
-                        5, 12, 23, 28,
-                        5, 12, 23, 32,
-                        5, 12, 23, 33,
-                        5, 12, 23, 42,
-                        5, 12, 24, 42,
-                        5, 12, 24, 43,
-                        5, 12, 24, 44,
-                        5, 12, 27, 33,
-                        5, 12, 27, 34,
-                        5, 12, 27, 44,
-                        5, 12, 28, 32,
-                        5, 12, 28, 34,
-                        5, 12, 28, 43,
-                        5, 12, 29, 32,
-                        5, 12, 29, 33,
-                        5, 12, 29, 42,
-                        5, 12, 32, 44,
-                        5, 12, 33, 43,
-                        5, 12, 34, 42,
-                        5, 14, 17, 30,
-                        5, 14, 17, 33,
-                        5, 14, 17, 34,
-                        5, 14, 17, 37,
-                        5, 14, 17, 38,
-                        5, 14, 17, 44,
-                        5, 14, 18, 25,
-                        5, 14, 18, 28,
-                        5, 14, 18, 29,
-                        5, 14, 18, 37,
-                        5, 14, 18, 38,
-                        5, 14, 18, 44,
-                        5, 14, 19, 24,
-                        5, 14, 19, 28,
-                        5, 14, 19, 29,
-                        5, 14, 19, 33,
-                        5, 14, 19, 34,
-                        5, 14, 19, 44,
-                        5, 14, 22, 24,
-                        5, 14, 22, 25,
-                        5, 14, 22, 29,
-                        5, 14, 22, 30,
-                        5, 14, 22, 34,
-                        5, 14, 22, 38,
-                        5, 14, 23, 24,
-                        5, 14, 23, 25,
-                        5, 14, 23, 28,
-                        5, 14, 23, 30,
-                        5, 14, 23, 33,
-                        5, 14, 23, 37,
-                        5, 14, 24, 37,
-                        5, 14, 24, 38,
-                        5, 14, 24, 44,
-                        5, 14, 25, 33,
-                        5, 14, 25, 34,
-                        5, 14, 25, 44,
-                        5, 14, 28, 30,
-                        5, 14, 28, 34,
-                        5, 14, 28, 38,
-                        5, 14, 29, 30,
-                        5, 14, 29, 33,
-                        5, 14, 29, 37,
-                        5, 14, 30, 44,
-                        5, 14, 33, 38,
-                        5, 14, 34, 37,
-                        5, 15, 17, 30,
-                        5, 15, 17, 32,
-                        5, 15, 17, 34,
-                        5, 15, 17, 36,
-                        5, 15, 17, 38,
-                        5, 15, 17, 43,
-                        5, 15, 18, 25,
-                        5, 15, 18, 27,
-                        5, 15, 18, 29,
-                        5, 15, 18, 36,
-                        5, 15, 18, 38,
-                        5, 15, 18, 43,
-                        5, 15, 19, 24,
-                        5, 15, 19, 27,
-                        5, 15, 19, 29,
-                        5, 15, 19, 32,
-                        5, 15, 19, 34,
-                        5, 15, 19, 43,
-                        5, 15, 21, 24,
-                        5, 15, 21, 25,
-                        5, 15, 21, 29,
-                        5, 15, 21, 30,
-                        5, 15, 21, 34,
-                        5, 15, 21, 38,
-                        5, 15, 23, 24,
-                        5, 15, 23, 25,
-                        5, 15, 23, 27,
-                        5, 15, 23, 30,
-                        5, 15, 23, 32,
-                        5, 15, 23, 36,
-                        5, 15, 24, 36,
-                        5, 15, 24, 38,
-                        5, 15, 24, 43,
-                        5, 15, 25, 32,
-                        5, 15, 25, 34,
-                        5, 15, 25, 43,
-                        5, 15, 27, 30,
-                        5, 15, 27, 34,
-                        5, 15, 27, 38,
-                        5, 15, 29, 30,
-                        5, 15, 29, 32,
-                        5, 15, 29, 36,
-                        5, 15, 30, 43,
-                        5, 15, 32, 38,
-                        5, 15, 34, 36,
-                        5, 16, 17, 30,
-                        5, 16, 17, 32,
-                        5, 16, 17, 33,
-                        5, 16, 17, 36,
-                        5, 16, 17, 37,
-                        5, 16, 17, 42,
-                        5, 16, 18, 25,
-                        5, 16, 18, 27,
-                        5, 16, 18, 28,
-                        5, 16, 18, 36,
-                        5, 16, 18, 37,
-                        5, 16, 18, 42,
-                        5, 16, 19, 24,
-                        5, 16, 19, 27,
-                        5, 16, 19, 28,
-                        5, 16, 19, 32,
-                        5, 16, 19, 33,
-                        5, 16, 19, 42,
-                        5, 16, 21, 24,
-                        5, 16, 21, 25,
-                        5, 16, 21, 28,
-                        5, 16, 21, 30,
-                        5, 16, 21, 33,
-                        5, 16, 21, 37,
-                        5, 16, 22, 24,
-                        5, 16, 22, 25,
-                        5, 16, 22, 27,
-                        5, 16, 22, 30,
-                        5, 16, 22, 32,
-                        5, 16, 22, 36,
-                        5, 16, 24, 36,
-                        5, 16, 24, 37,
-                        5, 16, 24, 42,
-                        5, 16, 25, 32,
-                        5, 16, 25, 33,
-                        5, 16, 25, 42,
-                        5, 16, 27, 30,
-                        5, 16, 27, 33,
-                        5, 16, 27, 37,
-                        5, 16, 28, 30,
-                        5, 16, 28, 32,
-                        5, 16, 28, 36,
-                        5, 16, 30, 42,
-                        5, 16, 32, 37,
-                        5, 16, 33, 36,
-                        5, 17, 30, 42,
-                        5, 17, 30, 43,
-                        5, 17, 30, 44,
-                        5, 17, 32, 37,
-                        5, 17, 32, 38,
-                        5, 17, 32, 44,
-                        5, 17, 33, 36,
-                        5, 17, 33, 38,
-                        5, 17, 33, 43,
-                        5, 17, 34, 36,
-                        5, 17, 34, 37,
-                        5, 17, 34, 42,
-                        5, 17, 36, 44,
-                        5, 17, 37, 43,
-                        5, 17, 38, 42,
-                        5, 18, 25, 42,
-                        5, 18, 25, 43,
-                        5, 18, 25, 44,
-                        5, 18, 27, 37,
-                        5, 18, 27, 38,
-                        5, 18, 27, 44,
-                        5, 18, 28, 36,
-                        5, 18, 28, 38,
-                        5, 18, 28, 43,
-                        5, 18, 29, 36,
-                        5, 18, 29, 37,
-                        5, 18, 29, 42,
-                        5, 18, 36, 44,
-                        5, 18, 37, 43,
-                        5, 18, 38, 42,
-                        5, 19, 24, 42,
-                        5, 19, 24, 43,
-                        5, 19, 24, 44,
-                        5, 19, 27, 33,
-                        5, 19, 27, 34,
-                        5, 19, 27, 44,
-                        5, 19, 28, 32,
-                        5, 19, 28, 34,
-                        5, 19, 28, 43,
-                        5, 19, 29, 32,
-                        5, 19, 29, 33,
-                        5, 19, 29, 42,
-                        5, 19, 32, 44,
-                        5, 19, 33, 43,
-                        5, 19, 34, 42,
-                        5, 21, 24, 37,
-                        5, 21, 24, 38,
-                        5, 21, 24, 44,
-                        5, 21, 25, 33,
-                        5, 21, 25, 34,
-                        5, 21, 25, 44,
-                        5, 21, 28, 30,
-                        5, 21, 28, 34,
-                        5, 21, 28, 38,
-                        5, 21, 29, 30,
-                        5, 21, 29, 33,
-                        5, 21, 29, 37,
-                        5, 21, 30, 44,
-                        5, 21, 33, 38,
-                        5, 21, 34, 37,
-                        5, 22, 24, 36,
-                        5, 22, 24, 38,
-                        5, 22, 24, 43,
-                        5, 22, 25, 32,
-                        5, 22, 25, 34,
-                        5, 22, 25, 43,
-                        5, 22, 27, 30,
-                        5, 22, 27, 34,
-                        5, 22, 27, 38,
-                        5, 22, 29, 30,
-                        5, 22, 29, 32,
-                        5, 22, 29, 36,
-                        5, 22, 30, 43,
-                        5, 22, 32, 38,
-                        5, 22, 34, 36,
-                        5, 23, 24, 36,
-                        5, 23, 24, 37,
-                        5, 23, 24, 42,
-                        5, 23, 25, 32,
-                        5, 23, 25, 33,
-                        5, 23, 25, 42,
-                        5, 23, 27, 30,
-                        5, 23, 27, 33,
-                        5, 23, 27, 37,
-                        5, 23, 28, 30,
-                        5, 23, 28, 32,
-                        5, 23, 28, 36,
-                        5, 23, 30, 42,
-                        5, 23, 32, 37,
-                        5, 23, 33, 36,
-                        5, 24, 36, 44,
-                        5, 24, 37, 43,
-                        5, 24, 38, 42,
-                        5, 25, 32, 44,
-                        5, 25, 33, 43,
-                        5, 25, 34, 42,
-                        5, 27, 30, 44,
-                        5, 27, 33, 38,
-                        5, 27, 34, 37,
-                        5, 28, 30, 43,
-                        5, 28, 32, 38,
-                        5, 28, 34, 36,
-                        5, 29, 30, 42,
-                        5, 29, 32, 37,
-                        5, 29, 33, 36,
-                        6, 9, 24, 35,
-                        6, 9, 24, 37,
-                        6, 9, 24, 38,
-                        6, 9, 24, 40,
-                        6, 9, 24, 41,
-                        6, 9, 24, 44,
-                        6, 9, 25, 31,
-                        6, 9, 25, 33,
-                        6, 9, 25, 34,
-                        6, 9, 25, 40,
-                        6, 9, 25, 41,
-                        6, 9, 25, 44,
-                        6, 9, 26, 30,
-                        6, 9, 26, 33,
-                        6, 9, 26, 34,
-                        6, 9, 26, 37,
-                        6, 9, 26, 38,
-                        6, 9, 26, 44,
-                        6, 9, 28, 30,
-                        6, 9, 28, 31,
-                        6, 9, 28, 34,
-                        6, 9, 28, 35,
-                        6, 9, 28, 38,
-                        6, 9, 28, 41,
-                        6, 9, 29, 30,
-                        6, 9, 29, 31,
-                        6, 9, 29, 33,
-                        6, 9, 29, 35,
-                        6, 9, 29, 37,
-                        6, 9, 29, 40,
-                        6, 9, 30, 40,
-                        6, 9, 30, 41,
-                        6, 9, 30, 44,
-                        6, 9, 31, 37,
-                        6, 9, 31, 38,
-                        6, 9, 31, 44,
-                        6, 9, 33, 35,
-                        6, 9, 33, 38,
-                        6, 9, 33, 41,
-                        6, 9, 34, 35,
-                        6, 9, 34, 37,
-                        6, 9, 34, 40,
-                        6, 9, 35, 44,
-                        6, 9, 37, 41,
-                        6, 9, 38, 40,
-                        6, 10, 18, 35,
-                        6, 10, 18, 37,
-                        6, 10, 18, 38,
-                        6, 10, 18, 40,
-                        6, 10, 18, 41,
-                        6, 10, 18, 44,
-                        6, 10, 19, 31,
-                        6, 10, 19, 33,
-                        6, 10, 19, 34,
-                        6, 10, 19, 40,
-                        6, 10, 19, 41,
-                        6, 10, 19, 44,
-                        6, 10, 20, 30,
-                        6, 10, 20, 33,
-                        6, 10, 20, 34,
-                        6, 10, 20, 37,
-                        6, 10, 20, 38,
-                        6, 10, 20, 44,
-                        6, 10, 22, 30,
-                        6, 10, 22, 31,
-                        6, 10, 22, 34,
-                        6, 10, 22, 35,
-                        6, 10, 22, 38,
-                        6, 10, 22, 41,
-                        6, 10, 23, 30,
-                        6, 10, 23, 31,
-                        6, 10, 23, 33,
-                        6, 10, 23, 35,
-                        6, 10, 23, 37,
-                        6, 10, 23, 40,
-                        6, 10, 30, 40,
-                        6, 10, 30, 41,
-                        6, 10, 30, 44,
-                        6, 10, 31, 37,
-                        6, 10, 31, 38,
-                        6, 10, 31, 44,
-                        6, 10, 33, 35,
-                        6, 10, 33, 38,
-                        6, 10, 33, 41,
-                        6, 10, 34, 35,
-                        6, 10, 34, 37,
-                        6, 10, 34, 40,
-                        6, 10, 35, 44,
-                        6, 10, 37, 41,
-                        6, 10, 38, 40,
-                        6, 11, 17, 35,
-                        6, 11, 17, 37,
-                        6, 11, 17, 38,
-                        6, 11, 17, 40,
-                        6, 11, 17, 41,
-                        6, 11, 17, 44,
-                        6, 11, 19, 26,
-                        6, 11, 19, 28,
-                        6, 11, 19, 29,
-                        6, 11, 19, 40,
-                        6, 11, 19, 41,
-                        6, 11, 19, 44,
-                        6, 11, 20, 25,
-                        6, 11, 20, 28,
-                        6, 11, 20, 29,
-                        6, 11, 20, 37,
-                        6, 11, 20, 38,
-                        6, 11, 20, 44,
-                        6, 11, 22, 25,
-                        6, 11, 22, 26,
-                        6, 11, 22, 29,
-                        6, 11, 22, 35,
-                        6, 11, 22, 38,
-                        6, 11, 22, 41,
-                        6, 11, 23, 25,
-                        6, 11, 23, 26,
-                        6, 11, 23, 28,
-                        6, 11, 23, 35,
-                        6, 11, 23, 37,
-                        6, 11, 23, 40,
-                        6, 11, 25, 40,
-                        6, 11, 25, 41,
-                        6, 11, 25, 44,
-                        6, 11, 26, 37,
-                        6, 11, 26, 38,
-                        6, 11, 26, 44,
-                        6, 11, 28, 35,
-                        6, 11, 28, 38,
-                        6, 11, 28, 41,
-                        6, 11, 29, 35,
-                        6, 11, 29, 37,
-                        6, 11, 29, 40,
-                        6, 11, 35, 44,
-                        6, 11, 37, 41,
-                        6, 11, 38, 40,
-                        6, 12, 17, 31,
-                        6, 12, 17, 33,
-                        6, 12, 17, 34,
-                        6, 12, 17, 40,
-                        6, 12, 17, 41,
-                        6, 12, 17, 44,
-                        6, 12, 18, 26,
-                        6, 12, 18, 28,
-                        6, 12, 18, 29,
-                        6, 12, 18, 40,
-                        6, 12, 18, 41,
-                        6, 12, 18, 44,
-                        6, 12, 20, 24,
-                        6, 12, 20, 28,
-                        6, 12, 20, 29,
-                        6, 12, 20, 33,
-                        6, 12, 20, 34,
-                        6, 12, 20, 44,
-                        6, 12, 22, 24,
-                        6, 12, 22, 26,
-                        6, 12, 22, 29,
-                        6, 12, 22, 31,
-                        6, 12, 22, 34,
-                        6, 12, 22, 41,
-                        6, 12, 23, 24,
-                        6, 12, 23, 26,
-                        6, 12, 23, 28,
-                        6, 12, 23, 31,
-                        6, 12, 23, 33,
-                        6, 12, 23, 40,
-                        6, 12, 24, 40,
-                        6, 12, 24, 41,
-                        6, 12, 24, 44,
-                        6, 12, 26, 33,
-                        6, 12, 26, 34,
-                        6, 12, 26, 44,
-                        6, 12, 28, 31,
-                        6, 12, 28, 34,
-                        6, 12, 28, 41,
-                        6, 12, 29, 31,
-                        6, 12, 29, 33,
-                        6, 12, 29, 40,
-                        6, 12, 31, 44,
-                        6, 12, 33, 41,
-                        6, 12, 34, 40,
-                        6, 13, 17, 30,
-                        6, 13, 17, 33,
-                        6, 13, 17, 34,
-                        6, 13, 17, 37,
-                        6, 13, 17, 38,
-                        6, 13, 17, 44,
-                        6, 13, 18, 25,
-                        6, 13, 18, 28,
-                        6, 13, 18, 29,
-                        6, 13, 18, 37,
-                        6, 13, 18, 38,
-                        6, 13, 18, 44,
-                        6, 13, 19, 24,
-                        6, 13, 19, 28,
-                        6, 13, 19, 29,
-                        6, 13, 19, 33,
-                        6, 13, 19, 34,
-                        6, 13, 19, 44,
-                        6, 13, 22, 24,
-                        6, 13, 22, 25,
-                        6, 13, 22, 29,
-                        6, 13, 22, 30,
-                        6, 13, 22, 34,
-                        6, 13, 22, 38,
-                        6, 13, 23, 24,
-                        6, 13, 23, 25,
-                        6, 13, 23, 28,
-                        6, 13, 23, 30,
-                        6, 13, 23, 33,
-                        6, 13, 23, 37,
-                        6, 13, 24, 37,
-                        6, 13, 24, 38,
-                        6, 13, 24, 44,
-                        6, 13, 25, 33,
-                        6, 13, 25, 34,
-                        6, 13, 25, 44,
-                        6, 13, 28, 30,
-                        6, 13, 28, 34,
-                        6, 13, 28, 38,
-                        6, 13, 29, 30,
-                        6, 13, 29, 33,
-                        6, 13, 29, 37,
-                        6, 13, 30, 44,
-                        6, 13, 33, 38,
-                        6, 13, 34, 37,
-                        6, 15, 17, 30,
-                        6, 15, 17, 31,
-                        6, 15, 17, 34,
-                        6, 15, 17, 35,
-                        6, 15, 17, 38,
-                        6, 15, 17, 41,
-                        6, 15, 18, 25,
-                        6, 15, 18, 26,
-                        6, 15, 18, 29,
-                        6, 15, 18, 35,
-                        6, 15, 18, 38,
-                        6, 15, 18, 41,
-                        6, 15, 19, 24,
-                        6, 15, 19, 26,
-                        6, 15, 19, 29,
-                        6, 15, 19, 31,
-                        6, 15, 19, 34,
-                        6, 15, 19, 41,
-                        6, 15, 20, 24,
-                        6, 15, 20, 25,
-                        6, 15, 20, 29,
-                        6, 15, 20, 30,
-                        6, 15, 20, 34,
-                        6, 15, 20, 38,
-                        6, 15, 23, 24,
-                        6, 15, 23, 25,
-                        6, 15, 23, 26,
-                        6, 15, 23, 30,
-                        6, 15, 23, 31,
-                        6, 15, 23, 35,
-                        6, 15, 24, 35,
-                        6, 15, 24, 38,
-                        6, 15, 24, 41,
-                        6, 15, 25, 31,
-                        6, 15, 25, 34,
-                        6, 15, 25, 41,
-                        6, 15, 26, 30,
-                        6, 15, 26, 34,
-                        6, 15, 26, 38,
-                        6, 15, 29, 30,
-                        6, 15, 29, 31,
-                        6, 15, 29, 35,
-                        6, 15, 30, 41,
-                        6, 15, 31, 38,
-                        6, 15, 34, 35,
-                        6, 16, 17, 30,
-                        6, 16, 17, 31,
-                        6, 16, 17, 33,
-                        6, 16, 17, 35,
-                        6, 16, 17, 37,
-                        6, 16, 17, 40,
-                        6, 16, 18, 25,
-                        6, 16, 18, 26,
-                        6, 16, 18, 28,
-                        6, 16, 18, 35,
-                        6, 16, 18, 37,
-                        6, 16, 18, 40,
-                        6, 16, 19, 24,
-                        6, 16, 19, 26,
-                        6, 16, 19, 28,
-                        6, 16, 19, 31,
-                        6, 16, 19, 33,
-                        6, 16, 19, 40,
-                        6, 16, 20, 24,
-                        6, 16, 20, 25,
-                        6, 16, 20, 28,
-                        6, 16, 20, 30,
-                        6, 16, 20, 33,
-                        6, 16, 20, 37,
-                        6, 16, 22, 24,
-                        6, 16, 22, 25,
-                        6, 16, 22, 26,
-                        6, 16, 22, 30,
-                        6, 16, 22, 31,
-                        6, 16, 22, 35,
-                        6, 16, 24, 35,
-                        6, 16, 24, 37,
-                        6, 16, 24, 40,
-                        6, 16, 25, 31,
-                        6, 16, 25, 33,
-                        6, 16, 25, 40,
-                        6, 16, 26, 30,
-                        6, 16, 26, 33,
-                        6, 16, 26, 37,
-                        6, 16, 28, 30,
-                        6, 16, 28, 31,
-                        6, 16, 28, 35,
-                        6, 16, 30, 40,
-                        6, 16, 31, 37,
-                        6, 16, 33, 35,
-                        6, 17, 30, 40,
-                        6, 17, 30, 41,
-                        6, 17, 30, 44,
-                        6, 17, 31, 37,
-                        6, 17, 31, 38,
-                        6, 17, 31, 44,
-                        6, 17, 33, 35,
-                        6, 17, 33, 38,
-                        6, 17, 33, 41,
-                        6, 17, 34, 35,
-                        6, 17, 34, 37,
-                        6, 17, 34, 40,
-                        6, 17, 35, 44,
-                        6, 17, 37, 41,
-                        6, 17, 38, 40,
-                        6, 18, 25, 40,
-                        6, 18, 25, 41,
-                        6, 18, 25, 44,
-                        6, 18, 26, 37,
-                        6, 18, 26, 38,
-                        6, 18, 26, 44,
-                        6, 18, 28, 35,
-                        6, 18, 28, 38,
-                        6, 18, 28, 41,
-                        6, 18, 29, 35,
-                        6, 18, 29, 37,
-                        6, 18, 29, 40,
-                        6, 18, 35, 44,
-                        6, 18, 37, 41,
-                        6, 18, 38, 40,
-                        6, 19, 24, 40,
-                        6, 19, 24, 41,
-                        6, 19, 24, 44,
-                        6, 19, 26, 33,
-                        6, 19, 26, 34,
-                        6, 19, 26, 44,
-                        6, 19, 28, 31,
-                        6, 19, 28, 34,
-                        6, 19, 28, 41,
-                        6, 19, 29, 31,
-                        6, 19, 29, 33,
-                        6, 19, 29, 40,
-                        6, 19, 31, 44,
-                        6, 19, 33, 41,
-                        6, 19, 34, 40,
-                        6, 20, 24, 37,
-                        6, 20, 24, 38,
-                        6, 20, 24, 44,
-                        6, 20, 25, 33,
-                        6, 20, 25, 34,
-                        6, 20, 25, 44,
-                        6, 20, 28, 30,
-                        6, 20, 28, 34,
-                        6, 20, 28, 38,
-                        6, 20, 29, 30,
-                        6, 20, 29, 33,
-                        6, 20, 29, 37,
-                        6, 20, 30, 44,
-                        6, 20, 33, 38,
-                        6, 20, 34, 37,
-                        6, 22, 24, 35,
-                        6, 22, 24, 38,
-                        6, 22, 24, 41,
-                        6, 22, 25, 31,
-                        6, 22, 25, 34,
-                        6, 22, 25, 41,
-                        6, 22, 26, 30,
-                        6, 22, 26, 34,
-                        6, 22, 26, 38,
-                        6, 22, 29, 30,
-                        6, 22, 29, 31,
-                        6, 22, 29, 35,
-                        6, 22, 30, 41,
-                        6, 22, 31, 38,
-                        6, 22, 34, 35,
-                        6, 23, 24, 35,
-                        6, 23, 24, 37,
-                        6, 23, 24, 40,
-                        6, 23, 25, 31,
-                        6, 23, 25, 33,
-                        6, 23, 25, 40,
-                        6, 23, 26, 30,
-                        6, 23, 26, 33,
-                        6, 23, 26, 37,
-                        6, 23, 28, 30,
-                        6, 23, 28, 31,
-                        6, 23, 28, 35,
-                        6, 23, 30, 40,
-                        6, 23, 31, 37,
-                        6, 23, 33, 35,
-                        6, 24, 35, 44,
-                        6, 24, 37, 41,
-                        6, 24, 38, 40,
-                        6, 25, 31, 44,
-                        6, 25, 33, 41,
-                        6, 25, 34, 40,
-                        6, 26, 30, 44,
-                        6, 26, 33, 38,
-                        6, 26, 34, 37,
-                        6, 28, 30, 41,
-                        6, 28, 31, 38,
-                        6, 28, 34, 35,
-                        6, 29, 30, 40,
-                        6, 29, 31, 37,
-                        6, 29, 33, 35,
-                        7, 9, 24, 35,
-                        7, 9, 24, 36,
-                        7, 9, 24, 38,
-                        7, 9, 24, 39,
-                        7, 9, 24, 41,
-                        7, 9, 24, 43,
-                        7, 9, 25, 31,
-                        7, 9, 25, 32,
-                        7, 9, 25, 34,
-                        7, 9, 25, 39,
-                        7, 9, 25, 41,
-                        7, 9, 25, 43,
-                        7, 9, 26, 30,
-                        7, 9, 26, 32,
-                        7, 9, 26, 34,
-                        7, 9, 26, 36,
-                        7, 9, 26, 38,
-                        7, 9, 26, 43,
-                        7, 9, 27, 30,
-                        7, 9, 27, 31,
-                        7, 9, 27, 34,
-                        7, 9, 27, 35,
-                        7, 9, 27, 38,
-                        7, 9, 27, 41,
-                        7, 9, 29, 30,
-                        7, 9, 29, 31,
-                        7, 9, 29, 32,
-                        7, 9, 29, 35,
-                        7, 9, 29, 36,
-                        7, 9, 29, 39,
-                        7, 9, 30, 39,
-                        7, 9, 30, 41,
-                        7, 9, 30, 43,
-                        7, 9, 31, 36,
-                        7, 9, 31, 38,
-                        7, 9, 31, 43,
-                        7, 9, 32, 35,
-                        7, 9, 32, 38,
-                        7, 9, 32, 41,
-                        7, 9, 34, 35,
-                        7, 9, 34, 36,
-                        7, 9, 34, 39,
-                        7, 9, 35, 43,
-                        7, 9, 36, 41,
-                        7, 9, 38, 39,
-                        7, 10, 18, 35,
-                        7, 10, 18, 36,
-                        7, 10, 18, 38,
-                        7, 10, 18, 39,
-                        7, 10, 18, 41,
-                        7, 10, 18, 43,
-                        7, 10, 19, 31,
-                        7, 10, 19, 32,
-                        7, 10, 19, 34,
-                        7, 10, 19, 39,
-                        7, 10, 19, 41,
-                        7, 10, 19, 43,
-                        7, 10, 20, 30,
-                        7, 10, 20, 32,
-                        7, 10, 20, 34,
-                        7, 10, 20, 36,
-                        7, 10, 20, 38,
-                        7, 10, 20, 43,
-                        7, 10, 21, 30,
-                        7, 10, 21, 31,
-                        7, 10, 21, 34,
-                        7, 10, 21, 35,
-                        7, 10, 21, 38,
-                        7, 10, 21, 41,
-                        7, 10, 23, 30,
-                        7, 10, 23, 31,
-                        7, 10, 23, 32,
-                        7, 10, 23, 35,
-                        7, 10, 23, 36,
-                        7, 10, 23, 39,
-                        7, 10, 30, 39,
-                        7, 10, 30, 41,
-                        7, 10, 30, 43,
-                        7, 10, 31, 36,
-                        7, 10, 31, 38,
-                        7, 10, 31, 43,
-                        7, 10, 32, 35,
-                        7, 10, 32, 38,
-                        7, 10, 32, 41,
-                        7, 10, 34, 35,
-                        7, 10, 34, 36,
-                        7, 10, 34, 39,
-                        7, 10, 35, 43,
-                        7, 10, 36, 41,
-                        7, 10, 38, 39,
-                        7, 11, 17, 35,
-                        7, 11, 17, 36,
-                        7, 11, 17, 38,
-                        7, 11, 17, 39,
-                        7, 11, 17, 41,
-                        7, 11, 17, 43,
-                        7, 11, 19, 26,
-                        7, 11, 19, 27,
-                        7, 11, 19, 29,
-                        7, 11, 19, 39,
-                        7, 11, 19, 41,
-                        7, 11, 19, 43,
-                        7, 11, 20, 25,
-                        7, 11, 20, 27,
-                        7, 11, 20, 29,
-                        7, 11, 20, 36,
-                        7, 11, 20, 38,
-                        7, 11, 20, 43,
-                        7, 11, 21, 25,
-                        7, 11, 21, 26,
-                        7, 11, 21, 29,
-                        7, 11, 21, 35,
-                        7, 11, 21, 38,
-                        7, 11, 21, 41,
-                        7, 11, 23, 25,
-                        7, 11, 23, 26,
-                        7, 11, 23, 27,
-                        7, 11, 23, 35,
-                        7, 11, 23, 36,
-                        7, 11, 23, 39,
-                        7, 11, 25, 39,
-                        7, 11, 25, 41,
-                        7, 11, 25, 43,
-                        7, 11, 26, 36,
-                        7, 11, 26, 38,
-                        7, 11, 26, 43,
-                        7, 11, 27, 35,
-                        7, 11, 27, 38,
-                        7, 11, 27, 41,
-                        7, 11, 29, 35,
-                        7, 11, 29, 36,
-                        7, 11, 29, 39,
-                        7, 11, 35, 43,
-                        7, 11, 36, 41,
-                        7, 11, 38, 39,
-                        7, 12, 17, 31,
-                        7, 12, 17, 32,
-                        7, 12, 17, 34,
-                        7, 12, 17, 39,
-                        7, 12, 17, 41,
-                        7, 12, 17, 43,
-                        7, 12, 18, 26,
-                        7, 12, 18, 27,
-                        7, 12, 18, 29,
-                        7, 12, 18, 39,
-                        7, 12, 18, 41,
-                        7, 12, 18, 43,
-                        7, 12, 20, 24,
-                        7, 12, 20, 27,
-                        7, 12, 20, 29,
-                        7, 12, 20, 32,
-                        7, 12, 20, 34,
-                        7, 12, 20, 43,
-                        7, 12, 21, 24,
-                        7, 12, 21, 26,
-                        7, 12, 21, 29,
-                        7, 12, 21, 31,
-                        7, 12, 21, 34,
-                        7, 12, 21, 41,
-                        7, 12, 23, 24,
-                        7, 12, 23, 26,
-                        7, 12, 23, 27,
-                        7, 12, 23, 31,
-                        7, 12, 23, 32,
-                        7, 12, 23, 39,
-                        7, 12, 24, 39,
-                        7, 12, 24, 41,
-                        7, 12, 24, 43,
-                        7, 12, 26, 32,
-                        7, 12, 26, 34,
-                        7, 12, 26, 43,
-                        7, 12, 27, 31,
-                        7, 12, 27, 34,
-                        7, 12, 27, 41,
-                        7, 12, 29, 31,
-                        7, 12, 29, 32,
-                        7, 12, 29, 39,
-                        7, 12, 31, 43,
-                        7, 12, 32, 41,
-                        7, 12, 34, 39,
-                        7, 13, 17, 30,
-                        7, 13, 17, 32,
-                        7, 13, 17, 34,
-                        7, 13, 17, 36,
-                        7, 13, 17, 38,
-                        7, 13, 17, 43,
-                        7, 13, 18, 25,
-                        7, 13, 18, 27,
-                        7, 13, 18, 29,
-                        7, 13, 18, 36,
-                        7, 13, 18, 38,
-                        7, 13, 18, 43,
-                        7, 13, 19, 24,
-                        7, 13, 19, 27,
-                        7, 13, 19, 29,
-                        7, 13, 19, 32,
-                        7, 13, 19, 34,
-                        7, 13, 19, 43,
-                        7, 13, 21, 24,
-                        7, 13, 21, 25,
-                        7, 13, 21, 29,
-                        7, 13, 21, 30,
-                        7, 13, 21, 34,
-                        7, 13, 21, 38,
-                        7, 13, 23, 24,
-                        7, 13, 23, 25,
-                        7, 13, 23, 27,
-                        7, 13, 23, 30,
-                        7, 13, 23, 32,
-                        7, 13, 23, 36,
-                        7, 13, 24, 36,
-                        7, 13, 24, 38,
-                        7, 13, 24, 43,
-                        7, 13, 25, 32,
-                        7, 13, 25, 34,
-                        7, 13, 25, 43,
-                        7, 13, 27, 30,
-                        7, 13, 27, 34,
-                        7, 13, 27, 38,
-                        7, 13, 29, 30,
-                        7, 13, 29, 32,
-                        7, 13, 29, 36,
-                        7, 13, 30, 43,
-                        7, 13, 32, 38,
-                        7, 13, 34, 36,
-                        7, 14, 17, 30,
-                        7, 14, 17, 31,
-                        7, 14, 17, 34,
-                        7, 14, 17, 35,
-                        7, 14, 17, 38,
-                        7, 14, 17, 41,
-                        7, 14, 18, 25,
-                        7, 14, 18, 26,
-                        7, 14, 18, 29,
-                        7, 14, 18, 35,
-                        7, 14, 18, 38,
-                        7, 14, 18, 41,
-                        7, 14, 19, 24,
-                        7, 14, 19, 26,
-                        7, 14, 19, 29,
-                        7, 14, 19, 31,
-                        7, 14, 19, 34,
-                        7, 14, 19, 41,
-                        7, 14, 20, 24,
-                        7, 14, 20, 25,
-                        7, 14, 20, 29,
-                        7, 14, 20, 30,
-                        7, 14, 20, 34,
-                        7, 14, 20, 38,
-                        7, 14, 23, 24,
-                        7, 14, 23, 25,
-                        7, 14, 23, 26,
-                        7, 14, 23, 30,
-                        7, 14, 23, 31,
-                        7, 14, 23, 35,
-                        7, 14, 24, 35,
-                        7, 14, 24, 38,
-                        7, 14, 24, 41,
-                        7, 14, 25, 31,
-                        7, 14, 25, 34,
-                        7, 14, 25, 41,
-                        7, 14, 26, 30,
-                        7, 14, 26, 34,
-                        7, 14, 26, 38,
-                        7, 14, 29, 30,
-                        7, 14, 29, 31,
-                        7, 14, 29, 35,
-                        7, 14, 30, 41,
-                        7, 14, 31, 38,
-                        7, 14, 34, 35,
-                        7, 16, 17, 30,
-                        7, 16, 17, 31,
-                        7, 16, 17, 32,
-                        7, 16, 17, 35,
-                        7, 16, 17, 36,
-                        7, 16, 17, 39,
-                        7, 16, 18, 25,
-                        7, 16, 18, 26,
-                        7, 16, 18, 27,
-                        7, 16, 18, 35,
-                        7, 16, 18, 36,
-                        7, 16, 18, 39,
-                        7, 16, 19, 24,
-                        7, 16, 19, 26,
-                        7, 16, 19, 27,
-                        7, 16, 19, 31,
-                        7, 16, 19, 32,
-                        7, 16, 19, 39,
-                        7, 16, 20, 24,
-                        7, 16, 20, 25,
-                        7, 16, 20, 27,
-                        7, 16, 20, 30,
-                        7, 16, 20, 32,
-                        7, 16, 20, 36,
-                        7, 16, 21, 24,
-                        7, 16, 21, 25,
-                        7, 16, 21, 26,
-                        7, 16, 21, 30,
-                        7, 16, 21, 31,
-                        7, 16, 21, 35,
-                        7, 16, 24, 35,
-                        7, 16, 24, 36,
-                        7, 16, 24, 39,
-                        7, 16, 25, 31,
-                        7, 16, 25, 32,
-                        7, 16, 25, 39,
-                        7, 16, 26, 30,
-                        7, 16, 26, 32,
-                        7, 16, 26, 36,
-                        7, 16, 27, 30,
-                        7, 16, 27, 31,
-                        7, 16, 27, 35,
-                        7, 16, 30, 39,
-                        7, 16, 31, 36,
-                        7, 16, 32, 35,
-                        7, 17, 30, 39,
-                        7, 17, 30, 41,
-                        7, 17, 30, 43,
-                        7, 17, 31, 36,
-                        7, 17, 31, 38,
-                        7, 17, 31, 43,
-                        7, 17, 32, 35,
-                        7, 17, 32, 38,
-                        7, 17, 32, 41,
-                        7, 17, 34, 35,
-                        7, 17, 34, 36,
-                        7, 17, 34, 39,
-                        7, 17, 35, 43,
-                        7, 17, 36, 41,
-                        7, 17, 38, 39,
-                        7, 18, 25, 39,
-                        7, 18, 25, 41,
-                        7, 18, 25, 43,
-                        7, 18, 26, 36,
-                        7, 18, 26, 38,
-                        7, 18, 26, 43,
-                        7, 18, 27, 35,
-                        7, 18, 27, 38,
-                        7, 18, 27, 41,
-                        7, 18, 29, 35,
-                        7, 18, 29, 36,
-                        7, 18, 29, 39,
-                        7, 18, 35, 43,
-                        7, 18, 36, 41,
-                        7, 18, 38, 39,
-                        7, 19, 24, 39,
-                        7, 19, 24, 41,
-                        7, 19, 24, 43,
-                        7, 19, 26, 32,
-                        7, 19, 26, 34,
-                        7, 19, 26, 43,
-                        7, 19, 27, 31,
-                        7, 19, 27, 34,
-                        7, 19, 27, 41,
-                        7, 19, 29, 31,
-                        7, 19, 29, 32,
-                        7, 19, 29, 39,
-                        7, 19, 31, 43,
-                        7, 19, 32, 41,
-                        7, 19, 34, 39,
-                        7, 20, 24, 36,
-                        7, 20, 24, 38,
-                        7, 20, 24, 43,
-                        7, 20, 25, 32,
-                        7, 20, 25, 34,
-                        7, 20, 25, 43,
-                        7, 20, 27, 30,
-                        7, 20, 27, 34,
-                        7, 20, 27, 38,
-                        7, 20, 29, 30,
-                        7, 20, 29, 32,
-                        7, 20, 29, 36,
-                        7, 20, 30, 43,
-                        7, 20, 32, 38,
-                        7, 20, 34, 36,
-                        7, 21, 24, 35,
-                        7, 21, 24, 38,
-                        7, 21, 24, 41,
-                        7, 21, 25, 31,
-                        7, 21, 25, 34,
-                        7, 21, 25, 41,
-                        7, 21, 26, 30,
-                        7, 21, 26, 34,
-                        7, 21, 26, 38,
-                        7, 21, 29, 30,
-                        7, 21, 29, 31,
-                        7, 21, 29, 35,
-                        7, 21, 30, 41,
-                        7, 21, 31, 38,
-                        7, 21, 34, 35,
-                        7, 23, 24, 35,
-                        7, 23, 24, 36,
-                        7, 23, 24, 39,
-                        7, 23, 25, 31,
-                        7, 23, 25, 32,
-                        7, 23, 25, 39,
-                        7, 23, 26, 30,
-                        7, 23, 26, 32,
-                        7, 23, 26, 36,
-                        7, 23, 27, 30,
-                        7, 23, 27, 31,
-                        7, 23, 27, 35,
-                        7, 23, 30, 39,
-                        7, 23, 31, 36,
-                        7, 23, 32, 35,
-                        7, 24, 35, 43,
-                        7, 24, 36, 41,
-                        7, 24, 38, 39,
-                        7, 25, 31, 43,
-                        7, 25, 32, 41,
-                        7, 25, 34, 39,
-                        7, 26, 30, 43,
-                        7, 26, 32, 38,
-                        7, 26, 34, 36,
-                        7, 27, 30, 41,
-                        7, 27, 31, 38,
-                        7, 27, 34, 35,
-                        7, 29, 30, 39,
-                        7, 29, 31, 36,
-                        7, 29, 32, 35,
-                        8, 9, 24, 35,
-                        8, 9, 24, 36,
-                        8, 9, 24, 37,
-                        8, 9, 24, 39,
-                        8, 9, 24, 40,
-                        8, 9, 24, 42,
-                        8, 9, 25, 31,
-                        8, 9, 25, 32,
-                        8, 9, 25, 33,
-                        8, 9, 25, 39,
-                        8, 9, 25, 40,
-                        8, 9, 25, 42,
-                        8, 9, 26, 30,
-                        8, 9, 26, 32,
-                        8, 9, 26, 33,
-                        8, 9, 26, 36,
-                        8, 9, 26, 37,
-                        8, 9, 26, 42,
-                        8, 9, 27, 30,
-                        8, 9, 27, 31,
-                        8, 9, 27, 33,
-                        8, 9, 27, 35,
-                        8, 9, 27, 37,
-                        8, 9, 27, 40,
-                        8, 9, 28, 30,
-                        8, 9, 28, 31,
-                        8, 9, 28, 32,
-                        8, 9, 28, 35,
-                        8, 9, 28, 36,
-                        8, 9, 28, 39,
-                        8, 9, 30, 39,
-                        8, 9, 30, 40,
-                        8, 9, 30, 42,
-                        8, 9, 31, 36,
-                        8, 9, 31, 37,
-                        8, 9, 31, 42,
-                        8, 9, 32, 35,
-                        8, 9, 32, 37,
-                        8, 9, 32, 40,
-                        8, 9, 33, 35,
-                        8, 9, 33, 36,
-                        8, 9, 33, 39,
-                        8, 9, 35, 42,
-                        8, 9, 36, 40,
-                        8, 9, 37, 39,
-                        8, 10, 18, 35,
-                        8, 10, 18, 36,
-                        8, 10, 18, 37,
-                        8, 10, 18, 39,
-                        8, 10, 18, 40,
-                        8, 10, 18, 42,
-                        8, 10, 19, 31,
-                        8, 10, 19, 32,
-                        8, 10, 19, 33,
-                        8, 10, 19, 39,
-                        8, 10, 19, 40,
-                        8, 10, 19, 42,
-                        8, 10, 20, 30,
-                        8, 10, 20, 32,
-                        8, 10, 20, 33,
-                        8, 10, 20, 36,
-                        8, 10, 20, 37,
-                        8, 10, 20, 42,
-                        8, 10, 21, 30,
-                        8, 10, 21, 31,
-                        8, 10, 21, 33,
-                        8, 10, 21, 35,
-                        8, 10, 21, 37,
-                        8, 10, 21, 40,
-                        8, 10, 22, 30,
-                        8, 10, 22, 31,
-                        8, 10, 22, 32,
-                        8, 10, 22, 35,
-                        8, 10, 22, 36,
-                        8, 10, 22, 39,
-                        8, 10, 30, 39,
-                        8, 10, 30, 40,
-                        8, 10, 30, 42,
-                        8, 10, 31, 36,
-                        8, 10, 31, 37,
-                        8, 10, 31, 42,
-                        8, 10, 32, 35,
-                        8, 10, 32, 37,
-                        8, 10, 32, 40,
-                        8, 10, 33, 35,
-                        8, 10, 33, 36,
-                        8, 10, 33, 39,
-                        8, 10, 35, 42,
-                        8, 10, 36, 40,
-                        8, 10, 37, 39,
-                        8, 11, 17, 35,
-                        8, 11, 17, 36,
-                        8, 11, 17, 37,
-                        8, 11, 17, 39,
-                        8, 11, 17, 40,
-                        8, 11, 17, 42,
-                        8, 11, 19, 26,
-                        8, 11, 19, 27,
-                        8, 11, 19, 28,
-                        8, 11, 19, 39,
-                        8, 11, 19, 40,
-                        8, 11, 19, 42,
-                        8, 11, 20, 25,
-                        8, 11, 20, 27,
-                        8, 11, 20, 28,
-                        8, 11, 20, 36,
-                        8, 11, 20, 37,
-                        8, 11, 20, 42,
-                        8, 11, 21, 25,
-                        8, 11, 21, 26,
-                        8, 11, 21, 28,
-                        8, 11, 21, 35,
-                        8, 11, 21, 37,
-                        8, 11, 21, 40,
-                        8, 11, 22, 25,
-                        8, 11, 22, 26,
-                        8, 11, 22, 27,
-                        8, 11, 22, 35,
-                        8, 11, 22, 36,
-                        8, 11, 22, 39,
-                        8, 11, 25, 39,
-                        8, 11, 25, 40,
-                        8, 11, 25, 42,
-                        8, 11, 26, 36,
-                        8, 11, 26, 37,
-                        8, 11, 26, 42,
-                        8, 11, 27, 35,
-                        8, 11, 27, 37,
-                        8, 11, 27, 40,
-                        8, 11, 28, 35,
-                        8, 11, 28, 36,
-                        8, 11, 28, 39,
-                        8, 11, 35, 42,
-                        8, 11, 36, 40,
-                        8, 11, 37, 39,
-                        8, 12, 17, 31,
-                        8, 12, 17, 32,
-                        8, 12, 17, 33,
-                        8, 12, 17, 39,
-                        8, 12, 17, 40,
-                        8, 12, 17, 42,
-                        8, 12, 18, 26,
-                        8, 12, 18, 27,
-                        8, 12, 18, 28,
-                        8, 12, 18, 39,
-                        8, 12, 18, 40,
-                        8, 12, 18, 42,
-                        8, 12, 20, 24,
-                        8, 12, 20, 27,
-                        8, 12, 20, 28,
-                        8, 12, 20, 32,
-                        8, 12, 20, 33,
-                        8, 12, 20, 42,
-                        8, 12, 21, 24,
-                        8, 12, 21, 26,
-                        8, 12, 21, 28,
-                        8, 12, 21, 31,
-                        8, 12, 21, 33,
-                        8, 12, 21, 40,
-                        8, 12, 22, 24,
-                        8, 12, 22, 26,
-                        8, 12, 22, 27,
-                        8, 12, 22, 31,
-                        8, 12, 22, 32,
-                        8, 12, 22, 39,
-                        8, 12, 24, 39,
-                        8, 12, 24, 40,
-                        8, 12, 24, 42,
-                        8, 12, 26, 32,
-                        8, 12, 26, 33,
-                        8, 12, 26, 42,
-                        8, 12, 27, 31,
-                        8, 12, 27, 33,
-                        8, 12, 27, 40,
-                        8, 12, 28, 31,
-                        8, 12, 28, 32,
-                        8, 12, 28, 39,
-                        8, 12, 31, 42,
-                        8, 12, 32, 40,
-                        8, 12, 33, 39,
-                        8, 13, 17, 30,
-                        8, 13, 17, 32,
-                        8, 13, 17, 33,
-                        8, 13, 17, 36,
-                        8, 13, 17, 37,
-                        8, 13, 17, 42,
-                        8, 13, 18, 25,
-                        8, 13, 18, 27,
-                        8, 13, 18, 28,
-                        8, 13, 18, 36,
-                        8, 13, 18, 37,
-                        8, 13, 18, 42,
-                        8, 13, 19, 24,
-                        8, 13, 19, 27,
-                        8, 13, 19, 28,
-                        8, 13, 19, 32,
-                        8, 13, 19, 33,
-                        8, 13, 19, 42,
-                        8, 13, 21, 24,
-                        8, 13, 21, 25,
-                        8, 13, 21, 28,
-                        8, 13, 21, 30,
-                        8, 13, 21, 33,
-                        8, 13, 21, 37,
-                        8, 13, 22, 24,
-                        8, 13, 22, 25,
-                        8, 13, 22, 27,
-                        8, 13, 22, 30,
-                        8, 13, 22, 32,
-                        8, 13, 22, 36,
-                        8, 13, 24, 36,
-                        8, 13, 24, 37,
-                        8, 13, 24, 42,
-                        8, 13, 25, 32,
-                        8, 13, 25, 33,
-                        8, 13, 25, 42,
-                        8, 13, 27, 30,
-                        8, 13, 27, 33,
-                        8, 13, 27, 37,
-                        8, 13, 28, 30,
-                        8, 13, 28, 32,
-                        8, 13, 28, 36,
-                        8, 13, 30, 42,
-                        8, 13, 32, 37,
-                        8, 13, 33, 36,
-                        8, 14, 17, 30,
-                        8, 14, 17, 31,
-                        8, 14, 17, 33,
-                        8, 14, 17, 35,
-                        8, 14, 17, 37,
-                        8, 14, 17, 40,
-                        8, 14, 18, 25,
-                        8, 14, 18, 26,
-                        8, 14, 18, 28,
-                        8, 14, 18, 35,
-                        8, 14, 18, 37,
-                        8, 14, 18, 40,
-                        8, 14, 19, 24,
-                        8, 14, 19, 26,
-                        8, 14, 19, 28,
-                        8, 14, 19, 31,
-                        8, 14, 19, 33,
-                        8, 14, 19, 40,
-                        8, 14, 20, 24,
-                        8, 14, 20, 25,
-                        8, 14, 20, 28,
-                        8, 14, 20, 30,
-                        8, 14, 20, 33,
-                        8, 14, 20, 37,
-                        8, 14, 22, 24,
-                        8, 14, 22, 25,
-                        8, 14, 22, 26,
-                        8, 14, 22, 30,
-                        8, 14, 22, 31,
-                        8, 14, 22, 35,
-                        8, 14, 24, 35,
-                        8, 14, 24, 37,
-                        8, 14, 24, 40,
-                        8, 14, 25, 31,
-                        8, 14, 25, 33,
-                        8, 14, 25, 40,
-                        8, 14, 26, 30,
-                        8, 14, 26, 33,
-                        8, 14, 26, 37,
-                        8, 14, 28, 30,
-                        8, 14, 28, 31,
-                        8, 14, 28, 35,
-                        8, 14, 30, 40,
-                        8, 14, 31, 37,
-                        8, 14, 33, 35,
-                        8, 15, 17, 30,
-                        8, 15, 17, 31,
-                        8, 15, 17, 32,
-                        8, 15, 17, 35,
-                        8, 15, 17, 36,
-                        8, 15, 17, 39,
-                        8, 15, 18, 25,
-                        8, 15, 18, 26,
-                        8, 15, 18, 27,
-                        8, 15, 18, 35,
-                        8, 15, 18, 36,
-                        8, 15, 18, 39,
-                        8, 15, 19, 24,
-                        8, 15, 19, 26,
-                        8, 15, 19, 27,
-                        8, 15, 19, 31,
-                        8, 15, 19, 32,
-                        8, 15, 19, 39,
-                        8, 15, 20, 24,
-                        8, 15, 20, 25,
-                        8, 15, 20, 27,
-                        8, 15, 20, 30,
-                        8, 15, 20, 32,
-                        8, 15, 20, 36,
-                        8, 15, 21, 24,
-                        8, 15, 21, 25,
-                        8, 15, 21, 26,
-                        8, 15, 21, 30,
-                        8, 15, 21, 31,
-                        8, 15, 21, 35,
-                        8, 15, 24, 35,
-                        8, 15, 24, 36,
-                        8, 15, 24, 39,
-                        8, 15, 25, 31,
-                        8, 15, 25, 32,
-                        8, 15, 25, 39,
-                        8, 15, 26, 30,
-                        8, 15, 26, 32,
-                        8, 15, 26, 36,
-                        8, 15, 27, 30,
-                        8, 15, 27, 31,
-                        8, 15, 27, 35,
-                        8, 15, 30, 39,
-                        8, 15, 31, 36,
-                        8, 15, 32, 35,
-                        8, 17, 30, 39,
-                        8, 17, 30, 40,
-                        8, 17, 30, 42,
-                        8, 17, 31, 36,
-                        8, 17, 31, 37,
-                        8, 17, 31, 42,
-                        8, 17, 32, 35,
-                        8, 17, 32, 37,
-                        8, 17, 32, 40,
-                        8, 17, 33, 35,
-                        8, 17, 33, 36,
-                        8, 17, 33, 39,
-                        8, 17, 35, 42,
-                        8, 17, 36, 40,
-                        8, 17, 37, 39,
-                        8, 18, 25, 39,
-                        8, 18, 25, 40,
-                        8, 18, 25, 42,
-                        8, 18, 26, 36,
-                        8, 18, 26, 37,
-                        8, 18, 26, 42,
-                        8, 18, 27, 35,
-                        8, 18, 27, 37,
-                        8, 18, 27, 40,
-                        8, 18, 28, 35,
-                        8, 18, 28, 36,
-                        8, 18, 28, 39,
-                        8, 18, 35, 42,
-                        8, 18, 36, 40,
-                        8, 18, 37, 39,
-                        8, 19, 24, 39,
-                        8, 19, 24, 40,
-                        8, 19, 24, 42,
-                        8, 19, 26, 32,
-                        8, 19, 26, 33,
-                        8, 19, 26, 42,
-                        8, 19, 27, 31,
-                        8, 19, 27, 33,
-                        8, 19, 27, 40,
-                        8, 19, 28, 31,
-                        8, 19, 28, 32,
-                        8, 19, 28, 39,
-                        8, 19, 31, 42,
-                        8, 19, 32, 40,
-                        8, 19, 33, 39,
-                        8, 20, 24, 36,
-                        8, 20, 24, 37,
-                        8, 20, 24, 42,
-                        8, 20, 25, 32,
-                        8, 20, 25, 33,
-                        8, 20, 25, 42,
-                        8, 20, 27, 30,
-                        8, 20, 27, 33,
-                        8, 20, 27, 37,
-                        8, 20, 28, 30,
-                        8, 20, 28, 32,
-                        8, 20, 28, 36,
-                        8, 20, 30, 42,
-                        8, 20, 32, 37,
-                        8, 20, 33, 36,
-                        8, 21, 24, 35,
-                        8, 21, 24, 37,
-                        8, 21, 24, 40,
-                        8, 21, 25, 31,
-                        8, 21, 25, 33,
-                        8, 21, 25, 40,
-                        8, 21, 26, 30,
-                        8, 21, 26, 33,
-                        8, 21, 26, 37,
-                        8, 21, 28, 30,
-                        8, 21, 28, 31,
-                        8, 21, 28, 35,
-                        8, 21, 30, 40,
-                        8, 21, 31, 37,
-                        8, 21, 33, 35,
-                        8, 22, 24, 35,
-                        8, 22, 24, 36,
-                        8, 22, 24, 39,
-                        8, 22, 25, 31,
-                        8, 22, 25, 32,
-                        8, 22, 25, 39,
-                        8, 22, 26, 30,
-                        8, 22, 26, 32,
-                        8, 22, 26, 36,
-                        8, 22, 27, 30,
-                        8, 22, 27, 31,
-                        8, 22, 27, 35,
-                        8, 22, 30, 39,
-                        8, 22, 31, 36,
-                        8, 22, 32, 35,
-                        8, 24, 35, 42,
-                        8, 24, 36, 40,
-                        8, 24, 37, 39,
-                        8, 25, 31, 42,
-                        8, 25, 32, 40,
-                        8, 25, 33, 39,
-                        8, 26, 30, 42,
-                        8, 26, 32, 37,
-                        8, 26, 33, 36,
-                        8, 27, 30, 40,
-                        8, 27, 31, 37,
-                        8, 27, 33, 35,
-                        8, 28, 30, 39,
-                        8, 28, 31, 36,
-                        8, 28, 32, 35,
-                        9, 24, 35, 42,
-                        9, 24, 35, 43,
-                        9, 24, 35, 44,
-                        9, 24, 36, 40,
-                        9, 24, 36, 41,
-                        9, 24, 36, 44,
-                        9, 24, 37, 39,
-                        9, 24, 37, 41,
-                        9, 24, 37, 43,
-                        9, 24, 38, 39,
-                        9, 24, 38, 40,
-                        9, 24, 38, 42,
-                        9, 24, 39, 44,
-                        9, 24, 40, 43,
-                        9, 24, 41, 42,
-                        9, 25, 31, 42,
-                        9, 25, 31, 43,
-                        9, 25, 31, 44,
-                        9, 25, 32, 40,
-                        9, 25, 32, 41,
-                        9, 25, 32, 44,
-                        9, 25, 33, 39,
-                        9, 25, 33, 41,
-                        9, 25, 33, 43,
-                        9, 25, 34, 39,
-                        9, 25, 34, 40,
-                        9, 25, 34, 42,
-                        9, 25, 39, 44,
-                        9, 25, 40, 43,
-                        9, 25, 41, 42,
-                        9, 26, 30, 42,
-                        9, 26, 30, 43,
-                        9, 26, 30, 44,
-                        9, 26, 32, 37,
-                        9, 26, 32, 38,
-                        9, 26, 32, 44,
-                        9, 26, 33, 36,
-                        9, 26, 33, 38,
-                        9, 26, 33, 43,
-                        9, 26, 34, 36,
-                        9, 26, 34, 37,
-                        9, 26, 34, 42,
-                        9, 26, 36, 44,
-                        9, 26, 37, 43,
-                        9, 26, 38, 42,
-                        9, 27, 30, 40,
-                        9, 27, 30, 41,
-                        9, 27, 30, 44,
-                        9, 27, 31, 37,
-                        9, 27, 31, 38,
-                        9, 27, 31, 44,
-                        9, 27, 33, 35,
-                        9, 27, 33, 38,
-                        9, 27, 33, 41,
-                        9, 27, 34, 35,
-                        9, 27, 34, 37,
-                        9, 27, 34, 40,
-                        9, 27, 35, 44,
-                        9, 27, 37, 41,
-                        9, 27, 38, 40,
-                        9, 28, 30, 39,
-                        9, 28, 30, 41,
-                        9, 28, 30, 43,
-                        9, 28, 31, 36,
-                        9, 28, 31, 38,
-                        9, 28, 31, 43,
-                        9, 28, 32, 35,
-                        9, 28, 32, 38,
-                        9, 28, 32, 41,
-                        9, 28, 34, 35,
-                        9, 28, 34, 36,
-                        9, 28, 34, 39,
-                        9, 28, 35, 43,
-                        9, 28, 36, 41,
-                        9, 28, 38, 39,
-                        9, 29, 30, 39,
-                        9, 29, 30, 40,
-                        9, 29, 30, 42,
-                        9, 29, 31, 36,
-                        9, 29, 31, 37,
-                        9, 29, 31, 42,
-                        9, 29, 32, 35,
-                        9, 29, 32, 37,
-                        9, 29, 32, 40,
-                        9, 29, 33, 35,
-                        9, 29, 33, 36,
-                        9, 29, 33, 39,
-                        9, 29, 35, 42,
-                        9, 29, 36, 40,
-                        9, 29, 37, 39,
-                        9, 30, 39, 44,
-                        9, 30, 40, 43,
-                        9, 30, 41, 42,
-                        9, 31, 36, 44,
-                        9, 31, 37, 43,
-                        9, 31, 38, 42,
-                        9, 32, 35, 44,
-                        9, 32, 37, 41,
-                        9, 32, 38, 40,
-                        9, 33, 35, 43,
-                        9, 33, 36, 41,
-                        9, 33, 38, 39,
-                        9, 34, 35, 42,
-                        9, 34, 36, 40,
-                        9, 34, 37, 39,
-                        10, 18, 35, 42,
-                        10, 18, 35, 43,
-                        10, 18, 35, 44,
-                        10, 18, 36, 40,
-                        10, 18, 36, 41,
-                        10, 18, 36, 44,
-                        10, 18, 37, 39,
-                        10, 18, 37, 41,
-                        10, 18, 37, 43,
-                        10, 18, 38, 39,
-                        10, 18, 38, 40,
-                        10, 18, 38, 42,
-                        10, 18, 39, 44,
-                        10, 18, 40, 43,
-                        10, 18, 41, 42,
-                        10, 19, 31, 42,
-                        10, 19, 31, 43,
-                        10, 19, 31, 44,
-                        10, 19, 32, 40,
-                        10, 19, 32, 41,
-                        10, 19, 32, 44,
-                        10, 19, 33, 39,
-                        10, 19, 33, 41,
-                        10, 19, 33, 43,
-                        10, 19, 34, 39,
-                        10, 19, 34, 40,
-                        10, 19, 34, 42,
-                        10, 19, 39, 44,
-                        10, 19, 40, 43,
-                        10, 19, 41, 42,
-                        10, 20, 30, 42,
-                        10, 20, 30, 43,
-                        10, 20, 30, 44,
-                        10, 20, 32, 37,
-                        10, 20, 32, 38,
-                        10, 20, 32, 44,
-                        10, 20, 33, 36,
-                        10, 20, 33, 38,
-                        10, 20, 33, 43,
-                        10, 20, 34, 36,
-                        10, 20, 34, 37,
-                        10, 20, 34, 42,
-                        10, 20, 36, 44,
-                        10, 20, 37, 43,
-                        10, 20, 38, 42,
-                        10, 21, 30, 40,
-                        10, 21, 30, 41,
-                        10, 21, 30, 44,
-                        10, 21, 31, 37,
-                        10, 21, 31, 38,
-                        10, 21, 31, 44,
-                        10, 21, 33, 35,
-                        10, 21, 33, 38,
-                        10, 21, 33, 41,
-                        10, 21, 34, 35,
-                        10, 21, 34, 37,
-                        10, 21, 34, 40,
-                        10, 21, 35, 44,
-                        10, 21, 37, 41,
-                        10, 21, 38, 40,
-                        10, 22, 30, 39,
-                        10, 22, 30, 41,
-                        10, 22, 30, 43,
-                        10, 22, 31, 36,
-                        10, 22, 31, 38,
-                        10, 22, 31, 43,
-                        10, 22, 32, 35,
-                        10, 22, 32, 38,
-                        10, 22, 32, 41,
-                        10, 22, 34, 35,
-                        10, 22, 34, 36,
-                        10, 22, 34, 39,
-                        10, 22, 35, 43,
-                        10, 22, 36, 41,
-                        10, 22, 38, 39,
-                        10, 23, 30, 39,
-                        10, 23, 30, 40,
-                        10, 23, 30, 42,
-                        10, 23, 31, 36,
-                        10, 23, 31, 37,
-                        10, 23, 31, 42,
-                        10, 23, 32, 35,
-                        10, 23, 32, 37,
-                        10, 23, 32, 40,
-                        10, 23, 33, 35,
-                        10, 23, 33, 36,
-                        10, 23, 33, 39,
-                        10, 23, 35, 42,
-                        10, 23, 36, 40,
-                        10, 23, 37, 39,
-                        10, 30, 39, 44,
-                        10, 30, 40, 43,
-                        10, 30, 41, 42,
-                        10, 31, 36, 44,
-                        10, 31, 37, 43,
-                        10, 31, 38, 42,
-                        10, 32, 35, 44,
-                        10, 32, 37, 41,
-                        10, 32, 38, 40,
-                        10, 33, 35, 43,
-                        10, 33, 36, 41,
-                        10, 33, 38, 39,
-                        10, 34, 35, 42,
-                        10, 34, 36, 40,
-                        10, 34, 37, 39,
-                        11, 17, 35, 42,
-                        11, 17, 35, 43,
-                        11, 17, 35, 44,
-                        11, 17, 36, 40,
-                        11, 17, 36, 41,
-                        11, 17, 36, 44,
-                        11, 17, 37, 39,
-                        11, 17, 37, 41,
-                        11, 17, 37, 43,
-                        11, 17, 38, 39,
-                        11, 17, 38, 40,
-                        11, 17, 38, 42,
-                        11, 17, 39, 44,
-                        11, 17, 40, 43,
-                        11, 17, 41, 42,
-                        11, 19, 26, 42,
-                        11, 19, 26, 43,
-                        11, 19, 26, 44,
-                        11, 19, 27, 40,
-                        11, 19, 27, 41,
-                        11, 19, 27, 44,
-                        11, 19, 28, 39,
-                        11, 19, 28, 41,
-                        11, 19, 28, 43,
-                        11, 19, 29, 39,
-                        11, 19, 29, 40,
-                        11, 19, 29, 42,
-                        11, 19, 39, 44,
-                        11, 19, 40, 43,
-                        11, 19, 41, 42,
-                        11, 20, 25, 42,
-                        11, 20, 25, 43,
-                        11, 20, 25, 44,
-                        11, 20, 27, 37,
-                        11, 20, 27, 38,
-                        11, 20, 27, 44,
-                        11, 20, 28, 36,
-                        11, 20, 28, 38,
-                        11, 20, 28, 43,
-                        11, 20, 29, 36,
-                        11, 20, 29, 37,
-                        11, 20, 29, 42,
-                        11, 20, 36, 44,
-                        11, 20, 37, 43,
-                        11, 20, 38, 42,
-                        11, 21, 25, 40,
-                        11, 21, 25, 41,
-                        11, 21, 25, 44,
-                        11, 21, 26, 37,
-                        11, 21, 26, 38,
-                        11, 21, 26, 44,
-                        11, 21, 28, 35,
-                        11, 21, 28, 38,
-                        11, 21, 28, 41,
-                        11, 21, 29, 35,
-                        11, 21, 29, 37,
-                        11, 21, 29, 40,
-                        11, 21, 35, 44,
-                        11, 21, 37, 41,
-                        11, 21, 38, 40,
-                        11, 22, 25, 39,
-                        11, 22, 25, 41,
-                        11, 22, 25, 43,
-                        11, 22, 26, 36,
-                        11, 22, 26, 38,
-                        11, 22, 26, 43,
-                        11, 22, 27, 35,
-                        11, 22, 27, 38,
-                        11, 22, 27, 41,
-                        11, 22, 29, 35,
-                        11, 22, 29, 36,
-                        11, 22, 29, 39,
-                        11, 22, 35, 43,
-                        11, 22, 36, 41,
-                        11, 22, 38, 39,
-                        11, 23, 25, 39,
-                        11, 23, 25, 40,
-                        11, 23, 25, 42,
-                        11, 23, 26, 36,
-                        11, 23, 26, 37,
-                        11, 23, 26, 42,
-                        11, 23, 27, 35,
-                        11, 23, 27, 37,
-                        11, 23, 27, 40,
-                        11, 23, 28, 35,
-                        11, 23, 28, 36,
-                        11, 23, 28, 39,
-                        11, 23, 35, 42,
-                        11, 23, 36, 40,
-                        11, 23, 37, 39,
-                        11, 25, 39, 44,
-                        11, 25, 40, 43,
-                        11, 25, 41, 42,
-                        11, 26, 36, 44,
-                        11, 26, 37, 43,
-                        11, 26, 38, 42,
-                        11, 27, 35, 44,
-                        11, 27, 37, 41,
-                        11, 27, 38, 40,
-                        11, 28, 35, 43,
-                        11, 28, 36, 41,
-                        11, 28, 38, 39,
-                        11, 29, 35, 42,
-                        11, 29, 36, 40,
-                        11, 29, 37, 39,
-                        12, 17, 31, 42,
-                        12, 17, 31, 43,
-                        12, 17, 31, 44,
-                        12, 17, 32, 40,
-                        12, 17, 32, 41,
-                        12, 17, 32, 44,
-                        12, 17, 33, 39,
-                        12, 17, 33, 41,
-                        12, 17, 33, 43,
-                        12, 17, 34, 39,
-                        12, 17, 34, 40,
-                        12, 17, 34, 42,
-                        12, 17, 39, 44,
-                        12, 17, 40, 43,
-                        12, 17, 41, 42,
-                        12, 18, 26, 42,
-                        12, 18, 26, 43,
-                        12, 18, 26, 44,
-                        12, 18, 27, 40,
-                        12, 18, 27, 41,
-                        12, 18, 27, 44,
-                        12, 18, 28, 39,
-                        12, 18, 28, 41,
-                        12, 18, 28, 43,
-                        12, 18, 29, 39,
-                        12, 18, 29, 40,
-                        12, 18, 29, 42,
-                        12, 18, 39, 44,
-                        12, 18, 40, 43,
-                        12, 18, 41, 42,
-                        12, 20, 24, 42,
-                        12, 20, 24, 43,
-                        12, 20, 24, 44,
-                        12, 20, 27, 33,
-                        12, 20, 27, 34,
-                        12, 20, 27, 44,
-                        12, 20, 28, 32,
-                        12, 20, 28, 34,
-                        12, 20, 28, 43,
-                        12, 20, 29, 32,
-                        12, 20, 29, 33,
-                        12, 20, 29, 42,
-                        12, 20, 32, 44,
-                        12, 20, 33, 43,
-                        12, 20, 34, 42,
-                        12, 21, 24, 40,
-                        12, 21, 24, 41,
-                        12, 21, 24, 44,
-                        12, 21, 26, 33,
-                        12, 21, 26, 34,
-                        12, 21, 26, 44,
-                        12, 21, 28, 31,
-                        12, 21, 28, 34,
-                        12, 21, 28, 41,
-                        12, 21, 29, 31,
-                        12, 21, 29, 33,
-                        12, 21, 29, 40,
-                        12, 21, 31, 44,
-                        12, 21, 33, 41,
-                        12, 21, 34, 40,
-                        12, 22, 24, 39,
-                        12, 22, 24, 41,
-                        12, 22, 24, 43,
-                        12, 22, 26, 32,
-                        12, 22, 26, 34,
-                        12, 22, 26, 43,
-                        12, 22, 27, 31,
-                        12, 22, 27, 34,
-                        12, 22, 27, 41,
-                        12, 22, 29, 31,
-                        12, 22, 29, 32,
-                        12, 22, 29, 39,
-                        12, 22, 31, 43,
-                        12, 22, 32, 41,
-                        12, 22, 34, 39,
-                        12, 23, 24, 39,
-                        12, 23, 24, 40,
-                        12, 23, 24, 42,
-                        12, 23, 26, 32,
-                        12, 23, 26, 33,
-                        12, 23, 26, 42,
-                        12, 23, 27, 31,
-                        12, 23, 27, 33,
-                        12, 23, 27, 40,
-                        12, 23, 28, 31,
-                        12, 23, 28, 32,
-                        12, 23, 28, 39,
-                        12, 23, 31, 42,
-                        12, 23, 32, 40,
-                        12, 23, 33, 39,
-                        12, 24, 39, 44,
-                        12, 24, 40, 43,
-                        12, 24, 41, 42,
-                        12, 26, 32, 44,
-                        12, 26, 33, 43,
-                        12, 26, 34, 42,
-                        12, 27, 31, 44,
-                        12, 27, 33, 41,
-                        12, 27, 34, 40,
-                        12, 28, 31, 43,
-                        12, 28, 32, 41,
-                        12, 28, 34, 39,
-                        12, 29, 31, 42,
-                        12, 29, 32, 40,
-                        12, 29, 33, 39,
-                        13, 17, 30, 42,
-                        13, 17, 30, 43,
-                        13, 17, 30, 44,
-                        13, 17, 32, 37,
-                        13, 17, 32, 38,
-                        13, 17, 32, 44,
-                        13, 17, 33, 36,
-                        13, 17, 33, 38,
-                        13, 17, 33, 43,
-                        13, 17, 34, 36,
-                        13, 17, 34, 37,
-                        13, 17, 34, 42,
-                        13, 17, 36, 44,
-                        13, 17, 37, 43,
-                        13, 17, 38, 42,
-                        13, 18, 25, 42,
-                        13, 18, 25, 43,
-                        13, 18, 25, 44,
-                        13, 18, 27, 37,
-                        13, 18, 27, 38,
-                        13, 18, 27, 44,
-                        13, 18, 28, 36,
-                        13, 18, 28, 38,
-                        13, 18, 28, 43,
-                        13, 18, 29, 36,
-                        13, 18, 29, 37,
-                        13, 18, 29, 42,
-                        13, 18, 36, 44,
-                        13, 18, 37, 43,
-                        13, 18, 38, 42,
-                        13, 19, 24, 42,
-                        13, 19, 24, 43,
-                        13, 19, 24, 44,
-                        13, 19, 27, 33,
-                        13, 19, 27, 34,
-                        13, 19, 27, 44,
-                        13, 19, 28, 32,
-                        13, 19, 28, 34,
-                        13, 19, 28, 43,
-                        13, 19, 29, 32,
-                        13, 19, 29, 33,
-                        13, 19, 29, 42,
-                        13, 19, 32, 44,
-                        13, 19, 33, 43,
-                        13, 19, 34, 42,
-                        13, 21, 24, 37,
-                        13, 21, 24, 38,
-                        13, 21, 24, 44,
-                        13, 21, 25, 33,
-                        13, 21, 25, 34,
-                        13, 21, 25, 44,
-                        13, 21, 28, 30,
-                        13, 21, 28, 34,
-                        13, 21, 28, 38,
-                        13, 21, 29, 30,
-                        13, 21, 29, 33,
-                        13, 21, 29, 37,
-                        13, 21, 30, 44,
-                        13, 21, 33, 38,
-                        13, 21, 34, 37,
-                        13, 22, 24, 36,
-                        13, 22, 24, 38,
-                        13, 22, 24, 43,
-                        13, 22, 25, 32,
-                        13, 22, 25, 34,
-                        13, 22, 25, 43,
-                        13, 22, 27, 30,
-                        13, 22, 27, 34,
-                        13, 22, 27, 38,
-                        13, 22, 29, 30,
-                        13, 22, 29, 32,
-                        13, 22, 29, 36,
-                        13, 22, 30, 43,
-                        13, 22, 32, 38,
-                        13, 22, 34, 36,
-                        13, 23, 24, 36,
-                        13, 23, 24, 37,
-                        13, 23, 24, 42,
-                        13, 23, 25, 32,
-                        13, 23, 25, 33,
-                        13, 23, 25, 42,
-                        13, 23, 27, 30,
-                        13, 23, 27, 33,
-                        13, 23, 27, 37,
-                        13, 23, 28, 30,
-                        13, 23, 28, 32,
-                        13, 23, 28, 36,
-                        13, 23, 30, 42,
-                        13, 23, 32, 37,
-                        13, 23, 33, 36,
-                        13, 24, 36, 44,
-                        13, 24, 37, 43,
-                        13, 24, 38, 42,
-                        13, 25, 32, 44,
-                        13, 25, 33, 43,
-                        13, 25, 34, 42,
-                        13, 27, 30, 44,
-                        13, 27, 33, 38,
-                        13, 27, 34, 37,
-                        13, 28, 30, 43,
-                        13, 28, 32, 38,
-                        13, 28, 34, 36,
-                        13, 29, 30, 42,
-                        13, 29, 32, 37,
-                        13, 29, 33, 36,
-                        14, 17, 30, 40,
-                        14, 17, 30, 41,
-                        14, 17, 30, 44,
-                        14, 17, 31, 37,
-                        14, 17, 31, 38,
-                        14, 17, 31, 44,
-                        14, 17, 33, 35,
-                        14, 17, 33, 38,
-                        14, 17, 33, 41,
-                        14, 17, 34, 35,
-                        14, 17, 34, 37,
-                        14, 17, 34, 40,
-                        14, 17, 35, 44,
-                        14, 17, 37, 41,
-                        14, 17, 38, 40,
-                        14, 18, 25, 40,
-                        14, 18, 25, 41,
-                        14, 18, 25, 44,
-                        14, 18, 26, 37,
-                        14, 18, 26, 38,
-                        14, 18, 26, 44,
-                        14, 18, 28, 35,
-                        14, 18, 28, 38,
-                        14, 18, 28, 41,
-                        14, 18, 29, 35,
-                        14, 18, 29, 37,
-                        14, 18, 29, 40,
-                        14, 18, 35, 44,
-                        14, 18, 37, 41,
-                        14, 18, 38, 40,
-                        14, 19, 24, 40,
-                        14, 19, 24, 41,
-                        14, 19, 24, 44,
-                        14, 19, 26, 33,
-                        14, 19, 26, 34,
-                        14, 19, 26, 44,
-                        14, 19, 28, 31,
-                        14, 19, 28, 34,
-                        14, 19, 28, 41,
-                        14, 19, 29, 31,
-                        14, 19, 29, 33,
-                        14, 19, 29, 40,
-                        14, 19, 31, 44,
-                        14, 19, 33, 41,
-                        14, 19, 34, 40,
-                        14, 20, 24, 37,
-                        14, 20, 24, 38,
-                        14, 20, 24, 44,
-                        14, 20, 25, 33,
-                        14, 20, 25, 34,
-                        14, 20, 25, 44,
-                        14, 20, 28, 30,
-                        14, 20, 28, 34,
-                        14, 20, 28, 38,
-                        14, 20, 29, 30,
-                        14, 20, 29, 33,
-                        14, 20, 29, 37,
-                        14, 20, 30, 44,
-                        14, 20, 33, 38,
-                        14, 20, 34, 37,
-                        14, 22, 24, 35,
-                        14, 22, 24, 38,
-                        14, 22, 24, 41,
-                        14, 22, 25, 31,
-                        14, 22, 25, 34,
-                        14, 22, 25, 41,
-                        14, 22, 26, 30,
-                        14, 22, 26, 34,
-                        14, 22, 26, 38,
-                        14, 22, 29, 30,
-                        14, 22, 29, 31,
-                        14, 22, 29, 35,
-                        14, 22, 30, 41,
-                        14, 22, 31, 38,
-                        14, 22, 34, 35,
-                        14, 23, 24, 35,
-                        14, 23, 24, 37,
-                        14, 23, 24, 40,
-                        14, 23, 25, 31,
-                        14, 23, 25, 33,
-                        14, 23, 25, 40,
-                        14, 23, 26, 30,
-                        14, 23, 26, 33,
-                        14, 23, 26, 37,
-                        14, 23, 28, 30,
-                        14, 23, 28, 31,
-                        14, 23, 28, 35,
-                        14, 23, 30, 40,
-                        14, 23, 31, 37,
-                        14, 23, 33, 35,
-                        14, 24, 35, 44,
-                        14, 24, 37, 41,
-                        14, 24, 38, 40,
-                        14, 25, 31, 44,
-                        14, 25, 33, 41,
-                        14, 25, 34, 40,
-                        14, 26, 30, 44,
-                        14, 26, 33, 38,
-                        14, 26, 34, 37,
-                        14, 28, 30, 41,
-                        14, 28, 31, 38,
-                        14, 28, 34, 35,
-                        14, 29, 30, 40,
-                        14, 29, 31, 37,
-                        14, 29, 33, 35,
-                        15, 17, 30, 39,
-                        15, 17, 30, 41,
-                        15, 17, 30, 43,
-                        15, 17, 31, 36,
-                        15, 17, 31, 38,
-                        15, 17, 31, 43,
-                        15, 17, 32, 35,
-                        15, 17, 32, 38,
-                        15, 17, 32, 41,
-                        15, 17, 34, 35,
-                        15, 17, 34, 36,
-                        15, 17, 34, 39,
-                        15, 17, 35, 43,
-                        15, 17, 36, 41,
-                        15, 17, 38, 39,
-                        15, 18, 25, 39,
-                        15, 18, 25, 41,
-                        15, 18, 25, 43,
-                        15, 18, 26, 36,
-                        15, 18, 26, 38,
-                        15, 18, 26, 43,
-                        15, 18, 27, 35,
-                        15, 18, 27, 38,
-                        15, 18, 27, 41,
-                        15, 18, 29, 35,
-                        15, 18, 29, 36,
-                        15, 18, 29, 39,
-                        15, 18, 35, 43,
-                        15, 18, 36, 41,
-                        15, 18, 38, 39,
-                        15, 19, 24, 39,
-                        15, 19, 24, 41,
-                        15, 19, 24, 43,
-                        15, 19, 26, 32,
-                        15, 19, 26, 34,
-                        15, 19, 26, 43,
-                        15, 19, 27, 31,
-                        15, 19, 27, 34,
-                        15, 19, 27, 41,
-                        15, 19, 29, 31,
-                        15, 19, 29, 32,
-                        15, 19, 29, 39,
-                        15, 19, 31, 43,
-                        15, 19, 32, 41,
-                        15, 19, 34, 39,
-                        15, 20, 24, 36,
-                        15, 20, 24, 38,
-                        15, 20, 24, 43,
-                        15, 20, 25, 32,
-                        15, 20, 25, 34,
-                        15, 20, 25, 43,
-                        15, 20, 27, 30,
-                        15, 20, 27, 34,
-                        15, 20, 27, 38,
-                        15, 20, 29, 30,
-                        15, 20, 29, 32,
-                        15, 20, 29, 36,
-                        15, 20, 30, 43,
-                        15, 20, 32, 38,
-                        15, 20, 34, 36,
-                        15, 21, 24, 35,
-                        15, 21, 24, 38,
-                        15, 21, 24, 41,
-                        15, 21, 25, 31,
-                        15, 21, 25, 34,
-                        15, 21, 25, 41,
-                        15, 21, 26, 30,
-                        15, 21, 26, 34,
-                        15, 21, 26, 38,
-                        15, 21, 29, 30,
-                        15, 21, 29, 31,
-                        15, 21, 29, 35,
-                        15, 21, 30, 41,
-                        15, 21, 31, 38,
-                        15, 21, 34, 35,
-                        15, 23, 24, 35,
-                        15, 23, 24, 36,
-                        15, 23, 24, 39,
-                        15, 23, 25, 31,
-                        15, 23, 25, 32,
-                        15, 23, 25, 39,
-                        15, 23, 26, 30,
-                        15, 23, 26, 32,
-                        15, 23, 26, 36,
-                        15, 23, 27, 30,
-                        15, 23, 27, 31,
-                        15, 23, 27, 35,
-                        15, 23, 30, 39,
-                        15, 23, 31, 36,
-                        15, 23, 32, 35,
-                        15, 24, 35, 43,
-                        15, 24, 36, 41,
-                        15, 24, 38, 39,
-                        15, 25, 31, 43,
-                        15, 25, 32, 41,
-                        15, 25, 34, 39,
-                        15, 26, 30, 43,
-                        15, 26, 32, 38,
-                        15, 26, 34, 36,
-                        15, 27, 30, 41,
-                        15, 27, 31, 38,
-                        15, 27, 34, 35,
-                        15, 29, 30, 39,
-                        15, 29, 31, 36,
-                        15, 29, 32, 35,
-                        16, 17, 30, 39,
-                        16, 17, 30, 40,
-                        16, 17, 30, 42,
-                        16, 17, 31, 36,
-                        16, 17, 31, 37,
-                        16, 17, 31, 42,
-                        16, 17, 32, 35,
-                        16, 17, 32, 37,
-                        16, 17, 32, 40,
-                        16, 17, 33, 35,
-                        16, 17, 33, 36,
-                        16, 17, 33, 39,
-                        16, 17, 35, 42,
-                        16, 17, 36, 40,
-                        16, 17, 37, 39,
-                        16, 18, 25, 39,
-                        16, 18, 25, 40,
-                        16, 18, 25, 42,
-                        16, 18, 26, 36,
-                        16, 18, 26, 37,
-                        16, 18, 26, 42,
-                        16, 18, 27, 35,
-                        16, 18, 27, 37,
-                        16, 18, 27, 40,
-                        16, 18, 28, 35,
-                        16, 18, 28, 36,
-                        16, 18, 28, 39,
-                        16, 18, 35, 42,
-                        16, 18, 36, 40,
-                        16, 18, 37, 39,
-                        16, 19, 24, 39,
-                        16, 19, 24, 40,
-                        16, 19, 24, 42,
-                        16, 19, 26, 32,
-                        16, 19, 26, 33,
-                        16, 19, 26, 42,
-                        16, 19, 27, 31,
-                        16, 19, 27, 33,
-                        16, 19, 27, 40,
-                        16, 19, 28, 31,
-                        16, 19, 28, 32,
-                        16, 19, 28, 39,
-                        16, 19, 31, 42,
-                        16, 19, 32, 40,
-                        16, 19, 33, 39,
-                        16, 20, 24, 36,
-                        16, 20, 24, 37,
-                        16, 20, 24, 42,
-                        16, 20, 25, 32,
-                        16, 20, 25, 33,
-                        16, 20, 25, 42,
-                        16, 20, 27, 30,
-                        16, 20, 27, 33,
-                        16, 20, 27, 37,
-                        16, 20, 28, 30,
-                        16, 20, 28, 32,
-                        16, 20, 28, 36,
-                        16, 20, 30, 42,
-                        16, 20, 32, 37,
-                        16, 20, 33, 36,
-                        16, 21, 24, 35,
-                        16, 21, 24, 37,
-                        16, 21, 24, 40,
-                        16, 21, 25, 31,
-                        16, 21, 25, 33,
-                        16, 21, 25, 40,
-                        16, 21, 26, 30,
-                        16, 21, 26, 33,
-                        16, 21, 26, 37,
-                        16, 21, 28, 30,
-                        16, 21, 28, 31,
-                        16, 21, 28, 35,
-                        16, 21, 30, 40,
-                        16, 21, 31, 37,
-                        16, 21, 33, 35,
-                        16, 22, 24, 35,
-                        16, 22, 24, 36,
-                        16, 22, 24, 39,
-                        16, 22, 25, 31,
-                        16, 22, 25, 32,
-                        16, 22, 25, 39,
-                        16, 22, 26, 30,
-                        16, 22, 26, 32,
-                        16, 22, 26, 36,
-                        16, 22, 27, 30,
-                        16, 22, 27, 31,
-                        16, 22, 27, 35,
-                        16, 22, 30, 39,
-                        16, 22, 31, 36,
-                        16, 22, 32, 35,
-                        16, 24, 35, 42,
-                        16, 24, 36, 40,
-                        16, 24, 37, 39,
-                        16, 25, 31, 42,
-                        16, 25, 32, 40,
-                        16, 25, 33, 39,
-                        16, 26, 30, 42,
-                        16, 26, 32, 37,
-                        16, 26, 33, 36,
-                        16, 27, 30, 40,
-                        16, 27, 31, 37,
-                        16, 27, 33, 35,
-                        16, 28, 30, 39,
-                        16, 28, 31, 36,
-                        16, 28, 32, 35,
-                        17, 30, 39, 44,
-                        17, 30, 40, 43,
-                        17, 30, 41, 42,
-                        17, 31, 36, 44,
-                        17, 31, 37, 43,
-                        17, 31, 38, 42,
-                        17, 32, 35, 44,
-                        17, 32, 37, 41,
-                        17, 32, 38, 40,
-                        17, 33, 35, 43,
-                        17, 33, 36, 41,
-                        17, 33, 38, 39,
-                        17, 34, 35, 42,
-                        17, 34, 36, 40,
-                        17, 34, 37, 39,
-                        18, 25, 39, 44,
-                        18, 25, 40, 43,
-                        18, 25, 41, 42,
-                        18, 26, 36, 44,
-                        18, 26, 37, 43,
-                        18, 26, 38, 42,
-                        18, 27, 35, 44,
-                        18, 27, 37, 41,
-                        18, 27, 38, 40,
-                        18, 28, 35, 43,
-                        18, 28, 36, 41,
-                        18, 28, 38, 39,
-                        18, 29, 35, 42,
-                        18, 29, 36, 40,
-                        18, 29, 37, 39,
-                        19, 24, 39, 44,
-                        19, 24, 40, 43,
-                        19, 24, 41, 42,
-                        19, 26, 32, 44,
-                        19, 26, 33, 43,
-                        19, 26, 34, 42,
-                        19, 27, 31, 44,
-                        19, 27, 33, 41,
-                        19, 27, 34, 40,
-                        19, 28, 31, 43,
-                        19, 28, 32, 41,
-                        19, 28, 34, 39,
-                        19, 29, 31, 42,
-                        19, 29, 32, 40,
-                        19, 29, 33, 39,
-                        20, 24, 36, 44,
-                        20, 24, 37, 43,
-                        20, 24, 38, 42,
-                        20, 25, 32, 44,
-                        20, 25, 33, 43,
-                        20, 25, 34, 42,
-                        20, 27, 30, 44,
-                        20, 27, 33, 38,
-                        20, 27, 34, 37,
-                        20, 28, 30, 43,
-                        20, 28, 32, 38,
-                        20, 28, 34, 36,
-                        20, 29, 30, 42,
-                        20, 29, 32, 37,
-                        20, 29, 33, 36,
-                        21, 24, 35, 44,
-                        21, 24, 37, 41,
-                        21, 24, 38, 40,
-                        21, 25, 31, 44,
-                        21, 25, 33, 41,
-                        21, 25, 34, 40,
-                        21, 26, 30, 44,
-                        21, 26, 33, 38,
-                        21, 26, 34, 37,
-                        21, 28, 30, 41,
-                        21, 28, 31, 38,
-                        21, 28, 34, 35,
-                        21, 29, 30, 40,
-                        21, 29, 31, 37,
-                        21, 29, 33, 35,
-                        22, 24, 35, 43,
-                        22, 24, 36, 41,
-                        22, 24, 38, 39,
-                        22, 25, 31, 43,
-                        22, 25, 32, 41,
-                        22, 25, 34, 39,
-                        22, 26, 30, 43,
-                        22, 26, 32, 38,
-                        22, 26, 34, 36,
-                        22, 27, 30, 41,
-                        22, 27, 31, 38,
-                        22, 27, 34, 35,
-                        22, 29, 30, 39,
-                        22, 29, 31, 36,
-                        22, 29, 32, 35,
-                        23, 24, 35, 42,
-                        23, 24, 36, 40,
-                        23, 24, 37, 39,
-                        23, 25, 31, 42,
-                        23, 25, 32, 40,
-                        23, 25, 33, 39,
-                        23, 26, 30, 42,
-                        23, 26, 32, 37,
-                        23, 26, 33, 36,
-                        23, 27, 30, 40,
-                        23, 27, 31, 37,
-                        23, 27, 33, 35,
-                        23, 28, 30, 39,
-                        23, 28, 31, 36,
-                        23, 28, 32, 35
-                },
-                {
-                        0, 17, 30, 39, 44,
-                        0, 17, 30, 40, 43,
-                        0, 17, 30, 41, 42,
-                        0, 17, 31, 36, 44,
-                        0, 17, 31, 37, 43,
-                        0, 17, 31, 38, 42,
-                        0, 17, 32, 35, 44,
-                        0, 17, 32, 37, 41,
-                        0, 17, 32, 38, 40,
-                        0, 17, 33, 35, 43,
-                        0, 17, 33, 36, 41,
-                        0, 17, 33, 38, 39,
-                        0, 17, 34, 35, 42,
-                        0, 17, 34, 36, 40,
-                        0, 17, 34, 37, 39,
-                        0, 18, 25, 39, 44,
-                        0, 18, 25, 40, 43,
-                        0, 18, 25, 41, 42,
-                        0, 18, 26, 36, 44,
-                        0, 18, 26, 37, 43,
-                        0, 18, 26, 38, 42,
-                        0, 18, 27, 35, 44,
-                        0, 18, 27, 37, 41,
-                        0, 18, 27, 38, 40,
-                        0, 18, 28, 35, 43,
-                        0, 18, 28, 36, 41,
-                        0, 18, 28, 38, 39,
-                        0, 18, 29, 35, 42,
-                        0, 18, 29, 36, 40,
-                        0, 18, 29, 37, 39,
-                        0, 19, 24, 39, 44,
-                        0, 19, 24, 40, 43,
-                        0, 19, 24, 41, 42,
-                        0, 19, 26, 32, 44,
-                        0, 19, 26, 33, 43,
-                        0, 19, 26, 34, 42,
-                        0, 19, 27, 31, 44,
-                        0, 19, 27, 33, 41,
-                        0, 19, 27, 34, 40,
-                        0, 19, 28, 31, 43,
-                        0, 19, 28, 32, 41,
-                        0, 19, 28, 34, 39,
-                        0, 19, 29, 31, 42,
-                        0, 19, 29, 32, 40,
-                        0, 19, 29, 33, 39,
-                        0, 20, 24, 36, 44,
-                        0, 20, 24, 37, 43,
-                        0, 20, 24, 38, 42,
-                        0, 20, 25, 32, 44,
-                        0, 20, 25, 33, 43,
-                        0, 20, 25, 34, 42,
-                        0, 20, 27, 30, 44,
-                        0, 20, 27, 33, 38,
-                        0, 20, 27, 34, 37,
-                        0, 20, 28, 30, 43,
-                        0, 20, 28, 32, 38,
-                        0, 20, 28, 34, 36,
-                        0, 20, 29, 30, 42,
-                        0, 20, 29, 32, 37,
-                        0, 20, 29, 33, 36,
-                        0, 21, 24, 35, 44,
-                        0, 21, 24, 37, 41,
-                        0, 21, 24, 38, 40,
-                        0, 21, 25, 31, 44,
-                        0, 21, 25, 33, 41,
-                        0, 21, 25, 34, 40,
-                        0, 21, 26, 30, 44,
-                        0, 21, 26, 33, 38,
-                        0, 21, 26, 34, 37,
-                        0, 21, 28, 30, 41,
-                        0, 21, 28, 31, 38,
-                        0, 21, 28, 34, 35,
-                        0, 21, 29, 30, 40,
-                        0, 21, 29, 31, 37,
-                        0, 21, 29, 33, 35,
-                        0, 22, 24, 35, 43,
-                        0, 22, 24, 36, 41,
-                        0, 22, 24, 38, 39,
-                        0, 22, 25, 31, 43,
-                        0, 22, 25, 32, 41,
-                        0, 22, 25, 34, 39,
-                        0, 22, 26, 30, 43,
-                        0, 22, 26, 32, 38,
-                        0, 22, 26, 34, 36,
-                        0, 22, 27, 30, 41,
-                        0, 22, 27, 31, 38,
-                        0, 22, 27, 34, 35,
-                        0, 22, 29, 30, 39,
-                        0, 22, 29, 31, 36,
-                        0, 22, 29, 32, 35,
-                        0, 23, 24, 35, 42,
-                        0, 23, 24, 36, 40,
-                        0, 23, 24, 37, 39,
-                        0, 23, 25, 31, 42,
-                        0, 23, 25, 32, 40,
-                        0, 23, 25, 33, 39,
-                        0, 23, 26, 30, 42,
-                        0, 23, 26, 32, 37,
-                        0, 23, 26, 33, 36,
-                        0, 23, 27, 30, 40,
-                        0, 23, 27, 31, 37,
-                        0, 23, 27, 33, 35,
-                        0, 23, 28, 30, 39,
-                        0, 23, 28, 31, 36,
-                        0, 23, 28, 32, 35,
-                        1, 10, 30, 39, 44,
-                        1, 10, 30, 40, 43,
-                        1, 10, 30, 41, 42,
-                        1, 10, 31, 36, 44,
-                        1, 10, 31, 37, 43,
-                        1, 10, 31, 38, 42,
-                        1, 10, 32, 35, 44,
-                        1, 10, 32, 37, 41,
-                        1, 10, 32, 38, 40,
-                        1, 10, 33, 35, 43,
-                        1, 10, 33, 36, 41,
-                        1, 10, 33, 38, 39,
-                        1, 10, 34, 35, 42,
-                        1, 10, 34, 36, 40,
-                        1, 10, 34, 37, 39,
-                        1, 11, 25, 39, 44,
-                        1, 11, 25, 40, 43,
-                        1, 11, 25, 41, 42,
-                        1, 11, 26, 36, 44,
-                        1, 11, 26, 37, 43,
-                        1, 11, 26, 38, 42,
-                        1, 11, 27, 35, 44,
-                        1, 11, 27, 37, 41,
-                        1, 11, 27, 38, 40,
-                        1, 11, 28, 35, 43,
-                        1, 11, 28, 36, 41,
-                        1, 11, 28, 38, 39,
-                        1, 11, 29, 35, 42,
-                        1, 11, 29, 36, 40,
-                        1, 11, 29, 37, 39,
-                        1, 12, 24, 39, 44,
-                        1, 12, 24, 40, 43,
-                        1, 12, 24, 41, 42,
-                        1, 12, 26, 32, 44,
-                        1, 12, 26, 33, 43,
-                        1, 12, 26, 34, 42,
-                        1, 12, 27, 31, 44,
-                        1, 12, 27, 33, 41,
-                        1, 12, 27, 34, 40,
-                        1, 12, 28, 31, 43,
-                        1, 12, 28, 32, 41,
-                        1, 12, 28, 34, 39,
-                        1, 12, 29, 31, 42,
-                        1, 12, 29, 32, 40,
-                        1, 12, 29, 33, 39,
-                        1, 13, 24, 36, 44,
-                        1, 13, 24, 37, 43,
-                        1, 13, 24, 38, 42,
-                        1, 13, 25, 32, 44,
-                        1, 13, 25, 33, 43,
-                        1, 13, 25, 34, 42,
-                        1, 13, 27, 30, 44,
-                        1, 13, 27, 33, 38,
-                        1, 13, 27, 34, 37,
-                        1, 13, 28, 30, 43,
-                        1, 13, 28, 32, 38,
-                        1, 13, 28, 34, 36,
-                        1, 13, 29, 30, 42,
-                        1, 13, 29, 32, 37,
-                        1, 13, 29, 33, 36,
-                        1, 14, 24, 35, 44,
-                        1, 14, 24, 37, 41,
-                        1, 14, 24, 38, 40,
-                        1, 14, 25, 31, 44,
-                        1, 14, 25, 33, 41,
-                        1, 14, 25, 34, 40,
-                        1, 14, 26, 30, 44,
-                        1, 14, 26, 33, 38,
-                        1, 14, 26, 34, 37,
-                        1, 14, 28, 30, 41,
-                        1, 14, 28, 31, 38,
-                        1, 14, 28, 34, 35,
-                        1, 14, 29, 30, 40,
-                        1, 14, 29, 31, 37,
-                        1, 14, 29, 33, 35,
-                        1, 15, 24, 35, 43,
-                        1, 15, 24, 36, 41,
-                        1, 15, 24, 38, 39,
-                        1, 15, 25, 31, 43,
-                        1, 15, 25, 32, 41,
-                        1, 15, 25, 34, 39,
-                        1, 15, 26, 30, 43,
-                        1, 15, 26, 32, 38,
-                        1, 15, 26, 34, 36,
-                        1, 15, 27, 30, 41,
-                        1, 15, 27, 31, 38,
-                        1, 15, 27, 34, 35,
-                        1, 15, 29, 30, 39,
-                        1, 15, 29, 31, 36,
-                        1, 15, 29, 32, 35,
-                        1, 16, 24, 35, 42,
-                        1, 16, 24, 36, 40,
-                        1, 16, 24, 37, 39,
-                        1, 16, 25, 31, 42,
-                        1, 16, 25, 32, 40,
-                        1, 16, 25, 33, 39,
-                        1, 16, 26, 30, 42,
-                        1, 16, 26, 32, 37,
-                        1, 16, 26, 33, 36,
-                        1, 16, 27, 30, 40,
-                        1, 16, 27, 31, 37,
-                        1, 16, 27, 33, 35,
-                        1, 16, 28, 30, 39,
-                        1, 16, 28, 31, 36,
-                        1, 16, 28, 32, 35,
-                        2, 9, 30, 39, 44,
-                        2, 9, 30, 40, 43,
-                        2, 9, 30, 41, 42,
-                        2, 9, 31, 36, 44,
-                        2, 9, 31, 37, 43,
-                        2, 9, 31, 38, 42,
-                        2, 9, 32, 35, 44,
-                        2, 9, 32, 37, 41,
-                        2, 9, 32, 38, 40,
-                        2, 9, 33, 35, 43,
-                        2, 9, 33, 36, 41,
-                        2, 9, 33, 38, 39,
-                        2, 9, 34, 35, 42,
-                        2, 9, 34, 36, 40,
-                        2, 9, 34, 37, 39,
-                        2, 11, 19, 39, 44,
-                        2, 11, 19, 40, 43,
-                        2, 11, 19, 41, 42,
-                        2, 11, 20, 36, 44,
-                        2, 11, 20, 37, 43,
-                        2, 11, 20, 38, 42,
-                        2, 11, 21, 35, 44,
-                        2, 11, 21, 37, 41,
-                        2, 11, 21, 38, 40,
-                        2, 11, 22, 35, 43,
-                        2, 11, 22, 36, 41,
-                        2, 11, 22, 38, 39,
-                        2, 11, 23, 35, 42,
-                        2, 11, 23, 36, 40,
-                        2, 11, 23, 37, 39,
-                        2, 12, 18, 39, 44,
-                        2, 12, 18, 40, 43,
-                        2, 12, 18, 41, 42,
-                        2, 12, 20, 32, 44,
-                        2, 12, 20, 33, 43,
-                        2, 12, 20, 34, 42,
-                        2, 12, 21, 31, 44,
-                        2, 12, 21, 33, 41,
-                        2, 12, 21, 34, 40,
-                        2, 12, 22, 31, 43,
-                        2, 12, 22, 32, 41,
-                        2, 12, 22, 34, 39,
-                        2, 12, 23, 31, 42,
-                        2, 12, 23, 32, 40,
-                        2, 12, 23, 33, 39,
-                        2, 13, 18, 36, 44,
-                        2, 13, 18, 37, 43,
-                        2, 13, 18, 38, 42,
-                        2, 13, 19, 32, 44,
-                        2, 13, 19, 33, 43,
-                        2, 13, 19, 34, 42,
-                        2, 13, 21, 30, 44,
-                        2, 13, 21, 33, 38,
-                        2, 13, 21, 34, 37,
-                        2, 13, 22, 30, 43,
-                        2, 13, 22, 32, 38,
-                        2, 13, 22, 34, 36,
-                        2, 13, 23, 30, 42,
-                        2, 13, 23, 32, 37,
-                        2, 13, 23, 33, 36,
-                        2, 14, 18, 35, 44,
-                        2, 14, 18, 37, 41,
-                        2, 14, 18, 38, 40,
-                        2, 14, 19, 31, 44,
-                        2, 14, 19, 33, 41,
-                        2, 14, 19, 34, 40,
-                        2, 14, 20, 30, 44,
-                        2, 14, 20, 33, 38,
-                        2, 14, 20, 34, 37,
-                        2, 14, 22, 30, 41,
-                        2, 14, 22, 31, 38,
-                        2, 14, 22, 34, 35,
-                        2, 14, 23, 30, 40,
-                        2, 14, 23, 31, 37,
-                        2, 14, 23, 33, 35,
-                        2, 15, 18, 35, 43,
-                        2, 15, 18, 36, 41,
-                        2, 15, 18, 38, 39,
-                        2, 15, 19, 31, 43,
-                        2, 15, 19, 32, 41,
-                        2, 15, 19, 34, 39,
-                        2, 15, 20, 30, 43,
-                        2, 15, 20, 32, 38,
-                        2, 15, 20, 34, 36,
-                        2, 15, 21, 30, 41,
-                        2, 15, 21, 31, 38,
-                        2, 15, 21, 34, 35,
-                        2, 15, 23, 30, 39,
-                        2, 15, 23, 31, 36,
-                        2, 15, 23, 32, 35,
-                        2, 16, 18, 35, 42,
-                        2, 16, 18, 36, 40,
-                        2, 16, 18, 37, 39,
-                        2, 16, 19, 31, 42,
-                        2, 16, 19, 32, 40,
-                        2, 16, 19, 33, 39,
-                        2, 16, 20, 30, 42,
-                        2, 16, 20, 32, 37,
-                        2, 16, 20, 33, 36,
-                        2, 16, 21, 30, 40,
-                        2, 16, 21, 31, 37,
-                        2, 16, 21, 33, 35,
-                        2, 16, 22, 30, 39,
-                        2, 16, 22, 31, 36,
-                        2, 16, 22, 32, 35,
-                        3, 9, 25, 39, 44,
-                        3, 9, 25, 40, 43,
-                        3, 9, 25, 41, 42,
-                        3, 9, 26, 36, 44,
-                        3, 9, 26, 37, 43,
-                        3, 9, 26, 38, 42,
-                        3, 9, 27, 35, 44,
-                        3, 9, 27, 37, 41,
-                        3, 9, 27, 38, 40,
-                        3, 9, 28, 35, 43,
-                        3, 9, 28, 36, 41,
-                        3, 9, 28, 38, 39,
-                        3, 9, 29, 35, 42,
-                        3, 9, 29, 36, 40,
-                        3, 9, 29, 37, 39,
-                        3, 10, 19, 39, 44,
-                        3, 10, 19, 40, 43,
-                        3, 10, 19, 41, 42,
-                        3, 10, 20, 36, 44,
-                        3, 10, 20, 37, 43,
-                        3, 10, 20, 38, 42,
-                        3, 10, 21, 35, 44,
-                        3, 10, 21, 37, 41,
-                        3, 10, 21, 38, 40,
-                        3, 10, 22, 35, 43,
-                        3, 10, 22, 36, 41,
-                        3, 10, 22, 38, 39,
-                        3, 10, 23, 35, 42,
-                        3, 10, 23, 36, 40,
-                        3, 10, 23, 37, 39,
-                        3, 12, 17, 39, 44,
-                        3, 12, 17, 40, 43,
-                        3, 12, 17, 41, 42,
-                        3, 12, 20, 27, 44,
-                        3, 12, 20, 28, 43,
-                        3, 12, 20, 29, 42,
-                        3, 12, 21, 26, 44,
-                        3, 12, 21, 28, 41,
-                        3, 12, 21, 29, 40,
-                        3, 12, 22, 26, 43,
-                        3, 12, 22, 27, 41,
-                        3, 12, 22, 29, 39,
-                        3, 12, 23, 26, 42,
-                        3, 12, 23, 27, 40,
-                        3, 12, 23, 28, 39,
-                        3, 13, 17, 36, 44,
-                        3, 13, 17, 37, 43,
-                        3, 13, 17, 38, 42,
-                        3, 13, 19, 27, 44,
-                        3, 13, 19, 28, 43,
-                        3, 13, 19, 29, 42,
-                        3, 13, 21, 25, 44,
-                        3, 13, 21, 28, 38,
-                        3, 13, 21, 29, 37,
-                        3, 13, 22, 25, 43,
-                        3, 13, 22, 27, 38,
-                        3, 13, 22, 29, 36,
-                        3, 13, 23, 25, 42,
-                        3, 13, 23, 27, 37,
-                        3, 13, 23, 28, 36,
-                        3, 14, 17, 35, 44,
-                        3, 14, 17, 37, 41,
-                        3, 14, 17, 38, 40,
-                        3, 14, 19, 26, 44,
-                        3, 14, 19, 28, 41,
-                        3, 14, 19, 29, 40,
-                        3, 14, 20, 25, 44,
-                        3, 14, 20, 28, 38,
-                        3, 14, 20, 29, 37,
-                        3, 14, 22, 25, 41,
-                        3, 14, 22, 26, 38,
-                        3, 14, 22, 29, 35,
-                        3, 14, 23, 25, 40,
-                        3, 14, 23, 26, 37,
-                        3, 14, 23, 28, 35,
-                        3, 15, 17, 35, 43,
-                        3, 15, 17, 36, 41,
-                        3, 15, 17, 38, 39,
-                        3, 15, 19, 26, 43,
-                        3, 15, 19, 27, 41,
-                        3, 15, 19, 29, 39,
-                        3, 15, 20, 25, 43,
-                        3, 15, 20, 27, 38,
-                        3, 15, 20, 29, 36,
-                        3, 15, 21, 25, 41,
-                        3, 15, 21, 26, 38,
-                        3, 15, 21, 29, 35,
-                        3, 15, 23, 25, 39,
-                        3, 15, 23, 26, 36,
-                        3, 15, 23, 27, 35,
-                        3, 16, 17, 35, 42,
-                        3, 16, 17, 36, 40,
-                        3, 16, 17, 37, 39,
-                        3, 16, 19, 26, 42,
-                        3, 16, 19, 27, 40,
-                        3, 16, 19, 28, 39,
-                        3, 16, 20, 25, 42,
-                        3, 16, 20, 27, 37,
-                        3, 16, 20, 28, 36,
-                        3, 16, 21, 25, 40,
-                        3, 16, 21, 26, 37,
-                        3, 16, 21, 28, 35,
-                        3, 16, 22, 25, 39,
-                        3, 16, 22, 26, 36,
-                        3, 16, 22, 27, 35,
-                        4, 9, 24, 39, 44,
-                        4, 9, 24, 40, 43,
-                        4, 9, 24, 41, 42,
-                        4, 9, 26, 32, 44,
-                        4, 9, 26, 33, 43,
-                        4, 9, 26, 34, 42,
-                        4, 9, 27, 31, 44,
-                        4, 9, 27, 33, 41,
-                        4, 9, 27, 34, 40,
-                        4, 9, 28, 31, 43,
-                        4, 9, 28, 32, 41,
-                        4, 9, 28, 34, 39,
-                        4, 9, 29, 31, 42,
-                        4, 9, 29, 32, 40,
-                        4, 9, 29, 33, 39,
-                        4, 10, 18, 39, 44,
-                        4, 10, 18, 40, 43,
-                        4, 10, 18, 41, 42,
-                        4, 10, 20, 32, 44,
-                        4, 10, 20, 33, 43,
-                        4, 10, 20, 34, 42,
-                        4, 10, 21, 31, 44,
-                        4, 10, 21, 33, 41,
-                        4, 10, 21, 34, 40,
-                        4, 10, 22, 31, 43,
-                        4, 10, 22, 32, 41,
-                        4, 10, 22, 34, 39,
-                        4, 10, 23, 31, 42,
-                        4, 10, 23, 32, 40,
-                        4, 10, 23, 33, 39,
-                        4, 11, 17, 39, 44,
-                        4, 11, 17, 40, 43,
-                        4, 11, 17, 41, 42,
-                        4, 11, 20, 27, 44,
-                        4, 11, 20, 28, 43,
-                        4, 11, 20, 29, 42,
-                        4, 11, 21, 26, 44,
-                        4, 11, 21, 28, 41,
-                        4, 11, 21, 29, 40,
-                        4, 11, 22, 26, 43,
-                        4, 11, 22, 27, 41,
-                        4, 11, 22, 29, 39,
-                        4, 11, 23, 26, 42,
-                        4, 11, 23, 27, 40,
-                        4, 11, 23, 28, 39,
-                        4, 13, 17, 32, 44,
-                        4, 13, 17, 33, 43,
-                        4, 13, 17, 34, 42,
-                        4, 13, 18, 27, 44,
-                        4, 13, 18, 28, 43,
-                        4, 13, 18, 29, 42,
-                        4, 13, 21, 24, 44,
-                        4, 13, 21, 28, 34,
-                        4, 13, 21, 29, 33,
-                        4, 13, 22, 24, 43,
-                        4, 13, 22, 27, 34,
-                        4, 13, 22, 29, 32,
-                        4, 13, 23, 24, 42,
-                        4, 13, 23, 27, 33,
-                        4, 13, 23, 28, 32,
-                        4, 14, 17, 31, 44,
-                        4, 14, 17, 33, 41,
-                        4, 14, 17, 34, 40,
-                        4, 14, 18, 26, 44,
-                        4, 14, 18, 28, 41,
-                        4, 14, 18, 29, 40,
-                        4, 14, 20, 24, 44,
-                        4, 14, 20, 28, 34,
-                        4, 14, 20, 29, 33,
-                        4, 14, 22, 24, 41,
-                        4, 14, 22, 26, 34,
-                        4, 14, 22, 29, 31,
-                        4, 14, 23, 24, 40,
-                        4, 14, 23, 26, 33,
-                        4, 14, 23, 28, 31,
-                        4, 15, 17, 31, 43,
-                        4, 15, 17, 32, 41,
-                        4, 15, 17, 34, 39,
-                        4, 15, 18, 26, 43,
-                        4, 15, 18, 27, 41,
-                        4, 15, 18, 29, 39,
-                        4, 15, 20, 24, 43,
-                        4, 15, 20, 27, 34,
-                        4, 15, 20, 29, 32,
-                        4, 15, 21, 24, 41,
-                        4, 15, 21, 26, 34,
-                        4, 15, 21, 29, 31,
-                        4, 15, 23, 24, 39,
-                        4, 15, 23, 26, 32,
-                        4, 15, 23, 27, 31,
-                        4, 16, 17, 31, 42,
-                        4, 16, 17, 32, 40,
-                        4, 16, 17, 33, 39,
-                        4, 16, 18, 26, 42,
-                        4, 16, 18, 27, 40,
-                        4, 16, 18, 28, 39,
-                        4, 16, 20, 24, 42,
-                        4, 16, 20, 27, 33,
-                        4, 16, 20, 28, 32,
-                        4, 16, 21, 24, 40,
-                        4, 16, 21, 26, 33,
-                        4, 16, 21, 28, 31,
-                        4, 16, 22, 24, 39,
-                        4, 16, 22, 26, 32,
-                        4, 16, 22, 27, 31,
-                        5, 9, 24, 36, 44,
-                        5, 9, 24, 37, 43,
-                        5, 9, 24, 38, 42,
-                        5, 9, 25, 32, 44,
-                        5, 9, 25, 33, 43,
-                        5, 9, 25, 34, 42,
-                        5, 9, 27, 30, 44,
-                        5, 9, 27, 33, 38,
-                        5, 9, 27, 34, 37,
-                        5, 9, 28, 30, 43,
-                        5, 9, 28, 32, 38,
-                        5, 9, 28, 34, 36,
-                        5, 9, 29, 30, 42,
-                        5, 9, 29, 32, 37,
-                        5, 9, 29, 33, 36,
-                        5, 10, 18, 36, 44,
-                        5, 10, 18, 37, 43,
-                        5, 10, 18, 38, 42,
-                        5, 10, 19, 32, 44,
-                        5, 10, 19, 33, 43,
-                        5, 10, 19, 34, 42,
-                        5, 10, 21, 30, 44,
-                        5, 10, 21, 33, 38,
-                        5, 10, 21, 34, 37,
-                        5, 10, 22, 30, 43,
-                        5, 10, 22, 32, 38,
-                        5, 10, 22, 34, 36,
-                        5, 10, 23, 30, 42,
-                        5, 10, 23, 32, 37,
-                        5, 10, 23, 33, 36,
-                        5, 11, 17, 36, 44,
-                        5, 11, 17, 37, 43,
-                        5, 11, 17, 38, 42,
-                        5, 11, 19, 27, 44,
-                        5, 11, 19, 28, 43,
-                        5, 11, 19, 29, 42,
-                        5, 11, 21, 25, 44,
-                        5, 11, 21, 28, 38,
-                        5, 11, 21, 29, 37,
-                        5, 11, 22, 25, 43,
-                        5, 11, 22, 27, 38,
-                        5, 11, 22, 29, 36,
-                        5, 11, 23, 25, 42,
-                        5, 11, 23, 27, 37,
-                        5, 11, 23, 28, 36,
-                        5, 12, 17, 32, 44,
-                        5, 12, 17, 33, 43,
-                        5, 12, 17, 34, 42,
-                        5, 12, 18, 27, 44,
-                        5, 12, 18, 28, 43,
-                        5, 12, 18, 29, 42,
-                        5, 12, 21, 24, 44,
-                        5, 12, 21, 28, 34,
-                        5, 12, 21, 29, 33,
-                        5, 12, 22, 24, 43,
-                        5, 12, 22, 27, 34,
-                        5, 12, 22, 29, 32,
-                        5, 12, 23, 24, 42,
-                        5, 12, 23, 27, 33,
-                        5, 12, 23, 28, 32,
-                        5, 14, 17, 30, 44,
-                        5, 14, 17, 33, 38,
-                        5, 14, 17, 34, 37,
-                        5, 14, 18, 25, 44,
-                        5, 14, 18, 28, 38,
-                        5, 14, 18, 29, 37,
-                        5, 14, 19, 24, 44,
-                        5, 14, 19, 28, 34,
-                        5, 14, 19, 29, 33,
-                        5, 14, 22, 24, 38,
-                        5, 14, 22, 25, 34,
-                        5, 14, 22, 29, 30,
-                        5, 14, 23, 24, 37,
-                        5, 14, 23, 25, 33,
-                        5, 14, 23, 28, 30,
-                        5, 15, 17, 30, 43,
-                        5, 15, 17, 32, 38,
-                        5, 15, 17, 34, 36,
-                        5, 15, 18, 25, 43,
-                        5, 15, 18, 27, 38,
-                        5, 15, 18, 29, 36,
-                        5, 15, 19, 24, 43,
-                        5, 15, 19, 27, 34,
-                        5, 15, 19, 29, 32,
-                        5, 15, 21, 24, 38,
-                        5, 15, 21, 25, 34,
-                        5, 15, 21, 29, 30,
-                        5, 15, 23, 24, 36,
-                        5, 15, 23, 25, 32,
-                        5, 15, 23, 27, 30,
-                        5, 16, 17, 30, 42,
-                        5, 16, 17, 32, 37,
-                        5, 16, 17, 33, 36,
-                        5, 16, 18, 25, 42,
-                        5, 16, 18, 27, 37,
-                        5, 16, 18, 28, 36,
-                        5, 16, 19, 24, 42,
-                        5, 16, 19, 27, 33,
-                        5, 16, 19, 28, 32,
-                        5, 16, 21, 24, 37,
-                        5, 16, 21, 25, 33,
-                        5, 16, 21, 28, 30,
-                        5, 16, 22, 24, 36,
-                        5, 16, 22, 25, 32,
-                        5, 16, 22, 27, 30,
-                        6, 9, 24, 35, 44,
-                        6, 9, 24, 37, 41,
-                        6, 9, 24, 38, 40,
-                        6, 9, 25, 31, 44,
-                        6, 9, 25, 33, 41,
-                        6, 9, 25, 34, 40,
-                        6, 9, 26, 30, 44,
-                        6, 9, 26, 33, 38,
-                        6, 9, 26, 34, 37,
-                        6, 9, 28, 30, 41,
-                        6, 9, 28, 31, 38,
-                        6, 9, 28, 34, 35,
-                        6, 9, 29, 30, 40,
-                        6, 9, 29, 31, 37,
-                        6, 9, 29, 33, 35,
-                        6, 10, 18, 35, 44,
-                        6, 10, 18, 37, 41,
-                        6, 10, 18, 38, 40,
-                        6, 10, 19, 31, 44,
-                        6, 10, 19, 33, 41,
-                        6, 10, 19, 34, 40,
-                        6, 10, 20, 30, 44,
-                        6, 10, 20, 33, 38,
-                        6, 10, 20, 34, 37,
-                        6, 10, 22, 30, 41,
-                        6, 10, 22, 31, 38,
-                        6, 10, 22, 34, 35,
-                        6, 10, 23, 30, 40,
-                        6, 10, 23, 31, 37,
-                        6, 10, 23, 33, 35,
-                        6, 11, 17, 35, 44,
-                        6, 11, 17, 37, 41,
-                        6, 11, 17, 38, 40,
-                        6, 11, 19, 26, 44,
-                        6, 11, 19, 28, 41,
-                        6, 11, 19, 29, 40,
-                        6, 11, 20, 25, 44,
-                        6, 11, 20, 28, 38,
-                        6, 11, 20, 29, 37,
-                        6, 11, 22, 25, 41,
-                        6, 11, 22, 26, 38,
-                        6, 11, 22, 29, 35,
-                        6, 11, 23, 25, 40,
-                        6, 11, 23, 26, 37,
-                        6, 11, 23, 28, 35,
-                        6, 12, 17, 31, 44,
-                        6, 12, 17, 33, 41,
-                        6, 12, 17, 34, 40,
-                        6, 12, 18, 26, 44,
-                        6, 12, 18, 28, 41,
-                        6, 12, 18, 29, 40,
-                        6, 12, 20, 24, 44,
-                        6, 12, 20, 28, 34,
-                        6, 12, 20, 29, 33,
-                        6, 12, 22, 24, 41,
-                        6, 12, 22, 26, 34,
-                        6, 12, 22, 29, 31,
-                        6, 12, 23, 24, 40,
-                        6, 12, 23, 26, 33,
-                        6, 12, 23, 28, 31,
-                        6, 13, 17, 30, 44,
-                        6, 13, 17, 33, 38,
-                        6, 13, 17, 34, 37,
-                        6, 13, 18, 25, 44,
-                        6, 13, 18, 28, 38,
-                        6, 13, 18, 29, 37,
-                        6, 13, 19, 24, 44,
-                        6, 13, 19, 28, 34,
-                        6, 13, 19, 29, 33,
-                        6, 13, 22, 24, 38,
-                        6, 13, 22, 25, 34,
-                        6, 13, 22, 29, 30,
-                        6, 13, 23, 24, 37,
-                        6, 13, 23, 25, 33,
-                        6, 13, 23, 28, 30,
-                        6, 15, 17, 30, 41,
-                        6, 15, 17, 31, 38,
-                        6, 15, 17, 34, 35,
-                        6, 15, 18, 25, 41,
-                        6, 15, 18, 26, 38,
-                        6, 15, 18, 29, 35,
-                        6, 15, 19, 24, 41,
-                        6, 15, 19, 26, 34,
-                        6, 15, 19, 29, 31,
-                        6, 15, 20, 24, 38,
-                        6, 15, 20, 25, 34,
-                        6, 15, 20, 29, 30,
-                        6, 15, 23, 24, 35,
-                        6, 15, 23, 25, 31,
-                        6, 15, 23, 26, 30,
-                        6, 16, 17, 30, 40,
-                        6, 16, 17, 31, 37,
-                        6, 16, 17, 33, 35,
-                        6, 16, 18, 25, 40,
-                        6, 16, 18, 26, 37,
-                        6, 16, 18, 28, 35,
-                        6, 16, 19, 24, 40,
-                        6, 16, 19, 26, 33,
-                        6, 16, 19, 28, 31,
-                        6, 16, 20, 24, 37,
-                        6, 16, 20, 25, 33,
-                        6, 16, 20, 28, 30,
-                        6, 16, 22, 24, 35,
-                        6, 16, 22, 25, 31,
-                        6, 16, 22, 26, 30,
-                        7, 9, 24, 35, 43,
-                        7, 9, 24, 36, 41,
-                        7, 9, 24, 38, 39,
-                        7, 9, 25, 31, 43,
-                        7, 9, 25, 32, 41,
-                        7, 9, 25, 34, 39,
-                        7, 9, 26, 30, 43,
-                        7, 9, 26, 32, 38,
-                        7, 9, 26, 34, 36,
-                        7, 9, 27, 30, 41,
-                        7, 9, 27, 31, 38,
-                        7, 9, 27, 34, 35,
-                        7, 9, 29, 30, 39,
-                        7, 9, 29, 31, 36,
-                        7, 9, 29, 32, 35,
-                        7, 10, 18, 35, 43,
-                        7, 10, 18, 36, 41,
-                        7, 10, 18, 38, 39,
-                        7, 10, 19, 31, 43,
-                        7, 10, 19, 32, 41,
-                        7, 10, 19, 34, 39,
-                        7, 10, 20, 30, 43,
-                        7, 10, 20, 32, 38,
-                        7, 10, 20, 34, 36,
-                        7, 10, 21, 30, 41,
-                        7, 10, 21, 31, 38,
-                        7, 10, 21, 34, 35,
-                        7, 10, 23, 30, 39,
-                        7, 10, 23, 31, 36,
-                        7, 10, 23, 32, 35,
-                        7, 11, 17, 35, 43,
-                        7, 11, 17, 36, 41,
-                        7, 11, 17, 38, 39,
-                        7, 11, 19, 26, 43,
-                        7, 11, 19, 27, 41,
-                        7, 11, 19, 29, 39,
-                        7, 11, 20, 25, 43,
-                        7, 11, 20, 27, 38,
-                        7, 11, 20, 29, 36,
-                        7, 11, 21, 25, 41,
-                        7, 11, 21, 26, 38,
-                        7, 11, 21, 29, 35,
-                        7, 11, 23, 25, 39,
-                        7, 11, 23, 26, 36,
-                        7, 11, 23, 27, 35,
-                        7, 12, 17, 31, 43,
-                        7, 12, 17, 32, 41,
-                        7, 12, 17, 34, 39,
-                        7, 12, 18, 26, 43,
-                        7, 12, 18, 27, 41,
-                        7, 12, 18, 29, 39,
-                        7, 12, 20, 24, 43,
-                        7, 12, 20, 27, 34,
-                        7, 12, 20, 29, 32,
-                        7, 12, 21, 24, 41,
-                        7, 12, 21, 26, 34,
-                        7, 12, 21, 29, 31,
-                        7, 12, 23, 24, 39,
-                        7, 12, 23, 26, 32,
-                        7, 12, 23, 27, 31,
-                        7, 13, 17, 30, 43,
-                        7, 13, 17, 32, 38,
-                        7, 13, 17, 34, 36,
-                        7, 13, 18, 25, 43,
-                        7, 13, 18, 27, 38,
-                        7, 13, 18, 29, 36,
-                        7, 13, 19, 24, 43,
-                        7, 13, 19, 27, 34,
-                        7, 13, 19, 29, 32,
-                        7, 13, 21, 24, 38,
-                        7, 13, 21, 25, 34,
-                        7, 13, 21, 29, 30,
-                        7, 13, 23, 24, 36,
-                        7, 13, 23, 25, 32,
-                        7, 13, 23, 27, 30,
-                        7, 14, 17, 30, 41,
-                        7, 14, 17, 31, 38,
-                        7, 14, 17, 34, 35,
-                        7, 14, 18, 25, 41,
-                        7, 14, 18, 26, 38,
-                        7, 14, 18, 29, 35,
-                        7, 14, 19, 24, 41,
-                        7, 14, 19, 26, 34,
-                        7, 14, 19, 29, 31,
-                        7, 14, 20, 24, 38,
-                        7, 14, 20, 25, 34,
-                        7, 14, 20, 29, 30,
-                        7, 14, 23, 24, 35,
-                        7, 14, 23, 25, 31,
-                        7, 14, 23, 26, 30,
-                        7, 16, 17, 30, 39,
-                        7, 16, 17, 31, 36,
-                        7, 16, 17, 32, 35,
-                        7, 16, 18, 25, 39,
-                        7, 16, 18, 26, 36,
-                        7, 16, 18, 27, 35,
-                        7, 16, 19, 24, 39,
-                        7, 16, 19, 26, 32,
-                        7, 16, 19, 27, 31,
-                        7, 16, 20, 24, 36,
-                        7, 16, 20, 25, 32,
-                        7, 16, 20, 27, 30,
-                        7, 16, 21, 24, 35,
-                        7, 16, 21, 25, 31,
-                        7, 16, 21, 26, 30,
-                        8, 9, 24, 35, 42,
-                        8, 9, 24, 36, 40,
-                        8, 9, 24, 37, 39,
-                        8, 9, 25, 31, 42,
-                        8, 9, 25, 32, 40,
-                        8, 9, 25, 33, 39,
-                        8, 9, 26, 30, 42,
-                        8, 9, 26, 32, 37,
-                        8, 9, 26, 33, 36,
-                        8, 9, 27, 30, 40,
-                        8, 9, 27, 31, 37,
-                        8, 9, 27, 33, 35,
-                        8, 9, 28, 30, 39,
-                        8, 9, 28, 31, 36,
-                        8, 9, 28, 32, 35,
-                        8, 10, 18, 35, 42,
-                        8, 10, 18, 36, 40,
-                        8, 10, 18, 37, 39,
-                        8, 10, 19, 31, 42,
-                        8, 10, 19, 32, 40,
-                        8, 10, 19, 33, 39,
-                        8, 10, 20, 30, 42,
-                        8, 10, 20, 32, 37,
-                        8, 10, 20, 33, 36,
-                        8, 10, 21, 30, 40,
-                        8, 10, 21, 31, 37,
-                        8, 10, 21, 33, 35,
-                        8, 10, 22, 30, 39,
-                        8, 10, 22, 31, 36,
-                        8, 10, 22, 32, 35,
-                        8, 11, 17, 35, 42,
-                        8, 11, 17, 36, 40,
-                        8, 11, 17, 37, 39,
-                        8, 11, 19, 26, 42,
-                        8, 11, 19, 27, 40,
-                        8, 11, 19, 28, 39,
-                        8, 11, 20, 25, 42,
-                        8, 11, 20, 27, 37,
-                        8, 11, 20, 28, 36,
-                        8, 11, 21, 25, 40,
-                        8, 11, 21, 26, 37,
-                        8, 11, 21, 28, 35,
-                        8, 11, 22, 25, 39,
-                        8, 11, 22, 26, 36,
-                        8, 11, 22, 27, 35,
-                        8, 12, 17, 31, 42,
-                        8, 12, 17, 32, 40,
-                        8, 12, 17, 33, 39,
-                        8, 12, 18, 26, 42,
-                        8, 12, 18, 27, 40,
-                        8, 12, 18, 28, 39,
-                        8, 12, 20, 24, 42,
-                        8, 12, 20, 27, 33,
-                        8, 12, 20, 28, 32,
-                        8, 12, 21, 24, 40,
-                        8, 12, 21, 26, 33,
-                        8, 12, 21, 28, 31,
-                        8, 12, 22, 24, 39,
-                        8, 12, 22, 26, 32,
-                        8, 12, 22, 27, 31,
-                        8, 13, 17, 30, 42,
-                        8, 13, 17, 32, 37,
-                        8, 13, 17, 33, 36,
-                        8, 13, 18, 25, 42,
-                        8, 13, 18, 27, 37,
-                        8, 13, 18, 28, 36,
-                        8, 13, 19, 24, 42,
-                        8, 13, 19, 27, 33,
-                        8, 13, 19, 28, 32,
-                        8, 13, 21, 24, 37,
-                        8, 13, 21, 25, 33,
-                        8, 13, 21, 28, 30,
-                        8, 13, 22, 24, 36,
-                        8, 13, 22, 25, 32,
-                        8, 13, 22, 27, 30,
-                        8, 14, 17, 30, 40,
-                        8, 14, 17, 31, 37,
-                        8, 14, 17, 33, 35,
-                        8, 14, 18, 25, 40,
-                        8, 14, 18, 26, 37,
-                        8, 14, 18, 28, 35,
-                        8, 14, 19, 24, 40,
-                        8, 14, 19, 26, 33,
-                        8, 14, 19, 28, 31,
-                        8, 14, 20, 24, 37,
-                        8, 14, 20, 25, 33,
-                        8, 14, 20, 28, 30,
-                        8, 14, 22, 24, 35,
-                        8, 14, 22, 25, 31,
-                        8, 14, 22, 26, 30,
-                        8, 15, 17, 30, 39,
-                        8, 15, 17, 31, 36,
-                        8, 15, 17, 32, 35,
-                        8, 15, 18, 25, 39,
-                        8, 15, 18, 26, 36,
-                        8, 15, 18, 27, 35,
-                        8, 15, 19, 24, 39,
-                        8, 15, 19, 26, 32,
-                        8, 15, 19, 27, 31,
-                        8, 15, 20, 24, 36,
-                        8, 15, 20, 25, 32,
-                        8, 15, 20, 27, 30,
-                        8, 15, 21, 24, 35,
-                        8, 15, 21, 25, 31,
-                        8, 15, 21, 26, 30
-                }
-        }
-};
@@ -1,9 +1,150 @@
 #ifndef SMSM_UB2DSTORAGE_H
 #define SMSM_UB2DSTORAGE_H
 
-#include <vector>
 #include <cstddef>
+#include <cstdint>
 
-extern const std::vector<std::vector<std::vector<size_t>>> valid_sets;
+// largest clique for which the valid sets are stored
+constexpr size_t valid_sets_max_n = 11;
+
+/**
+ * Number of sets of t pairwise disjoint edges in the clique with n nodes,
+ * i.e. binom(n, 2t) * (2t - 1)!!.
+ */
+constexpr size_t valid_sets_count(size_t n, size_t t) {
+    if (2 * t > n) { return 0; }
+    size_t binom = 1;
+    for (size_t i = 0; i < 2 * t; ++i) {
+        binom = binom * (n - i) / (i + 1);
+    }
+    size_t double_factorial = 1;
+    for (size_t i = 2 * t - 1; i > 1; i -= 2) {
+        double_factorial *= i;
+    }
+    return binom * double_factorial;
+}
+
+/**
+ * Number of edge indices stored over all clique sizes and set sizes.
+ */
+constexpr size_t valid_sets_total_size() {
+    size_t total = 0;
+    for (size_t n = 2; n <= valid_sets_max_n; ++n) {
+        for (size_t t = 1; 2 * t <= n; ++t) {
+            total += valid_sets_count(n, t) * t;
+        }
+    }
+    return total;
+}
+
+/**
+ * All sets of pairwise disjoint edges of the cliques with 2 to
+ * valid_sets_max_n nodes. Edges are numbered row by row, (0, 1), (0, 2), ...,
+ * (1, 2), ... and each set consists of t ascending edge indices. The sets of
+ * one clique size and set size form a block in lexicographic order, that is
+ * stored column by column: column j holds the j-th edge of every set, so the
+ * weights of all sets can be summed with one vectorized loop per column.
+ */
+struct ValidSets {
+    static constexpr size_t max_t = valid_sets_max_n / 2;
+
+    uint8_t data[valid_sets_total_size()]{};
+    uint32_t offset[(valid_sets_max_n + 1) * (max_t + 1)]{};
+
+    /**
+     * @return Pointer to the first column of the block of sets with t edges of
+     * the clique with n nodes. Column j starts at j * valid_sets_count(n, t).
+     */
+    constexpr const uint8_t *get(size_t n, size_t t) const {
+        return data + offset[n * (max_t + 1) + t];
+    }
+};
+
+/**
+ * Enumerates the valid sets with a depth-first search over the ascending edge
+ * indices. The search visits the sets of every size in lexicographic order,
+ * so each visited set is appended to the columns of its block.
+ */
+consteval ValidSets make_valid_sets() {
+    ValidSets vs;
+
+    uint8_t edge_n1[(valid_sets_max_n * (valid_sets_max_n - 1)) / 2]{};
+    uint8_t edge_n2[(valid_sets_max_n * (valid_sets_max_n - 1)) / 2]{};
+    size_t row_start[valid_sets_max_n + 1]{};
+    size_t block_start[ValidSets::max_t + 1]{};
+    size_t block_count[ValidSets::max_t + 1]{};
+    size_t write_idx[ValidSets::max_t + 1]{};
+    size_t stack[ValidSets::max_t]{};
+
+    size_t pos = 0;
+    for (size_t n = 2; n <= valid_sets_max_n; ++n) {
+        const size_t n_edges = (n * (n - 1)) / 2;
+        const size_t max_t = n / 2;
+        size_t e = 0;
+        for (size_t i = 0; i < n; ++i) {
+            row_start[i] = e;
+            for (size_t j = i + 1; j < n; ++j) {
+                edge_n1[e] = (uint8_t) i;
+                edge_n2[e] = (uint8_t) j;
+                e += 1;
+            }
+        }
+        row_start[n] = n_edges;
+
+        for (size_t t = 1; t <= max_t; ++t) {
+            vs.offset[n * (ValidSets::max_t + 1) + t] = (uint32_t) pos;
+            block_start[t] = pos;
+            block_count[t] = valid_sets_count(n, t);
+            write_idx[t] = 0;
+            pos += block_count[t] * t;
+        }
+
+        // stack[d] holds the edge at depth d, used is the bitset of covered nodes
+        size_t depth = 0;
+        size_t used = 0;
+        stack[0] = 0;
+        while (true) {
+            // find the next edge at the current depth that does not overlap
+            size_t edge = stack[depth];
+            while (edge < n_edges) {
+                if (used & (size_t(1) << edge_n1[edge])) {
+                    edge = row_start[edge_n1[edge] + 1];
+                } else if (used & (size_t(1) << edge_n2[edge])) {
+                    edge += 1;
+                } else {
+                    break;
+                }
+            }
+
+            if (edge >= n_edges) {
+                // backtrack
+                if (depth == 0) { break; }
+                depth -= 1;
+                used ^= (size_t(1) << edge_n1[stack[depth]]) | (size_t(1) << edge_n2[stack[depth]]);
+                stack[depth] += 1;
+                continue;
+            }
+
+            stack[depth] = edge;
+            const size_t t = depth + 1;
+            for (size_t d = 0; d < t; ++d) {
+                vs.data[block_start[t] + d * block_count[t] + write_idx[t]] = (uint8_t) stack[d];
+            }
+            write_idx[t] += 1;
+
+            if (t == max_t) {
+                stack[depth] += 1;
+            } else {
+                used ^= (size_t(1) << edge_n1[edge]) | (size_t(1) << edge_n2[edge]);
+                depth += 1;
+                stack[depth] = edge + 1;
+            }
+        }
+    }
+
+    return vs;
+}
+
+inline constexpr ValidSets valid_sets = make_valid_sets();
 
 #endif //SMSM_UB2DSTORAGE_H
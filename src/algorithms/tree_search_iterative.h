@@ -11,6 +11,7 @@
 #include <limits>
 #include <cstring>
 #include <numeric>
+#include <span>
 #include <utility>
 #include <vector>
 #include <cmath>
@@ -19,18 +20,23 @@
 #include "../utility/util.h"
 #include "../utility/AlgorithmConfiguration.h"
 #include "../utility/VectorOfVectors.h"
+#include "../structures/StructureInterface.h"
 #include "UpperBoundManager.h"
+#include "CandidateArena.h"
 #include "CandidateManager.h"
 #include "SICache.h"
 #include "PBFAlgorithm.h"
 #include "UB2DAlgorithm.h"
+#include "OracleScheduler.h"
+#include "SwapLocalState.h"
+#include "GRASP.h"
 
 /**
  * Algorithm to find the set S with k elements that maximizes a score function.
  *
  * @tparam T The structure holding the n elements.
  */
-template<class T, typename TypeSF>
+template<class T, typename TypeSF> requires SubmodularStructure<T, TypeSF>
 class TreeSearchIterative {
 public:
     T &t;
@@ -53,7 +59,8 @@ public:
 
     std::vector<TypeSF> scores;
 
-    // vectors to store 1d managers
+    // vectors to store 1d managers, their candidates are stored in the arena
+    CandidateArena<TypeSF> c_arena;
     std::vector<CandidateManager<TypeSF>> c_managers;
 
     // vectors for the UB2D managers
@@ -71,9 +78,12 @@ public:
     // holds object for recursive call
     AlgorithmConfiguration rec_ac;
     std::vector<UpperBoundManager<TypeSF>> rec_managers;
+    std::vector<TreeSearchIterative<T, TypeSF>> rec_searches;
 
     // vectors to hold SICache
     std::vector<SICache<TypeSF>> si_caches;
+    std::vector<SICache<TypeSF>> stale_caches; // gains of each depth keyed by candidates instead of indices
+    std::vector<size_t> stale_key;
 
     // Temporary vectors
     VectorOfVectors<size_t> p1_sets_even;
@@ -84,6 +94,16 @@ public:
     std::vector<TypeSF> p1_si_b;
     std::vector<size_t> set;
     std::vector<size_t> comb;
+    std::vector<uint32_t> batch_c;
+    std::vector<TypeSF> batch_si;
+    std::vector<std::pair<uint32_t, uint32_t>> batch_pairs;
+    std::vector<size_t> batch_idx;
+    std::vector<size_t> batch_hash;
+    std::vector<TypeSF> pair_si;
+    std::vector<std::pair<TypeSF, uint32_t>> greedy_heap;
+    std::vector<size_t> greedy_round;
+    std::vector<uint32_t> greedy_pool;
+    SwapLocalState<TypeSF> swap_state;
 
     // Variables to measure oracles
     // UB2D
@@ -107,6 +127,22 @@ public:
     size_t REC_n_success = 0;
     size_t REC_n_failure = 0;
 
+    // GRASP multi-start
+    GRASP<TypeSF> grasp_starts;
+    TypeSF GRASP_best_score = -std::numeric_limits<TypeSF>::max();
+    long GRASP_best_start = -1; // -1 if no start improved the greedy solution
+    size_t GRASP_n_finished = 0;
+
+    // online scheduling of the oracles
+    OracleScheduler scheduler;
+    std::vector<std::chrono::steady_clock::time_point> node_sp;
+    std::vector<uint8_t> node_started;
+
+    // symmetry breaking between twins
+    std::vector<uint64_t> twin_stamps; // index: depth * n_twin_classes + class
+    std::vector<uint64_t> twin_node_stamp;
+    uint64_t n_twin_nodes = 0;
+
     // variables needed for timing
     double time_needed = 0.0;
     std::chrono::steady_clock::time_point time_sp;
@@ -124,28 +160,106 @@ public:
         n = t.get_n();
         k = ac.k;
 
+        allocate(n, k);
+        assign_candidate_block(0, n);
+        c_managers[0].fill_candidates(n);
+
+        // the block gains of the bounded evaluation are only allocated if it is used
+        if constexpr (requires { t.enable_bounded_evaluation(); }) {
+            if (ac.LE_bounded_enabled) {
+                t.enable_bounded_evaluation();
+            }
+        }
+
+        // remove dominated candidates, as long as k candidates remain
+        if constexpr (requires { t.dominated; }) {
+            if (ac.dominance_enabled && t.dominated.size() == n) {
+                size_t n_dominated = std::count(t.dominated.begin(), t.dominated.end(), 1);
+                if (n - n_dominated >= k) {
+                    c_managers[0].fill_candidates(n, t.dominated);
+                }
+            }
+        }
+
+        for (size_t i = s_size; i < k; ++i) {
+            initial_s[i] = c_managers[0].get_c(i - s_size);
+        }
+    };
+
+    /**
+     * Replaces the initial set, search() starts with it as the best set. The
+     * set has to consist of k different elements.
+     *
+     * @param initial The initial set.
+     * @param err_msg Set to the reason if the set is not valid.
+     * @return False if the set is not valid, the initial set is then unchanged.
+     */
+    bool set_initial_solution(const std::vector<uint32_t> &initial, std::string &err_msg) {
+        std::vector<uint32_t> sorted(initial);
+        std::sort(sorted.begin(), sorted.end());
+        if (sorted.size() != k || (!sorted.empty() && sorted.back() >= n) ||
+            std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end()) {
+            err_msg = "The initial solution " + to_string(initial) + " is not a set of " + std::to_string(k) + " different elements from 0 to " + std::to_string(n - 1) + "!";
+            return false;
+        }
+        std::copy(sorted.begin(), sorted.end(), initial_s.begin());
+        return true;
+    };
+
+    /**
+     * Constructor for a reusable sub-search of the recursive heuristic. It
+     * extends a fixed prefix of S by at most max_r elements from a window of
+     * at most max_window candidates, see reset().
+     *
+     * @param t The structure (it will be used with the score function).
+     * @param ac Algorithm Configuration.
+     * @param max_k Largest size of S including the prefix.
+     * @param max_r Largest number of elements to add to the prefix.
+     * @param max_window Largest number of candidates.
+     */
+    TreeSearchIterative(T &t,
+                        AlgorithmConfiguration ac_temp,
+                        size_t max_k, size_t max_r, size_t max_window) : t(t), ac(std::move(ac_temp)) {
+        n = t.get_n();
+        k = max_k;
+
+        allocate(max_window, max_r);
+    };
+
+    /**
+     * Allocates all per depth objects.
+     *
+     * @param n_candidates Largest number of candidates on any depth.
+     * @param t_max_depth Number of depths.
+     */
+    void allocate(size_t n_candidates, size_t t_max_depth) {
         // allocate space for s
         s.resize(k);
         initial_s.resize(k);
         best_s.resize(k);
         best_greedy_s.resize(k);
-        size_t t_original_depth = t.depth;
         s_size = 0;
-        tree_max_depth = k - s_size;
+        tree_max_depth = t_max_depth;
 
         scores.resize(tree_max_depth, -std::numeric_limits<TypeSF>::max());
+        batch_c.resize(n_candidates);
+        batch_si.resize(n_candidates);
+        batch_pairs.resize(n_candidates);
+        batch_idx.resize(n_candidates);
+        batch_hash.resize(n_candidates);
+        pair_si.resize(n_candidates);
 
         // allocate space for Candidate Managers
-        for (size_t i = 0; i < tree_max_depth; ++i) { c_managers.emplace_back(n); }
-        c_managers[0].fill_candidates(n);
+        c_arena = CandidateArena<TypeSF>(n_candidates);
+        for (size_t i = 0; i < tree_max_depth; ++i) { c_managers.emplace_back(c_arena); }
 
         if (ac.UB2D_enabled) {
             // allocate space for the UB2D Manager
             for (size_t i = 0; i < tree_max_depth; ++i) { ub2d_managers.emplace_back(ac.UB2D_lazy_skip_start_value, ac.UB2D_lazy_skip_add_value, ac.UB2D_safe_skip_enabled); }
 
             // allocate space for UB2D Interfaces
-            size_t max_l = ac.determine_UB2D_max_l(n, k);
-            for (size_t i = 0; i < tree_max_depth; ++i) { ub2d_algorithms.emplace_back(max_l, ac.UB2D_alg_type); }
+            size_t max_l = std::min(ac.determine_UB2D_max_l(n, k), n_candidates);
+            for (size_t i = 0; i < tree_max_depth; ++i) { ub2d_algorithms.emplace_back(max_l, ac.UB2D_alg_type, ac.UB2D_warm_matching_enabled); }
         }
 
         if (ac.PBF_enabled) {
@@ -153,20 +267,35 @@ public:
             for (size_t i = 0; i < tree_max_depth; ++i) { pbf_managers.emplace_back(ac.PBF_lazy_skip_start_value, ac.PBF_lazy_skip_add_value, ac.PBF_safe_skip_enabled); }
 
             // allocate space for pbf algorithms
-            size_t max_n = ac.determine_PBF_max_n(n, k);
-            size_t max_l = ac.determine_PBF_max_l(n, k);
+            size_t max_n = std::min(ac.determine_PBF_max_n(n, k), n_candidates);
+            size_t max_l = std::min(ac.determine_PBF_max_l(n, k), n_candidates);
             for (size_t i = 0; i < tree_max_depth; ++i) { pbf_algorithms.emplace_back(max_n, max_l, k, ac.PBF_alg_type, ac.PBF_safe_skip_enabled); }
         }
 
         if (ac.REC_enabled) {
-            // allocate space for pbf managers
+            // allocate space for rec managers
             for (size_t i = 0; i < tree_max_depth; ++i) { rec_managers.emplace_back(ac.REC_lazy_skip_start_value, ac.REC_lazy_skip_add_value, ac.REC_safe_skip_enabled); }
-
         }
 
-        if (ac.UB2D_enabled || ac.PBF_enabled) {
+        if (ac.UB2D_enabled || ac.PBF_enabled || ac.REC_enabled) {
             // allocate space for caches
-            for (size_t i = 0; i < k; ++i) { si_caches.emplace_back(); }
+            for (size_t i = 0; i < tree_max_depth; ++i) { si_caches.emplace_back(); }
+            if (ac.stale_bounds_enabled) {
+                for (size_t i = 0; i < tree_max_depth; ++i) { stale_caches.emplace_back(); }
+            }
+        }
+
+        if (ac.oracle_scheduler_enabled) {
+            scheduler = OracleScheduler(tree_max_depth);
+            node_sp.resize(tree_max_depth);
+            node_started.resize(tree_max_depth, 0);
+        }
+
+        if constexpr (requires { t.twin_class; }) {
+            if (!t.twin_class.empty()) {
+                twin_stamps.resize(tree_max_depth * t.n_twin_classes, 0);
+                twin_node_stamp.resize(tree_max_depth, 0);
+            }
         }
 
         if (ac.REC_enabled) {
@@ -176,12 +305,84 @@ public:
             rec_ac.write_output = false;
             rec_ac.REC_enabled = false;
             rec_ac.measure_oracle_time = false;
+            rec_ac.oracle_scheduler_enabled = false;
+            rec_ac.GRASP_n_starts = 0;
+
+            // one sub-search per depth, restricted to the candidate window
+            size_t max_window = std::min(ac.determine_REC_max_l(n, k), n_candidates);
+            rec_searches.reserve(tree_max_depth);
+            for (size_t i = 0; i < tree_max_depth; ++i) { rec_searches.emplace_back(t, rec_ac, k, std::min(k, max_window), max_window); }
+        }
+    }
+
+    /**
+     * Places the candidates of the depth in the arena directly after the
+     * candidates of the parent depth, this releases the block of the previous
+     * sibling. If the arena has to grow, the blocks of the parent depths are
+     * bound again.
+     *
+     * @param depth The depth.
+     * @param n_candidates Maximum number of candidates of the depth.
+     */
+    void assign_candidate_block(const size_t depth, const size_t n_candidates) {
+        size_t start = 0;
+        size_t csum_start = 0;
+        if (depth > 0) {
+            start = c_managers[depth - 1].block_end();
+            csum_start = c_managers[depth - 1].csum_block_end();
         }
 
+        if (c_arena.reserve(start + n_candidates, csum_start + n_candidates + 1)) {
+            for (size_t d = 0; d < depth; ++d) { c_managers[d].rebind(); }
+        }
+        c_managers[depth].assign(c_arena, start, csum_start, n_candidates);
+    }
+
+    /**
+     * Prepares a sub-search for the next call. The search will find the best
+     * extension of the prefix by r elements from the first l candidates
+     * after the offset of the window. The structure has to be at the depth of
+     * the prefix.
+     *
+     * @param prefix The fixed elements of S.
+     * @param prefix_size Number of fixed elements.
+     * @param window The candidate manager holding the candidates, their score improvements must be relative to the prefix.
+     * @param l Number of candidates.
+     * @param r Number of elements to add.
+     * @param threshold The search stops once a set with a larger score is found.
+     */
+    void reset(const std::vector<uint32_t> &prefix, const size_t prefix_size,
+               const CandidateManager<TypeSF> &window, const size_t l, const size_t r, const TypeSF threshold) {
+        ASSERT(r <= tree_max_depth && prefix_size + r <= s.size() && l <= c_arena.sort_idx.size());
+
+        k = prefix_size + r;
+        s_size = prefix_size;
+        ac.k = k;
+        ac.score_threshold = threshold;
+        ac.finalize();
+
+        std::copy(prefix.begin(), prefix.begin() + prefix_size, s.begin());
+        std::copy(prefix.begin(), prefix.begin() + prefix_size, initial_s.begin());
+
+        assign_candidate_block(0, l);
+        CandidateManager<TypeSF> &c_manager = c_managers[0];
+        for (size_t i = 0; i < l; ++i) {
+            size_t idx = window.offset + i;
+            c_manager.set_entry(i, window.get_c(idx), window.get_si(idx), window.get_acc(idx));
+        }
+        c_manager.size = l;
+
         for (size_t i = s_size; i < k; ++i) {
-            initial_s[i] = c_managers[0].get_c(i - s_size);
+            initial_s[i] = c_manager.get_c(i - s_size);
         }
-    };
+
+        initial_score = -std::numeric_limits<TypeSF>::max();
+        best_score = -std::numeric_limits<TypeSF>::max();
+        best_greedy_score = -std::numeric_limits<TypeSF>::max();
+        std::fill(scores.begin(), scores.end(), -std::numeric_limits<TypeSF>::max());
+        n_tried_calls = 0;
+        time_exceeded = false;
+    }
 
     /**
      * Will start the search algorithm and return the best found set. The set
@@ -223,14 +424,21 @@ public:
             if (ac.greedy_local_search) {
                 greedy_local_search();
             } else {
-                simple_greedy();
+                initial_greedy();
+            }
+
+            if constexpr (requires { t.dist_mtx; }) {
+                if (ac.GRASP_n_starts > 0) {
+                    grasp();
+                }
             }
 
             // initialize structures
             if (ac.UB2D_enabled) { ub2d_managers[0].visit_new_depth(); }
             if (ac.PBF_enabled) { pbf_managers[0].visit_new_depth(); }
             if (ac.REC_enabled) { rec_managers[0].visit_new_depth(); }
-            if (ac.UB2D_enabled || ac.PBF_enabled) { si_caches[0].visit_new_depth(); }
+            if (!si_caches.empty()) { si_caches[0].visit_new_depth(); }
+            if (!stale_caches.empty()) { stale_caches[0].visit_new_depth(); }
 
             // search iterativ through the candidates
             iterative_search();
@@ -254,6 +462,7 @@ public:
         TypeSF score = scores[depth];
         TypeSF r_score = best_score - score;
         size_t depth_action = DEPTH_STAY;
+        start_twin_node(depth);
 
         while (depth != 0 || depth_action != DEPTH_UP) {
 
@@ -281,6 +490,12 @@ public:
                     continue;
                 }
 
+                // the subtree of a twin of an already chosen candidate is equivalent to a part of its subtree
+                if (twin_already_chosen(depth, c_managers[depth].get_c(c_managers[depth].offset))) {
+                    c_managers[depth].offset += 1;
+                    continue;
+                }
+
                 TypeSF sub_bound = std::numeric_limits<TypeSF>::max();
                 TypeSF ub2d_bound = std::numeric_limits<TypeSF>::max();
                 TypeSF pbf_bound = std::numeric_limits<TypeSF>::max();
@@ -307,20 +522,12 @@ public:
                 }
 
                 // Upper Bound 2D
-                if (ac.UB2D_enabled && ac.UB2D_depth_enabled[depth] && r_score >= (sub_bound - scores[depth]) * ac.UB2D_sub_bound_percentage_vec[depth]) {
-
-                    if (ac.measure_oracle_time) {
-                        sp_ub2d = get_time_point();
-                    }
+                if (ac.UB2D_enabled && call_oracle(OracleScheduler::UB2D, depth, r_score, sub_bound)) {
+                    sp_ub2d = start_oracle();
 
                     ub2d_bound = UB2D(depth);
                     if (ub2d_bound <= best_score) {
-
-                        if (ac.measure_oracle_time) {
-                            UB2D_success_time += get_elapsed_seconds(sp_ub2d, get_time_point());
-                            UB2D_n_success += 1;
-                        }
-
+                        finish_oracle(OracleScheduler::UB2D, depth, true, sp_ub2d);
                         depth_action = DEPTH_UP;
                         continue;
                     }
@@ -333,37 +540,22 @@ public:
                         c_managers[depth].size = general_RPC(r1_si_bound, largest_idx, depth);
                         if (c_managers[depth].size - c_managers[depth].offset == r) {
                             r_remaining_candidates(depth);
-
-                            if (ac.measure_oracle_time) {
-                                UB2D_success_time += get_elapsed_seconds(sp_ub2d, get_time_point());
-                                UB2D_n_success += 1;
-                            }
-
+                            finish_oracle(OracleScheduler::UB2D, depth, true, sp_ub2d);
                             depth_action = DEPTH_UP;
                             continue;
                         }
                     }
 
-                    if (ac.measure_oracle_time) {
-                        UB2D_failure_time += get_elapsed_seconds(sp_ub2d, get_time_point());
-                        UB2D_n_failure += 1;
-                    }
+                    finish_oracle(OracleScheduler::UB2D, depth, false, sp_ub2d);
                 }
 
                 // Partial Brute Force
-                if (ac.PBF_enabled && ac.PBF_depth_enabled[depth] && r_score >= (sub_bound - scores[depth]) * ac.PBF_sub_bound_percentage_vec[depth]) {
-                    if (ac.measure_oracle_time) {
-                        sp_pbf = get_time_point();
-                    }
+                if (ac.PBF_enabled && call_oracle(OracleScheduler::PBF, depth, r_score, sub_bound)) {
+                    sp_pbf = start_oracle();
 
                     pbf_bound = PBF(depth);
                     if (pbf_bound <= best_score) {
-
-                        if (ac.measure_oracle_time) {
-                            PBF_success_time += get_elapsed_seconds(sp_pbf, get_time_point());
-                            PBF_n_success += 1;
-                        }
-
+                        finish_oracle(OracleScheduler::PBF, depth, true, sp_pbf);
                         depth_action = DEPTH_UP;
                         continue;
                     }
@@ -376,37 +568,22 @@ public:
                         c_managers[depth].size = general_RPC(r1_si_bound, largest_idx, depth);
                         if (c_managers[depth].size - c_managers[depth].offset == r) {
                             r_remaining_candidates(depth);
-
-                            if (ac.measure_oracle_time) {
-                                PBF_success_time += get_elapsed_seconds(sp_pbf, get_time_point());
-                                PBF_n_success += 1;
-                            }
-
+                            finish_oracle(OracleScheduler::PBF, depth, true, sp_pbf);
                             depth_action = DEPTH_UP;
                             continue;
                         }
                     }
 
-                    if (ac.measure_oracle_time) {
-                        PBF_failure_time += get_elapsed_seconds(sp_pbf, get_time_point());
-                        PBF_n_failure += 1;
-                    }
+                    finish_oracle(OracleScheduler::PBF, depth, false, sp_pbf);
                 }
 
                 // Recursive heuristic
-                if (ac.REC_enabled && ac.REC_depth_enabled[depth] && r_score >= (sub_bound - scores[depth]) * ac.REC_sub_bound_percentage_vec[depth]) {
-                    if (ac.measure_oracle_time) {
-                        sp_rec = get_time_point();
-                    }
+                if (ac.REC_enabled && call_oracle(OracleScheduler::REC, depth, r_score, sub_bound)) {
+                    sp_rec = start_oracle();
 
                     rec_bound = REC(depth);
                     if (rec_bound <= best_score) {
-
-                        if (ac.measure_oracle_time) {
-                            REC_success_time += get_elapsed_seconds(sp_rec, get_time_point());
-                            REC_n_success += 1;
-                        }
-
+                        finish_oracle(OracleScheduler::REC, depth, true, sp_rec);
                         depth_action = DEPTH_UP;
                         continue;
                     }
@@ -419,25 +596,18 @@ public:
                         c_managers[depth].size = general_RPC(r1_si_bound, largest_idx, depth);
                         if (c_managers[depth].size - c_managers[depth].offset == r) {
                             r_remaining_candidates(depth);
-
-                            if (ac.measure_oracle_time) {
-                                REC_success_time += get_elapsed_seconds(sp_rec, get_time_point());
-                                REC_n_success += 1;
-                            }
-
+                            finish_oracle(OracleScheduler::REC, depth, true, sp_rec);
                             depth_action = DEPTH_UP;
                             continue;
                         }
                     }
 
-                    if (ac.measure_oracle_time) {
-                        REC_failure_time += get_elapsed_seconds(sp_rec, get_time_point());
-                        REC_n_failure += 1;
-                    }
+                    finish_oracle(OracleScheduler::REC, depth, false, sp_rec);
                 }
 
                 // no heuristic pruned, so go down the tree
                 s[s_size] = c_managers[depth].get_c(c_managers[depth].offset);
+                mark_twin_chosen(depth, s[s_size]);
                 scores[depth + 1] = c_managers[depth].get_acc(c_managers[depth].offset) ? scores[depth] + c_managers[depth].get_si(c_managers[depth].offset) : sf_1D(s, s_size + 1);
                 c_managers[depth].offset += 1;
 
@@ -448,6 +618,11 @@ public:
                 // we will go one depth up
                 // depth, s_size and r are assumed to be in wrong state
 
+                if (ac.oracle_scheduler_enabled && node_started[depth]) {
+                    scheduler.record_node(depth, get_elapsed_seconds(node_sp[depth], get_time_point()));
+                    node_started[depth] = 0;
+                }
+
                 depth -= 1;
                 s_size -= 1;
                 r = k - s_size;
@@ -457,6 +632,8 @@ public:
                 t.return_from_last_depth();
 
                 if (has_time_exceeded()) {
+                    // leave the structure at the depth of the start
+                    for (size_t d = 0; d < depth; ++d) { t.return_from_last_depth(); }
                     return;
                 }
 
@@ -507,9 +684,11 @@ public:
                 if (ac.UB2D_enabled) { ub2d_managers[depth].visit_new_depth(); }
                 if (ac.PBF_enabled) { pbf_managers[depth].visit_new_depth(); }
                 if (ac.REC_enabled) { rec_managers[depth].visit_new_depth(); }
-                if (ac.UB2D_enabled || ac.PBF_enabled) { si_caches[depth].visit_new_depth(); }
+                if (!si_caches.empty()) { si_caches[depth].visit_new_depth(); }
+                if (!stale_caches.empty()) { stale_caches[depth].visit_new_depth(); }
 
                 // dynamic candidate ordering
+                assign_candidate_block(depth, p_c_size - p_offset);
                 c_managers[depth].size = DCO(depth);
 
                 if (c_managers[depth].size < r) {
@@ -518,6 +697,12 @@ public:
                 }
 
                 c_managers[depth].offset = 0;
+                start_twin_node(depth);
+
+                if (ac.oracle_scheduler_enabled) {
+                    node_sp[depth] = get_time_point();
+                    node_started[depth] = 1;
+                }
 
                 depth_action = DEPTH_STAY;
                 continue;
@@ -525,6 +710,121 @@ public:
         }
     }
 
+    /**
+     * Starts a new node on the depth for the symmetry breaking, no candidate
+     * of the node was chosen yet.
+     */
+    inline void start_twin_node(const size_t depth) {
+        if (!twin_node_stamp.empty()) {
+            twin_node_stamp[depth] = ++n_twin_nodes;
+        }
+    }
+
+    /**
+     * Checks if a twin of the candidate was already chosen on the current node
+     * of the depth. Neither of them is in S, so exchanging them maps every set
+     * below the candidate to a set below the twin, that was already explored
+     * (or pruned by a bound). The candidate can therefore be skipped.
+     *
+     * @param depth The current depth of the search tree.
+     * @param c The candidate.
+     * @return True if the candidate can be skipped.
+     */
+    inline bool twin_already_chosen(const size_t depth, const uint32_t c) const {
+        if constexpr (requires { t.twin_class; }) {
+            if (!twin_node_stamp.empty() && t.twin_class[c] != T::no_twin_class) {
+                return twin_stamps[depth * t.n_twin_classes + t.twin_class[c]] == twin_node_stamp[depth];
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Marks the twin class of the candidate as chosen on the current node of
+     * the depth.
+     */
+    inline void mark_twin_chosen(const size_t depth, const uint32_t c) {
+        if constexpr (requires { t.twin_class; }) {
+            if (!twin_node_stamp.empty() && t.twin_class[c] != T::no_twin_class) {
+                twin_stamps[depth * t.n_twin_classes + t.twin_class[c]] = twin_node_stamp[depth];
+            }
+        }
+    }
+
+    /**
+     * Decides if the oracle is called on the current node. Without the
+     * scheduler, the oracle has to be enabled on the depth and the remaining
+     * score has to be large enough compared to the simple upper bound.
+     *
+     * @param o The oracle.
+     * @param depth The current depth of the search tree.
+     * @param r_score The score that is still needed to improve the best set.
+     * @param sub_bound The simple upper bound of the node.
+     * @return True if the oracle should be called.
+     */
+    bool call_oracle(const OracleScheduler::Oracle o, const size_t depth, const TypeSF r_score, const TypeSF sub_bound) {
+        if (ac.oracle_scheduler_enabled) {
+            return scheduler.should_call(o, depth);
+        }
+
+        const TypeSF sub_r_score = sub_bound - scores[depth];
+        if (o == OracleScheduler::UB2D) {
+            return ac.UB2D_depth_enabled[depth] && r_score >= sub_r_score * ac.UB2D_sub_bound_percentage_vec[depth];
+        } else if (o == OracleScheduler::PBF) {
+            return ac.PBF_depth_enabled[depth] && r_score >= sub_r_score * ac.PBF_sub_bound_percentage_vec[depth];
+        }
+        return ac.REC_depth_enabled[depth] && r_score >= sub_r_score * ac.REC_sub_bound_percentage_vec[depth];
+    }
+
+    /**
+     * @return The start time of an oracle call, only measured if needed.
+     */
+    inline std::chrono::steady_clock::time_point start_oracle() {
+        if (ac.measure_oracle_time || ac.oracle_scheduler_enabled) {
+            return get_time_point();
+        }
+        return {};
+    }
+
+    /**
+     * Records the outcome of an oracle call for the statistics and the
+     * scheduler.
+     *
+     * @param o The oracle.
+     * @param depth The current depth of the search tree.
+     * @param success Whether the oracle pruned the node.
+     * @param sp The start time of the call.
+     */
+    void finish_oracle(const OracleScheduler::Oracle o, const size_t depth, const bool success,
+                       const std::chrono::steady_clock::time_point sp) {
+        if (!ac.measure_oracle_time && !ac.oracle_scheduler_enabled) {
+            return;
+        }
+        const double seconds = get_elapsed_seconds(sp, get_time_point());
+
+        if (ac.oracle_scheduler_enabled) {
+            scheduler.record_call(o, depth, success, seconds);
+            if (success) {
+                // the time of a pruned node would underestimate the saved time
+                node_started[depth] = 0;
+            }
+        }
+
+        if (ac.measure_oracle_time) {
+            double &success_time = o == OracleScheduler::UB2D ? UB2D_success_time : (o == OracleScheduler::PBF ? PBF_success_time : REC_success_time);
+            double &failure_time = o == OracleScheduler::UB2D ? UB2D_failure_time : (o == OracleScheduler::PBF ? PBF_failure_time : REC_failure_time);
+            size_t &n_success = o == OracleScheduler::UB2D ? UB2D_n_success : (o == OracleScheduler::PBF ? PBF_n_success : REC_n_success);
+            size_t &n_failure = o == OracleScheduler::UB2D ? UB2D_n_failure : (o == OracleScheduler::PBF ? PBF_n_failure : REC_n_failure);
+            if (success) {
+                success_time += seconds;
+                n_success += 1;
+            } else {
+                failure_time += seconds;
+                n_failure += 1;
+            }
+        }
+    }
+
     /**
     * Special function to handle the case when only one more element has to be
     * chosen. It will look at the candidates from the parent and determine the
@@ -658,11 +958,40 @@ public:
         best_score = new_score;
     }
 
+    /**
+     * Computes the initial greedy solution with the configured greedy type.
+     *
+     * @return False if the time limit was exceeded.
+     */
+    bool initial_greedy() {
+        bool finished;
+        if (ac.greedy_type == 1) {
+            finished = lazy_greedy();
+        } else if (ac.greedy_type == 2) {
+            finished = stochastic_greedy();
+        } else {
+            finished = simple_greedy();
+        }
+        if (!finished) {
+            return false;
+        }
+
+        std::copy(s.begin(), s.end(), best_greedy_s.begin());
+
+        if (best_greedy_score > best_score) {
+            best_score = best_greedy_score;
+            std::copy(s.begin(), s.end(), best_s.begin());
+        }
+        return true;
+    }
+
     /**
      * A simple greedy algorithm that tries to find a good starting solution. It
      * iteratively chooses the best element k times.
+     *
+     * @return False if the time limit was exceeded.
      */
-    void simple_greedy() {
+    bool simple_greedy() {
         CandidateManager<TypeSF> &c_manager = c_managers[0];
 
         for (size_t i = s_size; i < k; ++i) {
@@ -680,55 +1009,162 @@ public:
                     }
 
                     if (has_time_exceeded()) {
-                        return;
+                        return false;
                     }
                 }
             }
             s[i] = best_c;
         }
+        return true;
+    }
 
-        std::copy(s.begin(), s.end(), best_greedy_s.begin());
+    /**
+     * Greedy algorithm with Minoux' lazy evaluation. The heap is seeded with
+     * the gains that DCO_depth_0 already stored in the candidate manager of
+     * depth 0, afterward they are kept in a max-heap. Gains can only shrink when S grows, so the top
+     * of the heap is only re-evaluated until its gain is up to date with the
+     * current round. The structure follows the chosen elements, so each
+     * re-evaluation is a single evaluate_1D.
+     *
+     * @return False if the time limit was exceeded.
+     */
+    bool lazy_greedy() {
+        CandidateManager<TypeSF> &c_manager = c_managers[0];
+        const size_t start_size = s_size;
+        TypeSF score = scores[0];
+
+        greedy_heap.clear();
+        greedy_round.assign(n, start_size);
+        for (size_t j = c_manager.offset; j < c_manager.size; ++j) {
+            ASSERT(c_manager.get_acc(j) == 1);
+            greedy_heap.emplace_back(c_manager.get_si(j), c_manager.get_c(j));
+        }
+        std::make_heap(greedy_heap.begin(), greedy_heap.end());
+
+        bool finished = true;
+        for (size_t i = start_size; i < k && finished; ++i) {
+            while (true) {
+                std::pop_heap(greedy_heap.begin(), greedy_heap.end());
+                std::pair<TypeSF, uint32_t> &top = greedy_heap.back();
+                if (greedy_round[top.second] == i) {
+                    break;
+                }
 
-        if (best_greedy_score > best_score) {
-            best_score = best_greedy_score;
-            std::copy(s.begin(), s.end(), best_s.begin());
+                s[i] = top.second;
+                top.first = sf_1D(s, i + 1) - score;
+                greedy_round[top.second] = i;
+                std::push_heap(greedy_heap.begin(), greedy_heap.end());
+
+                if (has_time_exceeded()) {
+                    finished = false;
+                    break;
+                }
+            }
+            if (!finished) { break; }
+
+            s[i] = greedy_heap.back().second;
+            score += greedy_heap.back().first;
+            greedy_heap.pop_back();
+
+            if (i + 1 < k) {
+                t.visit_new_depth(s, i + 1);
+                s_size += 1;
+            }
+        }
+
+        // leave the structure at the depth of the start
+        while (s_size > start_size) {
+            t.return_from_last_depth();
+            s_size -= 1;
+        }
+
+        if (finished) {
+            best_greedy_score = sf(s, k);
         }
+        return finished;
     }
 
     /**
-     * A simple greedy algorithm that tries to find a good starting solution. It
-     * iteratively chooses the best element k times.
+     * Stochastic greedy algorithm. Each round only evaluates a random sample
+     * of (n / k) * ln(1 / epsilon) of the remaining candidates with the batch
+     * evaluation and chooses the best one of them. In expectation this gives
+     * a (1 - 1/e - epsilon) approximation for monotone submodular functions.
+     * The random generator has a fixed seed, so the results are reproducible.
+     *
+     * @return False if the time limit was exceeded.
      */
-    void greedy_local_search() {
+    bool stochastic_greedy() {
         CandidateManager<TypeSF> &c_manager = c_managers[0];
+        const size_t start_size = s_size;
+        std::mt19937 rng(0);
+
+        greedy_pool.assign(&c_manager.candidates_c[c_manager.offset], &c_manager.candidates_c[c_manager.size]);
+        const size_t r = k - start_size;
+        const size_t sample_size = std::max((size_t) 1, (size_t) std::ceil(((double) greedy_pool.size() / (double) r) * std::log(1.0 / ac.greedy_epsilon)));
+
+        // only set once the last round is done, a break on the time limit leaves it false
+        bool finished = false;
+        for (size_t i = start_size; i < k; ++i) {
+            // draw the sample with a partial Fisher-Yates shuffle to the front of the pool
+            const size_t m = std::min(sample_size, greedy_pool.size());
+            for (size_t j = 0; j < m; ++j) {
+                std::uniform_int_distribution<size_t> dist(j, greedy_pool.size() - 1);
+                std::swap(greedy_pool[j], greedy_pool[dist(rng)]);
+            }
 
-        for (size_t i = s_size; i < k; ++i) {
-            uint32_t best_c = 0;
+            sf_1D_batch(s, i, std::span<const uint32_t>(greedy_pool.data(), m), std::span<TypeSF>(batch_si.data(), m));
+            size_t best_j = 0;
+            for (size_t j = 1; j < m; ++j) {
+                if (batch_si[j] > batch_si[best_j]) {
+                    best_j = j;
+                }
+            }
 
-            for (size_t j = c_manager.offset; j < c_manager.size; ++j) {
-                uint32_t c = c_manager.get_c(j);
-                if (!contains(s, i, c)) {
-                    s[i] = c;
-                    TypeSF new_score = sf(s, i + 1);
+            s[i] = greedy_pool[best_j];
+            std::swap(greedy_pool[best_j], greedy_pool.back());
+            greedy_pool.pop_back();
 
-                    if (new_score >= best_greedy_score) {
-                        best_greedy_score = new_score;
-                        best_c = c;
-                    }
+            if (i + 1 == k) {
+                finished = true;
+                break;
+            }
 
-                    if (has_time_exceeded()) {
-                        return;
-                    }
-                }
+            t.visit_new_depth(s, i + 1);
+            s_size += 1;
+
+            if (has_time_exceeded()) {
+                break;
             }
-            s[i] = best_c;
         }
 
-        std::copy(s.begin(), s.end(), best_greedy_s.begin());
+        // leave the structure at the depth of the start
+        while (s_size > start_size) {
+            t.return_from_last_depth();
+            s_size -= 1;
+        }
 
-        if (best_greedy_score > best_score) {
-            best_score = best_greedy_score;
-            std::copy(s.begin(), s.end(), best_s.begin());
+        if (finished) {
+            best_greedy_score = sf(s, k);
+        }
+        return finished;
+    }
+
+    /**
+     * A greedy algorithm that tries to find a good starting solution and
+     * improves it by exchanging single elements.
+     */
+    void greedy_local_search() {
+        CandidateManager<TypeSF> &c_manager = c_managers[0];
+
+        if (!initial_greedy()) {
+            return;
+        }
+
+        if constexpr (requires { t.dist_mtx; }) {
+            if (ac.local_search_type != 0) {
+                swap_local_search();
+                return;
+            }
         }
 
         // now perform a local search, with 5% of the time limit
@@ -771,6 +1207,104 @@ public:
         }
     }
 
+    /**
+     * Local search for structures with a sum-of-min score, that exchanges
+     * single elements of the greedy solution. The swaps are scored
+     * incrementally by the SwapLocalState, with the best or the first
+     * improvement policy. Every applied swap is verified with the score
+     * function. It uses the same time limit as the plain local search, the
+     * limit is checked after each pass over the candidates.
+     */
+    void swap_local_search() {
+        CandidateManager<TypeSF> &c_manager = c_managers[0];
+        double time_limit = std::min(90.0, ac.time_limit * 0.1);
+        auto sp = get_time_point();
+
+        greedy_pool.clear();
+        for (size_t j = c_manager.offset; j < c_manager.size; ++j) {
+            uint32_t c = c_manager.get_c(j);
+            if (!contains(s, k, c)) {
+                greedy_pool.push_back(c);
+            }
+        }
+
+        swap_state.assign(t.dist_mtx, s, k);
+        while (get_elapsed_seconds(sp, get_time_point()) < time_limit) {
+            typename SwapLocalState<TypeSF>::Swap swap = swap_state.find_swap(t.dist_mtx, greedy_pool.data(), greedy_pool.size(), s_size, k, ac.local_search_type == 2);
+            if (swap.gain <= 0) {
+                return;
+            }
+
+            uint32_t old_c = s[swap.pos];
+            s[swap.pos] = greedy_pool[swap.idx];
+            TypeSF new_score = sf(s, k);
+            if (new_score <= best_greedy_score) {
+                // the gain was only a rounding error
+                s[swap.pos] = old_c;
+                return;
+            }
+            greedy_pool[swap.idx] = old_c;
+
+            best_greedy_score = new_score;
+            std::copy(s.begin(), s.end(), best_greedy_s.begin());
+            if (best_greedy_score > best_score) {
+                best_score = best_greedy_score;
+                std::copy(s.begin(), s.end(), best_s.begin());
+            }
+
+            if (has_time_exceeded()) {
+                return;
+            }
+            swap_state.apply_swap(t.dist_mtx, s, k, swap.pos);
+        }
+    }
+
+    /**
+     * Runs the GRASP multi-start for structures with a sum-of-min score. The
+     * sets of all starts are scored with the score function afterward, the
+     * best one replaces the best set if it is better. The winning start is
+     * recorded in GRASP_best_start. The budget is the GRASP time limit, but
+     * at most the time left in the search.
+     */
+    void grasp() {
+        CandidateManager<TypeSF> &c_manager = c_managers[0];
+
+        greedy_pool.clear();
+        for (size_t j = c_manager.offset; j < c_manager.size; ++j) {
+            uint32_t c = c_manager.get_c(j);
+            if (!contains(s, s_size, c)) {
+                greedy_pool.push_back(c);
+            }
+        }
+        if (greedy_pool.size() < k - s_size) {
+            return;
+        }
+
+        // the budget of GRASP is capped by the time left in the search
+        const double time_left = ac.time_limit - get_elapsed_seconds(time_sp, get_time_point());
+        if (time_left <= 0.0) {
+            return;
+        }
+        grasp_starts.run(t.dist_mtx, s, s_size, k, greedy_pool, ac.GRASP_n_starts, ac.GRASP_alpha, ac.GRASP_seed, std::min(ac.GRASP_time_limit, time_left));
+
+        for (size_t i = 0; i < ac.GRASP_n_starts; ++i) {
+            if (grasp_starts.sets[i].size() != k) {
+                continue;
+            }
+            GRASP_n_finished += grasp_starts.finished[i];
+
+            TypeSF new_score = sf(grasp_starts.sets[i], k);
+            if (new_score > GRASP_best_score) {
+                GRASP_best_score = new_score;
+                if (new_score > best_score) {
+                    GRASP_best_start = (long) i;
+                    best_score = new_score;
+                    std::copy(grasp_starts.sets[i].begin(), grasp_starts.sets[i].end(), best_s.begin());
+                }
+            }
+        }
+    }
+
     /**
      * A wrapper function for the score function.
      *
@@ -801,6 +1335,42 @@ public:
         return t.evaluate_1D(temp_s, temp_s_size);
     };
 
+    /**
+     * A wrapper function for the score function. Evaluates S + {c} for each of
+     * the given candidates.
+     *
+     * @param temp_s The current set S, position temp_s_size is overwritten.
+     * @param temp_s_size The current size of S (without the candidates).
+     * @param candidates The candidates to evaluate.
+     * @param temp_scores Receives the score of S + {c} for each candidate.
+     */
+    void sf_1D_batch(std::vector<uint32_t> &temp_s, const size_t temp_s_size,
+                     std::span<const uint32_t> candidates, std::span<TypeSF> temp_scores) {
+        ASSERT(temp_s_size < k);
+        t.evaluate_1D_batch(temp_s, temp_s_size, candidates, temp_scores);
+    };
+
+    /**
+     * A wrapper function for the score function. Structures that support a
+     * bounded evaluation may stop early, once the score of S is proven to be
+     * at most max_score. All others always compute the exact score.
+     *
+     * @param temp_s The current set S.
+     * @param temp_s_size The current size of S.
+     * @param max_score The score up to which the exact value is not needed.
+     * @param temp_score Receives the exact score or an upper bound <= max_score.
+     * @return True if temp_score is exact, false if it is an upper bound.
+     */
+    bool sf_1D_bounded(const std::vector<uint32_t> &temp_s, const size_t temp_s_size, const TypeSF max_score, TypeSF &temp_score) {
+        ASSERT(temp_s_size <= k);
+        if constexpr (requires { t.evaluate_1D_bounded(temp_s, temp_s_size, max_score, temp_score); }) {
+            return t.evaluate_1D_bounded(temp_s, temp_s_size, max_score, temp_score);
+        } else {
+            temp_score = t.evaluate_1D(temp_s, temp_s_size);
+            return true;
+        }
+    };
+
     /**
      * A wrapper function for the score function.
      *
@@ -816,6 +1386,107 @@ public:
         return t.evaluate_2D(temp_s, temp_s_size);
     };
 
+    /**
+     * A wrapper function for the score function. Evaluates S + {a, b} for each
+     * of the given pairs.
+     *
+     * @param temp_s The current set S.
+     * @param temp_s_size The current size of S (without the pairs).
+     * @param pairs The pairs to evaluate, pairs with equal first elements should be consecutive.
+     * @param temp_scores Receives the score of S + {a, b} for each pair.
+     */
+    void sf_2D_batch(std::vector<uint32_t> &temp_s, const size_t temp_s_size,
+                     std::span<const std::pair<uint32_t, uint32_t>> pairs, std::span<TypeSF> temp_scores) {
+        ASSERT(temp_s_size + 2 <= k);
+        t.evaluate_2D_batch(temp_s, temp_s_size, pairs, temp_scores);
+    };
+
+    /**
+     * Computes the pairwise score improvements of the candidate at idx_1 with
+     * the candidates at idx_2_start, ..., idx_2_start + n_idx_2 - 1. Cached
+     * values are reused, all others are evaluated in one batch and inserted
+     * into the cache. The results are written to pair_si[0], ..., pair_si[n_idx_2 - 1].
+     * If use_stale is set, pairs that are not cached but were evaluated at the
+     * parent depth get the parent value, which is an upper bound by
+     * submodularity.
+     *
+     * @param depth The current depth of the search tree.
+     * @param idx_1 Index of the first candidate.
+     * @param idx_2_start Index of the first second candidate.
+     * @param n_idx_2 Number of second candidates.
+     * @param use_stale Whether to use the values of the parent depth.
+     * @return The number of values taken from the parent depth.
+     */
+    size_t compute_pair_si(const size_t depth, const size_t idx_1, const size_t idx_2_start, const size_t n_idx_2,
+                           const bool use_stale) {
+        const CandidateManager<TypeSF> &c_manager = c_managers[depth];
+        SICache<TypeSF> &si_cache = si_caches[depth];
+        const TypeSF score = scores[depth];
+        const uint32_t c_1 = c_manager.get_c(idx_1);
+
+        size_t n_batch = 0;
+        size_t n_stale = 0;
+        for (size_t j = 0; j < n_idx_2; ++j) {
+            size_t idx_2 = idx_2_start + j;
+
+            // look in cache for value
+            size_t hash = si_cache.hash_2D(idx_1, idx_2);
+            TypeSF score_imp = si_cache.get_entry_2D(hash, idx_1, idx_2);
+            if (score_imp < 0 && use_stale) {
+                score_imp = get_stale_entry_2D(depth - 1, c_1, c_manager.get_c(idx_2));
+                n_stale += score_imp >= 0;
+            }
+            pair_si[j] = score_imp;
+            if (score_imp < 0) {
+                batch_pairs[n_batch] = {c_1, c_manager.get_c(idx_2)};
+                batch_idx[n_batch] = j;
+                batch_hash[n_batch] = hash;
+                n_batch += 1;
+            }
+        }
+
+        if (n_batch == 0) { return n_stale; }
+
+        sf_2D_batch(s, s_size, std::span<const std::pair<uint32_t, uint32_t>>(batch_pairs.data(), n_batch),
+                    std::span<TypeSF>(batch_si.data(), n_batch));
+        for (size_t m = 0; m < n_batch; ++m) {
+            size_t j = batch_idx[m];
+            pair_si[j] = batch_si[m] - score;
+            si_cache.insert_entry_2D(batch_hash[m], idx_1, idx_2_start + j, pair_si[j]);
+            if (!stale_caches.empty()) {
+                insert_stale_entry_2D(depth, batch_pairs[m].first, batch_pairs[m].second, pair_si[j]);
+            }
+        }
+        return n_stale;
+    };
+
+    /**
+     * Returns the gain of the pair {c_1, c_2} evaluated at the given depth, or
+     * -1 if it was not evaluated.
+     */
+    TypeSF get_stale_entry_2D(const size_t depth, uint32_t c_1, uint32_t c_2) {
+        if (c_1 > c_2) { std::swap(c_1, c_2); }
+        SICache<TypeSF> &stale_cache = stale_caches[depth];
+        return stale_cache.get_entry_2D(stale_cache.hash_2D(c_1, c_2), c_1, c_2);
+    };
+
+    void insert_stale_entry_2D(const size_t depth, uint32_t c_1, uint32_t c_2, const TypeSF si) {
+        if (c_1 > c_2) { std::swap(c_1, c_2); }
+        SICache<TypeSF> &stale_cache = stale_caches[depth];
+        stale_cache.insert_entry_2D(stale_cache.hash_2D(c_1, c_2), c_1, c_2, si);
+    };
+
+    /**
+     * Writes the sorted candidates of the set into stale_key.
+     */
+    void make_stale_key(const CandidateManager<TypeSF> &c_manager, const std::vector<size_t> &t_set, const size_t set_size) {
+        stale_key.resize(set_size);
+        for (size_t m = 0; m < set_size; ++m) {
+            stale_key[m] = c_manager.get_c(t_set[m]);
+        }
+        std::sort(stale_key.begin(), stale_key.end());
+    };
+
     /**
      * A wrapper function for the score function.
      *
@@ -842,17 +1513,23 @@ public:
         CandidateManager<TypeSF> &c_manger = c_managers[0];
         const TypeSF score = scores[0];
 
+        size_t n_batch = 0;
         for (size_t i = c_manger.offset; i < c_manger.size; ++i) {
             if (c_manger.get_acc(i) == 0) {
-                uint32_t c = c_manger.get_c(i);
-                s[s_size] = c;
-                TypeSF si = sf_1D(s, s_size + 1) - score;
-                c_manger.set_entry(i, c, si, 1);
+                batch_c[n_batch++] = c_manger.get_c(i);
             }
         }
+        sf_1D_batch(s, s_size, std::span<const uint32_t>(batch_c.data(), n_batch), std::span<TypeSF>(batch_si.data(), n_batch));
 
-        c_manger.sort();
-        c_manger.calc_csum();
+        size_t j = 0;
+        for (size_t i = c_manger.offset; i < c_manger.size; ++i) {
+            if (c_manger.get_acc(i) == 0) {
+                c_manger.set_entry(i, batch_c[j], batch_si[j] - score, 1);
+                j += 1;
+            }
+        }
+
+        c_manger.sort_and_calc_csum();
 
         return c_manger.size;
     };
@@ -886,6 +1563,10 @@ public:
         CandidateManager<TypeSF> &c_manager = c_managers[depth];
         c_manager.clear(r);
 
+        if (ac.LE_mode == 3) {
+            return DCO_CELF(depth, rank_threshold);
+        }
+
         // default: update all
         auto update_scheme = [&](size_t curr_rank, double curr_score) {
             if (ac.LE_mode == 0) {
@@ -900,20 +1581,16 @@ public:
         };
 
         if (ac.LE_mode == 0) {
-            // process all elements
+            // process all elements in one batch
+            const size_t n_batch = p_c_size - p_offset;
             for (size_t i = p_offset; i < p_c_size; ++i) {
-                // get old values
-                uint32_t c = pc_manager.get_c(i);
-                TypeSF si = pc_manager.get_si(i);
-                uint8_t accurate = 0;
-
-                // update and also update heap
-                s[s_size] = c;
-                si = sf_1D(s, s_size + 1) - score;
-                accurate = 1;
+                batch_c[i - p_offset] = pc_manager.get_c(i);
+            }
+            sf_1D_batch(s, s_size, std::span<const uint32_t>(batch_c.data(), n_batch), std::span<TypeSF>(batch_si.data(), n_batch));
 
-                // insert into the manager
-                c_manager.add_entry(c, si, accurate);
+            // insert into the manager
+            for (size_t i = 0; i < n_batch; ++i) {
+                c_manager.add_entry(batch_c[i], batch_si[i] - score, 1);
             }
         } else {
             // initialize the heap
@@ -941,12 +1618,18 @@ public:
                 if (update) {
                     // update and also update heap
                     s[s_size] = c;
-                    si = sf_1D(s, s_size + 1) - score;
+                    if (ac.LE_bounded_enabled) {
+                        // evaluate exactly, but let the structure record its block gains
+                        TypeSF new_score;
+                        sf_1D_bounded(s, s_size + 1, -std::numeric_limits<TypeSF>::max(), new_score);
+                        si = new_score - score;
+                    } else {
+                        si = sf_1D(s, s_size + 1) - score;
+                    }
                     accurate = 1;
 
                     // update the heap
-                    size_t idx = c_manager.SUB_heap_find(c);
-                    c_manager.SUB_heap_update(idx, si);
+                    c_manager.SUB_heap_update(c, si);
                 }
 
                 // insert into the manager
@@ -971,8 +1654,15 @@ public:
                 if (update) {
                     // update and also update heap
                     s[s_size] = c;
-                    si = sf_1D(s, s_size + 1) - score;
-                    accurate = 1;
+                    if (ac.LE_bounded_enabled) {
+                        // stop early if the candidate can not enter the heap
+                        TypeSF new_score;
+                        accurate = sf_1D_bounded(s, s_size + 1, score + c_manager.SUB_heap_min(), new_score);
+                        si = accurate ? new_score - score : std::min(si, new_score - score);
+                    } else {
+                        si = sf_1D(s, s_size + 1) - score;
+                        accurate = 1;
+                    }
                 }
 
                 // update the heap, this will only insert if si is large enough
@@ -983,8 +1673,72 @@ public:
             }
         }
 
-        c_manager.sort();
-        c_manager.calc_csum();
+        c_manager.sort_and_calc_csum();
+
+        return c_manager.size;
+    };
+
+    /**
+     * Lazy greedy (CELF) variant of the dynamic candidate ordering. The parent
+     * score improvements are upper bounds by submodularity, so the candidates
+     * are kept in a max-heap and only the top is re-evaluated. A top that is
+     * already accurate is final and moved to the sorted prefix. The loop stops
+     * once the top r candidates prove that the node can be pruned (SUB), once
+     * all remaining candidates would be removed by RPC, or once
+     * max(r, rank_threshold) candidates are accurate. Remaining candidates keep
+     * their parent score improvement.
+     *
+     * @param depth The current depth of the search tree.
+     * @param rank_threshold Minimum number of accurate candidates.
+     * @return Number of candidates, 0 if the node can be pruned.
+     */
+    size_t DCO_CELF(const size_t depth, const size_t rank_threshold) {
+        const CandidateManager<TypeSF> &pc_manager = c_managers[depth - 1];
+        const size_t p_c_size = pc_manager.size;
+        const size_t p_offset = pc_manager.offset;
+
+        const size_t r = k - s_size;
+        const TypeSF score = scores[depth];
+        const TypeSF r_score = best_score - score;
+        const size_t n_accurate = std::max(r, rank_threshold);
+
+        CandidateManager<TypeSF> &c_manager = c_managers[depth];
+
+        // the parent candidates are sorted descending, so adding them in order is a valid heap
+        c_manager.prepare_candidate_heap(p_c_size - p_offset);
+        for (size_t i = p_offset; i < p_c_size; ++i) {
+            c_manager.add_to_candidate_heap(pc_manager.get_c(i), pc_manager.get_si(i));
+        }
+
+        while (!c_manager.candidate_heap_is_empty()) {
+            const size_t n_sorted = c_manager.n_sorted_candidates;
+            const TypeSF top_si = c_manager.top_candidate_heap_get_si();
+
+            // all remaining candidates are bounded by the top
+            if (n_sorted + 1 >= r && c_manager.get_partial_sum(0, r - 1) + top_si <= r_score) {
+                if (n_sorted < r) {
+                    return 0;
+                }
+                break;
+            }
+
+            if (n_sorted >= n_accurate) {
+                break;
+            }
+
+            if (c_manager.top_candidate_heap_is_accurate()) {
+                c_manager.top_candidate_heap_remove();
+
+                if (c_manager.n_sorted_candidates == r && c_manager.get_partial_sum(0, r) <= r_score) {
+                    return 0;
+                }
+            } else {
+                s[s_size] = c_manager.top_candidate_heap_get_c();
+                c_manager.top_candidate_heap_update(sf_1D(s, s_size + 1) - score);
+            }
+        }
+
+        c_manager.candidate_heap_sort_remaining();
 
         return c_manager.size;
     };
@@ -1098,9 +1852,12 @@ public:
         const size_t r = k - s_size;
         const TypeSF score = scores[depth];
         const size_t n_remaining = c_manager.size - c_manager.offset;
-        const bool need_candidates = ac.UB2D_safe_skip_enabled;
 
-        size_t l = std::min(ac.determine_UB2D_l(n, k, n_remaining, r), n_remaining);
+        size_t l = ac.determine_UB2D_l(n, k, n_remaining, r);
+        if (ac.oracle_scheduler_enabled) {
+            l = scheduler.scale_l(OracleScheduler::UB2D, depth, l);
+        }
+        l = std::min(l, n_remaining);
         if (l < 2) {
             return std::numeric_limits<TypeSF>::max();
         }
@@ -1110,8 +1867,8 @@ public:
         auto &ub2d_algorithm = ub2d_algorithms[depth];
         ub2d_algorithm.reinitialize(l, ac.UB2D_alg_type);
 
-        // lazy skip
-        if (ub2d_manager.do_lazy_skip()) {
+        // lazy skip, the scheduler already decides the rate of the calls
+        if (!ac.oracle_scheduler_enabled && ub2d_manager.do_lazy_skip()) {
             return std::numeric_limits<TypeSF>::max();
         }
 
@@ -1124,25 +1881,64 @@ public:
         }
         ub2d_manager.clear();
 
-        // Initialize the pairwise score improvements
+        // first try the pair gains of the parent as upper bounds
+        if (UB2D_fill_edges(depth, l, !stale_caches.empty() && depth > 0) > 0) {
+            TypeSF stale_bound = score + UB2D_si_bound(depth, l, false);
+            if (stale_bound <= best_score) {
+                return stale_bound;
+            }
+
+            ub2d_algorithm.reinitialize(l, ac.UB2D_alg_type);
+            UB2D_fill_edges(depth, l, false);
+        }
+
+        return score + UB2D_si_bound(depth, l, true);
+    };
+
+    /**
+     * Inserts the pairwise score improvements of the first l candidates as
+     * edges into the UB2D algorithm of the given depth.
+     *
+     * @param depth The current depth of the search tree.
+     * @param l Number of candidates.
+     * @param use_stale Whether to use the values of the parent depth.
+     * @return The number of values taken from the parent depth.
+     */
+    size_t UB2D_fill_edges(const size_t depth, const size_t l, const bool use_stale) {
+        const CandidateManager<TypeSF> &c_manager = c_managers[depth];
+        auto &ub2d_algorithm = ub2d_algorithms[depth];
+
+        size_t n_stale = 0;
         for (size_t i = 0; i < l; ++i) {
             size_t idx_1 = c_manager.offset + i;
-            s[s_size] = c_manager.get_c(idx_1);
+            n_stale += compute_pair_si(depth, idx_1, idx_1 + 1, l - i - 1, use_stale);
 
             for (size_t j = i + 1; j < l; ++j) {
-                size_t idx_2 = c_manager.offset + j;
-
-                // look in cache for value
-                size_t hash = si_cache.hash_2D(idx_1, idx_2);
-                TypeSF score_imp = si_cache.get_entry_2D(hash, idx_1, idx_2);
-                if (score_imp < 0) {
-                    s[s_size + 1] = c_manager.get_c(idx_2);
-                    score_imp = sf_2D(s, s_size + 2) - score;
-                    si_cache.insert_entry_2D(hash, idx_1, idx_2, score_imp);
-                }
-                ub2d_algorithm.add_edge(i, j, score_imp);
+                ub2d_algorithm.add_edge(i, j, pair_si[j - i - 1]);
             }
         }
+        return n_stale;
+    };
+
+    /**
+     * Calculates the UB2D bound on the score improvement from the edges of the
+     * UB2D algorithm.
+     *
+     * @param depth The current depth of the search tree.
+     * @param l Number of candidates.
+     * @param record If false, the solutions are not stored in the manager and
+     * the calculation stops as soon as the bound can not prune.
+     * @return The bound on the score improvement.
+     */
+    TypeSF UB2D_si_bound(const size_t depth, const size_t l, const bool record) {
+        const bool need_candidates = record && ac.UB2D_safe_skip_enabled;
+        const CandidateManager<TypeSF> &c_manager = c_managers[depth];
+        const size_t r = k - s_size;
+        const TypeSF score = scores[depth];
+        const size_t n_remaining = c_manager.size - c_manager.offset;
+
+        auto &ub2d_manager = ub2d_managers[depth];
+        auto &ub2d_algorithm = ub2d_algorithms[depth];
 
         // calculate the upper bound
         TypeSF ub2d_r_si_bound = -std::numeric_limits<TypeSF>::max();
@@ -1285,14 +2081,14 @@ public:
                 }
             }
 
-            if (!ac.UB2D_RPC_enabled && best_score < score + ub2d_r_si_bound) {
+            if ((!ac.UB2D_RPC_enabled || !record) && best_score < score + ub2d_r_si_bound) {
                 // when no rpc, we can stop if we have found a true better solution
                 break;
             }
 
         }
 
-        return score + ub2d_r_si_bound;
+        return ub2d_r_si_bound;
     };
 
     /**
@@ -1310,13 +2106,12 @@ public:
         const size_t r = k - s_size;
         const TypeSF score = scores[depth];
         const size_t n_remaining = c_manager.size - c_manager.offset;
-        const bool need_candidates = ac.PBF_safe_skip_enabled;
 
         UpperBoundManager<TypeSF> &pbf_manager = pbf_managers[depth];
         SICache<TypeSF> &si_cache = si_caches[depth];
 
-        // lazy skip
-        if (pbf_manager.do_lazy_skip()) {
+        // lazy skip, the scheduler already decides the rate of the calls
+        if (!ac.oracle_scheduler_enabled && pbf_manager.do_lazy_skip()) {
             return std::numeric_limits<TypeSF>::max();
         }
 
@@ -1329,6 +2124,9 @@ public:
         }
 
         size_t n_b = ac.determine_PBF_n(n, k, n_remaining, r);
+        if (ac.oracle_scheduler_enabled) {
+            n_b = scheduler.scale_l(OracleScheduler::PBF, depth, n_b);
+        }
         size_t l_b = std::min(r, ac.determine_PBF_l(n, k, n_remaining, r)); // if r is smaller there is no use to check larger sets
 
         while (n_b * l_b > n_remaining) {
@@ -1343,6 +2141,38 @@ public:
         PBFAlgorithm<TypeSF> &pbf_alg = pbf_algorithms[depth];
         pbf_alg.reinitialize(n_b, l_b, r, ac.PBF_alg_type, ac.PBF_safe_skip_enabled);
 
+        // first try the pair and set gains of the parent as upper bounds
+        if (PBF_fill_sets(depth, n_b, l_b, !stale_caches.empty() && depth > 0) > 0) {
+            TypeSF stale_bound = score + PBF_si_bound(depth, l, false);
+            if (stale_bound <= best_score) {
+                return stale_bound;
+            }
+
+            pbf_alg.reinitialize(n_b, l_b, r, ac.PBF_alg_type, ac.PBF_safe_skip_enabled);
+            PBF_fill_sets(depth, n_b, l_b, false);
+        }
+
+        return score + PBF_si_bound(depth, l, true);
+    };
+
+    /**
+     * Inserts the score improvements of all subsets of each block into the PBF
+     * algorithm of the given depth.
+     *
+     * @param depth The current depth of the search tree.
+     * @param n_b Number of blocks.
+     * @param l_b Size of each block.
+     * @param use_stale Whether to use the values of the parent depth.
+     * @return The number of values taken from the parent depth.
+     */
+    size_t PBF_fill_sets(const size_t depth, const size_t n_b, const size_t l_b, const bool use_stale) {
+        const CandidateManager<TypeSF> &c_manager = c_managers[depth];
+        const TypeSF score = scores[depth];
+        SICache<TypeSF> &si_cache = si_caches[depth];
+        PBFAlgorithm<TypeSF> &pbf_alg = pbf_algorithms[depth];
+
+        size_t n_stale = 0;
+
         // insert the 1d score improvements
         for (size_t b_id = 0; b_id < n_b; ++b_id) {
             for (size_t j = 0; j < l_b; ++j) {
@@ -1355,20 +2185,12 @@ public:
         for (size_t b_id = 0; b_id < n_b; ++b_id) {
             // Initialize the pairwise score improvements
             for (size_t i = 0; i < l_b; ++i) {
+                size_t idx_1 = c_manager.offset + (b_id * l_b) + i;
+                n_stale += compute_pair_si(depth, idx_1, idx_1 + 1, l_b - i - 1, use_stale);
+
                 for (size_t j = i + 1; j < l_b; ++j) {
-                    size_t idx_1 = c_manager.offset + (b_id * l_b) + i;
                     size_t idx_2 = c_manager.offset + (b_id * l_b) + j;
-
-                    // look in cache for value
-                    size_t hash = si_cache.hash_2D(idx_1, idx_2);
-                    TypeSF score_imp = si_cache.get_entry_2D(hash, idx_1, idx_2);
-                    if (score_imp < 0) {
-                        s[s_size] = c_manager.get_c(idx_1);
-                        s[s_size + 1] = c_manager.get_c(idx_2);
-                        score_imp = sf_2D(s, s_size + 2) - score;
-                        si_cache.insert_entry_2D(hash, idx_1, idx_2, score_imp);
-                    }
-                    pbf_alg.add_set_2(b_id, idx_1, idx_2, score_imp);
+                    pbf_alg.add_set_2(b_id, idx_1, idx_2, pair_si[j - i - 1]);
                 }
             }
         }
@@ -1396,15 +2218,49 @@ public:
                     // look for score improvement in cache
                     size_t hash = si_cache.vector_hash(set);
                     TypeSF score_imp = si_cache.get_entry(hash, set);
+                    if (score_imp < 0 && use_stale) {
+                        make_stale_key(c_manager, set, j);
+                        SICache<TypeSF> &stale_cache = stale_caches[depth - 1];
+                        score_imp = stale_cache.get_entry(stale_cache.vector_hash(stale_key), stale_key);
+                        n_stale += score_imp >= 0;
+                    }
                     if (score_imp < 0) {
                         score_imp = sf_XD(s, s_size + j) - score;
                         si_cache.insert_entry(hash, set, score_imp);
+                        if (!stale_caches.empty()) {
+                            make_stale_key(c_manager, set, j);
+                            SICache<TypeSF> &stale_cache = stale_caches[depth];
+                            stale_cache.insert_entry(stale_cache.vector_hash(stale_key), stale_key, score_imp);
+                        }
                     }
                     pbf_alg.add_set(b_id, set, j, score_imp);
                 }
             }
         }
 
+        return n_stale;
+    };
+
+    /**
+     * Calculates the PBF bound on the score improvement from the sets of the
+     * PBF algorithm.
+     *
+     * @param depth The current depth of the search tree.
+     * @param l Number of candidates in all blocks.
+     * @param record If false, the solutions are not stored in the manager and
+     * the calculation stops as soon as the bound can not prune.
+     * @return The bound on the score improvement.
+     */
+    TypeSF PBF_si_bound(const size_t depth, const size_t l, const bool record) {
+        const bool need_candidates = record && ac.PBF_safe_skip_enabled;
+        const CandidateManager<TypeSF> &c_manager = c_managers[depth];
+        const size_t r = k - s_size;
+        const TypeSF score = scores[depth];
+        const size_t n_remaining = c_manager.size - c_manager.offset;
+
+        UpperBoundManager<TypeSF> &pbf_manager = pbf_managers[depth];
+        PBFAlgorithm<TypeSF> &pbf_alg = pbf_algorithms[depth];
+
         // calculate the upper bound
         TypeSF pbf_r_si_bound = -std::numeric_limits<TypeSF>::max();
         TypeSF pbf_r1_si_bound = -std::numeric_limits<TypeSF>::max();
@@ -1465,14 +2321,14 @@ public:
                 }
             }
 
-            if (!ac.PBF_RPC_enabled && best_score < score + pbf_r_si_bound) {
+            if ((!ac.PBF_RPC_enabled || !record) && best_score < score + pbf_r_si_bound) {
                 // when no rpc, we can stop if we have found a true better solution
                 break;
             }
 
         }
 
-        return score + pbf_r_si_bound;
+        return pbf_r_si_bound;
     };
 
     /**
@@ -1486,17 +2342,21 @@ public:
         const TypeSF r_score = best_score - score;
         const bool need_candidates = ac.REC_safe_skip_enabled;
 
-        auto rec_manager = rec_managers[depth];
+        UpperBoundManager<TypeSF> &rec_manager = rec_managers[depth];
         SICache<TypeSF> &si_cache = si_caches[depth];
 
-        size_t l = std::min(ac.determine_REC_l(n, k, n_remaining, r), n_remaining);
+        size_t l = ac.determine_REC_l(n, k, n_remaining, r);
+        if (ac.oracle_scheduler_enabled) {
+            l = scheduler.scale_l(OracleScheduler::REC, depth, l);
+        }
+        l = std::min(l, n_remaining);
 
         if (l == n_remaining) {
             return std::numeric_limits<TypeSF>::max();
         }
 
-        // lazy skip
-        if (rec_manager.do_lazy_skip()) {
+        // lazy skip, the scheduler already decides the rate of the calls
+        if (!ac.oracle_scheduler_enabled && rec_manager.do_lazy_skip()) {
             return std::numeric_limits<TypeSF>::max();
         }
 
@@ -1541,14 +2401,15 @@ public:
                 rec_sol.resize(1);
                 rec_sol[0] = c_manager.get_c(c_manager.offset);
             } else {
-                rec_ac.k = s_size + n_candidates_p1;
-                rec_ac.score_threshold = score + (r_score - sum_p2);
-                rec_ac.finalize();
-                auto tree_search = TreeSearchIterative<T, TypeSF>(t, rec_ac);
-                auto res = tree_search.search();
+                TreeSearchIterative<T, TypeSF> &rec_search = rec_searches[depth];
+                rec_search.reset(s, s_size, c_manager, l, n_candidates_p1, score + (r_score - sum_p2));
+                rec_search.search();
+                if (rec_search.time_exceeded) {
+                    return std::numeric_limits<TypeSF>::max();
+                }
 
-                sum_p1 = tree_search.best_score - score;
-                rec_sol = tree_search.best_s;
+                sum_p1 = rec_search.best_score - score;
+                rec_sol.assign(rec_search.best_s.begin() + s_size, rec_search.best_s.begin() + s_size + n_candidates_p1);
             }
 
             if (rec_r_si_bound < sum_p1 + sum_p2) {
@@ -1660,8 +2521,15 @@ public:
         content += "\"initial_score\" : " + to_JSON_value(initial_score) + ",\n";
         content += "\"best_greedy_s\" : " + to_JSON(best_greedy_s) + ",\n";
         content += "\"best_greedy_score\" : " + to_JSON_value(best_greedy_score) + ",\n";
+        content += "\"GRASP_best_score\" : " + to_JSON_value(GRASP_best_score) + ",\n";
+        content += "\"GRASP_best_start\" : " + to_JSON_value((int) GRASP_best_start) + ",\n";
+        content += "\"GRASP_n_finished\" : " + to_JSON_value(GRASP_n_finished) + ",\n";
         content += "\"best_s\" : " + to_JSON(best_s) + ",\n";
         content += "\"best_score\" : " + to_JSON_value(best_score) + ",\n";
+        if constexpr (requires { t.merge_error_bound; }) {
+            content += "\"n_columns\" : " + to_JSON_value(t.n_columns) + ",\n";
+            content += "\"merge_error_bound\" : " + to_JSON_value(t.merge_error_bound) + ",\n";
+        }
         content += "\"time_needed\" : " + to_JSON_value(time_needed) + ",\n";
         content += "\"time_limit_exceeded\" : " + to_JSON_value(time_exceeded) + ",\n";
         content += "\"UB2D_success_time\" : " + to_JSON_value(UB2D_success_time) + ",\n";
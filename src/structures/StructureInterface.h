@@ -1,13 +1,64 @@
 #ifndef SMSM_STRUCTUREINTERFACE_H
 #define SMSM_STRUCTUREINTERFACE_H
 
+#include <concepts>
 #include <vector>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
+#include <span>
+#include <utility>
 
 /**
- * Interface for structures, so that all score functions can be called in the
- * same way.
+ * Requirements for structures, so that all score functions can be called in
+ * the same way. The search algorithms are templated on the structure, so all
+ * calls are resolved at compile time and can be inlined.
+ *
+ * evaluate_empty_set: Gives the score for the empty set.
+ * evaluate_1D: Gives the score for the set that has only added one element.
+ * evaluate_2D: Gives the score for the set that has only added two elements.
+ * evaluate_XD: Gives the score for sets that have added more than two elements.
+ * evaluate_general: Gives the score for any set of any size.
+ * evaluate_1D_batch: Gives the score of S + {c} for each candidate c, where S
+ *     has s_size elements.
+ * evaluate_2D_batch: Gives the score of S + {a, b} for each pair (a, b), where
+ *     S has s_size elements. Pairs with the same first element should be
+ *     consecutive, so the structure can share work between them.
+ * finalize: Processes the structure after it has been read.
+ * initialize_helping_structures: Will initialize helping structures for k
+ *     depths, that can help with score function evaluation.
+ * visit_new_depth: Signals to the structure, that a new depth will be
+ *     explored. Use this function to keep the helping structures up to date.
+ * return_from_last_depth: Signals to the structure, that we returned from the
+ *     last depth.
+ *
+ * @tparam T The structure.
+ * @tparam TypeSF Datatype of the score function.
+ */
+template<typename T, typename TypeSF>
+concept SubmodularStructure = requires(T &t,
+                                       const std::vector<uint32_t> &s,
+                                       size_t s_size,
+                                       std::span<const uint32_t> candidates,
+                                       std::span<const std::pair<uint32_t, uint32_t>> pairs,
+                                       std::span<TypeSF> batch_scores) {
+    { t.get_n() } -> std::convertible_to<size_t>;
+    { t.max_reachable_score } -> std::convertible_to<TypeSF>;
+    { t.evaluate_empty_set() } -> std::convertible_to<TypeSF>;
+    { t.evaluate_1D(s, s_size) } -> std::convertible_to<TypeSF>;
+    { t.evaluate_2D(s, s_size) } -> std::convertible_to<TypeSF>;
+    { t.evaluate_XD(s, s_size) } -> std::convertible_to<TypeSF>;
+    { t.evaluate_general(s, s_size) } -> std::convertible_to<TypeSF>;
+    t.evaluate_1D_batch(s, s_size, candidates, batch_scores);
+    t.evaluate_2D_batch(s, s_size, pairs, batch_scores);
+    t.finalize();
+    t.initialize_helping_structures(s_size);
+    t.visit_new_depth(s, s_size);
+    t.return_from_last_depth();
+};
+
+/**
+ * Common base of all structures.
  *
  * @tparam TypeSF Datatype of the score function.
  */
@@ -15,73 +66,6 @@ template<typename TypeSF>
 class StructureInterface {
 public:
     TypeSF max_reachable_score = std::numeric_limits<TypeSF>::max(); // maximum reachable score
-
-    /**
-     * Gives the score for the empty set.
-     *
-     * @return Score of empty set.
-     */
-    virtual inline TypeSF evaluate_empty_set() = 0;
-
-    /**
-     * Gives the score for the set that has only added one element.
-     *
-     * @return Score of the set.
-     */
-    virtual inline TypeSF evaluate_1D(const std::vector<uint32_t> &s, size_t s_size) = 0;
-
-    /**
-     * Gives the score for the set that has only added two elements.
-     *
-     * @return Score of the set.
-     */
-    virtual inline TypeSF evaluate_2D(const std::vector<uint32_t> &s, size_t s_size) = 0;
-
-    /**
-     * Evaluates the score function, for sets that have added more than two
-     * elements.
-     *
-     * @param s The set S.
-     * @param s_size The size of set S.
-     */
-    virtual inline TypeSF evaluate_XD(const std::vector<uint32_t> &s, size_t s_size) = 0;
-
-    /**
-     * Evaluates the score function in the most general way. The function
-     * should be able to accept any set of any size.
-     *
-     * @param s The set S.
-     * @param s_size The size of set S.
-     */
-    virtual inline TypeSF evaluate_general(const std::vector<uint32_t> &s, size_t s_size) = 0;
-
-    /**
-    * Processes the graph after all edges have been added.
-    */
-    virtual inline void finalize() = 0;
-
-    /**
-     * Will initialize helping structures, that can help with score function
-     * evaluation.
-     *
-     * @param k Number of depths, the search algorithm can explore.
-     */
-    virtual inline void initialize_helping_structures(size_t k) = 0;
-
-    /**
-     * Signals to the structure, that a new depth will be explored. Use this
-     * function to keep the helping structures up to date.
-     *
-     * @param s The set S, that is present at the new depth.
-     * @param s_size Size of the set S.
-     */
-    virtual inline void visit_new_depth(const std::vector<uint32_t> &s, size_t s_size) = 0;
-
-    /**
-     * Signals to the structure, that we returned from the last depth. Use this
-     * function to keep the helping structures up to date.
-     */
-    virtual inline void return_from_last_depth() = 0;
 };
 
 #endif //SMSM_STRUCTUREINTERFACE_H
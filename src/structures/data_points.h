@@ -96,7 +96,7 @@ public:
         std::cout << "write to " << file_path << std::endl;
     };
 
-    inline void finalize() override {
+    inline void finalize() {
         for (size_t i = 0; i < n_data_points; ++i) {
             auto &vec = data_points[i];
             if (vec.size() != dimensionality) {
@@ -106,11 +106,11 @@ public:
         }
     };
 
-    inline TypeSF evaluate_empty_set() override { return 0.0; };
+    inline TypeSF evaluate_empty_set() { return 0.0; };
 
-    inline TypeSF evaluate_1D([[maybe_unused]] const std::vector<uint32_t> &s, [[maybe_unused]] const size_t s_size) override { return 0.0; };
+    inline TypeSF evaluate_1D([[maybe_unused]] const std::vector<uint32_t> &s, [[maybe_unused]] const size_t s_size) { return 0.0; };
 
-    inline TypeSF evaluate_2D([[maybe_unused]] const std::vector<uint32_t> &s, [[maybe_unused]] const size_t s_size) override { return 0.0; };
+    inline TypeSF evaluate_2D([[maybe_unused]] const std::vector<uint32_t> &s, [[maybe_unused]] const size_t s_size) { return 0.0; };
 
     /**
      * Evaluates the score function.
@@ -118,7 +118,7 @@ public:
      * @param s The set S.
      * @param s_size The size of set S.
      */
-    inline TypeSF evaluate_XD([[maybe_unused]] const std::vector<uint32_t> &s, [[maybe_unused]] size_t s_size) override { return 0.0; };
+    inline TypeSF evaluate_XD([[maybe_unused]] const std::vector<uint32_t> &s, [[maybe_unused]] size_t s_size) { return 0.0; };
 
     /**
      * Evaluates the score function.
@@ -126,7 +126,7 @@ public:
      * @param s The set S.
      * @param s_size The size of set S.
      */
-    inline TypeSF evaluate_general([[maybe_unused]] const std::vector<uint32_t> &s, [[maybe_unused]] size_t s_size) override { return 0.0; };
+    inline TypeSF evaluate_general([[maybe_unused]] const std::vector<uint32_t> &s, [[maybe_unused]] size_t s_size) { return 0.0; };
 
     /**
      * Will initialize helping structures, that can help with score function
@@ -134,7 +134,7 @@ public:
      *
      * @param max_depth Maximum depth the searching algorithm will explore.
      */
-    inline void initialize_helping_structures([[maybe_unused]] size_t max_depth) override {};
+    inline void initialize_helping_structures([[maybe_unused]] size_t max_depth) {};
 
     /**
      * Signals to the structure, that a new depth will be explored.
@@ -142,13 +142,13 @@ public:
      * @param s The set S, that is present at the new depth.
      * @param s_size Size of the set S.
      */
-    inline void visit_new_depth([[maybe_unused]] const std::vector<uint32_t> &s, [[maybe_unused]] size_t s_size) override {};
+    inline void visit_new_depth([[maybe_unused]] const std::vector<uint32_t> &s, [[maybe_unused]] size_t s_size) {};
 
     /**
      * Signals to the structure, that we returned from the last depth.
      */
 
-    inline void return_from_last_depth() override {};
+    inline void return_from_last_depth() {};
 };
 
 #endif //SMSM_DATA_POINTS_H
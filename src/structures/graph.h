@@ -5,6 +5,8 @@
 #include <cstddef>
 #include <cstdlib>
 #include <iterator>
+#include <limits>
+#include <numeric>
 #include <optional>
 #include <vector>
 #include <fstream>
@@ -25,6 +27,11 @@ public:
     size_t n_edges = 0;
     std::vector<std::vector<uint32_t>> adj_list;
 
+    // classes of interchangeable vertices, empty if not determined
+    static constexpr uint32_t no_twin_class = std::numeric_limits<uint32_t>::max();
+    std::vector<uint32_t> twin_class; // class of each vertex, no_twin_class if the vertex has no twin
+    size_t n_twin_classes = 0;
+
 public:
     /**
      * Initializes a graph.
@@ -165,6 +172,47 @@ public:
         }
     };
 
+    /**
+     * Groups the vertices into classes of twins. Two vertices are twins if
+     * they have the same open neighbourhood (false twins) or the same closed
+     * neighbourhood (true twins), self loops are ignored. Exchanging two
+     * twins is an automorphism of the graph, so every score function that
+     * only depends on the graph gives the same score for both sets. A vertex
+     * can not have a true and a false twin at the same time, so the classes
+     * are disjoint. The neighbourhoods have to be sorted.
+     */
+    inline void determine_twin_classes() {
+        std::vector<std::vector<uint32_t>> open(n_nodes);
+        std::vector<std::vector<uint32_t>> closed(n_nodes);
+        for (uint32_t u = 0; u < n_nodes; ++u) {
+            for (uint32_t v: adj_list[u]) {
+                if (v != u) { open[u].push_back(v); }
+            }
+            closed[u] = open[u];
+            closed[u].insert(std::lower_bound(closed[u].begin(), closed[u].end(), u), u);
+        }
+
+        twin_class.assign(n_nodes, no_twin_class);
+        n_twin_classes = 0;
+        std::vector<uint32_t> order(n_nodes);
+        for (const std::vector<std::vector<uint32_t>> *neighbourhoods: {&open, &closed}) {
+            const std::vector<std::vector<uint32_t>> &nb = *neighbourhoods;
+            std::iota(order.begin(), order.end(), 0);
+            std::stable_sort(order.begin(), order.end(), [&nb](uint32_t a, uint32_t b) { return nb[a] < nb[b]; });
+
+            size_t i = 0;
+            while (i < n_nodes) {
+                size_t end = i + 1;
+                while (end < n_nodes && nb[order[end]] == nb[order[i]]) { end += 1; }
+                if (end - i > 1) {
+                    for (size_t j = i; j < end; ++j) { twin_class[order[j]] = (uint32_t) n_twin_classes; }
+                    n_twin_classes += 1;
+                }
+                i = end;
+            }
+        }
+    };
+
 
     /**
      * Returns a string representation of the graph.
@@ -209,23 +257,23 @@ public:
         file.close();
     };
 
-    inline void finalize() override { sort_unique_neighbours(); };
+    inline void finalize() { sort_unique_neighbours(); };
 
-    inline TypeSF evaluate_empty_set() override { return 0.0; };
+    inline TypeSF evaluate_empty_set() { return 0.0; };
 
-    inline TypeSF evaluate_1D([[maybe_unused]] const std::vector<uint32_t> &s, [[maybe_unused]] const size_t s_size) override { return 0.0; };
+    inline TypeSF evaluate_1D([[maybe_unused]] const std::vector<uint32_t> &s, [[maybe_unused]] const size_t s_size) { return 0.0; };
 
-    inline TypeSF evaluate_2D([[maybe_unused]] const std::vector<uint32_t> &s, [[maybe_unused]] const size_t s_size) override { return 0.0; };
+    inline TypeSF evaluate_2D([[maybe_unused]] const std::vector<uint32_t> &s, [[maybe_unused]] const size_t s_size) { return 0.0; };
 
-    inline TypeSF evaluate_XD([[maybe_unused]] const std::vector<uint32_t> &s, [[maybe_unused]] size_t s_size) override { return 0.0; };
+    inline TypeSF evaluate_XD([[maybe_unused]] const std::vector<uint32_t> &s, [[maybe_unused]] size_t s_size) { return 0.0; };
 
-    inline TypeSF evaluate_general([[maybe_unused]] const std::vector<uint32_t> &s, [[maybe_unused]] size_t s_size) override { return 0.0; };
+    inline TypeSF evaluate_general([[maybe_unused]] const std::vector<uint32_t> &s, [[maybe_unused]] size_t s_size) { return 0.0; };
 
-    inline void initialize_helping_structures([[maybe_unused]] size_t k) override {};
+    inline void initialize_helping_structures([[maybe_unused]] size_t k) {};
 
-    inline void visit_new_depth([[maybe_unused]] const std::vector<uint32_t> &s, [[maybe_unused]] size_t s_size) override {};
+    inline void visit_new_depth([[maybe_unused]] const std::vector<uint32_t> &s, [[maybe_unused]] size_t s_size) {};
 
-    inline void return_from_last_depth() override {};
+    inline void return_from_last_depth() {};
 };
 
 #endif //SMSM_GRAPH_H
@@ -1,6 +1,8 @@
 #ifndef SMSM_GRAPH_NEGATIVEGROUPFARNESS_H
 #define SMSM_GRAPH_NEGATIVEGROUPFARNESS_H
 
+#include <span>
+
 #include <boost/align/aligned_allocator.hpp>
 
 #include "../utility/util.h"
@@ -24,23 +26,151 @@ public:
     std::vector<std::vector<TypeSF, boost::alignment::aligned_allocator<TypeSF, 64>>> min_dist;
     std::vector<TypeSF, boost::alignment::aligned_allocator<TypeSF, 64>> temp_min;
 
-    inline TypeSF evaluate_empty_set() override {
+    // block gains for the bounded evaluation
+    BlockGainCache<TypeSF> block_gains;
+
+    inline TypeSF evaluate_empty_set() {
         return -(TypeSF) (Graph<TypeSF>::n_nodes * Graph<TypeSF>::n_nodes);
     };
 
-    inline TypeSF evaluate_1D(const std::vector<uint32_t> &s, const size_t s_size) override {
+    inline TypeSF evaluate_1D(const std::vector<uint32_t> &s, const size_t s_size) {
         TypeSF score = sum_of_min(min_dist[depth], dist_mtx[s[s_size - 1]]);
         ASSERT(evaluate_general(s, s_size) == -score);
         return -score;
     };
 
-    inline TypeSF evaluate_2D(const std::vector<uint32_t> &s, const size_t s_size) override {
+    /**
+     * Evaluates S + {c} for several candidates c at once. The candidates are
+     * processed in groups of four, so the current minimum vector is streamed
+     * only once per group instead of once per candidate.
+     *
+     * @param s The current set S.
+     * @param s_size The size of S (without the candidates).
+     * @param candidates The candidates to evaluate.
+     * @param batch_scores Receives the score of S + {c} for each candidate.
+     */
+    inline void evaluate_1D_batch([[maybe_unused]] const std::vector<uint32_t> &s, [[maybe_unused]] const size_t s_size,
+                                  std::span<const uint32_t> candidates, std::span<TypeSF> batch_scores) {
+        const TypeSF *v = min_dist[depth].data();
+        const size_t n_candidates = candidates.size();
+
+        size_t i = 0;
+        for (; i + 4 <= n_candidates; i += 4) {
+            sum_of_min_4_64(&batch_scores[i], v,
+                 dist_mtx[candidates[i]].data(), dist_mtx[candidates[i + 1]].data(),
+                 dist_mtx[candidates[i + 2]].data(), dist_mtx[candidates[i + 3]].data(), padded_n_nodes);
+            for (size_t j = i; j < i + 4; ++j) {
+                batch_scores[j] = -batch_scores[j];
+            }
+        }
+        for (; i < n_candidates; ++i) {
+            batch_scores[i] = -sum_of_min(min_dist[depth], dist_mtx[candidates[i]]);
+        }
+
+#if ASSERT_ENABLED
+        std::vector<uint32_t> temp_s(s.begin(), s.begin() + (long) s_size);
+        temp_s.push_back(0);
+        for (size_t j = 0; j < n_candidates; ++j) {
+            temp_s[s_size] = candidates[j];
+            ASSERT(evaluate_general(temp_s, s_size + 1) == batch_scores[j]);
+        }
+#endif
+    };
+
+    /**
+     * Evaluates S like evaluate_1D, but processes the minimum in blocks and
+     * stops as soon as the score is proven to be at most `max_score`. The gain
+     * of each block can only shrink when S grows, so the block gains of the
+     * candidate recorded at the deepest ancestor bound the unprocessed blocks.
+     * Without such a record the score is always computed exactly.
+     *
+     * @param s The set S, the last element is the new candidate.
+     * @param s_size The size of S.
+     * @param max_score The score up to which the exact value is not needed.
+     * @param score Receives the exact score, or an upper bound <= max_score.
+     * @return True if the score is exact, false if it is an upper bound.
+     */
+    inline bool evaluate_1D_bounded(const std::vector<uint32_t> &s, const size_t s_size, const TypeSF max_score, TypeSF &score) {
+        TypeSF sum_min = 0;
+        bool exact = block_gains.evaluate(depth, s[s_size - 1], min_dist[depth].data(), dist_mtx[s[s_size - 1]].data(), padded_n_nodes,
+                                          -max_score, sum_min);
+
+        score = -sum_min;
+        ASSERT(!exact || double_eq((double) evaluate_general(s, s_size), (double) score, 0.0001));
+        ASSERT(exact || (double) evaluate_general(s, s_size) <= (double) score + 0.0001);
+        return exact;
+    };
+
+    /**
+     * Allocates the block gains of the bounded evaluation, has to be called
+     * after initialize_helping_structures() on depth 0.
+     */
+    inline void enable_bounded_evaluation() {
+        block_gains.enable(min_dist.size(), Graph<TypeSF>::n_nodes);
+    };
+
+    inline TypeSF evaluate_2D(const std::vector<uint32_t> &s, const size_t s_size) {
         TypeSF score = sum_of_min(min_dist[depth], dist_mtx[s[s_size - 2]], dist_mtx[s[s_size - 1]]);
         ASSERT(evaluate_general(s, s_size) == -score);
         return -score;
     };
 
-    inline TypeSF evaluate_XD(const std::vector<uint32_t> &s, size_t s_size) override {
+    /**
+     * Evaluates S + {a, b} for several pairs at once. Consecutive pairs with
+     * the same first element share the minimum with its row, the second
+     * elements are then processed in groups of four.
+     *
+     * @param s The current set S.
+     * @param s_size The size of S (without the pairs).
+     * @param pairs The pairs to evaluate.
+     * @param batch_scores Receives the score of S + {a, b} for each pair.
+     */
+    inline void evaluate_2D_batch([[maybe_unused]] const std::vector<uint32_t> &s, [[maybe_unused]] const size_t s_size,
+                                  std::span<const std::pair<uint32_t, uint32_t>> pairs, std::span<TypeSF> batch_scores) {
+        const size_t n_pairs = pairs.size();
+
+        size_t i = 0;
+        while (i < n_pairs) {
+            const uint32_t first = pairs[i].first;
+            size_t end = i + 1;
+            while (end < n_pairs && pairs[end].first == first) {
+                end += 1;
+            }
+
+            if (end - i == 1) {
+                batch_scores[i] = -sum_of_min(min_dist[depth], dist_mtx[first], dist_mtx[pairs[i].second]);
+                i = end;
+                continue;
+            }
+
+            min(temp_min, min_dist[depth], dist_mtx[first]);
+            const TypeSF *v = temp_min.data();
+            for (; i + 4 <= end; i += 4) {
+                sum_of_min_4_64(&batch_scores[i], v,
+                     dist_mtx[pairs[i].second].data(), dist_mtx[pairs[i + 1].second].data(),
+                     dist_mtx[pairs[i + 2].second].data(), dist_mtx[pairs[i + 3].second].data(), padded_n_nodes);
+                for (size_t j = i; j < i + 4; ++j) {
+                    batch_scores[j] = -batch_scores[j];
+                }
+            }
+            for (; i < end; ++i) {
+                batch_scores[i] = -sum_of_min(temp_min, dist_mtx[pairs[i].second]);
+            }
+        }
+
+#if ASSERT_ENABLED
+        std::vector<uint32_t> temp_s(s.begin(), s.begin() + (long) s_size);
+        temp_s.push_back(0);
+        temp_s.push_back(0);
+        for (size_t j = 0; j < n_pairs; ++j) {
+            temp_s[s_size] = pairs[j].first;
+            temp_s[s_size + 1] = pairs[j].second;
+            ASSERT(evaluate_general(temp_s, s_size + 2) == batch_scores[j]);
+        }
+#endif
+    };
+
+    inline TypeSF evaluate_XD(const std::vector<uint32_t> &s, size_t s_size) {
         size_t n_new_elements = s_size - depth;
 
         min(temp_min, min_dist[depth], dist_mtx[s[depth]]);
@@ -52,7 +182,7 @@ public:
         return -score;
     };
 
-    inline TypeSF evaluate_general(const std::vector<uint32_t> &s, size_t s_size) override {
+    inline TypeSF evaluate_general(const std::vector<uint32_t> &s, size_t s_size) {
         if (s_size == 0) {
             return -(TypeSF) (Graph<TypeSF>::n_nodes * Graph<TypeSF>::n_nodes);
         } else if (s_size == 1) {
@@ -69,15 +199,16 @@ public:
         return -score;
     };
 
-    inline void finalize() override {
+    inline void finalize() {
         Graph<TypeSF>::sort_unique_neighbours();
         temp_min.resize(padded_n_nodes);
         initialize_dist_mtx();
+        initialize_blocks();
 
         Graph<TypeSF>::max_reachable_score = 0;
     };
 
-    inline void initialize_helping_structures(size_t k) override {
+    inline void initialize_helping_structures(size_t k) {
         min_dist.clear();
         min_dist.resize((k + 1), std::vector<TypeSF, boost::alignment::aligned_allocator<TypeSF, 64>>(padded_n_nodes, std::numeric_limits<TypeSF>::max()));
 
@@ -87,16 +218,19 @@ public:
             }
         }
 
+        block_gains.reset();
+
         depth = 0;
     };
 
-    inline void visit_new_depth(const std::vector<uint32_t> &s, size_t s_size) override {
+    inline void visit_new_depth(const std::vector<uint32_t> &s, size_t s_size) {
         depth += 1;
 
         min(min_dist[depth], min_dist[(depth - 1)], dist_mtx[s[s_size - 1]]);
+        block_gains.visit_new_depth(depth, min_dist[depth].data(), padded_n_nodes);
     };
 
-    inline void return_from_last_depth() override {
+    inline void return_from_last_depth() {
         depth -= 1;
     };
 
@@ -146,6 +280,14 @@ public:
             }
         }
     };
+
+    /**
+     * Splits the rows into at most 8 blocks (multiples of 64 elements) for the
+     * bounded evaluation.
+     */
+    inline void initialize_blocks() {
+        block_gains.set_blocks(padded_n_nodes);
+    };
 };
 
 #endif //SMSM_GRAPH_NEGATIVEGROUPFARNESS_H
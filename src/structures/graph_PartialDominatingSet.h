@@ -1,6 +1,9 @@
 #ifndef SMSM_GRAPH_PARTIALDOMINATINGSET_H
 #define SMSM_GRAPH_PARTIALDOMINATINGSET_H
 
+#include <span>
+#include <utility>
+
 #include "graph.h"
 
 /**
@@ -16,12 +19,14 @@ public:
     std::vector<TypeSF> scores;
     std::vector<std::vector<uint8_t>> vertex_sets;
     std::vector<uint8_t> temp;
+    std::vector<uint8_t> batch_mark; // all zero between calls
+    std::vector<uint8_t> dominated; // vertices that never have to be candidates, empty if not determined
 
-    inline TypeSF evaluate_empty_set() override {
+    inline TypeSF evaluate_empty_set() {
         return 0;
     };
 
-    inline TypeSF evaluate_1D(const std::vector<uint32_t> &s, const size_t s_size) override {
+    inline TypeSF evaluate_1D(const std::vector<uint32_t> &s, const size_t s_size) {
         TypeSF score = scores[depth];
 
         score += !vertex_sets[depth][s[s_size - 1]];
@@ -34,7 +39,39 @@ public:
         return score;
     };
 
-    inline TypeSF evaluate_2D(const std::vector<uint32_t> &s, const size_t s_size) override {
+    /**
+     * Evaluates S + {c} for several candidates at once.
+     *
+     * @param s The current set S.
+     * @param s_size The size of S (without the candidates).
+     * @param candidates The candidates to evaluate.
+     * @param batch_scores Receives the score of S + {c} for each candidate.
+     */
+    inline void evaluate_1D_batch([[maybe_unused]] const std::vector<uint32_t> &s, [[maybe_unused]] const size_t s_size,
+                                  std::span<const uint32_t> candidates, std::span<TypeSF> batch_scores) {
+        const std::vector<uint8_t> &covered = vertex_sets[depth];
+        const TypeSF base_score = scores[depth];
+
+        for (size_t i = 0; i < candidates.size(); ++i) {
+            const uint32_t c = candidates[i];
+            TypeSF score = base_score + !covered[c];
+            for (uint32_t neighbour: Graph<TypeSF>::adj_list[c]) {
+                score += !covered[neighbour];
+            }
+            batch_scores[i] = score;
+        }
+
+#if ASSERT_ENABLED
+        std::vector<uint32_t> temp_s(s.begin(), s.begin() + (long) s_size);
+        temp_s.push_back(0);
+        for (size_t j = 0; j < candidates.size(); ++j) {
+            temp_s[s_size] = candidates[j];
+            ASSERT(evaluate_general(temp_s, s_size + 1) == batch_scores[j]);
+        }
+#endif
+    };
+
+    inline TypeSF evaluate_2D(const std::vector<uint32_t> &s, const size_t s_size) {
         overwrite(temp, vertex_sets[depth]);
         TypeSF score = scores[depth];
 
@@ -56,7 +93,67 @@ public:
         return score;
     };
 
-    inline TypeSF evaluate_XD(const std::vector<uint32_t> &s, size_t s_size) override {
+    /**
+     * Evaluates S + {a, b} for several pairs at once. For consecutive pairs
+     * with the same first element, the vertices newly covered by a are marked
+     * once and the second elements only count what is still uncovered.
+     *
+     * @param s The current set S.
+     * @param s_size The size of S (without the pairs).
+     * @param pairs The pairs to evaluate.
+     * @param batch_scores Receives the score of S + {a, b} for each pair.
+     */
+    inline void evaluate_2D_batch([[maybe_unused]] const std::vector<uint32_t> &s, [[maybe_unused]] const size_t s_size,
+                                  std::span<const std::pair<uint32_t, uint32_t>> pairs, std::span<TypeSF> batch_scores) {
+        const std::vector<uint8_t> &covered = vertex_sets[depth];
+        const size_t n_pairs = pairs.size();
+
+        size_t i = 0;
+        while (i < n_pairs) {
+            const uint32_t first = pairs[i].first;
+
+            // mark everything the first element covers additionally
+            TypeSF first_score = scores[depth];
+            if (!covered[first]) {
+                batch_mark[first] = 1;
+                first_score += 1;
+            }
+            for (uint32_t neighbour: Graph<TypeSF>::adj_list[first]) {
+                if (!covered[neighbour] && !batch_mark[neighbour]) {
+                    batch_mark[neighbour] = 1;
+                    first_score += 1;
+                }
+            }
+
+            for (; i < n_pairs && pairs[i].first == first; ++i) {
+                const uint32_t second = pairs[i].second;
+                TypeSF score = first_score + (!covered[second] && !batch_mark[second]);
+                for (uint32_t neighbour: Graph<TypeSF>::adj_list[second]) {
+                    score += (neighbour != second) && !covered[neighbour] && !batch_mark[neighbour];
+                }
+                batch_scores[i] = score;
+            }
+
+            // reset the marks
+            batch_mark[first] = 0;
+            for (uint32_t neighbour: Graph<TypeSF>::adj_list[first]) {
+                batch_mark[neighbour] = 0;
+            }
+        }
+
+#if ASSERT_ENABLED
+        std::vector<uint32_t> temp_s(s.begin(), s.begin() + (long) s_size);
+        temp_s.push_back(0);
+        temp_s.push_back(0);
+        for (size_t j = 0; j < n_pairs; ++j) {
+            temp_s[s_size] = pairs[j].first;
+            temp_s[s_size + 1] = pairs[j].second;
+            ASSERT(evaluate_general(temp_s, s_size + 2) == batch_scores[j]);
+        }
+#endif
+    };
+
+    inline TypeSF evaluate_XD(const std::vector<uint32_t> &s, size_t s_size) {
         size_t n_new_elements = s_size - depth;
 
         overwrite(temp, vertex_sets[depth]);
@@ -77,7 +174,7 @@ public:
         return score;
     };
 
-    inline TypeSF evaluate_general(const std::vector<uint32_t> &s, size_t s_size) override {
+    inline TypeSF evaluate_general(const std::vector<uint32_t> &s, size_t s_size) {
         TypeSF score = 0;
 
         std::fill(temp.begin(), temp.end(), 0);
@@ -96,14 +193,64 @@ public:
         return score;
     };
 
-    inline void finalize() override {
+    inline void finalize() {
         Graph<TypeSF>::sort_unique_neighbours();
         temp.resize(Graph<TypeSF>::n_nodes);
+        batch_mark.resize(Graph<TypeSF>::n_nodes, 0);
 
         Graph<TypeSF>::max_reachable_score = Graph<TypeSF>::n_nodes;
     };
 
-    inline void initialize_helping_structures(size_t k) override {
+    /**
+     * Marks every vertex u whose closed neighbourhood N[u] is contained in the
+     * closed neighbourhood N[v] of another vertex v. Replacing u by v in any
+     * set does not decrease the score, so u does not have to be a candidate.
+     * If N[u] = N[v], only the vertex with the larger id is marked, so every
+     * marked vertex has an unmarked dominator. Since u is in N[v], only the
+     * neighbours of u with a closed neighbourhood at least as large are
+     * tested, by merging the sorted adjacency lists.
+     */
+    inline void determine_dominated_vertices() {
+        const std::vector<std::vector<uint32_t>> &adj_list = Graph<TypeSF>::adj_list;
+        const size_t n_nodes = Graph<TypeSF>::n_nodes;
+
+        // size of the closed neighbourhood, the adjacency list may contain the vertex itself
+        std::vector<size_t> closed_degree(n_nodes);
+        for (size_t u = 0; u < n_nodes; ++u) {
+            closed_degree[u] = adj_list[u].size() + !std::binary_search(adj_list[u].begin(), adj_list[u].end(), (uint32_t) u);
+        }
+
+        dominated.assign(n_nodes, 0);
+        for (uint32_t u = 0; u < n_nodes; ++u) {
+            for (uint32_t v: adj_list[u]) {
+                if (v == u || closed_degree[v] < closed_degree[u]) { continue; }
+                if (closed_degree[v] == closed_degree[u] && v > u) { continue; }
+
+                if (closed_neighbourhood_contained(u, v)) {
+                    dominated[u] = 1;
+                    break;
+                }
+            }
+        }
+    };
+
+    /**
+     * Checks if N[u] is contained in N[v] for adjacent vertices u and v.
+     */
+    inline bool closed_neighbourhood_contained(uint32_t u, uint32_t v) const {
+        const std::vector<uint32_t> &adj_u = Graph<TypeSF>::adj_list[u];
+        const std::vector<uint32_t> &adj_v = Graph<TypeSF>::adj_list[v];
+
+        size_t j = 0;
+        for (uint32_t w: adj_u) {
+            if (w == v || w == u) { continue; }
+            while (j < adj_v.size() && adj_v[j] < w) { j += 1; }
+            if (j == adj_v.size() || adj_v[j] != w) { return false; }
+        }
+        return true;
+    };
+
+    inline void initialize_helping_structures(size_t k) {
         vertex_sets.clear();
         vertex_sets.resize(k + 1, std::vector<uint8_t>(Graph<TypeSF>::n_nodes, 0));
 
@@ -113,7 +260,7 @@ public:
         depth = 0;
     };
 
-    inline void visit_new_depth(const std::vector<uint32_t> &s, size_t s_size) override {
+    inline void visit_new_depth(const std::vector<uint32_t> &s, size_t s_size) {
         depth += 1;
 
         scores[depth] = scores[depth - 1];
@@ -128,7 +275,7 @@ public:
         }
     };
 
-    inline void return_from_last_depth() override {
+    inline void return_from_last_depth() {
         depth -= 1;
     };
 };
@@ -19,7 +19,10 @@ AlgorithmConfiguration parse_command_line(int argc, char *argv[], bool verbose)
             ("help,h", "Produces a help message")
             ("type,t", boost_po::value<std::string>(&ac.structure_type), "Which structure is given (important for reading the input file)")
             ("input-file,i", boost_po::value<std::string>(&ac.input_file_path), "Path to the file holding the structure")
+            ("initial-solution", boost_po::value<std::string>(&ac.initial_solution_path), "Path to a JSON file holding an initial set (key \"best_s\" or \"s\")")
             ("k,k", boost_po::value<size_t>(&ac.k), "Size of the set.")
+            ("k-range", boost_po::value<std::vector<std::string>>()->multitoken(), "Solves every size of the set from k_min to k_max (instead of -k)")
+            ("batch", boost_po::value<std::vector<std::string>>()->multitoken(), "Solves the jobs of a JSONL manifest on a thread pool, each line holds the arguments of one job (instead of -t, -i, -k and -s)")
             ("score-function,s", boost_po::value<std::string>(&ac.score_function), "The function to maximize")
             ("output-file,o", boost_po::value<std::string>(&ac.output_file_path), "Path to the output file")
             ("verbose,v", boost_po::value<std::size_t>(&ac.verbose_level), "The verbose level")
@@ -27,13 +30,24 @@ AlgorithmConfiguration parse_command_line(int argc, char *argv[], bool verbose)
             ("measure-oracle", boost_po::value<bool>(&ac.measure_oracle_time)->default_value(false), "Whether to measure oracle time")
             ("SUB", boost_po::value<bool>(&ac.SUB_enabled)->default_value(false), "Enables Simple-Upper-Bound heuristic")
             ("RPC", boost_po::value<bool>(&ac.RPC_enabled)->default_value(false), "Enables Reduction-of-Possible-Candidates heuristic")
+            ("Dominance", boost_po::value<bool>(&ac.dominance_enabled)->default_value(false), "Whether candidates that can be replaced by another candidate without loss are removed (partial-dominating-set)")
+            ("Twins", boost_po::value<bool>(&ac.twins_enabled)->default_value(false), "Whether vertices with the same neighbourhood are detected and only one of them is branched on per node (graphs)")
+            ("Column-Reduction", boost_po::value<bool>(&ac.column_reduction_enabled)->default_value(false), "Whether identical data points share one weighted column of the distance matrix (k-medoid)")
+            ("Merge-Epsilon", boost_po::value<double>(&ac.column_merge_epsilon)->default_value(0.0), "Data points within this distance of a representative are merged into its column, the scores are then approximate (k-medoid)")
             ("LE", boost_po::value<std::vector<std::string>>()->multitoken(), "Enables Lazy-Evaluation")
+            ("LE-Bounded", boost_po::value<bool>(&ac.LE_bounded_enabled)->default_value(false), "Whether Lazy-Evaluation may stop evaluations early with an upper bound")
             ("UB2D", boost_po::value<std::vector<std::string>>()->multitoken(), "Enables Upper-Bound-2D-Dynamic heuristic")
             ("PBF", boost_po::value<std::vector<std::string>>()->multitoken(), "Enables Partial-Brute-Force heuristic")
+            ("Stale-Bounds", boost_po::value<bool>(&ac.stale_bounds_enabled)->default_value(false), "Whether UB2D and PBF first try the pair and set gains of the parent as upper bounds")
+            ("UB2D-Warm-Matching", boost_po::value<bool>(&ac.UB2D_warm_matching_enabled)->default_value(false), "Whether the UB2D matching keeps its Blossom V instance and only updates the edge costs between nodes")
+            ("Oracle-Scheduler", boost_po::value<bool>(&ac.oracle_scheduler_enabled)->default_value(false), "Whether UB2D, PBF and REC are called and sized by their measured success per depth instead of the fixed depth settings")
             ("REC", boost_po::value<std::vector<std::string>>()->multitoken(), "Enables Recursive heuristic")
             ("BFThreshold", boost_po::value<std::vector<std::string>>()->multitoken(), "Sets the Brute Force Threshold")
             ("Plain", boost_po::value<bool>(&ac.plain)->default_value(false), "Whether to check for the plain algorithm")
-            ("Greedy-Local-Search", boost_po::value<bool>(&ac.greedy_local_search)->default_value(false), "Whether to enable Greedy Local Search");
+            ("Greedy-Local-Search", boost_po::value<bool>(&ac.greedy_local_search)->default_value(false), "Whether to enable Greedy Local Search")
+            ("Greedy", boost_po::value<std::vector<std::string>>()->multitoken(), "Sets the greedy algorithm for the initial solution")
+            ("Local-Search", boost_po::value<std::vector<std::string>>()->multitoken(), "Sets the exchange policy of the greedy local search (swap scoring for sum-of-min structures)")
+            ("GRASP", boost_po::value<std::vector<std::string>>()->multitoken(), "Enables the GRASP multi-start before the search (sum-of-min structures)");
 
     boost_po::variables_map vm;
     boost_po::store(boost_po::parse_command_line(argc, argv, description), vm);
@@ -48,6 +62,16 @@ AlgorithmConfiguration parse_command_line(int argc, char *argv[], bool verbose)
         verbose = ac.verbose_level > 0;
     }
 
+    // a batch reads the required arguments of each job from the manifest
+    if (vm.count("batch")) {
+        std::vector<std::string> batch_option = vm["batch"].as<std::vector<std::string>>();
+        ac.parse_batch(batch_option, verbose);
+        if (vm.count("o") || vm.count("output-file")) {
+            ac.write_output = true;
+        }
+        return ac;
+    }
+
     // check required arguments
     if (!vm.count("type") && !vm.count("t")) {
         if (verbose) {
@@ -61,12 +85,16 @@ AlgorithmConfiguration parse_command_line(int argc, char *argv[], bool verbose)
         }
         ac.invalid = true;
     }
-    if (!vm.count("k")) {
+    if (!vm.count("k") && !vm.count("k-range")) {
         if (verbose) {
             std::cout << "-k [ --k  ] not specified\n";
         }
         ac.invalid = true;
     }
+    if (vm.count("k-range")) {
+        std::vector<std::string> k_range_option = vm["k-range"].as<std::vector<std::string>>();
+        ac.parse_k_range(k_range_option, verbose);
+    }
     if (!vm.count("score-function") && !vm.count("s")) {
         if (verbose) {
             std::cout << "-s [ --score-function  ] not specified\n";
@@ -128,6 +156,21 @@ AlgorithmConfiguration parse_command_line(int argc, char *argv[], bool verbose)
         ac.parse_BFThreshold(bf_threshold_option, verbose);
     }
 
+    if (vm.count("Greedy")) {
+        std::vector<std::string> greedy_option = vm["Greedy"].as<std::vector<std::string>>();
+        ac.parse_Greedy(greedy_option, verbose);
+    }
+
+    if (vm.count("Local-Search")) {
+        std::vector<std::string> local_search_option = vm["Local-Search"].as<std::vector<std::string>>();
+        ac.parse_Local_Search(local_search_option, verbose);
+    }
+
+    if (vm.count("GRASP")) {
+        std::vector<std::string> grasp_option = vm["GRASP"].as<std::vector<std::string>>();
+        ac.parse_GRASP(grasp_option, verbose);
+    }
+
     ac.finalize();
 
     return ac;
@@ -23,7 +23,13 @@ public:
 
     std::string structure_type; // 'graph', 'k-medoid'
     std::string input_file_path; // path to a file holding the data
+    std::string initial_solution_path; // path to a JSON file holding an initial set, empty if none
     size_t k; // required size of the set
+    size_t k_range_min = 0; // first size of the k-range, 0 if only k is solved
+    size_t k_range_max = 0; // last size of the k-range
+    std::string batch_manifest_path; // path to a JSONL file with one job per line, empty if no batch is run
+    size_t batch_n_threads = 1; // number of jobs solved at the same time
+    size_t batch_cache_mb = 0; // memory limit of the loaded structures in MB
     std::string score_function; // string specifying the score function
 
     double score_threshold = std::numeric_limits<double>::max(); // if a set of size k with a greater score has been found, it will return
@@ -32,6 +38,7 @@ public:
     std::string output_file_path = "../out.JSON"; // path specifying the file
 
     bool measure_oracle_time = false; // whether to measure oracle time
+    bool oracle_scheduler_enabled = false; // whether the oracle calls are scheduled online by their measured success
 
     double time_limit = std::numeric_limits<double>::max(); // given time limit
     size_t verbose_level = 0; // verbose level
@@ -42,6 +49,17 @@ public:
 
     bool greedy_local_search = false;
 
+    // Configuration of the initial greedy solution
+    uint32_t greedy_type = 0; // 0 - Plain, 1 - Lazy, 2 - Stochastic
+    double greedy_epsilon = 0.1; // sample size parameter of the stochastic greedy
+    uint32_t local_search_type = 0; // 0 - Plain, 1 - Swap with best improvement, 2 - Swap with first improvement
+
+    // Configuration of the GRASP multi-start (only for sum-of-min structures)
+    size_t GRASP_n_starts = 0; // 0 - disabled
+    double GRASP_time_limit = 0.0; // time budget in seconds (0 == infinite), capped by the time left in the search
+    double GRASP_alpha = 0.2; // size of the restricted candidate list
+    uint64_t GRASP_seed = 0;
+
     // if to use the plain algorithm
     bool plain = false;
 
@@ -51,11 +69,25 @@ public:
     // Configuration for RPC
     bool RPC_enabled = false;
 
+    // whether candidates that are dominated by another candidate are removed (only for supporting structures)
+    bool dominance_enabled = false;
+
+    // whether only one twin of each twin class is branched on per node (only for graphs)
+    bool twins_enabled = false;
+
+    // whether identical (or close) data points share one weighted column of the distance matrix (only for k-medoid)
+    bool column_reduction_enabled = false;
+    double column_merge_epsilon = 0.0;
+
     // Configuration for Lazy Evaluation
-    size_t LE_mode = 0; // 0 - disabled, 1 - score or rank, 2 - score and rank
+    size_t LE_mode = 0; // 0 - disabled, 1 - score or rank, 2 - score and rank, 3 - CELF
     double LE_y_rank_value = 0; // the rank y value
     size_t LE_rank_var = 0; // 0 - none, 1 - n, 2 - k, 3 - r_n, 4 - r_k
     double LE_y_score_value = 0; // the score y value
+    bool LE_bounded_enabled = false; // whether evaluations may stop early with a certified upper bound
+
+    // Configuration shared by the Upper Bound 2D and Partial Brute Force heuristic
+    bool stale_bounds_enabled = false; // whether pair and set gains of the parent are first tried as upper bounds
 
     // Configuration for the Upper Bound 2D heuristic
     bool UB2D_enabled = false;
@@ -63,9 +95,10 @@ public:
     size_t UB2D_l_var = 0; // 0 - no, 1 - n, 2 - k, 3 - r_n, 4 - r_k
     double UB2D_l_y = 0; // y value
     size_t UB2D_max_l = 0; // cap on how large the hyperparameter l can be
-    uint32_t UB2D_alg_type = 0; // 0 - invalid, 1 - Greedy, 2 - Matching, 3 - Brute Force, 4 - Dynamic
+    uint32_t UB2D_alg_type = 0; // 0 - invalid, 1 - Greedy, 2 - Matching, 3 - Brute Force, 4 - Dynamic, 5 - Edmonds
     uint32_t UB2D_odd_type = 0; // 0 - invalid, 1 - A (1 + pairs), 2 - B (pairs + 1), 3 - min(A, B)
     bool UB2D_RPC_enabled = true; // If we use RPC to remove elements
+    bool UB2D_warm_matching_enabled = false; // whether the Blossom V instances are warm-started across sibling nodes
     bool UB2D_safe_skip_enabled = false; // If we try to identify if we have tot start UB2D
     double UB2D_lazy_skip_start_value = 0.0; // start value for lazy skip heuristic
     double UB2D_lazy_skip_add_value = 1.0; // value to add to lazy skips
@@ -330,6 +363,7 @@ public:
             res = (size_t) REC_l_y;
         }
 
+        res = std::min(res, REC_max_l);
         return res;
     }
 
@@ -430,24 +464,44 @@ public:
 
         content += "\"structure-type\" : " + to_JSON_value(structure_type) + ",\n";
         content += "\"input-file-path\" : " + to_JSON_value(input_file_path) + ",\n";
+        content += "\"initial-solution-path\" : " + to_JSON_value(initial_solution_path) + ",\n";
         content += "\"k\" : " + to_JSON_value(k) + ",\n";
+        content += "\"k-range-min\" : " + to_JSON_value(k_range_min) + ",\n";
+        content += "\"k-range-max\" : " + to_JSON_value(k_range_max) + ",\n";
+        content += "\"batch-manifest-path\" : " + to_JSON_value(batch_manifest_path) + ",\n";
+        content += "\"batch-n-threads\" : " + to_JSON_value(batch_n_threads) + ",\n";
+        content += "\"batch-cache-mb\" : " + to_JSON_value(batch_cache_mb) + ",\n";
         content += "\"score-function\" : " + to_JSON_value(score_function) + ",\n";
 
         content += "\"score-threshold\" : " + ::to_JSON_value(score_threshold) + ",\n";
         content += "\"write-output\" : " + to_JSON_value(write_output) + ",\n";
         content += "\"output-file-path\" : " + to_JSON_value(output_file_path) + ",\n";
         content += "\"measure-oracle-time\" : " + to_JSON_value(measure_oracle_time) + ",\n";
+        content += "\"Oracle-scheduler-enabled\" : " + to_JSON_value(oracle_scheduler_enabled) + ",\n";
         content += "\"time-limit\" : " + to_JSON_value(time_limit) + ",\n";
         content += "\"verbose-level\" : " + to_JSON_value(verbose_level) + ",\n";
         content += "\"bf-threshold-n\" : " + to_JSON_value(bf_threshold_n) + ",\n";
         content += "\"bf-threshold-r\" : " + to_JSON_value(bf_threshold_r) + ",\n";
+        content += "\"Greedy-type\" : " + to_JSON_value(greedy_type) + ",\n";
+        content += "\"Greedy-epsilon\" : " + to_JSON_value(greedy_epsilon) + ",\n";
+        content += "\"Local-search-type\" : " + to_JSON_value(local_search_type) + ",\n";
+        content += "\"GRASP-n-starts\" : " + to_JSON_value(GRASP_n_starts) + ",\n";
+        content += "\"GRASP-time-limit\" : " + to_JSON_value(GRASP_time_limit) + ",\n";
+        content += "\"GRASP-alpha\" : " + to_JSON_value(GRASP_alpha) + ",\n";
+        content += "\"GRASP-seed\" : " + to_JSON_value((size_t) GRASP_seed) + ",\n";
         content += "\"SUB-enabled\" : " + to_JSON_value(SUB_enabled) + ",\n";
         content += "\"RPC-enabled\" : " + to_JSON_value(RPC_enabled) + ",\n";
+        content += "\"Dominance-enabled\" : " + to_JSON_value(dominance_enabled) + ",\n";
+        content += "\"Twins-enabled\" : " + to_JSON_value(twins_enabled) + ",\n";
+        content += "\"Column-reduction-enabled\" : " + to_JSON_value(column_reduction_enabled) + ",\n";
+        content += "\"Column-merge-epsilon\" : " + to_JSON_value(column_merge_epsilon) + ",\n";
 
         content += "\"LE-mode\" : " + to_JSON_value(LE_mode) + ",\n";
         content += "\"LE-y-rank-value\" : " + to_JSON_value(LE_y_rank_value) + ",\n";
         content += "\"LE-rank-var\" : " + to_JSON_value(LE_rank_var) + ",\n";
         content += "\"LE-y-score-value\" : " + to_JSON_value(LE_y_score_value) + ",\n";
+        content += "\"LE-bounded-enabled\" : " + to_JSON_value(LE_bounded_enabled) + ",\n";
+        content += "\"Stale-bounds-enabled\" : " + to_JSON_value(stale_bounds_enabled) + ",\n";
 
         content += "\"UB2D-enabled\" : " + to_JSON_value(UB2D_enabled) + ",\n";
         content += "\"UB2D-l-func\" : " + to_JSON_value(UB2D_l_func) + ",\n";
@@ -457,6 +511,7 @@ public:
         content += "\"UB2D-alg-type\" : " + to_JSON_value(UB2D_alg_type) + ",\n";
         content += "\"UB2D-odd-type\" : " + to_JSON_value(UB2D_odd_type) + ",\n";
         content += "\"UB2D-RPC-enabled\" : " + to_JSON_value(UB2D_RPC_enabled) + ",\n";
+        content += "\"UB2D-warm-matching-enabled\" : " + to_JSON_value(UB2D_warm_matching_enabled) + ",\n";
         content += "\"UB2D-safe-skips-enabled\" : " + to_JSON_value(UB2D_safe_skip_enabled) + ",\n";
         content += "\"UB2D-lazy-skip-start-value\" : " + to_JSON_value(UB2D_lazy_skip_start_value) + ",\n";
         content += "\"UB2D-lazy-skip-skip-add-value\" : " + to_JSON_value(UB2D_lazy_skip_add_value) + ",\n";
@@ -511,6 +566,25 @@ public:
 
     }
 
+    /**
+     * Maps the variable of a rank threshold to its LE_rank_var value.
+     *
+     * @param var_string One of n, k, r_n, r_k.
+     * @return The value or the maximum size_t if the variable is unknown.
+     */
+    static size_t parse_LE_rank_var(const std::string &var_string) {
+        if (var_string == "n") {
+            return 1;
+        } else if (var_string == "k") {
+            return 2;
+        } else if (var_string == "r_n") {
+            return 3;
+        } else if (var_string == "r_k") {
+            return 4;
+        }
+        return std::numeric_limits<size_t>::max();
+    }
+
     void parse_LE(std::vector<std::string> &le_option, bool verbose) {
         std::string err_msg = "--LE invalid input! Input is : >>";
         for (const auto &option: le_option) {
@@ -519,9 +593,9 @@ public:
         if (!le_option.empty()) {
             err_msg.pop_back();
         }
-        err_msg += "<<\nEither use:\n\t--LE Disabled\n\t--LE {Avg*y_1} {or, and} {n*y_2, k*y_2, r_n*y_2, r_k*y_2} for any y_1, y_2 >= 0\n";
+        err_msg += "<<\nEither use:\n\t--LE Disabled\n\t--LE {Avg*y_1} {or, and} {n*y_2, k*y_2, r_n*y_2, r_k*y_2} for any y_1, y_2 >= 0\n\t--LE CELF {n*y, k*y, r_n*y, r_k*y, y} for any y >= 0\n";
 
-        if (le_option.size() != 1 && le_option.size() != 3) {
+        if (le_option.size() != 1 && le_option.size() != 2 && le_option.size() != 3) {
             if (verbose) { std::cout << err_msg << std::endl; }
             invalid = true;
             return;
@@ -534,6 +608,31 @@ public:
             return;
         }
 
+        if (mode_string == "CELF") {
+            // lazy greedy, the rank is the minimum number of exact candidates
+            if (le_option.size() != 2) {
+                if (verbose) { std::cout << err_msg << std::endl; }
+                invalid = true;
+                return;
+            }
+            LE_mode = 3;
+
+            std::string rank_threshold_string = le_option[1];
+            if (contains(rank_threshold_string, '*')) {
+                std::vector<std::string> sub_strings = split(rank_threshold_string, '*');
+                LE_y_rank_value = std::stod(sub_strings[1]);
+                LE_rank_var = parse_LE_rank_var(sub_strings[0]);
+                if (LE_rank_var == std::numeric_limits<size_t>::max()) {
+                    if (verbose) { std::cout << err_msg << std::endl; }
+                    invalid = true;
+                }
+            } else {
+                LE_rank_var = 0;
+                LE_y_rank_value = std::stod(rank_threshold_string);
+            }
+            return;
+        }
+
         // check one more element is available
         if (le_option.size() != 3) {
             if (verbose) { std::cout << err_msg << std::endl; }
@@ -581,15 +680,8 @@ public:
             std::string y_string = sub_strings[1];
 
             LE_y_rank_value = std::stod(y_string);
-            if (var_string == "n") {
-                LE_rank_var = 1;
-            } else if (var_string == "k") {
-                LE_rank_var = 2;
-            } else if (var_string == "r_n") {
-                LE_rank_var = 3;
-            } else if (var_string == "r_k") {
-                LE_rank_var = 4;
-            } else {
+            LE_rank_var = parse_LE_rank_var(var_string);
+            if (LE_rank_var == std::numeric_limits<size_t>::max()) {
                 if (verbose) { std::cout << err_msg << std::endl; }
                 invalid = true;
                 return;
@@ -609,7 +701,7 @@ public:
             err_msg.pop_back();
         }
 
-        err_msg += "<<\nUse:\n\t--UB2D Disabled\n\t--UB2D {Sqrt[x]*y, x*y, y} {max_y} {Greedy, Matching, BForce, Dynamic} {A, B, AB} {0, 1} {0, 1} {lazy_start} {lazy_add} {low_depth_percentage} {high_depth_percentage} {sub_bound_percentage} for x in {n, k, r_n, r_k},y >= 0.0 (float), max_y >= 0 (int), 0.0 <= lazy_start <= 1.0 (float), 0.0 <= lazy_add <= 1.0 (float), 0.0 <= low_depth_percentage <= high_depth_percentage <= 1.0 (float), 0.0 <= sub_bound_percentage <= 1.0 (float).\n";
+        err_msg += "<<\nUse:\n\t--UB2D Disabled\n\t--UB2D {Sqrt[x]*y, x*y, y} {max_y} {Greedy, Matching, BForce, Dynamic, Edmonds} {A, B, AB} {0, 1} {0, 1} {lazy_start} {lazy_add} {low_depth_percentage} {high_depth_percentage} {sub_bound_percentage} for x in {n, k, r_n, r_k},y >= 0.0 (float), max_y >= 0 (int), 0.0 <= lazy_start <= 1.0 (float), 0.0 <= lazy_add <= 1.0 (float), 0.0 <= low_depth_percentage <= high_depth_percentage <= 1.0 (float), 0.0 <= sub_bound_percentage <= 1.0 (float).\n";
 
         if (ub2d_option.size() != 1 && ub2d_option.size() != 11) {
             if (verbose) { std::cout << err_msg << std::endl; }
@@ -700,12 +792,21 @@ public:
             UB2D_alg_type = 3;
         } else if (algorithm_string == "Dynamic") {
             UB2D_alg_type = 4;
+        } else if (algorithm_string == "Edmonds") {
+            UB2D_alg_type = 5;
         } else {
             if (verbose) { std::cout << err_msg << std::endl; }
             invalid = true;
             return;
         }
 
+        // the dynamic program stores the sets of nodes as 32 bit masks
+        if (UB2D_alg_type == 4 && UB2D_max_l > 31) {
+            if (verbose) { std::cout << "--UB2D invalid input! Dynamic only supports max_y <= 31, but max_y is " << UB2D_max_l << "." << std::endl; }
+            invalid = true;
+            return;
+        }
+
         // determine algorithm option
         std::string option_string = ub2d_option[3];
         if (option_string == "A") {
@@ -919,6 +1020,13 @@ public:
             return;
         }
 
+        // same limit as the dynamic program of UB2D
+        if (PBF_alg_type == 2 && PBF_max_l > 31) {
+            if (verbose) { std::cout << "--PBF invalid input! Dynamic only supports max_l <= 31, but max_l is " << PBF_max_l << "." << std::endl; }
+            invalid = true;
+            return;
+        }
+
         // determine RPC flag
         std::string rpc_string = pbf_option[5];
         PBF_RPC_enabled = std::stoi(rpc_string);
@@ -1105,6 +1213,168 @@ public:
         bf_threshold_n = std::stoi(bf_threshold_option[0]);
         bf_threshold_r = std::stoi(bf_threshold_option[1]);
     }
+
+    /**
+     * Parses the range of set sizes. k is set to the largest size, so that
+     * the structures are initialized for all sizes.
+     *
+     * @param k_range_option The options.
+     * @param verbose Whether to print error messages.
+     */
+    void parse_k_range(std::vector<std::string> &k_range_option, bool verbose) {
+        std::string err_msg = "--k-range invalid input! Input is : >>";
+        for (const auto &option: k_range_option) {
+            err_msg += option + " ";
+        }
+        if (!k_range_option.empty()) {
+            err_msg.pop_back();
+        }
+        err_msg += "<<\nUse:\n\t--k-range {k_min} {k_max} for 1 <= k_min <= k_max.\n";
+
+        if (k_range_option.size() != 2) {
+            if (verbose) { std::cout << err_msg << std::endl; }
+            invalid = true;
+            return;
+        }
+
+        k_range_min = std::stoul(k_range_option[0]);
+        k_range_max = std::stoul(k_range_option[1]);
+        if (k_range_min < 1 || k_range_min > k_range_max) {
+            if (verbose) { std::cout << err_msg << std::endl; }
+            invalid = true;
+            return;
+        }
+        k = k_range_max;
+    }
+
+    /**
+     * Parses the options of the batch mode.
+     *
+     * @param batch_option The options.
+     * @param verbose Whether to print error messages.
+     */
+    void parse_batch(std::vector<std::string> &batch_option, bool verbose) {
+        std::string err_msg = "--batch invalid input! Input is : >>";
+        for (const auto &option: batch_option) {
+            err_msg += option + " ";
+        }
+        if (!batch_option.empty()) {
+            err_msg.pop_back();
+        }
+        err_msg += "<<\nUse:\n\t--batch {manifest} {n_threads} {cache_mb} for n_threads >= 1.\n";
+
+        if (batch_option.size() != 3) {
+            if (verbose) { std::cout << err_msg << std::endl; }
+            invalid = true;
+            return;
+        }
+
+        batch_manifest_path = batch_option[0];
+        batch_n_threads = std::stoul(batch_option[1]);
+        batch_cache_mb = std::stoul(batch_option[2]);
+        if (batch_manifest_path.empty() || batch_n_threads < 1) {
+            if (verbose) { std::cout << err_msg << std::endl; }
+            invalid = true;
+            return;
+        }
+    }
+
+    /**
+     * Parses the options for the initial greedy solution.
+     *
+     * @param greedy_option The options.
+     * @param verbose Whether to print error messages.
+     */
+    void parse_Greedy(std::vector<std::string> &greedy_option, bool verbose) {
+        std::string err_msg = "--Greedy invalid input! Input is : >>";
+        for (const auto &option: greedy_option) {
+            err_msg += option + " ";
+        }
+        if (!greedy_option.empty()) {
+            err_msg.pop_back();
+        }
+        err_msg += "<<\nUse:\n\t--Greedy Plain\n\t--Greedy Lazy\n\t--Greedy Stochastic {epsilon} for 0 < epsilon < 1.\n";
+
+        if (greedy_option.size() == 1 && greedy_option[0] == "Plain") {
+            greedy_type = 0;
+        } else if (greedy_option.size() == 1 && greedy_option[0] == "Lazy") {
+            greedy_type = 1;
+        } else if (greedy_option.size() == 2 && greedy_option[0] == "Stochastic") {
+            greedy_type = 2;
+            greedy_epsilon = std::stod(greedy_option[1]);
+            if (greedy_epsilon <= 0.0 || greedy_epsilon >= 1.0) {
+                if (verbose) { std::cout << err_msg << std::endl; }
+                invalid = true;
+            }
+        } else {
+            if (verbose) { std::cout << err_msg << std::endl; }
+            invalid = true;
+        }
+    }
+
+    /**
+     * Parses the options for the greedy local search.
+     *
+     * @param local_search_option The options.
+     * @param verbose Whether to print error messages.
+     */
+    void parse_Local_Search(std::vector<std::string> &local_search_option, bool verbose) {
+        std::string err_msg = "--Local-Search invalid input! Input is : >>";
+        for (const auto &option: local_search_option) {
+            err_msg += option + " ";
+        }
+        if (!local_search_option.empty()) {
+            err_msg.pop_back();
+        }
+        err_msg += "<<\nUse:\n\t--Local-Search Plain\n\t--Local-Search Best\n\t--Local-Search First\n";
+
+        if (local_search_option.size() == 1 && local_search_option[0] == "Plain") {
+            local_search_type = 0;
+        } else if (local_search_option.size() == 1 && local_search_option[0] == "Best") {
+            local_search_type = 1;
+        } else if (local_search_option.size() == 1 && local_search_option[0] == "First") {
+            local_search_type = 2;
+        } else {
+            if (verbose) { std::cout << err_msg << std::endl; }
+            invalid = true;
+        }
+    }
+
+    /**
+     * Parses the options for the GRASP multi-start.
+     *
+     * @param grasp_option The options.
+     * @param verbose Whether to print error messages.
+     */
+    void parse_GRASP(std::vector<std::string> &grasp_option, bool verbose) {
+        std::string err_msg = "--GRASP invalid input! Input is : >>";
+        for (const auto &option: grasp_option) {
+            err_msg += option + " ";
+        }
+        if (!grasp_option.empty()) {
+            err_msg.pop_back();
+        }
+        err_msg += "<<\nUse:\n\t--GRASP {n_starts} {time_limit} {alpha} {seed} for time_limit >= 0 (0 == infinite) and 0 <= alpha <= 1.\n";
+
+        if (grasp_option.size() != 4) {
+            if (verbose) { std::cout << err_msg << std::endl; }
+            invalid = true;
+            return;
+        }
+
+        GRASP_n_starts = std::stoul(grasp_option[0]);
+        GRASP_time_limit = std::stod(grasp_option[1]);
+        GRASP_alpha = std::stod(grasp_option[2]);
+        GRASP_seed = std::stoull(grasp_option[3]);
+        if (GRASP_time_limit < 0.0 || GRASP_alpha < 0.0 || GRASP_alpha > 1.0) {
+            if (verbose) { std::cout << err_msg << std::endl; }
+            invalid = true;
+            return;
+        }
+        if (GRASP_time_limit == 0.0) {
+            GRASP_time_limit = std::numeric_limits<double>::max();
+        }
+    }
 };
 
 /**
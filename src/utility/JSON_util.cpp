@@ -45,11 +45,18 @@ std::string to_JSON_value(int n) {
 }
 
 std::string to_JSON_value(const std::string &s) {
-    return "\"" + s + "\"";
+    std::string content = "\"";
+    for (char c: s) {
+        if (c == '"' || c == '\\') {
+            content += '\\';
+        }
+        content += c;
+    }
+    return content + "\"";
 }
 
-std::vector<uint32_t> read_initial_vector(std::string &file_path) {
-    std::vector<uint32_t> s;
+bool read_initial_vector(const std::string &file_path, std::vector<uint32_t> &s, std::string &err_msg) {
+    s.clear();
 
     // open and read file
     std::string line;
@@ -61,29 +68,44 @@ std::vector<uint32_t> read_initial_vector(std::string &file_path) {
         }
         file.close();
     } else {
-        std::cout << "Could not read JSON file '" << file_path << "' as the initial solution file!" << std::endl;
-        exit(EXIT_FAILURE);
+        err_msg = "Could not read JSON file '" + file_path + "' as the initial solution file!";
+        return false;
     }
 
-    // remove all '\n', ' ', '{', '}', '[', ']' characters
+    // remove all '\n', '\t', ' ' characters
     content.erase(std::remove(content.begin(), content.end(), '\n'), content.end());
+    content.erase(std::remove(content.begin(), content.end(), '\t'), content.end());
     content.erase(std::remove(content.begin(), content.end(), ' '), content.end());
-    content.erase(std::remove(content.begin(), content.end(), '{'), content.end());
-    content.erase(std::remove(content.begin(), content.end(), '}'), content.end());
-    content.erase(std::remove(content.begin(), content.end(), '['), content.end());
-    content.erase(std::remove(content.begin(), content.end(), ']'), content.end());
 
-    // string should have the format '"s":x_1, x_2, ..., x_n'
-    std::string s_vec = split(content, ':')[1];
+    // the vector is the value of "best_s" (output file of a previous run) or of "s"
+    size_t key_pos = content.find("\"best_s\":[");
+    if (key_pos == std::string::npos) {
+        key_pos = content.find("\"s\":[");
+    }
+    size_t begin = key_pos == std::string::npos ? std::string::npos : content.find('[', key_pos);
+    size_t end = begin == std::string::npos ? std::string::npos : content.find(']', begin);
+    if (end == std::string::npos) {
+        err_msg = "Could not find the key \"best_s\" or \"s\" in the initial solution file '" + file_path + "'!";
+        return false;
+    }
+    std::string s_vec = content.substr(begin + 1, end - begin - 1);
 
     // get all numbers as strings
     std::vector<std::string> elements = split(s_vec, ',');
 
     // convert all string to integers.
     for (const std::string &s_e: elements) {
-        s.push_back(std::stoi(s_e));
+        if (s_e.empty()) {
+            continue;
+        }
+        try {
+            s.push_back(std::stoi(s_e));
+        } catch (const std::exception &) {
+            err_msg = "The initial solution file '" + file_path + "' holds the invalid element '" + s_e + "'!";
+            return false;
+        }
     }
     std::sort(s.begin(), s.end());
 
-    return s;
+    return true;
 }
@@ -9,6 +9,7 @@
 #include <fstream>
 #include <iostream>
 #include <algorithm>
+#include <stdexcept>
 
 #include "util.h"
 
@@ -109,11 +110,14 @@ std::string to_JSON(T *arr, size_t size) {
 }
 
 /**
- * Reads one vector from a JSON file.
+ * Reads one vector from a JSON file. The vector is the value of the key
+ * "best_s", so the output of a previous run can be used, or of the key "s".
  *
  * @param file_path Path to the file.
- * @return The vector.
+ * @param s The vector, sorted.
+ * @param err_msg Set to the reason if the file can not be read.
+ * @return False if the file can not be read.
  */
-std::vector<uint32_t> read_initial_vector(std::string &file_path);
+bool read_initial_vector(const std::string &file_path, std::vector<uint32_t> &s, std::string &err_msg);
 
 #endif //SMSM_JSON_UTIL_H
@@ -0,0 +1,172 @@
+#ifndef SMSM_STRUCTURECACHE_H
+#define SMSM_STRUCTURECACHE_H
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * Estimates the memory of the data of a structure, i.e. the distance matrix,
+ * the adjacency lists and the data points. Helping structures are not counted,
+ * a job allocates them on its copy after it was acquired. For the sum-of-min
+ * structures these are k + 1 minimum vectors of one row each, and with the
+ * bounded evaluation also up to 8 block gains and a stamp per element and
+ * depth. The memory limit should leave room for them for each job that runs
+ * at the same time.
+ */
+template<class T>
+size_t structure_bytes(const T &t) {
+    size_t bytes = sizeof(T);
+    if constexpr (requires { t.dist_mtx; }) {
+        for (const auto &row: t.dist_mtx) {
+            bytes += row.capacity() * sizeof(row[0]);
+        }
+    }
+    if constexpr (requires { t.adj_list; }) {
+        for (const auto &neighbours: t.adj_list) {
+            bytes += neighbours.capacity() * sizeof(uint32_t);
+        }
+    }
+    if constexpr (requires { t.vertex_sets; }) {
+        for (const auto &vertex_set: t.vertex_sets) {
+            bytes += vertex_set.capacity() * sizeof(vertex_set[0]);
+        }
+    }
+    if constexpr (requires { t.data_points; }) {
+        for (const auto &point: t.data_points) {
+            bytes += point.capacity() * sizeof(point[0]);
+        }
+    }
+    return bytes;
+}
+
+/**
+ * Least recently used cache of loaded and finalized structures. Each key is
+ * loaded and prepared once, jobs that wait for the same key in the meantime
+ * block until it is ready. The cached structure itself is never searched, a
+ * search changes its helping structures, so each job gets its own copy. The
+ * cached structures and the copies in use count toward the memory limit. An
+ * additional copy waits until it fits or no other copy is in use, cached
+ * structures without copies are evicted, least recently used first, to make
+ * room.
+ *
+ * @tparam T The structure.
+ */
+template<class T>
+class StructureCache {
+public:
+    struct Entry {
+        std::string key;
+        T structure;
+        size_t bytes = 0;
+        size_t n_copies = 0; // copies in use, the entry is not evicted while there are any
+
+        Entry(std::string t_key, const std::string &file_path) : key(std::move(t_key)), structure(file_path) {};
+    };
+
+    explicit StructureCache(size_t t_max_bytes) : max_bytes(t_max_bytes) {};
+
+    /**
+     * Returns a copy of the prepared structure of the key. The structure is
+     * loaded and prepared if it is not cached.
+     *
+     * @param key Identifies the file and the preparation of the structure.
+     * @param file_path Path to the file of the structure.
+     * @param prepare Finalizes a newly loaded structure.
+     * @return The copy, it has to be released after the job.
+     */
+    template<class Prepare>
+    T acquire(const std::string &key, const std::string &file_path, Prepare prepare) {
+        std::unique_lock<std::mutex> lock(mutex);
+        changed.wait(lock, [&] { return std::find(loading.begin(), loading.end(), key) == loading.end(); });
+
+        auto it = find(key);
+        if (it == entries.end()) {
+            n_loads += 1;
+            loading.push_back(key);
+            lock.unlock();
+
+            // load outside the lock, so other jobs can continue
+            std::list<Entry> loaded;
+            loaded.emplace_back(key, file_path);
+            prepare(loaded.front().structure);
+            loaded.front().bytes = structure_bytes(loaded.front().structure);
+
+            lock.lock();
+            used_bytes += loaded.front().bytes;
+            entries.splice(entries.begin(), loaded);
+            loading.erase(std::find(loading.begin(), loading.end(), key));
+            it = entries.begin();
+            changed.notify_all();
+        } else {
+            n_hits += 1;
+            entries.splice(entries.begin(), entries, it);
+        }
+
+        Entry &entry = *it;
+        entry.n_copies += 1;
+        while (true) {
+            evict(entry.bytes);
+            if (used_bytes + entry.bytes <= max_bytes || n_copies == 0) {
+                break;
+            }
+            changed.wait(lock);
+        }
+        used_bytes += entry.bytes;
+        n_copies += 1;
+        lock.unlock();
+
+        // the entry can not be evicted and is never changed, so it is copied outside the lock
+        return entry.structure;
+    }
+
+    /**
+     * Releases the memory of a copy of the key.
+     */
+    void release(const std::string &key) {
+        std::unique_lock<std::mutex> lock(mutex);
+        Entry &entry = *find(key);
+        entry.n_copies -= 1;
+        used_bytes -= entry.bytes;
+        n_copies -= 1;
+        evict(0);
+        changed.notify_all();
+    }
+
+    size_t n_hits = 0;
+    size_t n_loads = 0;
+
+private:
+    std::list<Entry> entries; // most recently used first
+    std::vector<std::string> loading; // keys that are currently loaded
+    std::mutex mutex;
+    std::condition_variable changed;
+    size_t max_bytes;
+    size_t used_bytes = 0; // cached structures and copies in use
+    size_t n_copies = 0;
+
+    typename std::list<Entry>::iterator find(const std::string &key) {
+        return std::find_if(entries.begin(), entries.end(), [&](const Entry &entry) { return entry.key == key; });
+    }
+
+    /**
+     * Evicts cached structures without copies until the additional bytes fit.
+     */
+    void evict(const size_t additional_bytes) {
+        auto it = entries.end();
+        while (used_bytes + additional_bytes > max_bytes && it != entries.begin()) {
+            --it;
+            if (it->n_copies == 0) {
+                used_bytes -= it->bytes;
+                it = entries.erase(it);
+            }
+        }
+    }
+};
+
+#endif //SMSM_STRUCTURECACHE_H
@@ -0,0 +1,104 @@
+#ifndef SMSM_THREADPOOL_H
+#define SMSM_THREADPOOL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Fixed number of worker threads that execute submitted tasks in the order
+ * of submission.
+ */
+class ThreadPool {
+public:
+    /**
+     * Starts the workers.
+     *
+     * @param n_threads Number of worker threads, at least one is started.
+     */
+    explicit ThreadPool(size_t n_threads) {
+        n_threads = std::max((size_t) 1, n_threads);
+        for (size_t i = 0; i < n_threads; ++i) {
+            workers.emplace_back([this] { work(); });
+        }
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /**
+     * Finishes all submitted tasks and joins the workers.
+     */
+    ~ThreadPool() {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            stop = true;
+        }
+        task_available.notify_all();
+        for (std::thread &worker: workers) {
+            worker.join();
+        }
+    }
+
+    /**
+     * Adds a task to the queue.
+     */
+    void submit(std::function<void()> task) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            tasks.push_back(std::move(task));
+        }
+        task_available.notify_one();
+    }
+
+    /**
+     * Blocks until the queue is empty and no task is running.
+     */
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex);
+        all_done.wait(lock, [this] { return tasks.empty() && n_running == 0; });
+    }
+
+private:
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> tasks;
+    std::mutex mutex;
+    std::condition_variable task_available;
+    std::condition_variable all_done;
+    size_t n_running = 0;
+    bool stop = false;
+
+    void work() {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                task_available.wait(lock, [this] { return stop || !tasks.empty(); });
+                if (tasks.empty()) {
+                    return;
+                }
+                task = std::move(tasks.front());
+                tasks.pop_front();
+                n_running += 1;
+            }
+
+            task();
+
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                n_running -= 1;
+                if (tasks.empty() && n_running == 0) {
+                    all_done.notify_all();
+                }
+            }
+        }
+    }
+};
+
+#endif //SMSM_THREADPOOL_H
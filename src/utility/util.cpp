@@ -132,7 +132,7 @@ size_t n_choose_k(size_t n, size_t k) {
 }
 
 size_t pow_2(size_t n){
-    return 1 << n;
+    return size_t(1) << n;
 }
 
 size_t ceil(size_t x, size_t y){
@@ -214,12 +214,11 @@ bool next_subset(std::vector<size_t> &set, size_t set_size, size_t n) {
     return set[0] <= n - set_size;
 }
 
-size_t next_subset(size_t bits, int k) {
-    bits += 1;
-    while (k != std::__popcount(bits)) {
-        bits += 1;
-    }
-    return bits;
+size_t next_subset(size_t bits, [[maybe_unused]] int k) {
+    // Gosper's hack, the next greater number with the same number of set bits
+    size_t lowest = bits & -bits;
+    size_t ripple = bits + lowest;
+    return (((ripple ^ bits) >> 2) / lowest) | ripple;
 }
 
 void generate_clique_valid_subsets(size_t max_n){
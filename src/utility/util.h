@@ -883,6 +883,227 @@ void overwrite(T *__restrict__ v1, const T *__restrict__ v2, size_t n) {
     }
 }
 
+/**
+ * Calculate four sums of minimum values against one shared vector in a single pass.
+ *
+ * Each element of `v` is loaded once and compared with the matching element of
+ * the four rows `r0` to `r3`, so the shared vector stays in registers while
+ * four independent accumulators are updated. `res[j]` receives the sum of
+ * min(v[i], rj[i]) over all i.
+ *
+ * @tparam T The type of elements in the arrays.
+ * @param res Array with space for the four sums.
+ * @param v The shared array (e.g. the current minimum distances).
+ * @param r0 The first row.
+ * @param r1 The second row.
+ * @param r2 The third row.
+ * @param r3 The fourth row.
+ * @param n The number of elements in each array.
+ */
+template<typename T>
+void sum_of_min_4(T *__restrict__ res, const T *__restrict__ v,
+                  const T *__restrict__ r0, const T *__restrict__ r1,
+                  const T *__restrict__ r2, const T *__restrict__ r3, size_t n) {
+    T sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+    for (size_t i = 0; i < n; ++i) {
+        const T x = v[i];
+        sum0 += std::min(x, r0[i]);
+        sum1 += std::min(x, r1[i]);
+        sum2 += std::min(x, r2[i]);
+        sum3 += std::min(x, r3[i]);
+    }
+    res[0] = sum0;
+    res[1] = sum1;
+    res[2] = sum2;
+    res[3] = sum3;
+}
+
+/**
+ * Computes the sum of each block of `block_size` consecutive elements. The
+ * last block may be shorter.
+ *
+ * @tparam T The type of elements in the array.
+ * @param v The array.
+ * @param n The number of elements in the array.
+ * @param block_size The number of elements per block.
+ * @param sums Receives the sum of each block.
+ */
+template<typename T>
+void block_sums(const T *__restrict__ v, size_t n, size_t block_size, T *__restrict__ sums) {
+    for (size_t b = 0, start = 0; start < n; ++b, start += block_size) {
+        sums[b] = sum(v + start, std::min(block_size, n - start));
+    }
+}
+
+/**
+ * Calculate the sum of minimum values of `v` and `row` block by block and stop
+ * as soon as the result is proven to reach `min_sum`.
+ *
+ * The gain of a block is its sum in `v` minus its sum of minimum values. If
+ * `gain_bounds` holds upper bounds for the gains of the blocks (e.g. the gains
+ * of the same row against an element-wise larger `v`), the unprocessed blocks
+ * contribute at least `v_sums[b] - gain_bounds[b]` each. Once the exact part
+ * plus this lower bound reaches `min_sum`, the evaluation stops.
+ *
+ * @tparam T The type of elements in the arrays.
+ * @param v The first array (e.g. the current minimum distances).
+ * @param row The second array (e.g. the distances of a candidate).
+ * @param n The number of elements in each array.
+ * @param block_size The number of elements per block.
+ * @param v_sums The block sums of `v`.
+ * @param gain_bounds Upper bounds for the gain of each block, or nullptr if unknown.
+ * @param min_sum The sum at which the evaluation can stop.
+ * @param lb_buffer Buffer with space for one value per block.
+ * @param gains Receives the gain of each block, only complete if the sum is exact.
+ * @param res Receives the exact sum or, if the evaluation stopped early, a lower bound of it that is >= min_sum.
+ * @return True if the sum was computed exactly, false if it stopped early.
+ */
+template<typename T>
+bool sum_of_min_bounded(const T *__restrict__ v, const T *__restrict__ row, size_t n, size_t block_size,
+                        const T *__restrict__ v_sums, const T *__restrict__ gain_bounds, T min_sum,
+                        T *__restrict__ lb_buffer, T *__restrict__ gains, T &res) {
+    const size_t n_blocks = (n + block_size - 1) / block_size;
+
+    if (gain_bounds != nullptr) {
+        // suffix sums of the lower bounds of each block
+        T suffix = 0;
+        for (size_t b = n_blocks; b-- > 0;) {
+            suffix += v_sums[b] - gain_bounds[b];
+            lb_buffer[b] = suffix;
+        }
+    }
+
+    T partial = 0;
+    for (size_t b = 0; b < n_blocks; ++b) {
+        const size_t start = b * block_size;
+        const T block = sum_of_min(v + start, row + start, std::min(block_size, n - start));
+        gains[b] = v_sums[b] - block;
+        partial += block;
+
+        if (gain_bounds != nullptr && b + 1 < n_blocks && partial + lb_buffer[b + 1] >= min_sum) {
+            res = partial + lb_buffer[b + 1];
+            return false;
+        }
+    }
+
+    res = partial;
+    return true;
+}
+
+/**
+ * Block gains for the bounded evaluation of sum-of-min structures. The gain
+ * of each block of a candidate can only shrink when S grows, so the gains
+ * recorded for the candidate at the deepest ancestor bound the unprocessed
+ * blocks in sum_of_min_bounded. A record is valid if its stamp equals the
+ * stamp of the visit of its depth. The memory is only allocated and the block
+ * sums are only updated after enable(), so searches without the bounded
+ * evaluation do not pay for it.
+ *
+ * @tparam T The type of the scores.
+ */
+template<typename T>
+class BlockGainCache {
+public:
+    size_t block_size = 0;
+    size_t n_blocks = 0;
+    bool enabled = false;
+
+    /**
+     * Splits n columns into at most 8 blocks of a multiple of 64 columns.
+     */
+    void set_blocks(const size_t n) {
+        n_blocks = std::min((size_t) 8, ceil(n, 128));
+        block_size = round_up(ceil(n, n_blocks), (size_t) 64);
+        n_blocks = ceil(n, block_size);
+        temp_block_lb.resize(n_blocks);
+    }
+
+    /**
+     * Frees the records, called when the helping structures are initialized.
+     */
+    void reset() {
+        enabled = false;
+        depth_stamp.clear();
+        block_sum.clear();
+        block_gain.clear();
+        block_gain_stamp.clear();
+    }
+
+    /**
+     * Allocates the records, has to be called on depth 0. Does nothing if
+     * already enabled.
+     *
+     * @param n_depths Number of depths of the structure (k + 1).
+     * @param n_rows Number of candidates.
+     */
+    void enable(const size_t n_depths, const size_t n_rows) {
+        if (enabled) {
+            return;
+        }
+        enabled = true;
+        block_sum.assign(n_depths, std::vector<T>(n_blocks, 0));
+        block_gain.assign(n_depths, std::vector<T>(n_rows * n_blocks, 0));
+        block_gain_stamp.assign(n_depths, std::vector<uint64_t>(n_rows, 0));
+        depth_stamp.assign(n_depths, 0);
+        depth_stamp[0] = ++n_visited_nodes;
+    }
+
+    /**
+     * Updates the block sums of a new depth.
+     *
+     * @param depth The new depth.
+     * @param v The minimum vector of the depth.
+     * @param n Number of columns.
+     */
+    inline void visit_new_depth(const size_t depth, const T *v, const size_t n) {
+        if (!enabled) {
+            return;
+        }
+        block_sums(v, n, block_size, block_sum[depth].data());
+        depth_stamp[depth] = ++n_visited_nodes;
+    }
+
+    /**
+     * Computes the sum of minimum values of v and the row of the candidate
+     * with sum_of_min_bounded, bounded by the gains of the deepest ancestor.
+     *
+     * @param depth The current depth.
+     * @param c The candidate.
+     * @param v The minimum vector of the depth.
+     * @param row The row of the candidate.
+     * @param n Number of columns.
+     * @param min_sum The sum at which the evaluation can stop.
+     * @param res Receives the exact sum or a lower bound of it that is >= min_sum.
+     * @return True if the sum is exact.
+     */
+    inline bool evaluate(const size_t depth, const uint32_t c, const T *v, const T *row, const size_t n,
+                         const T min_sum, T &res) {
+        ASSERT(enabled);
+        const T *gain_bounds = nullptr;
+        for (size_t d = depth; d-- > 0;) {
+            if (block_gain_stamp[d][c] == depth_stamp[d]) {
+                gain_bounds = &block_gain[d][c * n_blocks];
+                break;
+            }
+        }
+
+        bool exact = sum_of_min_bounded(v, row, n, block_size, block_sum[depth].data(), gain_bounds, min_sum,
+                                        temp_block_lb.data(), &block_gain[depth][c * n_blocks], res);
+        if (exact) {
+            block_gain_stamp[depth][c] = depth_stamp[depth];
+        }
+        return exact;
+    }
+
+private:
+    uint64_t n_visited_nodes = 0;
+    std::vector<uint64_t> depth_stamp;
+    std::vector<std::vector<T>> block_sum;
+    std::vector<std::vector<T>> block_gain;
+    std::vector<std::vector<uint64_t>> block_gain_stamp;
+    std::vector<T> temp_block_lb;
+};
+
 /* Vector Functions */
 template<typename T>
 T sum(const std::vector<T> &vec) {
@@ -1009,6 +1230,46 @@ T sum_of_min_64(T *__restrict__ v1, T *__restrict__ v2, T *__restrict__ v3, size
     return sum;
 }
 
+/**
+ * Calculate four sums of minimum values against one shared aligned memory block.
+ *
+ * Aligned counterpart of `sum_of_min_4`. All blocks are assumed to be aligned to
+ * a 64-byte boundary and to contain 'n' elements, with 'n' a multiple of 64.
+ *
+ * @tparam T The type of elements in the memory blocks.
+ * @param res Array with space for the four sums.
+ * @param v The shared aligned memory block.
+ * @param r0 The first aligned row.
+ * @param r1 The second aligned row.
+ * @param r2 The third aligned row.
+ * @param r3 The fourth aligned row.
+ * @param n The number of elements to consider in each memory block.
+ */
+template<typename T>
+void sum_of_min_4_64(T *__restrict__ res, const T *__restrict__ v,
+                     const T *__restrict__ r0, const T *__restrict__ r1,
+                     const T *__restrict__ r2, const T *__restrict__ r3, size_t n) {
+    v = static_cast<const T *>(__builtin_assume_aligned(v, 64));
+    r0 = static_cast<const T *>(__builtin_assume_aligned(r0, 64));
+    r1 = static_cast<const T *>(__builtin_assume_aligned(r1, 64));
+    r2 = static_cast<const T *>(__builtin_assume_aligned(r2, 64));
+    r3 = static_cast<const T *>(__builtin_assume_aligned(r3, 64));
+    if (n & 63) __builtin_unreachable();
+
+    T sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+    for (size_t i = 0; i < n; ++i) {
+        const T x = v[i];
+        sum0 += std::min(x, r0[i]);
+        sum1 += std::min(x, r1[i]);
+        sum2 += std::min(x, r2[i]);
+        sum3 += std::min(x, r3[i]);
+    }
+    res[0] = sum0;
+    res[1] = sum1;
+    res[2] = sum2;
+    res[3] = sum3;
+}
+
 /**
  * Overwrite the contents of one aligned memory block with another.
  *